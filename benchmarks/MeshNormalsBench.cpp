@@ -0,0 +1,99 @@
+// Normal and tangent generation throughput on a large bumpy grid
+//
+//   xmake build MeshNormalsBench && xmake run MeshNormalsBench [threads] [gridSize]
+//
+// threads defaults to 1; gridSize defaults to 1582, about 5M triangles.
+
+#include "Geometry/MeshNormals.h"
+#include "Threading/JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+constexpr int REPEATS = 3;
+
+template <typename Func>
+double BestSeconds(Func&& func)
+{
+    double best = 1e30;
+    for (int i = 0; i < REPEATS; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+// A size x size grid in the XZ plane with height bumps and a 0..1 UV range
+Renderer::Mesh MakeGrid(uint32_t size)
+{
+    Renderer::Mesh mesh;
+    const uint32_t stride = size + 1;
+    mesh.vertices.resize(static_cast<size_t>(stride) * stride);
+    for (uint32_t z = 0; z <= size; ++z)
+    {
+        for (uint32_t x = 0; x <= size; ++x)
+        {
+            Renderer::Vertex& v = mesh.vertices[static_cast<size_t>(z) * stride + x];
+            const float height = std::sin(x * 0.7f) * std::cos(z * 0.5f);
+            v.position = Math::Vector3(static_cast<float>(x), height, static_cast<float>(z));
+            v.color = {1.0f, 1.0f, 1.0f, 1.0f};
+            v.texCoord = Math::Vector2(static_cast<float>(x) / size, static_cast<float>(z) / size);
+        }
+    }
+
+    mesh.indices.reserve(static_cast<size_t>(size) * size * 6);
+    for (uint32_t z = 0; z < size; ++z)
+    {
+        for (uint32_t x = 0; x < size; ++x)
+        {
+            const uint32_t i0 = z * stride + x;
+            const uint32_t i1 = i0 + 1;
+            const uint32_t i2 = i0 + stride;
+            const uint32_t i3 = i2 + 1;
+            mesh.indices.insert(mesh.indices.end(), {i0, i2, i1, i1, i2, i3});
+        }
+    }
+    return mesh;
+}
+
+void Report(const char* name, size_t triangles, double seconds)
+{
+    std::printf("%-16s %7.3f s  %6.2f M triangles/s\n", name, seconds, triangles / seconds * 1e-6);
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t threads = argc > 1 ? std::max(1, std::atoi(argv[1])) : 1;
+    const uint32_t gridSize = argc > 2 ? static_cast<uint32_t>(std::max(1, std::atoi(argv[2]))) : 1582;
+    Threading::JobSystemOptions options;
+    options.workerCount = threads - 1;
+    Threading::JobSystem::InitializeDefault(options);
+
+    Renderer::Mesh mesh = MakeGrid(gridSize);
+    const size_t triangles = mesh.indices.size() / 3;
+    std::printf("MeshNormals, %zu triangles, %zu vertices, %zu thread(s)\n", triangles, mesh.vertices.size(),
+                threads);
+
+    Report("Area normals", triangles,
+           BestSeconds([&]() { Geometry::MeshNormals::GenerateNormals(mesh, Geometry::NormalWeighting::Area); }));
+    Report("Angle normals", triangles,
+           BestSeconds([&]() { Geometry::MeshNormals::GenerateNormals(mesh, Geometry::NormalWeighting::Angle); }));
+    Report("Tangents", triangles, BestSeconds([&]() { Geometry::MeshNormals::GenerateTangents(mesh); }));
+
+    // Keeps the results observable so the passes are not optimised away
+    double sumY = 0.0;
+    for (const Renderer::Vertex& v : mesh.vertices)
+    {
+        sumY += v.normal.y + v.tangent.x;
+    }
+    std::printf("checksum %.2f\n", sumY);
+    return 0;
+}
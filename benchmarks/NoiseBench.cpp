@@ -0,0 +1,131 @@
+// Noise throughput: scalar reference against the batch and tiled paths
+//
+//   xmake build NoiseBench && xmake run NoiseBench [threads]
+//
+// threads defaults to 1, so the batch figures compare one core with one core.
+
+#include "Math/Noise.h"
+#include "Threading/JobSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace Math;
+
+namespace
+{
+constexpr size_t POINT_COUNT = 2 * 1024 * 1024;
+constexpr size_t IMAGE_SIZE = 1024;
+constexpr int REPEATS = 3;
+
+template <typename Func>
+double BestSeconds(Func&& func)
+{
+    double best = 1e30;
+    for (int i = 0; i < REPEATS; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+// Keeps the results observable so the loops are not optimised away
+double Checksum(const std::vector<float>& values)
+{
+    double sum = 0.0;
+    for (float value : values)
+    {
+        sum += value;
+    }
+    return sum;
+}
+
+// The checksums should agree to within float rounding
+void Report(const char* name, size_t samples, double scalarSeconds, double batchSeconds, const char* unit,
+            double scalarSum, double batchSum)
+{
+    std::printf("%-22s %6.1f / %6.1f M%s/s (x%.1f), checksum %.2f / %.2f\n", name, samples / scalarSeconds * 1e-6,
+                samples / batchSeconds * 1e-6, unit, scalarSeconds / batchSeconds, scalarSum, batchSum);
+}
+
+void BenchPoints2(NoiseType type, const char* name, const std::vector<Vector2>& points, std::vector<float>& out)
+{
+    const double scalar = BestSeconds([&]() {
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            out[i] = type == NoiseType::Perlin ? Noise::Perlin(points[i].x, points[i].y)
+                                               : Noise::Simplex(points[i].x, points[i].y);
+        }
+    });
+    const double scalarSum = Checksum(out);
+    const double batch = BestSeconds([&]() { Noise::Evaluate(type, points.data(), points.size(), out.data()); });
+    Report(name, points.size(), scalar, batch, "samples", scalarSum, Checksum(out));
+}
+
+void BenchPoints3(NoiseType type, const char* name, const std::vector<Vector3>& points, std::vector<float>& out)
+{
+    const double scalar = BestSeconds([&]() {
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            out[i] = type == NoiseType::Perlin ? Noise::Perlin(points[i].x, points[i].y, points[i].z)
+                                               : Noise::Simplex(points[i].x, points[i].y, points[i].z);
+        }
+    });
+    const double scalarSum = Checksum(out);
+    const double batch = BestSeconds([&]() { Noise::Evaluate(type, points.data(), points.size(), out.data()); });
+    Report(name, points.size(), scalar, batch, "samples", scalarSum, Checksum(out));
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t threads = argc > 1 ? std::max(1, std::atoi(argv[1])) : 1;
+    Threading::JobSystemOptions options;
+    options.workerCount = threads - 1;
+    Threading::JobSystem::InitializeDefault(options);
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> coordinate(-256.0f, 256.0f);
+    std::vector<Vector2> points2(POINT_COUNT);
+    std::vector<Vector3> points3(POINT_COUNT);
+    for (size_t i = 0; i < POINT_COUNT; ++i)
+    {
+        points2[i] = Vector2(coordinate(rng), coordinate(rng));
+        points3[i] = Vector3(coordinate(rng), coordinate(rng), coordinate(rng));
+    }
+    std::vector<float> out(POINT_COUNT);
+
+    std::printf("Noise, %zu random points, %zu thread(s): scalar reference / batch\n", POINT_COUNT, threads);
+    BenchPoints2(NoiseType::Perlin, "Perlin 2D", points2, out);
+    BenchPoints3(NoiseType::Perlin, "Perlin 3D", points3, out);
+    BenchPoints2(NoiseType::Simplex, "Simplex 2D", points2, out);
+    BenchPoints3(NoiseType::Simplex, "Simplex 3D", points3, out);
+
+    // fBm image: per-pixel reference against GenerateImage's tiles
+    FractalSettings settings;
+    settings.octaves = 5;
+    settings.frequency = 1.0f / 64.0f;
+    const Vector2 origin(-512.0f, -512.0f);
+    std::vector<float> image(IMAGE_SIZE * IMAGE_SIZE);
+    const double scalar = BestSeconds([&]() {
+        for (size_t y = 0; y < IMAGE_SIZE; ++y)
+        {
+            for (size_t x = 0; x < IMAGE_SIZE; ++x)
+            {
+                image[y * IMAGE_SIZE + x] =
+                    Noise::Fractal(settings, origin.x + static_cast<float>(x), origin.y + static_cast<float>(y));
+            }
+        }
+    });
+    const double scalarSum = Checksum(image);
+    const double tiled = BestSeconds(
+        [&]() { Noise::GenerateImage(settings, origin, 1.0f, IMAGE_SIZE, IMAGE_SIZE, image.data()); });
+    Report("fBm 5 octaves 1024^2", IMAGE_SIZE * IMAGE_SIZE, scalar, tiled, "px", scalarSum, Checksum(image));
+    return 0;
+}
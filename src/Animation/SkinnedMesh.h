@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Renderer/RendererResources.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Animation
+{
+// Bone influences per vertex; extra influences must be folded in by the importer
+constexpr int MAX_BONE_INFLUENCES = 4;
+
+/**
+ * @brief Bone indices and blend weights of one vertex
+ *
+ * Unused slots should have a weight of zero. Weights do not need to sum to
+ * one; Skinner::Prepare normalizes them.
+ */
+struct BoneInfluences
+{
+    uint32_t bones[MAX_BONE_INFLUENCES] = {};
+    float weights[MAX_BONE_INFLUENCES] = {};
+};
+
+/**
+ * @brief A bind-pose mesh laid out for batched skinning
+ *
+ * The skinned attributes and influences are stored as separate streams
+ * (structure of arrays) padded to a multiple of Skinner::BATCH_SIZE, so the
+ * vectorized kernel loads whole batches without tail checks. Padding entries
+ * have zero weights and bone 0.
+ */
+struct SkinnedMesh
+{
+    enum Stream
+    {
+        PositionX,
+        PositionY,
+        PositionZ,
+        NormalX,
+        NormalY,
+        NormalZ,
+        TangentX,
+        TangentY,
+        TangentZ,
+        StreamCount
+    };
+
+    // Source mesh; supplies indices and the attributes skinning leaves untouched
+    Renderer::Mesh bindPose;
+
+    std::vector<float> streams[StreamCount];
+    std::vector<uint32_t> boneIndices[MAX_BONE_INFLUENCES];
+    std::vector<float> boneWeights[MAX_BONE_INFLUENCES];
+
+    // One past the highest bone referenced with a non-zero weight
+    uint32_t boneCount = 0;
+
+    size_t GetVertexCount() const
+    {
+        return bindPose.vertices.size();
+    }
+};
+
+} // namespace Animation
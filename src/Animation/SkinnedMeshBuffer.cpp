@@ -0,0 +1,60 @@
+#include "Animation/SkinnedMeshBuffer.h"
+
+namespace Animation
+{
+
+SkinnedMeshBuffer::SkinnedMeshBuffer(Renderer::IRenderer& renderer, const SkinnedMesh& mesh)
+    : m_renderer(renderer), m_mesh(mesh), m_vertices(mesh.bindPose.vertices)
+{
+    // Attributes that skinning does not write keep their bind-pose values
+    const uint32_t vertexBytes = static_cast<uint32_t>(m_vertices.size() * sizeof(Renderer::Vertex));
+    const uint32_t indexBytes = static_cast<uint32_t>(mesh.bindPose.indices.size() * sizeof(uint32_t));
+
+    m_vertexBuffer = m_renderer.CreateBuffer(Renderer::BufferType::VertexBuffer, Renderer::BufferUsage::Dynamic,
+                                             vertexBytes, m_vertices.data());
+    m_indexBuffer = m_renderer.CreateBuffer(Renderer::BufferType::IndexBuffer, Renderer::BufferUsage::Immutable,
+                                            indexBytes, mesh.bindPose.indices.data());
+}
+
+SkinnedMeshBuffer::~SkinnedMeshBuffer()
+{
+    if (m_vertexBuffer)
+        m_renderer.DestroyBuffer(m_vertexBuffer);
+    if (m_indexBuffer)
+        m_renderer.DestroyBuffer(m_indexBuffer);
+}
+
+bool SkinnedMeshBuffer::Update(const std::vector<Math::Matrix4x4>& palette)
+{
+    if (!Skinner::Skin(m_mesh, palette, m_vertices.data()))
+        return false;
+
+    Upload();
+    return true;
+}
+
+SkinningJob SkinnedMeshBuffer::GetSkinningJob(const std::vector<Math::Matrix4x4>& palette)
+{
+    SkinningJob job;
+    job.mesh = &m_mesh;
+    job.palette = palette.data();
+    job.paletteSize = palette.size();
+    job.output = m_vertices.data();
+    return job;
+}
+
+void SkinnedMeshBuffer::Upload()
+{
+    const uint32_t vertexBytes = static_cast<uint32_t>(m_vertices.size() * sizeof(Renderer::Vertex));
+    m_renderer.UpdateBuffer(m_vertexBuffer, 0, vertexBytes, m_vertices.data());
+}
+
+void SkinnedMeshBuffer::Draw()
+{
+    m_renderer.SetVertexBuffer(m_vertexBuffer, sizeof(Renderer::Vertex));
+    m_renderer.SetIndexBuffer(m_indexBuffer);
+    m_renderer.SetPrimitiveTopology(Renderer::PrimitiveTopology::TriangleList);
+    m_renderer.DrawIndexed(static_cast<uint32_t>(m_mesh.bindPose.indices.size()));
+}
+
+} // namespace Animation
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Animation/Skinner.h"
+#include "Renderer/IRenderer.h"
+
+namespace Animation
+{
+/**
+ * @brief GPU buffers for one skinned mesh instance
+ *
+ * Owns a BufferUsage::Dynamic vertex buffer and an immutable index buffer.
+ * Skinning writes straight into the CPU vertex array that UpdateBuffer
+ * uploads, in the final interleaved layout, so each frame costs one skinning
+ * pass and one upload with no intermediate copies.
+ *
+ * For crowds, collect GetSkinningJob() from every instance, run
+ * Skinner::SkinJobs once, then call Upload() on each instance.
+ */
+class SkinnedMeshBuffer
+{
+  public:
+    /**
+     * @brief Create the GPU buffers for a prepared mesh
+     * @param renderer Renderer that owns the buffers; must outlive this object
+     * @param mesh Prepared mesh; must outlive this object
+     */
+    SkinnedMeshBuffer(Renderer::IRenderer& renderer, const SkinnedMesh& mesh);
+    ~SkinnedMeshBuffer();
+
+    SkinnedMeshBuffer(const SkinnedMeshBuffer&) = delete;
+    SkinnedMeshBuffer& operator=(const SkinnedMeshBuffer&) = delete;
+
+    /**
+     * @brief Skin with the given palette and upload the result
+     * @param palette Skinning matrices indexed by bone
+     * @return False if the palette is too small (nothing is uploaded)
+     */
+    bool Update(const std::vector<Math::Matrix4x4>& palette);
+
+    /**
+     * @brief Describe this instance as a job for Skinner::SkinJobs
+     * @param palette Skinning matrices; must stay alive until the job runs
+     */
+    SkinningJob GetSkinningJob(const std::vector<Math::Matrix4x4>& palette);
+
+    // Upload the current CPU vertices to the dynamic vertex buffer
+    void Upload();
+
+    // Bind the buffers and draw every triangle
+    void Draw();
+
+    // CPU-side vertices in upload layout
+    const std::vector<Renderer::Vertex>& GetVertices() const
+    {
+        return m_vertices;
+    }
+
+  private:
+    Renderer::IRenderer& m_renderer;
+    const SkinnedMesh& m_mesh;
+    std::vector<Renderer::Vertex> m_vertices;
+    Renderer::BufferHandle m_vertexBuffer = nullptr;
+    Renderer::BufferHandle m_indexBuffer = nullptr;
+};
+
+} // namespace Animation
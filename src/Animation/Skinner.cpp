@@ -0,0 +1,274 @@
+#include "Animation/Skinner.h"
+#include "Math/Simd.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Animation
+{
+namespace
+{
+constexpr size_t GRAIN_BATCHES = 128;
+constexpr int BLEND_TERMS = 12; // Columns 0-2 of all four matrix rows
+constexpr float MIN_LENGTH_SQUARED = 1e-30f;
+
+static_assert(sizeof(Math::Matrix4x4) == 16 * sizeof(float), "Palette gathers assume a packed 4x4 float matrix");
+
+// Offset of blend term t within a Matrix4x4, as row * 4 + column
+constexpr int TermOffset(int term)
+{
+    return (term / 3) * 4 + term % 3;
+}
+
+void WriteVertex(Renderer::Vertex& vertex, const float (&skinned)[SkinnedMesh::StreamCount])
+{
+    vertex.position = Math::Vector3(skinned[SkinnedMesh::PositionX], skinned[SkinnedMesh::PositionY],
+                                    skinned[SkinnedMesh::PositionZ]);
+    vertex.normal =
+        Math::Vector3(skinned[SkinnedMesh::NormalX], skinned[SkinnedMesh::NormalY], skinned[SkinnedMesh::NormalZ]);
+    vertex.tangent.x = skinned[SkinnedMesh::TangentX];
+    vertex.tangent.y = skinned[SkinnedMesh::TangentY];
+    vertex.tangent.z = skinned[SkinnedMesh::TangentZ];
+}
+
+#if defined(HERMIT_SIMD_AVX2)
+void SkinBatches(const SkinnedMesh& mesh, const Math::Matrix4x4* palette, Renderer::Vertex* output, size_t begin,
+                 size_t end)
+{
+    const float* paletteBase = &palette[0].m[0][0];
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 minLengthSquared = _mm256_set1_ps(MIN_LENGTH_SQUARED);
+
+    for (size_t v = begin; v < end; v += Skinner::BATCH_SIZE)
+    {
+        __m256 blend[BLEND_TERMS];
+        for (int t = 0; t < BLEND_TERMS; ++t)
+        {
+            blend[t] = zero;
+        }
+
+        for (int k = 0; k < MAX_BONE_INFLUENCES; ++k)
+        {
+            const __m256 weight = _mm256_loadu_ps(mesh.boneWeights[k].data() + v);
+            if (_mm256_movemask_ps(_mm256_cmp_ps(weight, zero, _CMP_NEQ_OQ)) == 0)
+                continue;
+
+            // Each bone's matrix is 16 floats, so the gather index is bone * 16
+            const __m256i bones = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mesh.boneIndices[k].data() + v));
+            const __m256i offsets = _mm256_slli_epi32(bones, 4);
+            for (int t = 0; t < BLEND_TERMS; ++t)
+            {
+                const __m256 term = _mm256_i32gather_ps(paletteBase + TermOffset(t), offsets, 4);
+                blend[t] = _mm256_add_ps(blend[t], _mm256_mul_ps(weight, term));
+            }
+        }
+
+        alignas(32) float skinned[SkinnedMesh::StreamCount][Skinner::BATCH_SIZE];
+        for (int first = 0; first < SkinnedMesh::StreamCount; first += 3)
+        {
+            const __m256 x = _mm256_loadu_ps(mesh.streams[first + 0].data() + v);
+            const __m256 y = _mm256_loadu_ps(mesh.streams[first + 1].data() + v);
+            const __m256 z = _mm256_loadu_ps(mesh.streams[first + 2].data() + v);
+
+            __m256 result[3];
+            for (int c = 0; c < 3; ++c)
+            {
+                result[c] = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, blend[c]), _mm256_mul_ps(y, blend[3 + c])),
+                                          _mm256_mul_ps(z, blend[6 + c]));
+            }
+
+            if (first == SkinnedMesh::PositionX)
+            {
+                for (int c = 0; c < 3; ++c)
+                {
+                    result[c] = _mm256_add_ps(result[c], blend[9 + c]);
+                }
+            }
+            else
+            {
+                const __m256 lengthSquared = _mm256_add_ps(
+                    _mm256_add_ps(_mm256_mul_ps(result[0], result[0]), _mm256_mul_ps(result[1], result[1])),
+                    _mm256_mul_ps(result[2], result[2]));
+                const __m256 inverseLength =
+                    _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_max_ps(lengthSquared, minLengthSquared)));
+                for (int c = 0; c < 3; ++c)
+                {
+                    result[c] = _mm256_mul_ps(result[c], inverseLength);
+                }
+            }
+
+            for (int c = 0; c < 3; ++c)
+            {
+                _mm256_store_ps(skinned[first + c], result[c]);
+            }
+        }
+
+        const size_t count = std::min(Skinner::BATCH_SIZE, end - v);
+        for (size_t lane = 0; lane < count; ++lane)
+        {
+            float vertex[SkinnedMesh::StreamCount];
+            for (int s = 0; s < SkinnedMesh::StreamCount; ++s)
+            {
+                vertex[s] = skinned[s][lane];
+            }
+            WriteVertex(output[v + lane], vertex);
+        }
+    }
+}
+#else
+void SkinBatches(const SkinnedMesh& mesh, const Math::Matrix4x4* palette, Renderer::Vertex* output, size_t begin,
+                 size_t end)
+{
+    for (size_t v = begin; v < end; ++v)
+    {
+        float blend[BLEND_TERMS] = {};
+        for (int k = 0; k < MAX_BONE_INFLUENCES; ++k)
+        {
+            const float weight = mesh.boneWeights[k][v];
+            if (weight == 0.0f)
+                continue;
+
+            const float* matrix = &palette[mesh.boneIndices[k][v]].m[0][0];
+            for (int t = 0; t < BLEND_TERMS; ++t)
+            {
+                blend[t] += weight * matrix[TermOffset(t)];
+            }
+        }
+
+        float skinned[SkinnedMesh::StreamCount];
+        for (int attribute = 0; attribute < 3; ++attribute)
+        {
+            const int first = attribute * 3;
+            const float x = mesh.streams[first + 0][v];
+            const float y = mesh.streams[first + 1][v];
+            const float z = mesh.streams[first + 2][v];
+            for (int c = 0; c < 3; ++c)
+            {
+                skinned[first + c] = x * blend[c] + y * blend[3 + c] + z * blend[6 + c];
+            }
+        }
+
+        // Positions take the translation row, directions are renormalized
+        for (int c = 0; c < 3; ++c)
+        {
+            skinned[SkinnedMesh::PositionX + c] += blend[9 + c];
+        }
+        for (int first = SkinnedMesh::NormalX; first < SkinnedMesh::StreamCount; first += 3)
+        {
+            const float lengthSquared =
+                skinned[first] * skinned[first] + skinned[first + 1] * skinned[first + 1] + skinned[first + 2] * skinned[first + 2];
+            const float inverseLength = 1.0f / std::sqrt(std::max(lengthSquared, MIN_LENGTH_SQUARED));
+            for (int c = 0; c < 3; ++c)
+            {
+                skinned[first + c] *= inverseLength;
+            }
+        }
+
+        WriteVertex(output[v], skinned);
+    }
+}
+#endif
+
+bool IsValidJob(const SkinningJob& job)
+{
+    return job.mesh && job.output && (job.mesh->boneCount == 0 || job.palette) &&
+           job.paletteSize >= job.mesh->boneCount;
+}
+} // namespace
+
+bool Skinner::Prepare(const Renderer::Mesh& bindPose, const std::vector<BoneInfluences>& influences,
+                      SkinnedMesh& outMesh)
+{
+    const size_t vertexCount = bindPose.vertices.size();
+    if (influences.size() != vertexCount)
+        return false;
+
+    const size_t paddedCount = (vertexCount + BATCH_SIZE - 1) / BATCH_SIZE * BATCH_SIZE;
+    outMesh.bindPose = bindPose;
+    outMesh.boneCount = 0;
+    for (std::vector<float>& stream : outMesh.streams)
+    {
+        stream.assign(paddedCount, 0.0f);
+    }
+    for (int k = 0; k < MAX_BONE_INFLUENCES; ++k)
+    {
+        outMesh.boneIndices[k].assign(paddedCount, 0);
+        outMesh.boneWeights[k].assign(paddedCount, 0.0f);
+    }
+
+    for (size_t v = 0; v < vertexCount; ++v)
+    {
+        const Renderer::Vertex& vertex = bindPose.vertices[v];
+        const float attributes[SkinnedMesh::StreamCount] = {vertex.position.x, vertex.position.y, vertex.position.z,
+                                                            vertex.normal.x,   vertex.normal.y,   vertex.normal.z,
+                                                            vertex.tangent.x,  vertex.tangent.y,  vertex.tangent.z};
+        for (int s = 0; s < SkinnedMesh::StreamCount; ++s)
+        {
+            outMesh.streams[s][v] = attributes[s];
+        }
+
+        const BoneInfluences& influence = influences[v];
+        float totalWeight = 0.0f;
+        for (int k = 0; k < MAX_BONE_INFLUENCES; ++k)
+        {
+            totalWeight += std::max(influence.weights[k], 0.0f);
+        }
+
+        for (int k = 0; k < MAX_BONE_INFLUENCES; ++k)
+        {
+            float weight = totalWeight > 0.0f ? std::max(influence.weights[k], 0.0f) / totalWeight : 0.0f;
+            if (totalWeight <= 0.0f && k == 0)
+                weight = 1.0f;
+
+            // Unused slots point at bone 0 so gathers never leave the palette
+            if (weight > 0.0f)
+            {
+                outMesh.boneIndices[k][v] = influence.bones[k];
+                outMesh.boneWeights[k][v] = weight;
+                outMesh.boneCount = std::max(outMesh.boneCount, influence.bones[k] + 1);
+            }
+        }
+    }
+
+    return true;
+}
+
+bool Skinner::Skin(const SkinnedMesh& mesh, const std::vector<Math::Matrix4x4>& palette, Renderer::Vertex* output)
+{
+    if (palette.size() < mesh.boneCount)
+        return false;
+
+    const size_t vertexCount = mesh.GetVertexCount();
+    const size_t batchCount = (vertexCount + BATCH_SIZE - 1) / BATCH_SIZE;
+    Threading::ParallelFor(batchCount, GRAIN_BATCHES, [&](size_t begin, size_t end) {
+        SkinRange(mesh, palette.data(), output, begin * BATCH_SIZE, std::min(end * BATCH_SIZE, vertexCount));
+    });
+    return true;
+}
+
+bool Skinner::SkinJobs(const std::vector<SkinningJob>& jobs)
+{
+    bool allValid = true;
+    for (const SkinningJob& job : jobs)
+    {
+        allValid = allValid && IsValidJob(job);
+    }
+
+    Threading::ParallelFor(jobs.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (IsValidJob(jobs[i]))
+                SkinRange(*jobs[i].mesh, jobs[i].palette, jobs[i].output, 0, jobs[i].mesh->GetVertexCount());
+        }
+    });
+    return allValid;
+}
+
+void Skinner::SkinRange(const SkinnedMesh& mesh, const Math::Matrix4x4* palette, Renderer::Vertex* output,
+                        size_t begin, size_t end)
+{
+    SkinBatches(mesh, palette, output, begin, end);
+}
+
+} // namespace Animation
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Animation/SkinnedMesh.h"
+#include "Math/Matrix4x4.h"
+#include <vector>
+
+namespace Animation
+{
+/**
+ * @brief One mesh instance to skin as part of a batch
+ */
+struct SkinningJob
+{
+    const SkinnedMesh* mesh = nullptr;
+    const Math::Matrix4x4* palette = nullptr; // Skinning matrices (inverse bind * bone world)
+    size_t paletteSize = 0;
+    Renderer::Vertex* output = nullptr; // GetVertexCount() vertices, prefilled with the bind pose
+};
+
+/**
+ * @brief CPU linear-blend skinning
+ *
+ * Each vertex is transformed by the weighted sum of its bones' skinning
+ * matrices. Positions, normals and tangent directions are written into an
+ * interleaved Renderer::Vertex array, which is the layout uploaded to the
+ * vertex buffer, so no repacking pass is needed. The other attributes in the
+ * output are not touched; fill them once from SkinnedMesh::bindPose.
+ *
+ * With AVX2 the kernel processes BATCH_SIZE vertices per iteration, gathering
+ * palette rows by bone index; otherwise a scalar loop runs the same math.
+ * Work is split across threads in batch-aligned vertex ranges.
+ *
+ * Normals and tangents are transformed by the blended matrix's upper 3x3 and
+ * renormalized, which is exact for rotations and uniform scale.
+ */
+class Skinner
+{
+  public:
+    static constexpr size_t BATCH_SIZE = 8;
+
+    /**
+     * @brief Build the batched layout for a bind-pose mesh
+     * @param bindPose Bind-pose vertices and indices
+     * @param influences One entry per vertex
+     * @param outMesh Receives the prepared mesh
+     * @return False if influences does not match the vertex count
+     * @note Weights are normalized to sum to one. A vertex whose weights are
+     *       all zero is bound fully to its first bone.
+     */
+    static bool Prepare(const Renderer::Mesh& bindPose, const std::vector<BoneInfluences>& influences,
+                        SkinnedMesh& outMesh);
+
+    /**
+     * @brief Skin one mesh, split across worker threads
+     * @param mesh Prepared mesh
+     * @param palette Skinning matrices indexed by bone
+     * @param output Destination with mesh.GetVertexCount() vertices
+     * @return False if the palette has fewer than mesh.boneCount matrices
+     */
+    static bool Skin(const SkinnedMesh& mesh, const std::vector<Math::Matrix4x4>& palette, Renderer::Vertex* output);
+
+    /**
+     * @brief Skin many instances, one instance per task
+     * @param jobs Instances to skin
+     * @return False if any job has a missing or too small palette; valid
+     *         jobs are still skinned
+     * @note Prefer this over calling Skin() per instance when skinning
+     *       crowds of small meshes, as it batches them into one
+     *       job-system dispatch instead of one per mesh
+     */
+    static bool SkinJobs(const std::vector<SkinningJob>& jobs);
+
+    /**
+     * @brief Skin a range of vertices on the calling thread
+     * @param mesh Prepared mesh
+     * @param palette Skinning matrices, at least mesh.boneCount of them
+     * @param output Destination for the whole mesh
+     * @param begin First vertex, a multiple of BATCH_SIZE
+     * @param end One past the last vertex
+     */
+    static void SkinRange(const SkinnedMesh& mesh, const Math::Matrix4x4* palette, Renderer::Vertex* output,
+                          size_t begin, size_t end);
+};
+
+} // namespace Animation
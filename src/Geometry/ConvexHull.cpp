@@ -0,0 +1,539 @@
+#include "Geometry/ConvexHull.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace Geometry
+{
+namespace
+{
+constexpr uint32_t NONE = UINT32_MAX;
+
+// Working face; its three edges are 3 * face + 0..2, so next and face
+// lookups need no storage
+struct Face
+{
+    double normal[3];
+    double offset; // Dot(normal, p) - offset is the signed distance
+    uint32_t firstPoint;
+    uint32_t farthestPoint;
+    double farthestDistance;
+    bool deleted;
+    bool visible;
+};
+
+uint32_t NextEdge(uint32_t edge)
+{
+    return edge % 3 == 2 ? edge - 2 : edge + 1;
+}
+
+class QuickHull
+{
+  public:
+    QuickHull(const Math::Vector3* points, size_t count, const HullOptions& options)
+        : m_points(points), m_count(count), m_maxVertices(options.maxVertices), m_epsilon(options.epsilon)
+    {
+    }
+
+    bool Run(ConvexHull& outHull);
+
+  private:
+    double Distance(const Face& face, uint32_t point) const
+    {
+        const Math::Vector3& p = m_points[point];
+        return face.normal[0] * p.x + face.normal[1] * p.y + face.normal[2] * p.z - face.offset;
+    }
+
+    uint32_t AddFace(uint32_t a, uint32_t b, uint32_t c);
+    void AddToOutside(uint32_t face, uint32_t point, double distance);
+    bool AssignPoint(uint32_t point, const uint32_t* faces, size_t faceCount);
+    bool BuildInitialTetrahedron();
+    void AddPoint(uint32_t startFace);
+    void Extract(ConvexHull& outHull) const;
+
+    const Math::Vector3* m_points;
+    size_t m_count;
+    uint32_t m_maxVertices;
+    double m_epsilon;
+
+    std::vector<Face> m_faces;
+    std::vector<uint32_t> m_edgeOrigin;
+    std::vector<uint32_t> m_edgeTwin;
+    std::vector<uint32_t> m_freeFaces;
+    std::vector<uint32_t> m_pointNext; // Outside-list links, one per point
+
+    // Scratch reused by every iteration
+    struct Frame
+    {
+        uint32_t face;
+        uint32_t edge;
+        uint32_t remaining;
+    };
+    struct HorizonEdge
+    {
+        uint32_t origin;
+        uint32_t head;
+        uint32_t twin;
+    };
+    std::vector<uint32_t> m_pending;
+    std::vector<uint32_t> m_visible;
+    std::vector<Frame> m_stack;
+    std::vector<HorizonEdge> m_horizon;
+    std::vector<uint32_t> m_newFaces;
+    std::vector<uint32_t> m_orphans;
+};
+
+uint32_t QuickHull::AddFace(uint32_t a, uint32_t b, uint32_t c)
+{
+    uint32_t face;
+    if (!m_freeFaces.empty())
+    {
+        face = m_freeFaces.back();
+        m_freeFaces.pop_back();
+    }
+    else
+    {
+        face = static_cast<uint32_t>(m_faces.size());
+        m_faces.emplace_back();
+        m_edgeOrigin.resize(m_edgeOrigin.size() + 3);
+        m_edgeTwin.resize(m_edgeTwin.size() + 3);
+    }
+
+    const Math::Vector3& pa = m_points[a];
+    const Math::Vector3& pb = m_points[b];
+    const Math::Vector3& pc = m_points[c];
+    // Planes and distances use doubles: with float rounding, visibility tests
+    // on large inputs with tiny faces disagree between neighbours and the
+    // horizon stops being a single loop
+    const double ux = double(pb.x) - pa.x, uy = double(pb.y) - pa.y, uz = double(pb.z) - pa.z;
+    const double vx = double(pc.x) - pa.x, vy = double(pc.y) - pa.y, vz = double(pc.z) - pa.z;
+    double nx = uy * vz - uz * vy, ny = uz * vx - ux * vz, nz = ux * vy - uy * vx;
+    const double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+    if (length > 0.0)
+    {
+        nx /= length;
+        ny /= length;
+        nz /= length;
+    }
+
+    Face& f = m_faces[face];
+    f.normal[0] = nx;
+    f.normal[1] = ny;
+    f.normal[2] = nz;
+    // Average the three vertices so the plane does not favour one of them
+    f.offset = (nx * (double(pa.x) + pb.x + pc.x) + ny * (double(pa.y) + pb.y + pc.y) +
+                nz * (double(pa.z) + pb.z + pc.z)) /
+               3.0;
+    f.firstPoint = NONE;
+    f.farthestPoint = NONE;
+    f.farthestDistance = 0.0;
+    f.deleted = false;
+    f.visible = false;
+
+    m_edgeOrigin[3 * face + 0] = a;
+    m_edgeOrigin[3 * face + 1] = b;
+    m_edgeOrigin[3 * face + 2] = c;
+    m_edgeTwin[3 * face + 0] = m_edgeTwin[3 * face + 1] = m_edgeTwin[3 * face + 2] = NONE;
+    return face;
+}
+
+void QuickHull::AddToOutside(uint32_t face, uint32_t point, double distance)
+{
+    Face& f = m_faces[face];
+    m_pointNext[point] = f.firstPoint;
+    f.firstPoint = point;
+    if (distance > f.farthestDistance)
+    {
+        f.farthestDistance = distance;
+        f.farthestPoint = point;
+    }
+}
+
+bool QuickHull::AssignPoint(uint32_t point, const uint32_t* faces, size_t faceCount)
+{
+    for (size_t i = 0; i < faceCount; ++i)
+    {
+        const double distance = Distance(m_faces[faces[i]], point);
+        if (distance > m_epsilon)
+        {
+            AddToOutside(faces[i], point, distance);
+            return true;
+        }
+    }
+    return false; // Inside the hull for good
+}
+
+bool QuickHull::BuildInitialTetrahedron()
+{
+    // Extreme points along each axis; the farthest-apart pair is the first edge
+    uint32_t extremes[6] = {0, 0, 0, 0, 0, 0};
+    float maxAbs[3] = {0.0f, 0.0f, 0.0f};
+    for (uint32_t i = 0; i < m_count; ++i)
+    {
+        const Math::Vector3& p = m_points[i];
+        const float c[3] = {p.x, p.y, p.z};
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const Math::Vector3& low = m_points[extremes[2 * axis]];
+            const Math::Vector3& high = m_points[extremes[2 * axis + 1]];
+            const float lowValue = axis == 0 ? low.x : (axis == 1 ? low.y : low.z);
+            const float highValue = axis == 0 ? high.x : (axis == 1 ? high.y : high.z);
+            if (c[axis] < lowValue)
+            {
+                extremes[2 * axis] = i;
+            }
+            if (c[axis] > highValue)
+            {
+                extremes[2 * axis + 1] = i;
+            }
+            maxAbs[axis] = std::max(maxAbs[axis], std::fabs(c[axis]));
+        }
+    }
+
+    if (m_epsilon <= 0.0)
+    {
+        m_epsilon = 3.0f * FLT_EPSILON * (maxAbs[0] + maxAbs[1] + maxAbs[2]);
+    }
+
+    uint32_t a = 0, b = 0;
+    float best = -1.0f;
+    for (int i = 0; i < 6; ++i)
+    {
+        for (int j = i + 1; j < 6; ++j)
+        {
+            const float d = Math::Vector3::DistanceSquared(m_points[extremes[i]], m_points[extremes[j]]);
+            if (d > best)
+            {
+                best = d;
+                a = extremes[i];
+                b = extremes[j];
+            }
+        }
+    }
+    if (std::sqrt(best) <= m_epsilon)
+    {
+        return false;
+    }
+
+    // Farthest point from the line ab
+    const Math::Vector3 origin = m_points[a];
+    const Math::Vector3 direction = (m_points[b] - origin).Normalized();
+    uint32_t c = 0;
+    best = -1.0f;
+    for (uint32_t i = 0; i < m_count; ++i)
+    {
+        const Math::Vector3& p = m_points[i];
+        const float x = p.x - origin.x, y = p.y - origin.y, z = p.z - origin.z;
+        const float along = x * direction.x + y * direction.y + z * direction.z;
+        const float d = x * x + y * y + z * z - along * along;
+        if (d > best)
+        {
+            best = d;
+            c = i;
+        }
+    }
+    if (std::sqrt(best) <= m_epsilon)
+    {
+        return false;
+    }
+
+    // Farthest point from the plane abc
+    const Math::Vector3 normal =
+        Math::Vector3::Cross(m_points[b] - m_points[a], m_points[c] - m_points[a]).Normalized();
+    const float offset = Math::Vector3::Dot(normal, origin);
+    uint32_t d = 0;
+    float signedBest = 0.0f;
+    for (uint32_t i = 0; i < m_count; ++i)
+    {
+        const Math::Vector3& p = m_points[i];
+        const float distance = normal.x * p.x + normal.y * p.y + normal.z * p.z - offset;
+        if (std::fabs(distance) > std::fabs(signedBest))
+        {
+            signedBest = distance;
+            d = i;
+        }
+    }
+    if (std::fabs(signedBest) <= m_epsilon)
+    {
+        return false;
+    }
+
+    // Wind abc away from d, then the other faces follow
+    if (signedBest > 0.0f)
+    {
+        std::swap(b, c);
+    }
+    const uint32_t faces[4] = {AddFace(a, b, c), AddFace(a, d, b), AddFace(b, d, c), AddFace(c, d, a)};
+    for (uint32_t e = 0; e < 12; ++e)
+    {
+        const uint32_t origin = m_edgeOrigin[e], head = m_edgeOrigin[NextEdge(e)];
+        for (uint32_t other = 0; other < 12; ++other)
+        {
+            if (m_edgeOrigin[other] == head && m_edgeOrigin[NextEdge(other)] == origin)
+            {
+                m_edgeTwin[e] = other;
+            }
+        }
+    }
+
+    for (uint32_t i = 0; i < m_count; ++i)
+    {
+        if (i != a && i != b && i != c && i != d)
+        {
+            AssignPoint(i, faces, 4);
+        }
+    }
+    for (uint32_t face : faces)
+    {
+        if (m_faces[face].firstPoint != NONE)
+        {
+            m_pending.push_back(face);
+        }
+    }
+    return true;
+}
+
+void QuickHull::AddPoint(uint32_t startFace)
+{
+    const uint32_t eye = m_faces[startFace].farthestPoint;
+
+    // Depth-first search for the faces the eye sees. Crossing each face's
+    // edges in order from the one it was entered by yields the horizon as a
+    // closed loop. Visibility has no tolerance: a face within epsilon of the
+    // eye but surrounded by visible faces would leave a hole and split the
+    // horizon into several loops.
+    m_visible.clear();
+    m_horizon.clear();
+    m_faces[startFace].visible = true;
+    m_visible.push_back(startFace);
+    m_stack.push_back({startFace, 3 * startFace, 3});
+    while (!m_stack.empty())
+    {
+        Frame& frame = m_stack.back();
+        if (frame.remaining == 0)
+        {
+            m_stack.pop_back();
+            continue;
+        }
+        const uint32_t edge = frame.edge;
+        frame.edge = NextEdge(edge);
+        frame.remaining--;
+
+        const uint32_t twin = m_edgeTwin[edge];
+        const uint32_t neighbour = twin / 3;
+        if (m_faces[neighbour].visible)
+        {
+            continue;
+        }
+        if (Distance(m_faces[neighbour], eye) > 0.0)
+        {
+            m_faces[neighbour].visible = true;
+            m_visible.push_back(neighbour);
+            m_stack.push_back({neighbour, NextEdge(twin), 2});
+        }
+        else
+        {
+            m_horizon.push_back({m_edgeOrigin[edge], m_edgeOrigin[NextEdge(edge)], twin});
+        }
+    }
+
+    // Release the visible faces, keeping their outside points for reassignment
+    m_orphans.clear();
+    for (uint32_t face : m_visible)
+    {
+        Face& f = m_faces[face];
+        for (uint32_t point = f.firstPoint; point != NONE; point = m_pointNext[point])
+        {
+            if (point != eye)
+            {
+                m_orphans.push_back(point);
+            }
+        }
+        f.deleted = true;
+        f.firstPoint = NONE;
+        m_freeFaces.push_back(face);
+    }
+
+    // Fan of new faces from the horizon to the eye
+    m_newFaces.clear();
+    for (const HorizonEdge& horizon : m_horizon)
+    {
+        const uint32_t face = AddFace(horizon.origin, horizon.head, eye);
+        m_edgeTwin[3 * face] = horizon.twin;
+        m_edgeTwin[horizon.twin] = 3 * face;
+        m_newFaces.push_back(face);
+    }
+    const size_t fanSize = m_newFaces.size();
+    for (size_t i = 0; i < fanSize; ++i)
+    {
+        // Edge head -> eye of one face pairs with eye -> origin of the next
+        const uint32_t face = m_newFaces[i];
+        const uint32_t following = m_newFaces[(i + 1) % fanSize];
+        m_edgeTwin[3 * face + 1] = 3 * following + 2;
+        m_edgeTwin[3 * following + 2] = 3 * face + 1;
+    }
+
+    for (uint32_t point : m_orphans)
+    {
+        AssignPoint(point, m_newFaces.data(), fanSize);
+    }
+    for (uint32_t face : m_newFaces)
+    {
+        if (m_faces[face].firstPoint != NONE)
+        {
+            m_pending.push_back(face);
+        }
+    }
+}
+
+void QuickHull::Extract(ConvexHull& outHull) const
+{
+    outHull.Clear();
+    std::vector<uint32_t> faceRemap(m_faces.size(), NONE);
+    std::vector<uint32_t> vertexRemap(m_count, NONE);
+    uint32_t faceCount = 0;
+    for (size_t face = 0; face < m_faces.size(); ++face)
+    {
+        if (!m_faces[face].deleted)
+        {
+            faceRemap[face] = faceCount++;
+        }
+    }
+
+    outHull.faces.resize(faceCount);
+    outHull.edges.resize(3 * static_cast<size_t>(faceCount));
+    for (size_t face = 0; face < m_faces.size(); ++face)
+    {
+        const uint32_t target = faceRemap[face];
+        if (target == NONE)
+        {
+            continue;
+        }
+
+        const Face& f = m_faces[face];
+        HullFace& hullFace = outHull.faces[target];
+        hullFace.edge = 3 * target;
+        hullFace.plane = Math::Plane(
+            Math::Vector3(static_cast<float>(f.normal[0]), static_cast<float>(f.normal[1]), static_cast<float>(f.normal[2])),
+            static_cast<float>(-f.offset));
+
+        for (uint32_t k = 0; k < 3; ++k)
+        {
+            const uint32_t source = 3 * static_cast<uint32_t>(face) + k;
+            uint32_t& vertex = vertexRemap[m_edgeOrigin[source]];
+            if (vertex == NONE)
+            {
+                vertex = static_cast<uint32_t>(outHull.vertices.size());
+                outHull.vertices.push_back(m_points[m_edgeOrigin[source]]);
+            }
+
+            const uint32_t twin = m_edgeTwin[source];
+            HullHalfEdge& edge = outHull.edges[3 * target + k];
+            edge.origin = vertex;
+            edge.twin = 3 * faceRemap[twin / 3] + twin % 3;
+            edge.next = 3 * target + (k + 1) % 3;
+            edge.face = target;
+        }
+    }
+}
+
+bool QuickHull::Run(ConvexHull& outHull)
+{
+    outHull.Clear();
+    if (m_count < 4 || m_count >= NONE)
+    {
+        return false;
+    }
+
+    // Sized once up front; the face count of a hull stays below 2n
+    m_pointNext.assign(m_count, NONE);
+    m_faces.reserve(std::min<size_t>(2 * m_count, 4096));
+    if (!BuildInitialTetrahedron())
+    {
+        return false;
+    }
+
+    uint32_t vertexCount = 4;
+    const uint32_t vertexLimit = m_maxVertices == 0 ? NONE : std::max(m_maxVertices, 4u);
+    while (!m_pending.empty() && vertexCount < vertexLimit)
+    {
+        // Without a limit the order does not matter and the stack is cheapest.
+        // With one, take the farthest outside point of all so the vertices
+        // kept are the ones that matter most for the shape.
+        if (vertexLimit != NONE)
+        {
+            size_t best = m_pending.size() - 1;
+            for (size_t i = 0; i < m_pending.size(); ++i)
+            {
+                const Face& candidate = m_faces[m_pending[i]];
+                if (!candidate.deleted && candidate.firstPoint != NONE &&
+                    candidate.farthestDistance > m_faces[m_pending[best]].farthestDistance)
+                {
+                    best = i;
+                }
+            }
+            std::swap(m_pending[best], m_pending.back());
+        }
+
+        const uint32_t face = m_pending.back();
+        m_pending.pop_back();
+        if (m_faces[face].deleted || m_faces[face].firstPoint == NONE)
+        {
+            continue;
+        }
+        AddPoint(face);
+        ++vertexCount;
+    }
+
+    Extract(outHull);
+    return true;
+}
+} // namespace
+
+bool ConvexHullBuilder::Build(const Math::Vector3* points, size_t count, ConvexHull& outHull,
+                              const HullOptions& options)
+{
+    QuickHull quickHull(points, count, options);
+    return quickHull.Run(outHull);
+}
+
+bool ConvexHullBuilder::Build(const std::vector<Math::Vector3>& points, ConvexHull& outHull,
+                              const HullOptions& options)
+{
+    return Build(points.data(), points.size(), outHull, options);
+}
+
+bool ConvexHullBuilder::Build(const Renderer::Mesh& mesh, ConvexHull& outHull, const HullOptions& options)
+{
+    std::vector<Math::Vector3> positions(mesh.vertices.size());
+    for (size_t i = 0; i < mesh.vertices.size(); ++i)
+    {
+        positions[i] = mesh.vertices[i].position;
+    }
+    return Build(positions, outHull, options);
+}
+
+Renderer::Mesh ConvexHullBuilder::ToMesh(const ConvexHull& hull)
+{
+    Renderer::Mesh mesh;
+    mesh.vertices.resize(hull.vertices.size());
+    for (size_t i = 0; i < hull.vertices.size(); ++i)
+    {
+        mesh.vertices[i].position = hull.vertices[i];
+        mesh.vertices[i].color = {1.0f, 1.0f, 1.0f, 1.0f};
+    }
+
+    mesh.indices.reserve(hull.faces.size() * 3);
+    for (const HullFace& face : hull.faces)
+    {
+        uint32_t edge = face.edge;
+        do
+        {
+            mesh.indices.push_back(hull.edges[edge].origin);
+            edge = hull.edges[edge].next;
+        } while (edge != face.edge);
+    }
+    return mesh;
+}
+
+} // namespace Geometry
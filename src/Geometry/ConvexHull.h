@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Math/Frustum.h"
+#include "Math/Vector3.h"
+#include "Renderer/RendererResources.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Geometry
+{
+/**
+ * @brief One directed edge of a hull face
+ *
+ * Edges of a face form a loop wound so that Cross(b - a, c - a) points out of
+ * the hull; twin is the opposite edge, which belongs to the neighbouring face.
+ */
+struct HullHalfEdge
+{
+    uint32_t origin = 0; // Index into ConvexHull::vertices
+    uint32_t twin = 0;
+    uint32_t next = 0;
+    uint32_t face = 0;
+};
+
+struct HullFace
+{
+    uint32_t edge = 0;  // Any edge of the face
+    Math::Plane plane;  // Normal points out of the hull
+};
+
+/**
+ * @brief A closed convex polyhedron in half-edge form
+ *
+ * Faces are triangles; coplanar neighbours are not merged.
+ */
+struct ConvexHull
+{
+    std::vector<Math::Vector3> vertices;
+    std::vector<HullHalfEdge> edges;
+    std::vector<HullFace> faces;
+
+    void Clear()
+    {
+        vertices.clear();
+        edges.clear();
+        faces.clear();
+    }
+};
+
+struct HullOptions
+{
+    // Stop once the hull has this many vertices (at least 4); 0 means no limit.
+    // Adding a point can bury earlier vertices, so the result may have fewer.
+    uint32_t maxVertices = 0;
+    // Points closer than this to a face count as inside; 0 derives it from
+    // the extent of the input and float precision
+    float epsilon = 0.0f;
+};
+
+/**
+ * @brief Builds 3D convex hulls with the quickhull algorithm
+ *
+ * Starts from the largest tetrahedron among the extreme points and adds the
+ * farthest outside point of one face at a time. Each point lives on at most
+ * one face's outside list (an intrusive linked list), so after the initial
+ * arrays are sized, iterations only reuse scratch storage. Deleted faces are
+ * recycled for new ones.
+ *
+ * With a vertex limit, each step instead adds the farthest outside point over
+ * all faces. Building stops at the limit, so the hull keeps the most
+ * significant vertices but may leave some input points outside.
+ */
+class ConvexHullBuilder
+{
+  public:
+    /**
+     * @brief Build the convex hull of a point set
+     * @param points Input points
+     * @param count Number of points
+     * @param outHull Receives the hull; only referenced points become vertices
+     * @param options Vertex limit and tolerance
+     * @return False (with an empty hull) if the points do not span a volume
+     */
+    static bool Build(const Math::Vector3* points, size_t count, ConvexHull& outHull, const HullOptions& options = {});
+    static bool Build(const std::vector<Math::Vector3>& points, ConvexHull& outHull, const HullOptions& options = {});
+
+    /**
+     * @brief Build the convex hull of a mesh's vertex positions
+     */
+    static bool Build(const Renderer::Mesh& mesh, ConvexHull& outHull, const HullOptions& options = {});
+
+    /**
+     * @brief Convert a hull to an indexed triangle mesh
+     * @param hull Source hull
+     * @return Mesh sharing the hull's vertices, wound like the hull's faces
+     */
+    static Renderer::Mesh ToMesh(const ConvexHull& hull);
+};
+
+} // namespace Geometry
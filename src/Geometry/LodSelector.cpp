@@ -0,0 +1,50 @@
+#include "Geometry/LodSelector.h"
+#include <cmath>
+#include <limits>
+
+namespace Geometry
+{
+
+LodSelector::LodSelector()
+    : LodSelector(1.0471976f, 1080) // 60 degrees, 1080p
+{
+}
+
+LodSelector::LodSelector(float verticalFov, uint32_t viewportHeight, float pixelThreshold)
+    : m_pixelsPerUnit(0.0f), m_pixelThreshold(pixelThreshold)
+{
+    SetProjection(verticalFov, viewportHeight);
+}
+
+void LodSelector::SetProjection(float verticalFov, uint32_t viewportHeight)
+{
+    m_pixelsPerUnit = static_cast<float>(viewportHeight) / (2.0f * std::tan(verticalFov * 0.5f));
+}
+
+void LodSelector::SetPixelThreshold(float pixelThreshold)
+{
+    m_pixelThreshold = pixelThreshold;
+}
+
+float LodSelector::GetProjectedError(float error, float distance) const
+{
+    if (distance <= 0.0f)
+        return error > 0.0f ? std::numeric_limits<float>::max() : 0.0f;
+
+    return error * m_pixelsPerUnit / distance;
+}
+
+uint32_t LodSelector::SelectLevel(const LodChain& chain, float distance, float scale) const
+{
+    // Levels are ordered fine to coarse with non-decreasing error
+    for (size_t i = chain.levels.size(); i > 1; --i)
+    {
+        const LodLevel& level = chain.levels[i - 1];
+        if (GetProjectedError(level.error * scale, distance) <= m_pixelThreshold)
+            return static_cast<uint32_t>(i - 1);
+    }
+
+    return 0;
+}
+
+} // namespace Geometry
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Geometry/MeshSimplifier.h"
+#include <cstdint>
+
+namespace Geometry
+{
+/**
+ * @brief Picks a LodChain level from its projected screen-space error
+ *
+ * A level's object-space error is projected to pixels for the current
+ * perspective projection; the coarsest level whose projected error stays
+ * under the pixel threshold is selected. Draw the result with
+ * DrawIndexed(level.indexCount, level.indexOffset) so RenderStats reflects
+ * the reduced triangle count.
+ */
+class LodSelector
+{
+  public:
+    LodSelector();
+
+    /**
+     * @brief Construct a selector for a perspective projection
+     * @param verticalFov Vertical field of view in radians
+     * @param viewportHeight Viewport height in pixels
+     * @param pixelThreshold Largest acceptable error in pixels
+     */
+    LodSelector(float verticalFov, uint32_t viewportHeight, float pixelThreshold = 1.0f);
+
+    /**
+     * @brief Update the projection used to convert errors to pixels
+     * @param verticalFov Vertical field of view in radians
+     * @param viewportHeight Viewport height in pixels
+     */
+    void SetProjection(float verticalFov, uint32_t viewportHeight);
+
+    /**
+     * @brief Set the largest acceptable error in pixels
+     * @param pixelThreshold Error threshold in pixels
+     */
+    void SetPixelThreshold(float pixelThreshold);
+
+    /**
+     * @brief Project an object-space error at a given view distance
+     * @param error Geometric error in world units
+     * @param distance Distance from the camera in world units
+     * @return Error in pixels
+     */
+    float GetProjectedError(float error, float distance) const;
+
+    /**
+     * @brief Select the coarsest acceptable level of a chain
+     * @param chain LOD chain to choose from
+     * @param distance Distance from the camera to the object
+     * @param scale Uniform object-to-world scale applied to level errors
+     * @return Index into chain.levels
+     */
+    uint32_t SelectLevel(const LodChain& chain, float distance, float scale = 1.0f) const;
+
+  private:
+    float m_pixelsPerUnit; // Pixels covered by one world unit at distance 1
+    float m_pixelThreshold;
+};
+
+} // namespace Geometry
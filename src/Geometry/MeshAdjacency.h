@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Geometry
+{
+/**
+ * @brief Vertex-to-triangle adjacency in compressed (offset + list) form
+ *
+ * The triangles touching vertex v are
+ * triangles[offsets[v]] .. triangles[offsets[v + 1] - 1].
+ */
+struct MeshAdjacency
+{
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> triangles;
+
+    /**
+     * @brief Rebuild the adjacency for a triangle list
+     * @param indices Triangle list indices
+     * @param vertexCount Number of vertices referenced by indices
+     * @note Trailing indices that do not form a full triangle are ignored
+     */
+    void Build(const std::vector<uint32_t>& indices, size_t vertexCount)
+    {
+        const size_t indexCount = (indices.size() / 3) * 3;
+
+        offsets.assign(vertexCount + 1, 0);
+        for (size_t i = 0; i < indexCount; ++i)
+        {
+            offsets[indices[i] + 1]++;
+        }
+        for (size_t i = 0; i < vertexCount; ++i)
+        {
+            offsets[i + 1] += offsets[i];
+        }
+
+        triangles.resize(indexCount);
+        std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < indexCount; ++i)
+        {
+            triangles[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+
+    // First triangle adjacent to a vertex
+    const uint32_t* Begin(uint32_t vertex) const
+    {
+        return triangles.data() + offsets[vertex];
+    }
+
+    // One past the last triangle adjacent to a vertex
+    const uint32_t* End(uint32_t vertex) const
+    {
+        return triangles.data() + offsets[vertex + 1];
+    }
+};
+
+} // namespace Geometry
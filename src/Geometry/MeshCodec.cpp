@@ -0,0 +1,372 @@
+#include "Geometry/MeshCodec.h"
+#include "Math/Simd.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Geometry
+{
+namespace
+{
+constexpr uint32_t MAGIC = 0x31434D48; // "HMC1"
+constexpr uint32_t VERSION = 2;
+constexpr int ATTRIBUTE_COUNT = 16; // Position, color, normal, tangent, texCoord
+constexpr int STREAM_COUNT = ATTRIBUTE_COUNT + 1;
+constexpr size_t HEADER_SIZE = sizeof(uint32_t) * (4 + STREAM_COUNT);
+constexpr size_t TAIL_PADDING = 16; // Lets the decoder read whole 16-byte groups
+constexpr size_t CHUNK_VERTICES = 256;
+
+const uint8_t CODE_LENGTHS[4] = {0, 1, 2, 4};
+
+static_assert(sizeof(Renderer::Vertex) == ATTRIBUTE_COUNT * sizeof(float), "Vertex layout changed; update MeshCodec");
+
+uint32_t FloatBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float BitsToFloat(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint32_t ZigZagEncode(uint32_t delta)
+{
+    return (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+}
+
+#if !defined(HERMIT_SIMD_SSSE3)
+// The SSSE3 decoder inlines this into its prefix sum
+uint32_t ZigZagDecode(uint32_t value)
+{
+    return (value >> 1) ^ (0u - (value & 1u));
+}
+#endif
+
+void WriteU32(std::vector<uint8_t>& out, size_t offset, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+    {
+        out[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+uint32_t ReadU32(const uint8_t* data)
+{
+    return uint32_t(data[0]) | (uint32_t(data[1]) << 8) | (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24);
+}
+
+void GetAttributes(const Renderer::Vertex& v, float out[ATTRIBUTE_COUNT])
+{
+    const float values[ATTRIBUTE_COUNT] = {
+        v.position.x, v.position.y, v.position.z,
+        v.color.r, v.color.g, v.color.b, v.color.a,
+        v.normal.x, v.normal.y, v.normal.z,
+        v.tangent.x, v.tangent.y, v.tangent.z, v.tangent.w,
+        v.texCoord.x, v.texCoord.y};
+    std::memcpy(out, values, sizeof(values));
+}
+
+void SetAttributes(Renderer::Vertex& v, const uint32_t (&scratch)[ATTRIBUTE_COUNT][CHUNK_VERTICES], size_t i)
+{
+    v.position.x = BitsToFloat(scratch[0][i]);
+    v.position.y = BitsToFloat(scratch[1][i]);
+    v.position.z = BitsToFloat(scratch[2][i]);
+    v.color.r = BitsToFloat(scratch[3][i]);
+    v.color.g = BitsToFloat(scratch[4][i]);
+    v.color.b = BitsToFloat(scratch[5][i]);
+    v.color.a = BitsToFloat(scratch[6][i]);
+    v.normal.x = BitsToFloat(scratch[7][i]);
+    v.normal.y = BitsToFloat(scratch[8][i]);
+    v.normal.z = BitsToFloat(scratch[9][i]);
+    v.tangent.x = BitsToFloat(scratch[10][i]);
+    v.tangent.y = BitsToFloat(scratch[11][i]);
+    v.tangent.z = BitsToFloat(scratch[12][i]);
+    v.tangent.w = BitsToFloat(scratch[13][i]);
+    v.texCoord.x = BitsToFloat(scratch[14][i]);
+    v.texCoord.y = BitsToFloat(scratch[15][i]);
+}
+
+// Appends zigzag-encoded values as [control bytes][data bytes]; the last
+// group is padded with zeros, which cost no data bytes.
+void EncodeStream(const std::vector<uint32_t>& values, std::vector<uint8_t>& out)
+{
+    const size_t groupCount = (values.size() + 3) / 4;
+    const size_t controlOffset = out.size();
+    out.resize(out.size() + groupCount, 0);
+
+    for (size_t g = 0; g < groupCount; ++g)
+    {
+        uint8_t control = 0;
+        for (size_t lane = 0; lane < 4; ++lane)
+        {
+            const size_t i = g * 4 + lane;
+            const uint32_t value = i < values.size() ? values[i] : 0;
+            const uint32_t code = value == 0 ? 0 : value < 0x100 ? 1 : value < 0x10000 ? 2 : 3;
+            control |= static_cast<uint8_t>(code << (lane * 2));
+
+            for (uint8_t b = 0; b < CODE_LENGTHS[code]; ++b)
+            {
+                out.push_back(static_cast<uint8_t>(value >> (8 * b)));
+            }
+        }
+        out[controlOffset + g] = control;
+    }
+}
+
+struct DecodeTables
+{
+    uint8_t lengths[256];
+    alignas(16) uint8_t shuffles[256][16];
+
+    DecodeTables()
+    {
+        for (int control = 0; control < 256; ++control)
+        {
+            uint8_t offset = 0;
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                const uint8_t length = CODE_LENGTHS[(control >> (lane * 2)) & 3];
+                for (int b = 0; b < 4; ++b)
+                {
+                    // 0x80 makes the shuffle write a zero byte
+                    shuffles[control][lane * 4 + b] = b < length ? static_cast<uint8_t>(offset + b) : 0x80;
+                }
+                offset += length;
+            }
+            lengths[control] = offset;
+        }
+    }
+};
+
+const DecodeTables& GetDecodeTables()
+{
+    static const DecodeTables tables;
+    return tables;
+}
+
+// Reads one stream incrementally; each call decodes whole groups of four
+struct StreamReader
+{
+    const uint8_t* control = nullptr;
+    const uint8_t* controlEnd = nullptr;
+    const uint8_t* data = nullptr;
+    const uint8_t* dataEnd = nullptr;
+    uint32_t previous = 0;
+
+    bool Open(const uint8_t* stream, size_t streamSize, size_t valueCount)
+    {
+        const size_t groupCount = (valueCount + 3) / 4;
+        if (groupCount > streamSize)
+            return false;
+
+        control = stream;
+        controlEnd = stream + groupCount;
+        data = controlEnd;
+        dataEnd = stream + streamSize;
+        previous = 0;
+        return true;
+    }
+
+    // Decodes groupCount groups into out (groupCount * 4 values)
+    bool Decode(size_t groupCount, uint32_t* out, const DecodeTables& tables)
+    {
+        if (groupCount > static_cast<size_t>(controlEnd - control))
+            return false;
+
+#if defined(HERMIT_SIMD_SSSE3)
+        const __m128i one = _mm_set1_epi32(1);
+        __m128i prev = _mm_set1_epi32(static_cast<int>(previous));
+
+        for (size_t g = 0; g < groupCount; ++g)
+        {
+            const uint8_t c = control[g];
+            const uint8_t length = tables.lengths[c];
+            if (length > dataEnd - data)
+                return false;
+
+            __m128i v = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)),
+                                         _mm_load_si128(reinterpret_cast<const __m128i*>(tables.shuffles[c])));
+            data += length;
+
+            // Zigzag decode, then an inclusive prefix sum across the four lanes
+            v = _mm_xor_si128(_mm_srli_epi32(v, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, one)));
+            v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+            v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+            v = _mm_add_epi32(v, prev);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + g * 4), v);
+            prev = _mm_shuffle_epi32(v, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+
+        previous = static_cast<uint32_t>(_mm_cvtsi128_si32(prev));
+#else
+        for (size_t g = 0; g < groupCount; ++g)
+        {
+            const uint8_t c = control[g];
+            if (tables.lengths[c] > dataEnd - data)
+                return false;
+
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                const uint8_t length = CODE_LENGTHS[(c >> (lane * 2)) & 3];
+                uint32_t value = 0;
+                for (uint8_t b = 0; b < length; ++b)
+                {
+                    value |= uint32_t(data[b]) << (8 * b);
+                }
+                data += length;
+
+                previous += ZigZagDecode(value);
+                out[g * 4 + lane] = previous;
+            }
+        }
+#endif
+
+        control += groupCount;
+        return true;
+    }
+
+    bool IsFinished() const
+    {
+        return control == controlEnd && data == dataEnd;
+    }
+};
+} // namespace
+
+std::vector<uint8_t> MeshCodec::Encode(const Renderer::Mesh& mesh)
+{
+    const uint32_t vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+    const uint32_t indexCount = static_cast<uint32_t>(mesh.indices.size());
+
+    std::vector<uint8_t> out(HEADER_SIZE, 0);
+    WriteU32(out, 0, MAGIC);
+    WriteU32(out, 4, VERSION);
+    WriteU32(out, 8, vertexCount);
+    WriteU32(out, 12, indexCount);
+
+    std::vector<uint32_t> deltas;
+    auto appendStream = [&](int stream) {
+        const size_t start = out.size();
+        EncodeStream(deltas, out);
+        WriteU32(out, 16 + stream * 4, static_cast<uint32_t>(out.size() - start));
+    };
+
+    // Transpose to SoA once so each attribute stream is a linear pass
+    std::vector<uint32_t> attributes(size_t(vertexCount) * ATTRIBUTE_COUNT);
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+        float values[ATTRIBUTE_COUNT];
+        GetAttributes(mesh.vertices[i], values);
+        for (int attribute = 0; attribute < ATTRIBUTE_COUNT; ++attribute)
+        {
+            attributes[size_t(attribute) * vertexCount + i] = FloatBits(values[attribute]);
+        }
+    }
+
+    for (int attribute = 0; attribute < ATTRIBUTE_COUNT; ++attribute)
+    {
+        const uint32_t* bits = attributes.data() + size_t(attribute) * vertexCount;
+        deltas.resize(vertexCount);
+        uint32_t previous = 0;
+        for (uint32_t i = 0; i < vertexCount; ++i)
+        {
+            deltas[i] = ZigZagEncode(bits[i] - previous);
+            previous = bits[i];
+        }
+        appendStream(attribute);
+    }
+
+    deltas.resize(indexCount);
+    uint32_t previousIndex = 0;
+    for (uint32_t i = 0; i < indexCount; ++i)
+    {
+        deltas[i] = ZigZagEncode(mesh.indices[i] - previousIndex);
+        previousIndex = mesh.indices[i];
+    }
+    appendStream(ATTRIBUTE_COUNT);
+
+    out.resize(out.size() + TAIL_PADDING, 0);
+    return out;
+}
+
+bool MeshCodec::Decode(const uint8_t* data, size_t size, Renderer::Mesh& outMesh)
+{
+    if (!data || size < HEADER_SIZE + TAIL_PADDING)
+        return false;
+
+    if (ReadU32(data) != MAGIC || ReadU32(data + 4) != VERSION)
+        return false;
+
+    const uint32_t vertexCount = ReadU32(data + 8);
+    const uint32_t indexCount = ReadU32(data + 12);
+
+    StreamReader readers[STREAM_COUNT];
+    size_t offset = HEADER_SIZE;
+    const size_t payloadEnd = size - TAIL_PADDING;
+    for (int stream = 0; stream < STREAM_COUNT; ++stream)
+    {
+        const size_t streamSize = ReadU32(data + 16 + stream * 4);
+        const size_t valueCount = stream < ATTRIBUTE_COUNT ? vertexCount : indexCount;
+        if (streamSize > payloadEnd - offset || !readers[stream].Open(data + offset, streamSize, valueCount))
+            return false;
+        offset += streamSize;
+    }
+
+    const DecodeTables& tables = GetDecodeTables();
+
+    // Vertices decode attribute-by-attribute into a small SoA chunk, then
+    // interleave into the AoS vertex buffer while the chunk is in L1.
+    outMesh.vertices.resize(vertexCount);
+    uint32_t scratch[ATTRIBUTE_COUNT][CHUNK_VERTICES];
+    for (size_t base = 0; base < vertexCount; base += CHUNK_VERTICES)
+    {
+        const size_t count = std::min<size_t>(CHUNK_VERTICES, vertexCount - base);
+        const size_t groupCount = (count + 3) / 4;
+        for (int attribute = 0; attribute < ATTRIBUTE_COUNT; ++attribute)
+        {
+            if (!readers[attribute].Decode(groupCount, scratch[attribute], tables))
+                return false;
+        }
+
+        Renderer::Vertex* vertices = outMesh.vertices.data() + base;
+        for (size_t i = 0; i < count; ++i)
+        {
+            SetAttributes(vertices[i], scratch, i);
+        }
+    }
+
+    // Indices decode in place; the buffer is rounded up to whole groups
+    const size_t indexGroups = (size_t(indexCount) + 3) / 4;
+    outMesh.indices.resize(indexGroups * 4);
+    if (!readers[ATTRIBUTE_COUNT].Decode(indexGroups, outMesh.indices.data(), tables))
+        return false;
+    outMesh.indices.resize(indexCount);
+
+    for (const StreamReader& reader : readers)
+    {
+        if (!reader.IsFinished())
+            return false;
+    }
+
+    // Well-formed streams can still name vertices that do not exist
+    uint32_t maxIndex = 0;
+    for (uint32_t index : outMesh.indices)
+    {
+        maxIndex = std::max(maxIndex, index);
+    }
+    if (indexCount > 0 && maxIndex >= vertexCount)
+        return false;
+
+    return true;
+}
+
+bool MeshCodec::Decode(const std::vector<uint8_t>& data, Renderer::Mesh& outMesh)
+{
+    return Decode(data.data(), data.size(), outMesh);
+}
+
+} // namespace Geometry
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Renderer/RendererResources.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Geometry
+{
+/**
+ * @brief Lossless compression codec for Mesh vertex and index data
+ *
+ * Every vertex attribute and the index buffer are stored as separate
+ * streams of 32-bit deltas (vertex attributes by bit pattern, relative to the
+ * previous vertex). Deltas are zigzag-encoded and packed four at a time with
+ * a one-byte control word giving each value a length of 0, 1, 2 or 4 bytes,
+ * so unchanged attributes cost two bits per vertex. The format decodes with
+ * one byte shuffle per four values on SSSE3/AVX2 builds and falls back to a
+ * scalar decoder elsewhere.
+ *
+ * Encoded data is little-endian and self-describing; Decode() validates
+ * every stream and every index against the vertex count, and fails rather
+ * than reading or handing out anything out of bounds.
+ */
+class MeshCodec
+{
+  public:
+    /**
+     * @brief Compress a mesh
+     * @param mesh Mesh to encode
+     * @return Encoded bytes
+     */
+    static std::vector<uint8_t> Encode(const Renderer::Mesh& mesh);
+
+    /**
+     * @brief Decompress a mesh produced by Encode()
+     * @param data Encoded bytes
+     * @param size Number of encoded bytes
+     * @param outMesh Receives the decoded mesh
+     * @return True on success, false if the data is malformed
+     */
+    static bool Decode(const uint8_t* data, size_t size, Renderer::Mesh& outMesh);
+
+    /**
+     * @brief Decompress a mesh produced by Encode()
+     * @param data Encoded bytes
+     * @param outMesh Receives the decoded mesh
+     * @return True on success, false if the data is malformed
+     */
+    static bool Decode(const std::vector<uint8_t>& data, Renderer::Mesh& outMesh);
+};
+
+} // namespace Geometry
@@ -0,0 +1,179 @@
+#include "Geometry/MeshNormals.h"
+#include "Geometry/MeshAdjacency.h"
+#include "Geometry/VertexWelder.h"
+#include "Threading/ParallelFor.h"
+#include <cmath>
+
+namespace Geometry
+{
+namespace
+{
+constexpr size_t GRAIN_SIZE = 4096;
+constexpr float DEGENERATE_UV_AREA = 1e-12f;
+constexpr float DEGENERATE_TANGENT_LENGTH_SQUARED = 1e-12f;
+
+// Interior angle of triangle t at the corner referencing key, where keys are
+// the (possibly remapped) index values used to build the adjacency
+float CornerAngle(const std::vector<Renderer::Vertex>& vertices, const std::vector<uint32_t>& indices,
+                  const std::vector<uint32_t>& keys, uint32_t triangle, uint32_t key)
+{
+    const size_t base = static_cast<size_t>(triangle) * 3;
+    int corner = 0;
+    while (corner < 2 && keys[base + corner] != key)
+        ++corner;
+
+    const Math::Vector3& p = vertices[indices[base + corner]].position;
+    const Math::Vector3& a = vertices[indices[base + (corner + 1) % 3]].position;
+    const Math::Vector3& b = vertices[indices[base + (corner + 2) % 3]].position;
+    return Math::Vector3::Angle(a - p, b - p);
+}
+
+// Remove the component of v along unit normal n
+Math::Vector3 ProjectOntoPlane(const Math::Vector3& v, const Math::Vector3& n)
+{
+    return v - n * Math::Vector3::Dot(n, v);
+}
+} // namespace
+
+void MeshNormals::GenerateNormals(Renderer::Mesh& mesh, NormalWeighting weighting)
+{
+    std::vector<Renderer::Vertex>& vertices = mesh.vertices;
+    const std::vector<uint32_t>& indices = mesh.indices;
+    const size_t triangleCount = indices.size() / 3;
+
+    // Smooth across attribute seams by accumulating per position group
+    WeldOptions positionOnly;
+    positionOnly.positionOnly = true;
+    std::vector<uint32_t> remap;
+    const uint32_t groupCount = VertexWelder::GenerateRemap(vertices, remap, positionOnly);
+
+    std::vector<uint32_t> groupIndices(triangleCount * 3);
+    Threading::ParallelFor(groupIndices.size(), GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            groupIndices[i] = remap[indices[i]];
+        }
+    });
+
+    // Phase 1: face normals, left unnormalized (length is twice the face area)
+    // for area weighting
+    const bool areaWeighted = weighting == NormalWeighting::Area;
+    std::vector<Math::Vector3> faceNormals(triangleCount);
+    Threading::ParallelFor(triangleCount, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; ++t)
+        {
+            const Math::Vector3& p0 = vertices[indices[t * 3 + 0]].position;
+            const Math::Vector3& p1 = vertices[indices[t * 3 + 1]].position;
+            const Math::Vector3& p2 = vertices[indices[t * 3 + 2]].position;
+            const Math::Vector3 normal = Math::Vector3::Cross(p1 - p0, p2 - p0);
+            faceNormals[t] = areaWeighted ? normal : normal.Normalized();
+        }
+    });
+
+    // Phase 2: each group gathers the faces around it
+    MeshAdjacency adjacency;
+    adjacency.Build(groupIndices, groupCount);
+
+    std::vector<Math::Vector3> groupNormals(groupCount);
+    Threading::ParallelFor(groupCount, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t g = begin; g < end; ++g)
+        {
+            const uint32_t group = static_cast<uint32_t>(g);
+            Math::Vector3 sum = Math::Vector3::Zero();
+            for (const uint32_t* t = adjacency.Begin(group); t != adjacency.End(group); ++t)
+            {
+                if (areaWeighted)
+                {
+                    sum = sum + faceNormals[*t];
+                }
+                else
+                {
+                    const float angle = CornerAngle(vertices, indices, groupIndices, *t, group);
+                    sum = sum + faceNormals[*t] * angle;
+                }
+            }
+            groupNormals[g] = sum.Normalized();
+        }
+    });
+
+    Threading::ParallelFor(vertices.size(), GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t v = begin; v < end; ++v)
+        {
+            vertices[v].normal = groupNormals[remap[v]];
+        }
+    });
+}
+
+void MeshNormals::GenerateTangents(Renderer::Mesh& mesh)
+{
+    std::vector<Renderer::Vertex>& vertices = mesh.vertices;
+    const std::vector<uint32_t>& indices = mesh.indices;
+    const size_t triangleCount = indices.size() / 3;
+
+    // Phase 1: per-face texture-space gradients of position
+    std::vector<Math::Vector3> faceTangents(triangleCount);
+    std::vector<Math::Vector3> faceBitangents(triangleCount);
+    Threading::ParallelFor(triangleCount, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t t = begin; t < end; ++t)
+        {
+            const Renderer::Vertex& v0 = vertices[indices[t * 3 + 0]];
+            const Renderer::Vertex& v1 = vertices[indices[t * 3 + 1]];
+            const Renderer::Vertex& v2 = vertices[indices[t * 3 + 2]];
+
+            const Math::Vector3 e1 = v1.position - v0.position;
+            const Math::Vector3 e2 = v2.position - v0.position;
+            const float du1 = v1.texCoord.x - v0.texCoord.x;
+            const float dv1 = v1.texCoord.y - v0.texCoord.y;
+            const float du2 = v2.texCoord.x - v0.texCoord.x;
+            const float dv2 = v2.texCoord.y - v0.texCoord.y;
+
+            // Faces with collapsed UVs carry no tangent information
+            const float uvArea = du1 * dv2 - du2 * dv1;
+            if (std::fabs(uvArea) < DEGENERATE_UV_AREA)
+            {
+                faceTangents[t] = Math::Vector3::Zero();
+                faceBitangents[t] = Math::Vector3::Zero();
+                continue;
+            }
+
+            const float inverseArea = 1.0f / uvArea;
+            faceTangents[t] = (e1 * dv2 - e2 * dv1) * inverseArea;
+            faceBitangents[t] = (e2 * du1 - e1 * du2) * inverseArea;
+        }
+    });
+
+    // Phase 2: each vertex gathers projected, angle-weighted gradients
+    MeshAdjacency adjacency;
+    adjacency.Build(indices, vertices.size());
+
+    Threading::ParallelFor(vertices.size(), GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t v = begin; v < end; ++v)
+        {
+            const uint32_t vertex = static_cast<uint32_t>(v);
+            const Math::Vector3 normal = vertices[v].normal;
+
+            Math::Vector3 sumTangent = Math::Vector3::Zero();
+            Math::Vector3 sumBitangent = Math::Vector3::Zero();
+            for (const uint32_t* t = adjacency.Begin(vertex); t != adjacency.End(vertex); ++t)
+            {
+                const float angle = CornerAngle(vertices, indices, indices, *t, vertex);
+                sumTangent = sumTangent + ProjectOntoPlane(faceTangents[*t], normal).Normalized() * angle;
+                sumBitangent = sumBitangent + ProjectOntoPlane(faceBitangents[*t], normal).Normalized() * angle;
+            }
+
+            // Gram-Schmidt against the normal; fall back to any perpendicular
+            Math::Vector3 tangent = ProjectOntoPlane(sumTangent, normal);
+            if (tangent.MagnitudeSquared() > DEGENERATE_TANGENT_LENGTH_SQUARED)
+                tangent = tangent.Normalized();
+            else
+                tangent = Math::Vector3::Orthogonal(normal).Normalized();
+
+            const float handedness =
+                Math::Vector3::Dot(Math::Vector3::Cross(normal, tangent), sumBitangent) < 0.0f ? -1.0f : 1.0f;
+
+            vertices[v].tangent = {tangent.x, tangent.y, tangent.z, handedness};
+        }
+    });
+}
+
+} // namespace Geometry
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Renderer/RendererResources.h"
+
+namespace Geometry
+{
+/**
+ * @brief How face normals are weighted when averaged into vertex normals
+ */
+enum class NormalWeighting
+{
+    Area, // Larger triangles contribute more
+    Angle // Each triangle contributes by its corner angle at the vertex
+};
+
+/**
+ * @brief Generates smooth vertex normals and tangent frames
+ *
+ * Both generators run in two parallel phases: per-face vectors are computed
+ * over triangle ranges, then each vertex gathers the faces around it through
+ * a vertex-to-triangle adjacency. Gathering instead of scattering means every
+ * output is written by exactly one thread, so no atomics or per-thread copies
+ * of the vertex arrays are needed and results are deterministic.
+ */
+class MeshNormals
+{
+  public:
+    /**
+     * @brief Compute Vertex::normal for every vertex
+     * @param mesh Mesh to update in place (triangle list)
+     * @param weighting Face weighting scheme
+     * @note Vertices that share a position (e.g. split by UV seams) receive
+     *       the same normal, so seams stay invisible in lighting
+     */
+    static void GenerateNormals(Renderer::Mesh& mesh, NormalWeighting weighting = NormalWeighting::Angle);
+
+    /**
+     * @brief Compute Vertex::tangent from positions, normals and texCoords
+     * @param mesh Mesh to update in place (triangle list)
+     * @note Follows the MikkTSpace construction: per-face UV gradients are
+     *       projected onto each vertex's tangent plane, angle-weighted,
+     *       summed, and orthogonalized against the normal. tangent.w holds the
+     *       sign such that bitangent = w * Cross(normal, tangent).
+     *       Normals must already be set.
+     */
+    static void GenerateTangents(Renderer::Mesh& mesh);
+};
+
+} // namespace Geometry
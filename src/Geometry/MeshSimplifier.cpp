@@ -0,0 +1,369 @@
+#include "Geometry/MeshSimplifier.h"
+#include "Geometry/MeshAdjacency.h"
+#include "Geometry/VertexWelder.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <unordered_map>
+
+namespace Geometry
+{
+namespace
+{
+// Symmetric 4x4 error quadric stored as its 10 unique terms plus the
+// accumulated plane weight used to normalize the error.
+struct Quadric
+{
+    double a00 = 0.0, a11 = 0.0, a22 = 0.0;
+    double a01 = 0.0, a02 = 0.0, a12 = 0.0;
+    double b0 = 0.0, b1 = 0.0, b2 = 0.0;
+    double c = 0.0;
+    double w = 0.0;
+
+    Quadric& operator+=(const Quadric& other)
+    {
+        a00 += other.a00;
+        a11 += other.a11;
+        a22 += other.a22;
+        a01 += other.a01;
+        a02 += other.a02;
+        a12 += other.a12;
+        b0 += other.b0;
+        b1 += other.b1;
+        b2 += other.b2;
+        c += other.c;
+        w += other.w;
+        return *this;
+    }
+};
+
+void AddPlane(Quadric& q, const Math::Vector3& n, float d, float weight)
+{
+    q.a00 += weight * n.x * n.x;
+    q.a11 += weight * n.y * n.y;
+    q.a22 += weight * n.z * n.z;
+    q.a01 += weight * n.x * n.y;
+    q.a02 += weight * n.x * n.z;
+    q.a12 += weight * n.y * n.z;
+    q.b0 += weight * n.x * d;
+    q.b1 += weight * n.y * d;
+    q.b2 += weight * n.z * d;
+    q.c += weight * d * d;
+    q.w += weight;
+}
+
+// Returns the weighted mean squared distance of p to the planes in q
+double Evaluate(const Quadric& q, const Math::Vector3& p)
+{
+    const double x = p.x, y = p.y, z = p.z;
+    double r = q.a00 * x * x + q.a11 * y * y + q.a22 * z * z;
+    r += 2.0 * (q.a01 * x * y + q.a02 * x * z + q.a12 * y * z);
+    r += 2.0 * (q.b0 * x + q.b1 * y + q.b2 * z);
+    r += q.c;
+
+    return q.w > 0.0 ? std::abs(r) / q.w : 0.0;
+}
+
+uint64_t MakeEdgeKey(uint32_t a, uint32_t b)
+{
+    return a < b ? (uint64_t(a) << 32) | b : (uint64_t(b) << 32) | a;
+}
+
+// Locks vertices that must not move: seam vertices (several referenced
+// vertices share the position group) and vertices on border or non-manifold edges.
+std::vector<uint8_t> ClassifyLockedVertices(const std::vector<uint32_t>& indices,
+                                            const std::vector<uint32_t>& remap)
+{
+    const size_t vertexCount = remap.size();
+    std::vector<uint8_t> referenced(vertexCount, 0);
+    std::vector<uint32_t> groupSize(vertexCount, 0);
+    for (uint32_t index : indices)
+    {
+        if (!referenced[index])
+        {
+            referenced[index] = 1;
+            groupSize[remap[index]]++;
+        }
+    }
+
+    std::vector<uint8_t> locked(vertexCount, 0);
+    for (size_t i = 0; i < vertexCount; ++i)
+    {
+        locked[i] = groupSize[remap[i]] > 1 ? 1 : 0;
+    }
+
+    std::unordered_map<uint64_t, uint32_t> edgeUseCount;
+    edgeUseCount.reserve(indices.size());
+    for (size_t i = 0; i < indices.size(); i += 3)
+    {
+        for (int e = 0; e < 3; ++e)
+        {
+            const uint32_t a = remap[indices[i + e]];
+            const uint32_t b = remap[indices[i + (e + 1) % 3]];
+            edgeUseCount[MakeEdgeKey(a, b)]++;
+        }
+    }
+
+    for (size_t i = 0; i < indices.size(); i += 3)
+    {
+        for (int e = 0; e < 3; ++e)
+        {
+            const uint32_t a = indices[i + e];
+            const uint32_t b = indices[i + (e + 1) % 3];
+            if (edgeUseCount[MakeEdgeKey(remap[a], remap[b])] != 2)
+            {
+                locked[a] = 1;
+                locked[b] = 1;
+            }
+        }
+    }
+
+    return locked;
+}
+
+struct Collapse
+{
+    uint32_t from;
+    uint32_t to;
+    double cost;
+};
+
+// Rejects collapses that would flip or degenerate a surviving triangle
+bool CollapseFlipsTriangle(const Collapse& collapse,
+                           const std::vector<Renderer::Vertex>& vertices,
+                           const std::vector<uint32_t>& indices,
+                           const MeshAdjacency& adjacency)
+{
+    const Math::Vector3& target = vertices[collapse.to].position;
+
+    for (const uint32_t* t = adjacency.Begin(collapse.from); t != adjacency.End(collapse.from); ++t)
+    {
+        const uint32_t* tri = &indices[*t * 3];
+        if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to)
+            continue; // This triangle is removed by the collapse
+
+        Math::Vector3 before[3];
+        Math::Vector3 after[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            before[i] = vertices[tri[i]].position;
+            after[i] = tri[i] == collapse.from ? target : before[i];
+        }
+
+        const Math::Vector3 n0 = Math::Vector3::Cross(before[1] - before[0], before[2] - before[0]);
+        const Math::Vector3 n1 = Math::Vector3::Cross(after[1] - after[0], after[2] - after[0]);
+        const float limit = 0.25f * std::sqrt(n0.MagnitudeSquared() * n1.MagnitudeSquared());
+        if (Math::Vector3::Dot(n0, n1) <= limit)
+            return true;
+    }
+
+    return false;
+}
+} // namespace
+
+std::vector<uint32_t> MeshSimplifier::Simplify(const Renderer::Mesh& mesh, float targetRatio,
+                                               float maxError, float* outError)
+{
+    const float ratio = std::max(0.0f, std::min(1.0f, targetRatio));
+    const size_t triangleCount = mesh.indices.size() / 3;
+    const size_t targetIndexCount = static_cast<size_t>(triangleCount * ratio) * 3;
+    return SimplifyIndices(mesh.vertices, mesh.indices, targetIndexCount, maxError, outError);
+}
+
+std::vector<uint32_t> MeshSimplifier::SimplifyIndices(const std::vector<Renderer::Vertex>& vertices,
+                                                      const std::vector<uint32_t>& indices,
+                                                      size_t targetIndexCount, float maxError,
+                                                      float* outError)
+{
+    std::vector<uint32_t> result(indices.begin(), indices.begin() + (indices.size() / 3) * 3);
+    targetIndexCount = (targetIndexCount / 3) * 3;
+
+    if (outError)
+        *outError = 0.0f;
+
+    if (result.size() <= targetIndexCount || vertices.empty())
+        return result;
+
+    const size_t vertexCount = vertices.size();
+
+    // Vertices sharing a position form one group with a single quadric
+    WeldOptions positionOnly;
+    positionOnly.positionOnly = true;
+    std::vector<uint32_t> remap;
+    VertexWelder::GenerateRemap(vertices, remap, positionOnly);
+
+    const std::vector<uint8_t> locked = ClassifyLockedVertices(result, remap);
+
+    std::vector<Quadric> quadrics(vertexCount);
+    for (size_t i = 0; i < result.size(); i += 3)
+    {
+        const Math::Vector3& p0 = vertices[result[i + 0]].position;
+        const Math::Vector3& p1 = vertices[result[i + 1]].position;
+        const Math::Vector3& p2 = vertices[result[i + 2]].position;
+
+        Math::Vector3 normal = Math::Vector3::Cross(p1 - p0, p2 - p0);
+        const float doubleArea = normal.Magnitude();
+        if (doubleArea <= std::numeric_limits<float>::epsilon())
+            continue;
+
+        normal /= doubleArea;
+        const float d = -Math::Vector3::Dot(normal, p0);
+        for (int k = 0; k < 3; ++k)
+        {
+            AddPlane(quadrics[remap[result[i + k]]], normal, d, doubleArea * 0.5f);
+        }
+    }
+
+    const double maxErrorSquared = double(maxError) * double(maxError);
+    double resultError = 0.0;
+
+    MeshAdjacency adjacency;
+    std::vector<Collapse> candidates;
+    std::vector<uint32_t> collapseRemap(vertexCount);
+    std::vector<uint8_t> touched(vertexCount);
+
+    auto collapseCost = [&](uint32_t from, uint32_t to) {
+        Quadric q = quadrics[remap[from]];
+        q += quadrics[remap[to]];
+        return Evaluate(q, vertices[to].position);
+    };
+
+    while (result.size() > targetIndexCount)
+    {
+        adjacency.Build(result, vertexCount);
+
+        candidates.clear();
+        for (size_t i = 0; i < result.size(); i += 3)
+        {
+            for (int e = 0; e < 3; ++e)
+            {
+                const uint32_t a = result[i + e];
+                const uint32_t b = result[i + (e + 1) % 3];
+                if (!locked[a])
+                    candidates.push_back({a, b, collapseCost(a, b)});
+                if (!locked[b])
+                    candidates.push_back({b, a, collapseCost(b, a)});
+            }
+        }
+
+        if (candidates.empty())
+            break;
+
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Collapse& lhs, const Collapse& rhs) { return lhs.cost < rhs.cost; });
+
+        std::iota(collapseRemap.begin(), collapseRemap.end(), 0u);
+        std::fill(touched.begin(), touched.end(), uint8_t(0));
+
+        const size_t trianglesToRemove = (result.size() - targetIndexCount) / 3;
+        size_t trianglesRemoved = 0;
+
+        for (const Collapse& collapse : candidates)
+        {
+            if (trianglesRemoved >= trianglesToRemove || collapse.cost > maxErrorSquared)
+                break;
+
+            if (touched[collapse.from] || touched[collapse.to])
+                continue;
+
+            if (CollapseFlipsTriangle(collapse, vertices, result, adjacency))
+                continue;
+
+            // Freeze the one-ring so later collapses in this pass see valid topology
+            for (const uint32_t* t = adjacency.Begin(collapse.from); t != adjacency.End(collapse.from); ++t)
+            {
+                const uint32_t* tri = &result[*t * 3];
+                touched[tri[0]] = touched[tri[1]] = touched[tri[2]] = 1;
+
+                if (tri[0] == collapse.to || tri[1] == collapse.to || tri[2] == collapse.to)
+                    trianglesRemoved++;
+            }
+
+            collapseRemap[collapse.from] = collapse.to;
+            quadrics[remap[collapse.to]] += quadrics[remap[collapse.from]];
+            resultError = std::max(resultError, collapse.cost);
+        }
+
+        if (trianglesRemoved == 0)
+            break;
+
+        size_t writeIndex = 0;
+        for (size_t i = 0; i < result.size(); i += 3)
+        {
+            const uint32_t a = collapseRemap[result[i + 0]];
+            const uint32_t b = collapseRemap[result[i + 1]];
+            const uint32_t c = collapseRemap[result[i + 2]];
+            if (a == b || b == c || a == c)
+                continue;
+
+            result[writeIndex++] = a;
+            result[writeIndex++] = b;
+            result[writeIndex++] = c;
+        }
+        result.resize(writeIndex);
+    }
+
+    if (outError)
+        *outError = static_cast<float>(std::sqrt(resultError));
+
+    return result;
+}
+
+LodChain MeshSimplifier::BuildLodChain(const Renderer::Mesh& mesh, const std::vector<float>& ratios)
+{
+    LodChain chain;
+    chain.mesh = mesh;
+    chain.mesh.indices.resize((mesh.indices.size() / 3) * 3);
+    chain.levels.push_back({0, static_cast<uint32_t>(chain.mesh.indices.size()), 0.0f});
+
+    const size_t sourceTriangleCount = chain.mesh.indices.size() / 3;
+    std::vector<uint32_t> current = chain.mesh.indices;
+    float accumulatedError = 0.0f;
+
+    for (float ratio : ratios)
+    {
+        const float clamped = std::max(0.0f, std::min(1.0f, ratio));
+        const size_t targetIndexCount = static_cast<size_t>(sourceTriangleCount * clamped) * 3;
+        if (targetIndexCount >= current.size())
+            continue;
+
+        float levelError = 0.0f;
+        std::vector<uint32_t> lod = SimplifyIndices(mesh.vertices, current, targetIndexCount,
+                                                    std::numeric_limits<float>::max(), &levelError);
+        if (lod.empty() || lod.size() >= current.size())
+            break;
+
+        // Errors of successive levels are measured against their parent, so
+        // summing them bounds the deviation from the original surface.
+        accumulatedError += levelError;
+
+        LodLevel level;
+        level.indexOffset = static_cast<uint32_t>(chain.mesh.indices.size());
+        level.indexCount = static_cast<uint32_t>(lod.size());
+        level.error = accumulatedError;
+        chain.levels.push_back(level);
+
+        chain.mesh.indices.insert(chain.mesh.indices.end(), lod.begin(), lod.end());
+        current = std::move(lod);
+    }
+
+    return chain;
+}
+
+std::vector<LodChain> MeshSimplifier::BuildLodChains(const std::vector<Renderer::Mesh>& meshes,
+                                                     const std::vector<float>& ratios)
+{
+    std::vector<LodChain> chains(meshes.size());
+
+    Threading::ParallelFor(meshes.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            chains[i] = BuildLodChain(meshes[i], ratios);
+        }
+    });
+
+    return chains;
+}
+
+} // namespace Geometry
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Renderer/RendererResources.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Geometry
+{
+/**
+ * @brief One level of detail inside a LodChain
+ *
+ * Levels share the chain's vertex buffer and index a sub-range of its
+ * index buffer, so drawing a level is a single DrawIndexed call with
+ * indexCount/indexOffset taken from here.
+ */
+struct LodLevel
+{
+    uint32_t indexOffset = 0;
+    uint32_t indexCount = 0;
+    float error = 0.0f; // Object-space geometric deviation from LOD 0
+};
+
+/**
+ * @brief A mesh together with progressively simplified index ranges
+ *
+ * mesh.indices holds every level back to back, starting with the original
+ * triangles at level 0.
+ */
+struct LodChain
+{
+    Renderer::Mesh mesh;
+    std::vector<LodLevel> levels;
+};
+
+/**
+ * @brief Quadric-error-metric (QEM) mesh simplifier
+ *
+ * Simplifies indexed triangle meshes through half-edge collapses ranked by
+ * the Garland-Heckbert quadric error. Vertices are never moved or created,
+ * so every simplified index buffer remains valid against the original vertex
+ * buffer. Vertices on attribute seams (several vertices sharing one position)
+ * and on open borders are locked, which keeps UV/color seams and silhouettes
+ * intact.
+ */
+class MeshSimplifier
+{
+  public:
+    /**
+     * @brief Simplify a mesh towards a target triangle ratio
+     * @param mesh Source mesh (triangle list)
+     * @param targetRatio Fraction of triangles to keep, in [0,1]
+     * @param maxError Largest object-space deviation a collapse may introduce
+     * @param outError Optional output for the deviation of the result
+     * @return Simplified index buffer referencing mesh.vertices
+     * @note Stops early if no further collapse stays under maxError
+     */
+    static std::vector<uint32_t> Simplify(const Renderer::Mesh& mesh, float targetRatio,
+                                          float maxError = std::numeric_limits<float>::max(),
+                                          float* outError = nullptr);
+
+    /**
+     * @brief Simplify an index buffer towards a target index count
+     * @param vertices Vertex buffer referenced by indices
+     * @param indices Source index buffer (triangle list)
+     * @param targetIndexCount Desired number of indices in the result
+     * @param maxError Largest object-space deviation a collapse may introduce
+     * @param outError Optional output for the deviation of the result
+     * @return Simplified index buffer
+     */
+    static std::vector<uint32_t> SimplifyIndices(const std::vector<Renderer::Vertex>& vertices,
+                                                 const std::vector<uint32_t>& indices,
+                                                 size_t targetIndexCount,
+                                                 float maxError = std::numeric_limits<float>::max(),
+                                                 float* outError = nullptr);
+
+    /**
+     * @brief Build a LOD chain with one level per target ratio
+     * @param mesh Source mesh, stored as level 0
+     * @param ratios Triangle ratios relative to the source, in decreasing order
+     * @return Chain containing the source level followed by one level per ratio
+     * @note Each level is simplified from the previous one, and levels that
+     *       fail to reduce the triangle count further are dropped
+     */
+    static LodChain BuildLodChain(const Renderer::Mesh& mesh, const std::vector<float>& ratios);
+
+    /**
+     * @brief Build LOD chains for many meshes in parallel
+     * @param meshes Source meshes
+     * @param ratios Triangle ratios applied to every mesh
+     * @return One chain per input mesh, in the same order
+     */
+    static std::vector<LodChain> BuildLodChains(const std::vector<Renderer::Mesh>& meshes,
+                                                const std::vector<float>& ratios);
+};
+
+} // namespace Geometry
@@ -0,0 +1,200 @@
+#include "Geometry/MeshletBuilder.h"
+#include "Geometry/MeshAdjacency.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Geometry
+{
+namespace
+{
+constexpr uint8_t NOT_IN_MESHLET = 0xFF;
+
+// Tracks the meshlet currently being grown
+struct MeshletState
+{
+    std::vector<uint32_t> vertices;
+    std::vector<uint32_t> triangles;
+    Math::Vector3 centroidSum;
+};
+
+uint32_t CountNewVertices(const uint32_t* tri, const std::vector<uint8_t>& slot)
+{
+    return (slot[tri[0]] == NOT_IN_MESHLET) + (slot[tri[1]] == NOT_IN_MESHLET) + (slot[tri[2]] == NOT_IN_MESHLET);
+}
+
+Math::Vector3 TriangleCentroid(const uint32_t* tri, const std::vector<Renderer::Vertex>& vertices)
+{
+    return (vertices[tri[0]].position + vertices[tri[1]].position + vertices[tri[2]].position) * (1.0f / 3.0f);
+}
+} // namespace
+
+MeshletMesh MeshletBuilder::Build(const Renderer::Mesh& mesh, uint32_t maxVertices, uint32_t maxTriangles)
+{
+    maxVertices = std::max(3u, std::min(maxVertices, MAX_VERTICES));
+    maxTriangles = std::max(1u, std::min(maxTriangles, MAX_TRIANGLES));
+
+    const std::vector<uint32_t>& indices = mesh.indices;
+    const size_t triangleCount = indices.size() / 3;
+    const size_t vertexCount = mesh.vertices.size();
+
+    MeshletMesh result;
+    result.indices.reserve(triangleCount * 3);
+
+    MeshAdjacency adjacency;
+    adjacency.Build(indices, vertexCount);
+
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    std::vector<uint8_t> slot(vertexCount, NOT_IN_MESHLET);
+    MeshletState state;
+    size_t seedCursor = 0;
+
+    auto flush = [&]() {
+        if (state.triangles.empty())
+            return;
+
+        Meshlet meshlet;
+        meshlet.vertexOffset = static_cast<uint32_t>(result.vertexIndices.size());
+        meshlet.vertexCount = static_cast<uint32_t>(state.vertices.size());
+        meshlet.indexOffset = static_cast<uint32_t>(result.indices.size());
+        meshlet.triangleCount = static_cast<uint32_t>(state.triangles.size());
+
+        result.vertexIndices.insert(result.vertexIndices.end(), state.vertices.begin(), state.vertices.end());
+        for (uint32_t t : state.triangles)
+        {
+            result.indices.insert(result.indices.end(), &indices[t * 3], &indices[t * 3] + 3);
+        }
+
+        ComputeBounds(meshlet, mesh.vertices, result);
+        result.meshlets.push_back(meshlet);
+
+        for (uint32_t v : state.vertices)
+        {
+            slot[v] = NOT_IN_MESHLET;
+        }
+        state.vertices.clear();
+        state.triangles.clear();
+        state.centroidSum = Math::Vector3::Zero();
+    };
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+    {
+        // Prefer an unemitted neighbour that adds the fewest vertices, then
+        // the one closest to the current centroid.
+        uint32_t best = UINT32_MAX;
+        uint32_t bestNewVertices = 4;
+        float bestDistance = std::numeric_limits<float>::max();
+
+        if (!state.triangles.empty())
+        {
+            const Math::Vector3 centroid = state.centroidSum * (1.0f / static_cast<float>(state.triangles.size()));
+            for (uint32_t v : state.vertices)
+            {
+                for (const uint32_t* t = adjacency.Begin(v); t != adjacency.End(v); ++t)
+                {
+                    if (emitted[*t])
+                        continue;
+
+                    const uint32_t* tri = &indices[*t * 3];
+                    const uint32_t newVertices = CountNewVertices(tri, slot);
+                    if (newVertices > bestNewVertices)
+                        continue;
+
+                    const float distance = Math::Vector3::DistanceSquared(TriangleCentroid(tri, mesh.vertices), centroid);
+                    if (newVertices < bestNewVertices || distance < bestDistance)
+                    {
+                        best = *t;
+                        bestNewVertices = newVertices;
+                        bestDistance = distance;
+                    }
+                }
+            }
+        }
+
+        if (best == UINT32_MAX)
+        {
+            while (emitted[seedCursor])
+                ++seedCursor;
+            best = static_cast<uint32_t>(seedCursor);
+        }
+
+        const uint32_t* tri = &indices[best * 3];
+        if (state.vertices.size() + CountNewVertices(tri, slot) > maxVertices || state.triangles.size() >= maxTriangles)
+        {
+            flush();
+        }
+
+        for (int k = 0; k < 3; ++k)
+        {
+            if (slot[tri[k]] == NOT_IN_MESHLET)
+            {
+                slot[tri[k]] = static_cast<uint8_t>(state.vertices.size());
+                state.vertices.push_back(tri[k]);
+            }
+        }
+
+        state.triangles.push_back(best);
+        state.centroidSum += TriangleCentroid(tri, mesh.vertices);
+        emitted[best] = 1;
+    }
+
+    flush();
+    return result;
+}
+
+void MeshletBuilder::ComputeBounds(Meshlet& meshlet, const std::vector<Renderer::Vertex>& vertices,
+                                   const MeshletMesh& meshletMesh)
+{
+    // Sphere around the AABB center of the meshlet's vertices
+    Math::Vector3 minimum(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Math::Vector3 maximum = -minimum;
+    for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+    {
+        const Math::Vector3& p = vertices[meshletMesh.vertexIndices[meshlet.vertexOffset + i]].position;
+        minimum = Math::Vector3(std::min(minimum.x, p.x), std::min(minimum.y, p.y), std::min(minimum.z, p.z));
+        maximum = Math::Vector3(std::max(maximum.x, p.x), std::max(maximum.y, p.y), std::max(maximum.z, p.z));
+    }
+
+    meshlet.center = (minimum + maximum) * 0.5f;
+    float radiusSquared = 0.0f;
+    for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+    {
+        const Math::Vector3& p = vertices[meshletMesh.vertexIndices[meshlet.vertexOffset + i]].position;
+        radiusSquared = std::max(radiusSquared, Math::Vector3::DistanceSquared(p, meshlet.center));
+    }
+    meshlet.radius = std::sqrt(radiusSquared);
+
+    // Normal cone from the average of the unit face normals
+    auto faceNormal = [&](uint32_t t) {
+        const uint32_t* tri = &meshletMesh.indices[meshlet.indexOffset + t * 3];
+        const Math::Vector3& p0 = vertices[tri[0]].position;
+        return Math::Vector3::Cross(vertices[tri[1]].position - p0, vertices[tri[2]].position - p0).Normalized();
+    };
+
+    Math::Vector3 axis = Math::Vector3::Zero();
+    for (uint32_t t = 0; t < meshlet.triangleCount; ++t)
+    {
+        axis += faceNormal(t);
+    }
+
+    meshlet.coneAxis = axis.Normalized();
+    meshlet.coneCutoff = 1.0f;
+
+    if (axis.Magnitude() <= std::numeric_limits<float>::epsilon())
+        return;
+
+    // Degenerate triangles normalize to zero and are skipped
+    float minDot = 1.0f;
+    for (uint32_t t = 0; t < meshlet.triangleCount; ++t)
+    {
+        const Math::Vector3 normal = faceNormal(t);
+        if (normal.MagnitudeSquared() > 0.0f)
+            minDot = std::min(minDot, Math::Vector3::Dot(normal, meshlet.coneAxis));
+    }
+
+    // Cones wider than ~84 degrees are too loose to ever reject anything
+    if (minDot > 0.1f)
+        meshlet.coneCutoff = std::sqrt(1.0f - minDot * minDot);
+}
+
+} // namespace Geometry
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Math/Vector3.h"
+#include "Renderer/RendererResources.h"
+#include <cstdint>
+#include <vector>
+
+namespace Geometry
+{
+/**
+ * @brief A small cluster of triangles with culling bounds
+ *
+ * The cluster's triangles are a contiguous range of MeshletMesh::indices,
+ * so a visible meshlet is drawn with DrawIndexed(triangleCount * 3, indexOffset).
+ */
+struct Meshlet
+{
+    uint32_t vertexOffset = 0; // First entry in MeshletMesh::vertexIndices
+    uint32_t vertexCount = 0;
+    uint32_t indexOffset = 0; // First entry in MeshletMesh::indices
+    uint32_t triangleCount = 0;
+
+    // Bounding sphere of the cluster's vertices
+    Math::Vector3 center;
+    float radius = 0.0f;
+
+    // Normal cone: the cluster is back-facing when
+    // Dot(center - eye, coneAxis) >= coneCutoff * |center - eye| + radius.
+    // A cutoff of 1 disables back-face rejection for the cluster.
+    Math::Vector3 coneAxis;
+    float coneCutoff = 1.0f;
+};
+
+/**
+ * @brief A mesh split into meshlets
+ *
+ * indices is a reordered copy of the source index buffer that still
+ * references the source vertex buffer, so only the index buffer needs to be
+ * re-uploaded.
+ */
+struct MeshletMesh
+{
+    std::vector<Meshlet> meshlets;
+    std::vector<uint32_t> vertexIndices; // Unique source vertices per meshlet
+    std::vector<uint32_t> indices;       // Triangle list grouped by meshlet
+};
+
+/**
+ * @brief Splits triangle meshes into vertex- and triangle-bounded clusters
+ *
+ * Clusters grow greedily from a seed triangle, preferring neighbours that add
+ * the fewest new vertices and lie closest to the cluster centroid, which keeps
+ * clusters compact and their normal cones narrow.
+ */
+class MeshletBuilder
+{
+  public:
+    static constexpr uint32_t MAX_VERTICES = 64;
+    static constexpr uint32_t MAX_TRIANGLES = 124;
+
+    /**
+     * @brief Build meshlets for a triangle-list mesh
+     * @param mesh Source mesh
+     * @param maxVertices Vertex limit per meshlet (at most MAX_VERTICES)
+     * @param maxTriangles Triangle limit per meshlet (at most MAX_TRIANGLES)
+     * @return Meshlets with bounding spheres and normal cones
+     */
+    static MeshletMesh Build(const Renderer::Mesh& mesh, uint32_t maxVertices = MAX_VERTICES,
+                             uint32_t maxTriangles = MAX_TRIANGLES);
+
+    /**
+     * @brief Recompute the bounding sphere and normal cone of a meshlet
+     * @param meshlet Meshlet whose ranges are already set
+     * @param vertices Source vertex buffer
+     * @param meshletMesh Container holding the meshlet's index ranges
+     */
+    static void ComputeBounds(Meshlet& meshlet, const std::vector<Renderer::Vertex>& vertices,
+                              const MeshletMesh& meshletMesh);
+};
+
+} // namespace Geometry
@@ -0,0 +1,68 @@
+#include "Geometry/MeshletCuller.h"
+
+namespace Geometry
+{
+
+float MeshletCullStats::GetCulledRatio() const
+{
+    if (totalMeshlets == 0)
+        return 0.0f;
+
+    return static_cast<float>(frustumCulled + backfaceCulled) / static_cast<float>(totalMeshlets);
+}
+
+void MeshletCuller::Cull(const MeshletMesh& mesh, const Math::Frustum& frustum, const Math::Vector3& cameraPosition,
+                         std::vector<MeshletDrawRange>& outRanges, MeshletCullStats* stats)
+{
+    outRanges.clear();
+
+    MeshletCullStats localStats;
+    localStats.totalMeshlets = static_cast<uint32_t>(mesh.meshlets.size());
+
+    for (const Meshlet& meshlet : mesh.meshlets)
+    {
+        if (!frustum.IntersectsSphere(meshlet.center, meshlet.radius))
+        {
+            localStats.frustumCulled++;
+            continue;
+        }
+
+        if (IsBackfacing(meshlet, cameraPosition))
+        {
+            localStats.backfaceCulled++;
+            continue;
+        }
+
+        const uint32_t indexCount = meshlet.triangleCount * 3;
+        if (!outRanges.empty() && outRanges.back().indexOffset + outRanges.back().indexCount == meshlet.indexOffset)
+        {
+            outRanges.back().indexCount += indexCount;
+        }
+        else
+        {
+            outRanges.push_back({meshlet.indexOffset, indexCount});
+        }
+    }
+
+    if (stats)
+        *stats = localStats;
+}
+
+bool MeshletCuller::IsBackfacing(const Meshlet& meshlet, const Math::Vector3& cameraPosition)
+{
+    if (meshlet.coneCutoff >= 1.0f)
+        return false;
+
+    const Math::Vector3 toCenter = meshlet.center - cameraPosition;
+    return Math::Vector3::Dot(toCenter, meshlet.coneAxis) >= meshlet.coneCutoff * toCenter.Magnitude() + meshlet.radius;
+}
+
+void MeshletCuller::Draw(Renderer::IRenderer& renderer, const std::vector<MeshletDrawRange>& ranges)
+{
+    for (const MeshletDrawRange& range : ranges)
+    {
+        renderer.DrawIndexed(range.indexCount, range.indexOffset);
+    }
+}
+
+} // namespace Geometry
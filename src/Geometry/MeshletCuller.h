@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Geometry/MeshletBuilder.h"
+#include "Math/Frustum.h"
+#include "Renderer/IRenderer.h"
+#include <cstdint>
+#include <vector>
+
+namespace Geometry
+{
+/**
+ * @brief A contiguous range of MeshletMesh::indices to draw
+ */
+struct MeshletDrawRange
+{
+    uint32_t indexOffset = 0;
+    uint32_t indexCount = 0;
+};
+
+/**
+ * @brief Per-pass culling statistics
+ */
+struct MeshletCullStats
+{
+    uint32_t totalMeshlets = 0;
+    uint32_t frustumCulled = 0;
+    uint32_t backfaceCulled = 0;
+
+    /**
+     * @brief Fraction of meshlets rejected by either test
+     * @return Value in [0,1], or 0 when nothing was tested
+     */
+    float GetCulledRatio() const;
+};
+
+/**
+ * @brief CPU cluster culling for meshlet meshes
+ *
+ * Rejects meshlets whose bounding sphere is outside the frustum or whose
+ * normal cone faces away from the camera. Surviving meshlets are merged into
+ * as few contiguous index ranges as possible so each range costs one
+ * DrawIndexed call. Inputs are expected in the mesh's object space.
+ */
+class MeshletCuller
+{
+  public:
+    /**
+     * @brief Cull meshlets and collect the visible index ranges
+     * @param mesh Meshlet mesh to cull
+     * @param frustum View frustum in object space
+     * @param cameraPosition Camera position in object space
+     * @param outRanges Receives the visible ranges (cleared first)
+     * @param stats Optional statistics output
+     */
+    static void Cull(const MeshletMesh& mesh, const Math::Frustum& frustum, const Math::Vector3& cameraPosition,
+                     std::vector<MeshletDrawRange>& outRanges, MeshletCullStats* stats = nullptr);
+
+    /**
+     * @brief Test whether a meshlet faces entirely away from the camera
+     * @param meshlet Meshlet with computed bounds
+     * @param cameraPosition Camera position in object space
+     * @return True if every triangle in the meshlet is back-facing
+     */
+    static bool IsBackfacing(const Meshlet& meshlet, const Math::Vector3& cameraPosition);
+
+    /**
+     * @brief Issue one DrawIndexed call per visible range
+     * @param renderer Renderer with the meshlet index buffer already bound
+     * @param ranges Ranges produced by Cull()
+     */
+    static void Draw(Renderer::IRenderer& renderer, const std::vector<MeshletDrawRange>& ranges);
+};
+
+} // namespace Geometry
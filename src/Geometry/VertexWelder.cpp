@@ -0,0 +1,187 @@
+#include "Geometry/VertexWelder.h"
+#include <cmath>
+#include <cstring>
+
+namespace Geometry
+{
+namespace
+{
+constexpr uint32_t EMPTY_SLOT = UINT32_MAX;
+constexpr int POSITION_WORDS = 3;
+constexpr int KEY_WORDS = 16; // Position, color, normal, tangent, texCoord
+
+// Quantized values are clamped to this range before the integer cast
+constexpr float MIN_QUANTUM = -2147483648.0f;
+constexpr float MAX_QUANTUM = 2147483520.0f; // Largest float below 2^31
+
+struct VertexKey
+{
+    uint32_t words[KEY_WORDS];
+};
+
+struct KeyBuilder
+{
+    float inversePositionEpsilon;
+    float inverseColorEpsilon;
+    float inverseNormalEpsilon;
+    float inverseTexCoordEpsilon;
+    int wordCount;
+
+    static uint32_t Encode(float value, float inverseEpsilon)
+    {
+        if (inverseEpsilon > 0.0f)
+        {
+            // fmax() drops NaN, so NaN lands on the low end with -inf
+            const float quantum = std::floor(value * inverseEpsilon + 0.5f);
+            return static_cast<uint32_t>(static_cast<int32_t>(std::fmin(std::fmax(quantum, MIN_QUANTUM), MAX_QUANTUM)));
+        }
+
+        // Adding +0.0f folds -0.0f into +0.0f so both compare equal
+        const float folded = value + 0.0f;
+        uint32_t bits;
+        std::memcpy(&bits, &folded, sizeof(bits));
+        return bits;
+    }
+
+    VertexKey Build(const Renderer::Vertex& v) const
+    {
+        VertexKey key;
+        key.words[0] = Encode(v.position.x, inversePositionEpsilon);
+        key.words[1] = Encode(v.position.y, inversePositionEpsilon);
+        key.words[2] = Encode(v.position.z, inversePositionEpsilon);
+        key.words[3] = Encode(v.color.r, inverseColorEpsilon);
+        key.words[4] = Encode(v.color.g, inverseColorEpsilon);
+        key.words[5] = Encode(v.color.b, inverseColorEpsilon);
+        key.words[6] = Encode(v.color.a, inverseColorEpsilon);
+        key.words[7] = Encode(v.normal.x, inverseNormalEpsilon);
+        key.words[8] = Encode(v.normal.y, inverseNormalEpsilon);
+        key.words[9] = Encode(v.normal.z, inverseNormalEpsilon);
+        key.words[10] = Encode(v.tangent.x, inverseNormalEpsilon);
+        key.words[11] = Encode(v.tangent.y, inverseNormalEpsilon);
+        key.words[12] = Encode(v.tangent.z, inverseNormalEpsilon);
+        key.words[13] = Encode(v.tangent.w, 0.0f);
+        key.words[14] = Encode(v.texCoord.x, inverseTexCoordEpsilon);
+        key.words[15] = Encode(v.texCoord.y, inverseTexCoordEpsilon);
+        return key;
+    }
+
+    bool Equal(const VertexKey& a, const VertexKey& b) const
+    {
+        for (int i = 0; i < wordCount; ++i)
+        {
+            if (a.words[i] != b.words[i])
+                return false;
+        }
+        return true;
+    }
+
+    uint32_t Hash(const VertexKey& key) const
+    {
+        // MurmurHash2-style mixing over the active words
+        const uint32_t m = 0x5bd1e995u;
+        uint32_t h = 0x9747b28cu;
+        for (int i = 0; i < wordCount; ++i)
+        {
+            uint32_t k = key.words[i] * m;
+            k ^= k >> 24;
+            h = (h * m) ^ (k * m);
+        }
+        h ^= h >> 13;
+        h *= m;
+        h ^= h >> 15;
+        return h;
+    }
+};
+
+// One table slot: the full hash filters most mismatches before a key compare
+struct Slot
+{
+    uint32_t hash;
+    uint32_t vertex;
+};
+
+size_t TableSizeFor(size_t count)
+{
+    size_t size = 16;
+    while (size < count * 2)
+        size <<= 1;
+    return size;
+}
+} // namespace
+
+uint32_t VertexWelder::GenerateRemap(const std::vector<Renderer::Vertex>& vertices, std::vector<uint32_t>& remap,
+                                     const WeldOptions& options)
+{
+    const size_t count = vertices.size();
+    remap.resize(count);
+
+    KeyBuilder builder;
+    builder.inversePositionEpsilon = options.positionEpsilon > 0.0f ? 1.0f / options.positionEpsilon : 0.0f;
+    builder.inverseColorEpsilon = options.colorEpsilon > 0.0f ? 1.0f / options.colorEpsilon : 0.0f;
+    builder.inverseNormalEpsilon = options.normalEpsilon > 0.0f ? 1.0f / options.normalEpsilon : 0.0f;
+    builder.inverseTexCoordEpsilon = options.texCoordEpsilon > 0.0f ? 1.0f / options.texCoordEpsilon : 0.0f;
+    builder.wordCount = options.positionOnly ? POSITION_WORDS : KEY_WORDS;
+
+    const size_t tableSize = TableSizeFor(count);
+    const size_t mask = tableSize - 1;
+    std::vector<Slot> table(tableSize, Slot{0, EMPTY_SLOT});
+
+    uint32_t uniqueCount = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const VertexKey key = builder.Build(vertices[i]);
+        const uint32_t hash = builder.Hash(key);
+
+        for (size_t probe = hash & mask;; probe = (probe + 1) & mask)
+        {
+            Slot& slot = table[probe];
+            if (slot.vertex == EMPTY_SLOT)
+            {
+                slot.hash = hash;
+                slot.vertex = static_cast<uint32_t>(i);
+                remap[i] = uniqueCount++;
+                break;
+            }
+
+            if (slot.hash == hash && builder.Equal(builder.Build(vertices[slot.vertex]), key))
+            {
+                remap[i] = remap[slot.vertex];
+                break;
+            }
+        }
+    }
+
+    return uniqueCount;
+}
+
+Renderer::Mesh VertexWelder::Weld(const std::vector<Renderer::Vertex>& vertices, const WeldOptions& options)
+{
+    Renderer::Mesh mesh;
+    const uint32_t uniqueCount = GenerateRemap(vertices, mesh.indices, options);
+
+    // Unique ids are assigned in first-occurrence order
+    mesh.vertices.reserve(uniqueCount);
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        if (mesh.indices[i] == mesh.vertices.size())
+            mesh.vertices.push_back(vertices[i]);
+    }
+
+    return mesh;
+}
+
+Renderer::Mesh VertexWelder::Weld(const Renderer::Mesh& mesh, const WeldOptions& options)
+{
+    Renderer::Mesh result = Weld(mesh.vertices, options);
+    const std::vector<uint32_t> remap = std::move(result.indices);
+
+    result.indices.resize(mesh.indices.size());
+    for (size_t i = 0; i < mesh.indices.size(); ++i)
+    {
+        result.indices[i] = remap[mesh.indices[i]];
+    }
+
+    return result;
+}
+
+} // namespace Geometry
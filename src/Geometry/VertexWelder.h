@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Renderer/RendererResources.h"
+#include <cstdint>
+#include <vector>
+
+namespace Geometry
+{
+/**
+ * @brief Controls which vertices VertexWelder treats as identical
+ *
+ * An epsilon of zero compares the attribute bit-exactly (with -0 and +0
+ * considered equal). A positive epsilon quantizes the attribute to a grid of
+ * that spacing first; vertices that straddle a grid cell boundary may still
+ * stay separate. Values more than 2^31 cells from zero share the outermost
+ * cell, and NaN shares the lowest one.
+ */
+struct WeldOptions
+{
+    float positionEpsilon = 0.0f;
+    float colorEpsilon = 0.0f;
+    float normalEpsilon = 0.0f; // Applies to normals and tangents
+    float texCoordEpsilon = 0.0f;
+    bool positionOnly = false; // Ignore every attribute except position
+};
+
+/**
+ * @brief Deduplicates vertices and builds index buffers
+ *
+ * Uses a single open-addressing hash table (linear probing, load factor
+ * <= 0.5) keyed on the vertex attributes, so welding is one linear pass with
+ * no per-vertex allocation. Unique vertices keep the order of their first
+ * occurrence.
+ */
+class VertexWelder
+{
+  public:
+    /**
+     * @brief Map every vertex to the index of its unique representative
+     * @param vertices Vertex stream to deduplicate
+     * @param remap Receives one entry per vertex, in [0, unique count)
+     * @param options Comparison options
+     * @return Number of unique vertices
+     */
+    static uint32_t GenerateRemap(const std::vector<Renderer::Vertex>& vertices, std::vector<uint32_t>& remap,
+                                  const WeldOptions& options = {});
+
+    /**
+     * @brief Build an indexed mesh from an unindexed triangle list
+     * @param vertices Triangle soup, three vertices per triangle
+     * @param options Comparison options
+     * @return Mesh with unique vertices and a matching index buffer
+     */
+    static Renderer::Mesh Weld(const std::vector<Renderer::Vertex>& vertices, const WeldOptions& options = {});
+
+    /**
+     * @brief Remove duplicate vertices from an indexed mesh
+     * @param mesh Source mesh
+     * @param options Comparison options
+     * @return Mesh with unique vertices and remapped indices
+     */
+    static Renderer::Mesh Weld(const Renderer::Mesh& mesh, const WeldOptions& options = {});
+};
+
+} // namespace Geometry
@@ -0,0 +1,122 @@
+#include "Math/BoundingBox.h"
+#include <algorithm>
+#include <limits>
+
+namespace Math
+{
+
+BoundingBox::BoundingBox()
+    : min(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()),
+      max(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max())
+{
+}
+
+BoundingBox::BoundingBox(const Vector3& min, const Vector3& max)
+    : min(min), max(max)
+{
+}
+
+BoundingBox BoundingBox::FromCenterExtents(const Vector3& center, const Vector3& extents)
+{
+    return BoundingBox(center - extents, center + extents);
+}
+
+BoundingBox BoundingBox::Union(const BoundingBox& a, const BoundingBox& b)
+{
+    return BoundingBox(Vector3(std::min(a.min.x, b.min.x), std::min(a.min.y, b.min.y), std::min(a.min.z, b.min.z)),
+                       Vector3(std::max(a.max.x, b.max.x), std::max(a.max.y, b.max.y), std::max(a.max.z, b.max.z)));
+}
+
+bool BoundingBox::IsEmpty() const
+{
+    return min.x > max.x || min.y > max.y || min.z > max.z;
+}
+
+Vector3 BoundingBox::GetCenter() const
+{
+    return (min + max) * 0.5f;
+}
+
+Vector3 BoundingBox::GetExtents() const
+{
+    return (max - min) * 0.5f;
+}
+
+Vector3 BoundingBox::GetSize() const
+{
+    return max - min;
+}
+
+float BoundingBox::GetSurfaceArea() const
+{
+    if (IsEmpty())
+        return 0.0f;
+
+    const Vector3 size = GetSize();
+    return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+void BoundingBox::Expand(const Vector3& point)
+{
+    min = Vector3(std::min(min.x, point.x), std::min(min.y, point.y), std::min(min.z, point.z));
+    max = Vector3(std::max(max.x, point.x), std::max(max.y, point.y), std::max(max.z, point.z));
+}
+
+void BoundingBox::Expand(const BoundingBox& box)
+{
+    *this = Union(*this, box);
+}
+
+bool BoundingBox::Contains(const Vector3& point) const
+{
+    return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y && point.z >= min.z &&
+           point.z <= max.z;
+}
+
+bool BoundingBox::Contains(const BoundingBox& box) const
+{
+    return box.min.x >= min.x && box.max.x <= max.x && box.min.y >= min.y && box.max.y <= max.y &&
+           box.min.z >= min.z && box.max.z <= max.z;
+}
+
+bool BoundingBox::Intersects(const BoundingBox& box) const
+{
+    return box.min.x <= max.x && box.max.x >= min.x && box.min.y <= max.y && box.max.y >= min.y &&
+           box.min.z <= max.z && box.max.z >= min.z;
+}
+
+bool BoundingBox::IntersectsSphere(const Vector3& center, float radius) const
+{
+    return DistanceSquared(center) <= radius * radius;
+}
+
+bool BoundingBox::IntersectsRay(const Vector3& origin, const Vector3& inverseDirection, float maxDistance,
+                                float& outDistance) const
+{
+    // Slab test; min/max keep NaNs from 0 * inf out of the running interval
+    float tx0 = (min.x - origin.x) * inverseDirection.x;
+    float tx1 = (max.x - origin.x) * inverseDirection.x;
+    float ty0 = (min.y - origin.y) * inverseDirection.y;
+    float ty1 = (max.y - origin.y) * inverseDirection.y;
+    float tz0 = (min.z - origin.z) * inverseDirection.z;
+    float tz1 = (max.z - origin.z) * inverseDirection.z;
+
+    const float tNear = std::max(std::max(std::min(tx0, tx1), std::min(ty0, ty1)), std::max(std::min(tz0, tz1), 0.0f));
+    const float tFar = std::min(std::min(std::max(tx0, tx1), std::max(ty0, ty1)), std::min(std::max(tz0, tz1), maxDistance));
+
+    if (tNear > tFar)
+        return false;
+
+    outDistance = tNear;
+    return true;
+}
+
+float BoundingBox::DistanceSquared(const Vector3& point) const
+{
+    const float dx = std::max(std::max(min.x - point.x, 0.0f), point.x - max.x);
+    const float dy = std::max(std::max(min.y - point.y, 0.0f), point.y - max.y);
+    const float dz = std::max(std::max(min.z - point.z, 0.0f), point.z - max.z);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+} // namespace Math
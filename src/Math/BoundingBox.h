@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Math/Vector3.h"
+
+namespace Math
+{
+/**
+ * @brief An axis-aligned bounding box
+ *
+ * A default-constructed box is empty (min > max) so it can be grown with
+ * Expand() without a special first case.
+ */
+struct BoundingBox
+{
+    Vector3 min;
+    Vector3 max;
+
+    BoundingBox();
+    BoundingBox(const Vector3& min, const Vector3& max);
+
+    /**
+     * @brief Create a box from its center and half-size
+     * @param center Box center
+     * @param extents Half the size along each axis
+     * @return The box
+     */
+    static BoundingBox FromCenterExtents(const Vector3& center, const Vector3& extents);
+
+    /**
+     * @brief Smallest box containing two boxes
+     * @param a First box
+     * @param b Second box
+     * @return The union, or an empty box if both are empty
+     */
+    static BoundingBox Union(const BoundingBox& a, const BoundingBox& b);
+
+    /**
+     * @brief Test whether the box contains no points
+     * @return True if min exceeds max on any axis
+     */
+    bool IsEmpty() const;
+
+    Vector3 GetCenter() const;
+    Vector3 GetExtents() const;
+    Vector3 GetSize() const;
+
+    /**
+     * @brief Surface area, the cost metric used by BVH builders
+     * @return Area of the six faces, or 0 for an empty box
+     */
+    float GetSurfaceArea() const;
+
+    /**
+     * @brief Grow the box to include a point
+     * @param point Point to include
+     */
+    void Expand(const Vector3& point);
+
+    /**
+     * @brief Grow the box to include another box
+     * @param box Box to include
+     */
+    void Expand(const BoundingBox& box);
+
+    bool Contains(const Vector3& point) const;
+    bool Contains(const BoundingBox& box) const;
+    bool Intersects(const BoundingBox& box) const;
+
+    /**
+     * @brief Test whether a sphere overlaps the box
+     * @param center Sphere center
+     * @param radius Sphere radius
+     * @return True if the sphere touches or overlaps the box
+     */
+    bool IntersectsSphere(const Vector3& center, float radius) const;
+
+    /**
+     * @brief Slab test against a ray
+     * @param origin Ray origin
+     * @param inverseDirection Component-wise reciprocal of the ray direction
+     * @param maxDistance Ignore hits further than this
+     * @param outDistance Receives the entry distance (0 if the origin is inside)
+     * @return True if the ray enters the box within [0, maxDistance]
+     * @note Taking the reciprocal lets callers amortize the divisions over
+     *       every box a ray is tested against
+     */
+    bool IntersectsRay(const Vector3& origin, const Vector3& inverseDirection, float maxDistance,
+                       float& outDistance) const;
+
+    /**
+     * @brief Squared distance from a point to the box
+     * @param point Point to measure from
+     * @return 0 if the point is inside
+     */
+    float DistanceSquared(const Vector3& point) const;
+};
+
+} // namespace Math
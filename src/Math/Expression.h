@@ -0,0 +1,597 @@
+#pragma once
+
+#include "Math/Simd.h"
+#include "Math/Vector3.h"
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+// Opt-in expression templates over the Math types.
+//
+// Chained arithmetic on Vector3 (a + b * s - c) normally materializes a
+// temporary per operator and calls out-of-line code for each. The types
+// here record the expression instead and evaluate it in one pass:
+//
+//   Vector3 r = Math::Evaluate(Math::Lazy(a) + b * s - c);
+//
+// The same operators work on structure-of-arrays float streams, where
+// Assign() runs a single loop over SIMD packets with no intermediate arrays:
+//
+//   Math::Assign(outX, outY, outZ, count,
+//                Math::Streams(px, py, pz) + Math::Streams(vx, vy, vz) * dt);
+//
+// Expression nodes hold their operands by value. Leaves are a Vector3 copy
+// or a pointer, so an expression may outlive the temporaries it was built
+// from, but not the arrays its streams point into.
+
+namespace Math
+{
+// ---------------------------------------------------------------------------
+// SIMD packets used by stream evaluation
+// ---------------------------------------------------------------------------
+
+namespace Packet
+{
+#if defined(HERMIT_SIMD_AVX2)
+using Type = __m256;
+constexpr size_t WIDTH = 8;
+inline Type Load(const float* p) { return _mm256_loadu_ps(p); }
+inline void Store(float* p, Type v) { _mm256_storeu_ps(p, v); }
+inline Type Broadcast(float v) { return _mm256_set1_ps(v); }
+inline Type Add(Type a, Type b) { return _mm256_add_ps(a, b); }
+inline Type Subtract(Type a, Type b) { return _mm256_sub_ps(a, b); }
+inline Type Multiply(Type a, Type b) { return _mm256_mul_ps(a, b); }
+inline Type Divide(Type a, Type b) { return _mm256_div_ps(a, b); }
+inline Type Min(Type a, Type b) { return _mm256_min_ps(a, b); }
+inline Type Max(Type a, Type b) { return _mm256_max_ps(a, b); }
+inline Type Sqrt(Type a) { return _mm256_sqrt_ps(a); }
+#elif defined(HERMIT_SIMD_SSE2)
+using Type = __m128;
+constexpr size_t WIDTH = 4;
+inline Type Load(const float* p) { return _mm_loadu_ps(p); }
+inline void Store(float* p, Type v) { _mm_storeu_ps(p, v); }
+inline Type Broadcast(float v) { return _mm_set1_ps(v); }
+inline Type Add(Type a, Type b) { return _mm_add_ps(a, b); }
+inline Type Subtract(Type a, Type b) { return _mm_sub_ps(a, b); }
+inline Type Multiply(Type a, Type b) { return _mm_mul_ps(a, b); }
+inline Type Divide(Type a, Type b) { return _mm_div_ps(a, b); }
+inline Type Min(Type a, Type b) { return _mm_min_ps(a, b); }
+inline Type Max(Type a, Type b) { return _mm_max_ps(a, b); }
+inline Type Sqrt(Type a) { return _mm_sqrt_ps(a); }
+#else
+using Type = float;
+constexpr size_t WIDTH = 1;
+inline Type Load(const float* p) { return *p; }
+inline void Store(float* p, Type v) { *p = v; }
+inline Type Broadcast(float v) { return v; }
+inline Type Add(Type a, Type b) { return a + b; }
+inline Type Subtract(Type a, Type b) { return a - b; }
+inline Type Multiply(Type a, Type b) { return a * b; }
+inline Type Divide(Type a, Type b) { return a / b; }
+inline Type Min(Type a, Type b) { return b < a ? b : a; }
+inline Type Max(Type a, Type b) { return a < b ? b : a; }
+inline Type Sqrt(Type a) { return std::sqrt(a); }
+#endif
+} // namespace Packet
+
+// Element-wise operations, applicable to both floats and packets
+namespace ExpressionOps
+{
+struct Add
+{
+    static float Apply(float a, float b) { return a + b; }
+    template <typename P> static P Apply(P a, P b) { return Packet::Add(a, b); }
+};
+
+struct Subtract
+{
+    static float Apply(float a, float b) { return a - b; }
+    template <typename P> static P Apply(P a, P b) { return Packet::Subtract(a, b); }
+};
+
+struct Multiply
+{
+    static float Apply(float a, float b) { return a * b; }
+    template <typename P> static P Apply(P a, P b) { return Packet::Multiply(a, b); }
+};
+
+struct Divide
+{
+    static float Apply(float a, float b) { return a / b; }
+    template <typename P> static P Apply(P a, P b) { return Packet::Divide(a, b); }
+};
+
+struct Min
+{
+    static float Apply(float a, float b) { return b < a ? b : a; }
+    template <typename P> static P Apply(P a, P b) { return Packet::Min(a, b); }
+};
+
+struct Max
+{
+    static float Apply(float a, float b) { return a < b ? b : a; }
+    template <typename P> static P Apply(P a, P b) { return Packet::Max(a, b); }
+};
+
+struct Negate
+{
+    static float Apply(float a) { return -a; }
+    template <typename P> static P Apply(P a) { return Packet::Subtract(Packet::Broadcast(0.0f), a); }
+};
+
+struct Sqrt
+{
+    static float Apply(float a) { return std::sqrt(a); }
+    template <typename P> static P Apply(P a) { return Packet::Sqrt(a); }
+};
+} // namespace ExpressionOps
+
+// ---------------------------------------------------------------------------
+// Single Vector3 expressions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Base of every lazily evaluated Vector3 expression
+ *
+ * Derived types provide float Get(int axis) const for axis 0, 1, 2.
+ */
+template <typename E>
+struct VectorExpression
+{
+    const E& Self() const { return static_cast<const E&>(*this); }
+};
+
+// A Vector3 operand, copied into the expression
+class VectorLeaf : public VectorExpression<VectorLeaf>
+{
+  public:
+    explicit VectorLeaf(const Vector3& v) : m_x(v.x), m_y(v.y), m_z(v.z) {}
+    float Get(int axis) const { return axis == 0 ? m_x : (axis == 1 ? m_y : m_z); }
+
+  private:
+    float m_x, m_y, m_z;
+};
+
+// The same scalar on every axis; used for vector-scalar products
+class VectorBroadcast : public VectorExpression<VectorBroadcast>
+{
+  public:
+    explicit VectorBroadcast(float value) : m_value(value) {}
+    float Get(int) const { return m_value; }
+
+  private:
+    float m_value;
+};
+
+template <typename L, typename R, typename Op>
+class VectorBinary : public VectorExpression<VectorBinary<L, R, Op>>
+{
+  public:
+    VectorBinary(const L& left, const R& right) : m_left(left), m_right(right) {}
+    float Get(int axis) const { return Op::Apply(m_left.Get(axis), m_right.Get(axis)); }
+
+  private:
+    L m_left;
+    R m_right;
+};
+
+template <typename E, typename Op>
+class VectorUnary : public VectorExpression<VectorUnary<E, Op>>
+{
+  public:
+    explicit VectorUnary(const E& operand) : m_operand(operand) {}
+    float Get(int axis) const { return Op::Apply(m_operand.Get(axis)); }
+
+  private:
+    E m_operand;
+};
+
+template <typename L, typename R>
+class VectorCross : public VectorExpression<VectorCross<L, R>>
+{
+  public:
+    VectorCross(const L& left, const R& right) : m_left(left), m_right(right) {}
+    float Get(int axis) const
+    {
+        const int a = (axis + 1) % 3;
+        const int b = (axis + 2) % 3;
+        return m_left.Get(a) * m_right.Get(b) - m_left.Get(b) * m_right.Get(a);
+    }
+
+  private:
+    L m_left;
+    R m_right;
+};
+
+// Maps operator arguments (expressions or plain Vector3) to expression nodes
+template <typename T>
+struct VectorOperand
+{
+    using Type = T;
+    static const T& Wrap(const T& value) { return value; }
+};
+
+template <>
+struct VectorOperand<Vector3>
+{
+    using Type = VectorLeaf;
+    static VectorLeaf Wrap(const Vector3& value) { return VectorLeaf(value); }
+};
+
+template <typename T>
+constexpr bool IsVectorExpression = std::is_base_of<VectorExpression<T>, T>::value;
+
+template <typename T>
+constexpr bool IsVectorOperand = IsVectorExpression<T> || std::is_same<T, Vector3>::value;
+
+// Enabled when both are operands and at least one is already an expression,
+// so plain Vector3 arithmetic keeps using the Vector3 operators
+template <typename L, typename R>
+using EnableVectorBinary =
+    std::enable_if_t<IsVectorOperand<L> && IsVectorOperand<R> && (IsVectorExpression<L> || IsVectorExpression<R>)>;
+
+/**
+ * @brief Start an expression from a Vector3
+ * @param v Vector to wrap
+ * @return A leaf that combines with Vector3 and other expressions lazily
+ */
+inline VectorLeaf Lazy(const Vector3& v)
+{
+    return VectorLeaf(v);
+}
+
+template <typename L, typename R, typename = EnableVectorBinary<L, R>>
+VectorBinary<typename VectorOperand<L>::Type, typename VectorOperand<R>::Type, ExpressionOps::Add>
+operator+(const L& left, const R& right)
+{
+    return {VectorOperand<L>::Wrap(left), VectorOperand<R>::Wrap(right)};
+}
+
+template <typename L, typename R, typename = EnableVectorBinary<L, R>>
+VectorBinary<typename VectorOperand<L>::Type, typename VectorOperand<R>::Type, ExpressionOps::Subtract>
+operator-(const L& left, const R& right)
+{
+    return {VectorOperand<L>::Wrap(left), VectorOperand<R>::Wrap(right)};
+}
+
+template <typename E>
+VectorBinary<E, VectorBroadcast, ExpressionOps::Multiply> operator*(const VectorExpression<E>& v, float s)
+{
+    return {v.Self(), VectorBroadcast(s)};
+}
+
+template <typename E>
+VectorBinary<VectorBroadcast, E, ExpressionOps::Multiply> operator*(float s, const VectorExpression<E>& v)
+{
+    return {VectorBroadcast(s), v.Self()};
+}
+
+template <typename E>
+VectorBinary<E, VectorBroadcast, ExpressionOps::Divide> operator/(const VectorExpression<E>& v, float s)
+{
+    return {v.Self(), VectorBroadcast(s)};
+}
+
+template <typename E>
+VectorUnary<E, ExpressionOps::Negate> operator-(const VectorExpression<E>& v)
+{
+    return VectorUnary<E, ExpressionOps::Negate>(v.Self());
+}
+
+template <typename L, typename R, typename = EnableVectorBinary<L, R>>
+VectorCross<typename VectorOperand<L>::Type, typename VectorOperand<R>::Type> Cross(const L& left, const R& right)
+{
+    return {VectorOperand<L>::Wrap(left), VectorOperand<R>::Wrap(right)};
+}
+
+template <typename L, typename R, typename = EnableVectorBinary<L, R>>
+float Dot(const L& left, const R& right)
+{
+    const auto a = VectorOperand<L>::Wrap(left);
+    const auto b = VectorOperand<R>::Wrap(right);
+    return a.Get(0) * b.Get(0) + a.Get(1) * b.Get(1) + a.Get(2) * b.Get(2);
+}
+
+/**
+ * @brief Evaluate an expression into a Vector3
+ * @param expression Expression to evaluate
+ * @return The result, computed in a single pass
+ */
+template <typename E>
+Vector3 Evaluate(const VectorExpression<E>& expression)
+{
+    const E& e = expression.Self();
+    return Vector3(e.Get(0), e.Get(1), e.Get(2));
+}
+
+// ---------------------------------------------------------------------------
+// Structure-of-arrays stream expressions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Base of every lazily evaluated float stream expression
+ *
+ * Derived types provide float Element(size_t i) const and
+ * Packet::Type LoadPacket(size_t i) const, the latter returning elements
+ * i .. i + Packet::WIDTH - 1.
+ */
+template <typename E>
+struct StreamExpression
+{
+    const E& Self() const { return static_cast<const E&>(*this); }
+};
+
+// A float array operand
+class Stream : public StreamExpression<Stream>
+{
+  public:
+    explicit Stream(const float* data) : m_data(data) {}
+    float Element(size_t i) const { return m_data[i]; }
+    Packet::Type LoadPacket(size_t i) const { return Packet::Load(m_data + i); }
+
+  private:
+    const float* m_data;
+};
+
+// The same value at every index
+class StreamConstant : public StreamExpression<StreamConstant>
+{
+  public:
+    explicit StreamConstant(float value) : m_value(value) {}
+    float Element(size_t) const { return m_value; }
+    Packet::Type LoadPacket(size_t) const { return Packet::Broadcast(m_value); }
+
+  private:
+    float m_value;
+};
+
+template <typename L, typename R, typename Op>
+class StreamBinary : public StreamExpression<StreamBinary<L, R, Op>>
+{
+  public:
+    StreamBinary(const L& left, const R& right) : m_left(left), m_right(right) {}
+    float Element(size_t i) const { return Op::Apply(m_left.Element(i), m_right.Element(i)); }
+    Packet::Type LoadPacket(size_t i) const { return Op::Apply(m_left.LoadPacket(i), m_right.LoadPacket(i)); }
+
+  private:
+    L m_left;
+    R m_right;
+};
+
+template <typename E, typename Op>
+class StreamUnary : public StreamExpression<StreamUnary<E, Op>>
+{
+  public:
+    explicit StreamUnary(const E& operand) : m_operand(operand) {}
+    float Element(size_t i) const { return Op::Apply(m_operand.Element(i)); }
+    Packet::Type LoadPacket(size_t i) const { return Op::Apply(m_operand.LoadPacket(i)); }
+
+  private:
+    E m_operand;
+};
+
+// Maps operator arguments (expressions or plain floats) to stream nodes
+template <typename T>
+struct StreamOperand
+{
+    using Type = T;
+    static const T& Wrap(const T& value) { return value; }
+};
+
+template <>
+struct StreamOperand<float>
+{
+    using Type = StreamConstant;
+    static StreamConstant Wrap(float value) { return StreamConstant(value); }
+};
+
+template <typename T>
+constexpr bool IsStreamExpression = std::is_base_of<StreamExpression<T>, T>::value;
+
+template <typename T>
+constexpr bool IsStreamOperand = IsStreamExpression<T> || std::is_same<T, float>::value;
+
+template <typename L, typename R>
+using EnableStreamBinary =
+    std::enable_if_t<IsStreamOperand<L> && IsStreamOperand<R> && (IsStreamExpression<L> || IsStreamExpression<R>)>;
+
+template <typename L, typename R, typename Op>
+using StreamBinaryOf = StreamBinary<typename StreamOperand<L>::Type, typename StreamOperand<R>::Type, Op>;
+
+template <typename L, typename R, typename = EnableStreamBinary<L, R>>
+StreamBinaryOf<L, R, ExpressionOps::Add> operator+(const L& left, const R& right)
+{
+    return {StreamOperand<L>::Wrap(left), StreamOperand<R>::Wrap(right)};
+}
+
+template <typename L, typename R, typename = EnableStreamBinary<L, R>>
+StreamBinaryOf<L, R, ExpressionOps::Subtract> operator-(const L& left, const R& right)
+{
+    return {StreamOperand<L>::Wrap(left), StreamOperand<R>::Wrap(right)};
+}
+
+template <typename L, typename R, typename = EnableStreamBinary<L, R>>
+StreamBinaryOf<L, R, ExpressionOps::Multiply> operator*(const L& left, const R& right)
+{
+    return {StreamOperand<L>::Wrap(left), StreamOperand<R>::Wrap(right)};
+}
+
+template <typename L, typename R, typename = EnableStreamBinary<L, R>>
+StreamBinaryOf<L, R, ExpressionOps::Divide> operator/(const L& left, const R& right)
+{
+    return {StreamOperand<L>::Wrap(left), StreamOperand<R>::Wrap(right)};
+}
+
+template <typename L, typename R, typename = EnableStreamBinary<L, R>>
+StreamBinaryOf<L, R, ExpressionOps::Min> Min(const L& left, const R& right)
+{
+    return {StreamOperand<L>::Wrap(left), StreamOperand<R>::Wrap(right)};
+}
+
+template <typename L, typename R, typename = EnableStreamBinary<L, R>>
+StreamBinaryOf<L, R, ExpressionOps::Max> Max(const L& left, const R& right)
+{
+    return {StreamOperand<L>::Wrap(left), StreamOperand<R>::Wrap(right)};
+}
+
+template <typename E>
+StreamUnary<E, ExpressionOps::Negate> operator-(const StreamExpression<E>& operand)
+{
+    return StreamUnary<E, ExpressionOps::Negate>(operand.Self());
+}
+
+template <typename E>
+StreamUnary<E, ExpressionOps::Sqrt> Sqrt(const StreamExpression<E>& operand)
+{
+    return StreamUnary<E, ExpressionOps::Sqrt>(operand.Self());
+}
+
+/**
+ * @brief Evaluate a stream expression into an array in one loop
+ * @param destination Output array of count floats
+ * @param count Number of elements; every stream must have at least this many
+ * @param expression Expression to evaluate
+ * @note The destination may be one of the expression's input streams
+ */
+template <typename E>
+void Assign(float* destination, size_t count, const StreamExpression<E>& expression)
+{
+    const E& e = expression.Self();
+    const size_t packetEnd = count - count % Packet::WIDTH;
+    for (size_t i = 0; i < packetEnd; i += Packet::WIDTH)
+    {
+        Packet::Store(destination + i, e.LoadPacket(i));
+    }
+    for (size_t i = packetEnd; i < count; ++i)
+    {
+        destination[i] = e.Element(i);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Vector3 streams: three component stream expressions evaluated together
+// ---------------------------------------------------------------------------
+
+template <typename X, typename Y, typename Z>
+struct Vector3StreamExpression
+{
+    X x;
+    Y y;
+    Z z;
+};
+
+template <typename X, typename Y, typename Z>
+Vector3StreamExpression<X, Y, Z> MakeVector3Stream(const X& x, const Y& y, const Z& z)
+{
+    return {x, y, z};
+}
+
+/**
+ * @brief View three component arrays as a stream of Vector3
+ * @param x X components
+ * @param y Y components
+ * @param z Z components
+ */
+inline Vector3StreamExpression<Stream, Stream, Stream> Streams(const float* x, const float* y, const float* z)
+{
+    return {Stream(x), Stream(y), Stream(z)};
+}
+
+/**
+ * @brief Use one Vector3 for every element of a stream expression
+ * @param v Vector to repeat
+ */
+inline Vector3StreamExpression<StreamConstant, StreamConstant, StreamConstant> Splat(const Vector3& v)
+{
+    return {StreamConstant(v.x), StreamConstant(v.y), StreamConstant(v.z)};
+}
+
+template <typename X1, typename Y1, typename Z1, typename X2, typename Y2, typename Z2>
+auto operator+(const Vector3StreamExpression<X1, Y1, Z1>& a, const Vector3StreamExpression<X2, Y2, Z2>& b)
+{
+    return MakeVector3Stream(a.x + b.x, a.y + b.y, a.z + b.z);
+}
+
+template <typename X1, typename Y1, typename Z1, typename X2, typename Y2, typename Z2>
+auto operator-(const Vector3StreamExpression<X1, Y1, Z1>& a, const Vector3StreamExpression<X2, Y2, Z2>& b)
+{
+    return MakeVector3Stream(a.x - b.x, a.y - b.y, a.z - b.z);
+}
+
+template <typename X, typename Y, typename Z, typename S, typename = std::enable_if_t<IsStreamOperand<S>>>
+auto operator*(const Vector3StreamExpression<X, Y, Z>& v, const S& s)
+{
+    return MakeVector3Stream(v.x * s, v.y * s, v.z * s);
+}
+
+template <typename X, typename Y, typename Z, typename S, typename = std::enable_if_t<IsStreamOperand<S>>>
+auto operator*(const S& s, const Vector3StreamExpression<X, Y, Z>& v)
+{
+    return MakeVector3Stream(s * v.x, s * v.y, s * v.z);
+}
+
+template <typename X, typename Y, typename Z, typename S, typename = std::enable_if_t<IsStreamOperand<S>>>
+auto operator/(const Vector3StreamExpression<X, Y, Z>& v, const S& s)
+{
+    return MakeVector3Stream(v.x / s, v.y / s, v.z / s);
+}
+
+template <typename X, typename Y, typename Z>
+auto operator-(const Vector3StreamExpression<X, Y, Z>& v)
+{
+    return MakeVector3Stream(-v.x, -v.y, -v.z);
+}
+
+template <typename X1, typename Y1, typename Z1, typename X2, typename Y2, typename Z2>
+auto Dot(const Vector3StreamExpression<X1, Y1, Z1>& a, const Vector3StreamExpression<X2, Y2, Z2>& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+template <typename X1, typename Y1, typename Z1, typename X2, typename Y2, typename Z2>
+auto Cross(const Vector3StreamExpression<X1, Y1, Z1>& a, const Vector3StreamExpression<X2, Y2, Z2>& b)
+{
+    return MakeVector3Stream(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+template <typename X, typename Y, typename Z>
+auto Magnitude(const Vector3StreamExpression<X, Y, Z>& v)
+{
+    return Sqrt(Dot(v, v));
+}
+
+/**
+ * @brief Evaluate a Vector3 stream expression into component arrays
+ * @param x Output X components
+ * @param y Output Y components
+ * @param z Output Z components
+ * @param count Number of elements
+ * @param expression Expression to evaluate
+ * @note All three components of an element are computed before any is
+ *       stored, so the outputs may alias the expression's input streams
+ */
+template <typename X, typename Y, typename Z>
+void Assign(float* x, float* y, float* z, size_t count, const Vector3StreamExpression<X, Y, Z>& expression)
+{
+    const size_t packetEnd = count - count % Packet::WIDTH;
+    for (size_t i = 0; i < packetEnd; i += Packet::WIDTH)
+    {
+        const Packet::Type rx = expression.x.LoadPacket(i);
+        const Packet::Type ry = expression.y.LoadPacket(i);
+        const Packet::Type rz = expression.z.LoadPacket(i);
+        Packet::Store(x + i, rx);
+        Packet::Store(y + i, ry);
+        Packet::Store(z + i, rz);
+    }
+    for (size_t i = packetEnd; i < count; ++i)
+    {
+        const float rx = expression.x.Element(i);
+        const float ry = expression.y.Element(i);
+        const float rz = expression.z.Element(i);
+        x[i] = rx;
+        y[i] = ry;
+        z[i] = rz;
+    }
+}
+
+} // namespace Math
@@ -0,0 +1,86 @@
+#include "Math/Frustum.h"
+#include <cmath>
+
+namespace Math
+{
+
+// Plane
+Plane::Plane()
+    : normal(0.0f, 1.0f, 0.0f), distance(0.0f)
+{
+}
+
+Plane::Plane(const Vector3& normal, float distance)
+    : normal(normal), distance(distance)
+{
+}
+
+Plane Plane::FromPointNormal(const Vector3& point, const Vector3& normal)
+{
+    Vector3 n = normal.Normalized();
+    return Plane(n, -Vector3::Dot(n, point));
+}
+
+float Plane::GetSignedDistance(const Vector3& point) const
+{
+    return Vector3::Dot(normal, point) + distance;
+}
+
+// Frustum
+Frustum Frustum::FromPerspective(const Vector3& position, const Vector3& forward, const Vector3& up,
+                                 float verticalFov, float aspectRatio, float nearDistance, float farDistance)
+{
+    const Vector3 f = forward.Normalized();
+    const Vector3 r = Vector3::Cross(up, f).Normalized();
+    const Vector3 u = Vector3::Cross(f, r);
+
+    const float halfHeight = std::tan(verticalFov * 0.5f);
+    const float halfWidth = halfHeight * aspectRatio;
+
+    // Each side plane contains the camera position and one frustum edge;
+    // its normal is the in-plane perpendicular that points inside.
+    Frustum frustum;
+    frustum.planes[Left] = Plane::FromPointNormal(position, f * halfWidth + r);
+    frustum.planes[Right] = Plane::FromPointNormal(position, f * halfWidth - r);
+    frustum.planes[Bottom] = Plane::FromPointNormal(position, f * halfHeight + u);
+    frustum.planes[Top] = Plane::FromPointNormal(position, f * halfHeight - u);
+    frustum.planes[Near] = Plane::FromPointNormal(position + f * nearDistance, f);
+    frustum.planes[Far] = Plane::FromPointNormal(position + f * farDistance, -f);
+    return frustum;
+}
+
+bool Frustum::ContainsPoint(const Vector3& point) const
+{
+    for (const Plane& plane : planes)
+    {
+        if (plane.GetSignedDistance(point) < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+bool Frustum::IntersectsSphere(const Vector3& center, float radius) const
+{
+    for (const Plane& plane : planes)
+    {
+        if (plane.GetSignedDistance(center) < -radius)
+            return false;
+    }
+    return true;
+}
+
+bool Frustum::IntersectsBox(const BoundingBox& box) const
+{
+    for (const Plane& plane : planes)
+    {
+        // The corner furthest along the normal is the last to leave the plane
+        const Vector3 positive(plane.normal.x >= 0.0f ? box.max.x : box.min.x,
+                               plane.normal.y >= 0.0f ? box.max.y : box.min.y,
+                               plane.normal.z >= 0.0f ? box.max.z : box.min.z);
+        if (plane.GetSignedDistance(positive) < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+} // namespace Math
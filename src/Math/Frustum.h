@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Math/BoundingBox.h"
+#include "Math/Vector3.h"
+
+namespace Math
+{
+/**
+ * @brief A plane in Hessian normal form: Dot(normal, p) + distance = 0
+ */
+struct Plane
+{
+    Vector3 normal;
+    float distance;
+
+    Plane();
+    Plane(const Vector3& normal, float distance);
+
+    /**
+     * @brief Create a plane through a point with the given normal
+     * @param point Any point on the plane
+     * @param normal Plane normal (normalized by this function)
+     * @return The plane
+     */
+    static Plane FromPointNormal(const Vector3& point, const Vector3& normal);
+
+    /**
+     * @brief Signed distance from the plane to a point
+     * @param point Point to test
+     * @return Positive on the side the normal points to
+     */
+    float GetSignedDistance(const Vector3& point) const;
+};
+
+/**
+ * @brief A view frustum described by six inward-facing planes
+ *
+ * Used for visibility tests against bounding volumes. Planes point into the
+ * frustum, so a volume is outside as soon as it lies fully behind any plane.
+ */
+class Frustum
+{
+  public:
+    enum PlaneIndex
+    {
+        Left = 0,
+        Right,
+        Bottom,
+        Top,
+        Near,
+        Far,
+        PlaneCount
+    };
+
+    Plane planes[PlaneCount];
+
+    /**
+     * @brief Build a perspective frustum from a camera description
+     * @param position Camera position
+     * @param forward View direction
+     * @param up Approximate up direction
+     * @param verticalFov Vertical field of view in radians
+     * @param aspectRatio Viewport width divided by height
+     * @param nearDistance Distance to the near plane
+     * @param farDistance Distance to the far plane
+     * @return The frustum in the same space as the inputs
+     * @note Uses a left-handed basis (right = Cross(up, forward)), matching
+     *       the DirectX renderers
+     */
+    static Frustum FromPerspective(const Vector3& position, const Vector3& forward, const Vector3& up,
+                                   float verticalFov, float aspectRatio, float nearDistance, float farDistance);
+
+    /**
+     * @brief Test whether a point lies inside the frustum
+     * @param point Point to test
+     * @return True if the point is inside or on the boundary
+     */
+    bool ContainsPoint(const Vector3& point) const;
+
+    /**
+     * @brief Test whether a sphere overlaps the frustum
+     * @param center Sphere center
+     * @param radius Sphere radius
+     * @return False only if the sphere is fully outside one plane
+     * @note Conservative: spheres near frustum corners may report true
+     */
+    bool IntersectsSphere(const Vector3& center, float radius) const;
+
+    /**
+     * @brief Test whether an axis-aligned box overlaps the frustum
+     * @param box Box to test
+     * @return False only if the box is fully outside one plane
+     * @note Conservative in the same way as IntersectsSphere
+     */
+    bool IntersectsBox(const BoundingBox& box) const;
+};
+
+} // namespace Math
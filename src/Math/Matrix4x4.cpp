@@ -0,0 +1,208 @@
+#include "Math/Matrix4x4.h"
+#include <cmath>
+#include <limits>
+
+namespace Math
+{
+
+// Constructors
+Matrix4x4::Matrix4x4()
+    : Matrix4x4(1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f)
+{
+}
+
+Matrix4x4::Matrix4x4(float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13,
+                     float m20, float m21, float m22, float m23, float m30, float m31, float m32, float m33)
+    : m{{m00, m01, m02, m03}, {m10, m11, m12, m13}, {m20, m21, m22, m23}, {m30, m31, m32, m33}}
+{
+}
+
+// Arithmetic operators
+Matrix4x4 Matrix4x4::operator*(const Matrix4x4& other) const
+{
+    Matrix4x4 result;
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            result.m[row][column] = m[row][0] * other.m[0][column] + m[row][1] * other.m[1][column] +
+                                    m[row][2] * other.m[2][column] + m[row][3] * other.m[3][column];
+        }
+    }
+    return result;
+}
+
+Matrix4x4 Matrix4x4::operator*(float scalar) const
+{
+    Matrix4x4 result;
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            result.m[row][column] = m[row][column] * scalar;
+        }
+    }
+    return result;
+}
+
+Matrix4x4 Matrix4x4::operator+(const Matrix4x4& other) const
+{
+    Matrix4x4 result;
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            result.m[row][column] = m[row][column] + other.m[row][column];
+        }
+    }
+    return result;
+}
+
+// Comparison operators
+bool Matrix4x4::operator==(const Matrix4x4& other) const
+{
+    const float epsilon = std::numeric_limits<float>::epsilon();
+    for (int row = 0; row < 4; ++row)
+    {
+        for (int column = 0; column < 4; ++column)
+        {
+            if (std::abs(m[row][column] - other.m[row][column]) >= epsilon)
+                return false;
+        }
+    }
+    return true;
+}
+
+bool Matrix4x4::operator!=(const Matrix4x4& other) const
+{
+    return !(*this == other);
+}
+
+// Transforms
+Vector3 Matrix4x4::TransformPoint(const Vector3& point) const
+{
+    return Vector3(point.x * m[0][0] + point.y * m[1][0] + point.z * m[2][0] + m[3][0],
+                   point.x * m[0][1] + point.y * m[1][1] + point.z * m[2][1] + m[3][1],
+                   point.x * m[0][2] + point.y * m[1][2] + point.z * m[2][2] + m[3][2]);
+}
+
+Vector3 Matrix4x4::TransformVector(const Vector3& vector) const
+{
+    return Vector3(vector.x * m[0][0] + vector.y * m[1][0] + vector.z * m[2][0],
+                   vector.x * m[0][1] + vector.y * m[1][1] + vector.z * m[2][1],
+                   vector.x * m[0][2] + vector.y * m[1][2] + vector.z * m[2][2]);
+}
+
+// Matrix operations
+Matrix4x4 Matrix4x4::Transposed() const
+{
+    return Matrix4x4(m[0][0], m[1][0], m[2][0], m[3][0], m[0][1], m[1][1], m[2][1], m[3][1], m[0][2], m[1][2],
+                     m[2][2], m[3][2], m[0][3], m[1][3], m[2][3], m[3][3]);
+}
+
+float Matrix4x4::Determinant() const
+{
+    // Laplace expansion along the first row using 2x2 minors of the bottom rows
+    const float s0 = m[2][0] * m[3][1] - m[2][1] * m[3][0];
+    const float s1 = m[2][0] * m[3][2] - m[2][2] * m[3][0];
+    const float s2 = m[2][0] * m[3][3] - m[2][3] * m[3][0];
+    const float s3 = m[2][1] * m[3][2] - m[2][2] * m[3][1];
+    const float s4 = m[2][1] * m[3][3] - m[2][3] * m[3][1];
+    const float s5 = m[2][2] * m[3][3] - m[2][3] * m[3][2];
+
+    return m[0][0] * (m[1][1] * s5 - m[1][2] * s4 + m[1][3] * s3) -
+           m[0][1] * (m[1][0] * s5 - m[1][2] * s2 + m[1][3] * s1) +
+           m[0][2] * (m[1][0] * s4 - m[1][1] * s2 + m[1][3] * s0) -
+           m[0][3] * (m[1][0] * s3 - m[1][1] * s1 + m[1][2] * s0);
+}
+
+Matrix4x4 Matrix4x4::Inverse() const
+{
+    // Cofactor expansion with shared 2x2 minors of the top and bottom row pairs
+    const float a0 = m[0][0] * m[1][1] - m[0][1] * m[1][0];
+    const float a1 = m[0][0] * m[1][2] - m[0][2] * m[1][0];
+    const float a2 = m[0][0] * m[1][3] - m[0][3] * m[1][0];
+    const float a3 = m[0][1] * m[1][2] - m[0][2] * m[1][1];
+    const float a4 = m[0][1] * m[1][3] - m[0][3] * m[1][1];
+    const float a5 = m[0][2] * m[1][3] - m[0][3] * m[1][2];
+    const float b0 = m[2][0] * m[3][1] - m[2][1] * m[3][0];
+    const float b1 = m[2][0] * m[3][2] - m[2][2] * m[3][0];
+    const float b2 = m[2][0] * m[3][3] - m[2][3] * m[3][0];
+    const float b3 = m[2][1] * m[3][2] - m[2][2] * m[3][1];
+    const float b4 = m[2][1] * m[3][3] - m[2][3] * m[3][1];
+    const float b5 = m[2][2] * m[3][3] - m[2][3] * m[3][2];
+
+    const float determinant = a0 * b5 - a1 * b4 + a2 * b3 + a3 * b2 - a4 * b1 + a5 * b0;
+    if (std::abs(determinant) < std::numeric_limits<float>::min())
+        return Identity();
+
+    const float s = 1.0f / determinant;
+    return Matrix4x4((m[1][1] * b5 - m[1][2] * b4 + m[1][3] * b3) * s, (-m[0][1] * b5 + m[0][2] * b4 - m[0][3] * b3) * s,
+                     (m[3][1] * a5 - m[3][2] * a4 + m[3][3] * a3) * s, (-m[2][1] * a5 + m[2][2] * a4 - m[2][3] * a3) * s,
+                     (-m[1][0] * b5 + m[1][2] * b2 - m[1][3] * b1) * s, (m[0][0] * b5 - m[0][2] * b2 + m[0][3] * b1) * s,
+                     (-m[3][0] * a5 + m[3][2] * a2 - m[3][3] * a1) * s, (m[2][0] * a5 - m[2][2] * a2 + m[2][3] * a1) * s,
+                     (m[1][0] * b4 - m[1][1] * b2 + m[1][3] * b0) * s, (-m[0][0] * b4 + m[0][1] * b2 - m[0][3] * b0) * s,
+                     (m[3][0] * a4 - m[3][1] * a2 + m[3][3] * a0) * s, (-m[2][0] * a4 + m[2][1] * a2 - m[2][3] * a0) * s,
+                     (-m[1][0] * b3 + m[1][1] * b1 - m[1][2] * b0) * s, (m[0][0] * b3 - m[0][1] * b1 + m[0][2] * b0) * s,
+                     (-m[3][0] * a3 + m[3][1] * a1 - m[3][2] * a0) * s, (m[2][0] * a3 - m[2][1] * a1 + m[2][2] * a0) * s);
+}
+
+// Static factory functions
+Matrix4x4 Matrix4x4::Identity()
+{
+    return Matrix4x4();
+}
+
+Matrix4x4 Matrix4x4::Translation(const Vector3& translation)
+{
+    Matrix4x4 result;
+    result.m[3][0] = translation.x;
+    result.m[3][1] = translation.y;
+    result.m[3][2] = translation.z;
+    return result;
+}
+
+Matrix4x4 Matrix4x4::Scale(const Vector3& scale)
+{
+    Matrix4x4 result;
+    result.m[0][0] = scale.x;
+    result.m[1][1] = scale.y;
+    result.m[2][2] = scale.z;
+    return result;
+}
+
+Matrix4x4 Matrix4x4::RotationX(float angle)
+{
+    const float c = std::cos(angle);
+    const float s = std::sin(angle);
+    return Matrix4x4(1.0f, 0.0f, 0.0f, 0.0f, 0.0f, c, s, 0.0f, 0.0f, -s, c, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+Matrix4x4 Matrix4x4::RotationY(float angle)
+{
+    const float c = std::cos(angle);
+    const float s = std::sin(angle);
+    return Matrix4x4(c, 0.0f, -s, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, s, 0.0f, c, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+Matrix4x4 Matrix4x4::RotationZ(float angle)
+{
+    const float c = std::cos(angle);
+    const float s = std::sin(angle);
+    return Matrix4x4(c, s, 0.0f, 0.0f, -s, c, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+Matrix4x4 Matrix4x4::RotationAxis(const Vector3& axis, float angle)
+{
+    const float c = std::cos(angle);
+    const float s = std::sin(angle);
+    const float t = 1.0f - c;
+    const float x = axis.x, y = axis.y, z = axis.z;
+
+    return Matrix4x4(t * x * x + c, t * x * y + s * z, t * x * z - s * y, 0.0f,
+                     t * x * y - s * z, t * y * y + c, t * y * z + s * x, 0.0f,
+                     t * x * z + s * y, t * y * z - s * x, t * z * z + c, 0.0f,
+                     0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+} // namespace Math
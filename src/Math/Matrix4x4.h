@@ -0,0 +1,89 @@
+#pragma once
+
+#include "Math/Vector3.h"
+
+namespace Math
+{
+/**
+ * @brief A 4x4 matrix for affine and projective transforms
+ *
+ * Uses the row-vector convention of the left-handed renderer: a point is
+ * transformed as p' = p * M, translation lives in the last row, and A * B
+ * applies A first, then B. Elements are stored row-major as m[row][column].
+ */
+class Matrix4x4
+{
+  public:
+    // Member variables
+    float m[4][4];
+
+    // Constructors
+    Matrix4x4(); // Identity
+    Matrix4x4(float m00, float m01, float m02, float m03, float m10, float m11, float m12, float m13, float m20,
+              float m21, float m22, float m23, float m30, float m31, float m32, float m33);
+
+    // Arithmetic operators
+    Matrix4x4 operator*(const Matrix4x4& other) const;
+    Matrix4x4 operator*(float scalar) const;
+    Matrix4x4 operator+(const Matrix4x4& other) const;
+
+    // Comparison operators
+    bool operator==(const Matrix4x4& other) const;
+    bool operator!=(const Matrix4x4& other) const;
+
+    /**
+     * @brief Transform a point, including translation
+     * @param point Point to transform
+     * @return Transformed point (the w component is assumed to stay 1)
+     */
+    Vector3 TransformPoint(const Vector3& point) const;
+
+    /**
+     * @brief Transform a direction, ignoring translation
+     * @param vector Direction to transform
+     * @return Transformed direction
+     */
+    Vector3 TransformVector(const Vector3& vector) const;
+
+    /**
+     * @brief Return the transpose of this matrix
+     * @return A new matrix with rows and columns swapped
+     */
+    Matrix4x4 Transposed() const;
+
+    /**
+     * @brief Calculate the determinant of this matrix
+     * @return The determinant as a float
+     */
+    float Determinant() const;
+
+    /**
+     * @brief Return the inverse of this matrix
+     * @return The inverse, or the identity if the matrix is singular
+     */
+    Matrix4x4 Inverse() const;
+
+    // Static factory functions
+    static Matrix4x4 Identity();
+    static Matrix4x4 Translation(const Vector3& translation);
+    static Matrix4x4 Scale(const Vector3& scale);
+
+    /**
+     * @brief Rotation about a coordinate axis
+     * @param angle Angle in radians, clockwise when looking along the axis
+     *        toward the origin (left-handed)
+     */
+    static Matrix4x4 RotationX(float angle);
+    static Matrix4x4 RotationY(float angle);
+    static Matrix4x4 RotationZ(float angle);
+
+    /**
+     * @brief Rotation about an arbitrary axis
+     * @param axis Axis of rotation (should be normalized)
+     * @param angle Angle in radians
+     * @return Rotation matrix consistent with RotationX/Y/Z
+     */
+    static Matrix4x4 RotationAxis(const Vector3& axis, float angle);
+};
+
+} // namespace Math
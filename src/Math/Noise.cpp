@@ -0,0 +1,679 @@
+#include "Math/Noise.h"
+#include "Math/Simd.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Math
+{
+namespace
+{
+// Every kernel below is written once against a lane type: float/uint32_t/bool
+// for the scalar reference, and eight-wide wrappers for AVX2. The helpers
+// here give both the same vocabulary.
+
+inline float Floor(float v)
+{
+    return std::floor(v);
+}
+
+inline float Max(float a, float b)
+{
+    return std::max(a, b);
+}
+
+// Integer lattice coordinate of an already floored value
+inline uint32_t ToCell(float v)
+{
+    return static_cast<uint32_t>(static_cast<int32_t>(v));
+}
+
+inline float Select(bool mask, float a, float b)
+{
+    return mask ? a : b;
+}
+
+inline bool HasBit(uint32_t value, uint32_t bit)
+{
+    return (value & bit) != 0;
+}
+
+inline bool Below(uint32_t value, uint32_t limit)
+{
+    return value < limit;
+}
+
+inline bool Equal(uint32_t a, uint32_t b)
+{
+    return a == b;
+}
+
+inline uint32_t One(bool mask)
+{
+    return mask ? 1u : 0u;
+}
+
+inline uint32_t AtLeast(uint32_t value, uint32_t limit)
+{
+    return value >= limit ? 1u : 0u;
+}
+
+inline float ToFloat(uint32_t value)
+{
+    return static_cast<float>(static_cast<int32_t>(value));
+}
+
+template <typename F>
+struct Lanes
+{
+    using UInt = uint32_t;
+};
+
+#if defined(HERMIT_SIMD_AVX2)
+struct Mask8
+{
+    __m256 v;
+};
+
+struct Float8
+{
+    __m256 v;
+    Float8() = default;
+    Float8(__m256 value) : v(value) {}
+    Float8(float value) : v(_mm256_set1_ps(value)) {}
+};
+
+struct UInt8
+{
+    __m256i v;
+    UInt8() = default;
+    UInt8(__m256i value) : v(value) {}
+    UInt8(uint32_t value) : v(_mm256_set1_epi32(static_cast<int32_t>(value))) {}
+};
+
+inline Float8 operator+(Float8 a, Float8 b) { return _mm256_add_ps(a.v, b.v); }
+inline Float8 operator-(Float8 a, Float8 b) { return _mm256_sub_ps(a.v, b.v); }
+inline Float8 operator*(Float8 a, Float8 b) { return _mm256_mul_ps(a.v, b.v); }
+inline Float8 operator-(Float8 a) { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)); }
+inline Mask8 operator>(Float8 a, Float8 b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)}; }
+inline Mask8 operator>=(Float8 a, Float8 b) { return {_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ)}; }
+
+inline UInt8 operator+(UInt8 a, UInt8 b) { return _mm256_add_epi32(a.v, b.v); }
+inline UInt8 operator-(UInt8 a, UInt8 b) { return _mm256_sub_epi32(a.v, b.v); }
+inline UInt8 operator*(UInt8 a, UInt8 b) { return _mm256_mullo_epi32(a.v, b.v); }
+inline UInt8 operator^(UInt8 a, UInt8 b) { return _mm256_xor_si256(a.v, b.v); }
+inline UInt8 operator&(UInt8 a, UInt8 b) { return _mm256_and_si256(a.v, b.v); }
+inline UInt8 operator>>(UInt8 a, int bits) { return _mm256_srli_epi32(a.v, bits); }
+
+inline Float8 Floor(Float8 v)
+{
+    return _mm256_floor_ps(v.v);
+}
+
+inline Float8 Max(Float8 a, Float8 b)
+{
+    return _mm256_max_ps(a.v, b.v);
+}
+
+inline UInt8 ToCell(Float8 v)
+{
+    return _mm256_cvttps_epi32(v.v);
+}
+
+inline Float8 Select(Mask8 mask, Float8 a, Float8 b)
+{
+    return _mm256_blendv_ps(b.v, a.v, mask.v);
+}
+
+inline Mask8 HasBit(UInt8 value, uint32_t bit)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i clear = _mm256_cmpeq_epi32(_mm256_and_si256(value.v, UInt8(bit).v), zero);
+    return {_mm256_castsi256_ps(_mm256_xor_si256(clear, _mm256_set1_epi32(-1)))};
+}
+
+// Hash bits are masked to a few low bits first, so a signed compare is exact
+inline Mask8 Below(UInt8 value, uint32_t limit)
+{
+    return {_mm256_castsi256_ps(_mm256_cmpgt_epi32(UInt8(limit).v, value.v))};
+}
+
+inline Mask8 Equal(UInt8 a, UInt8 b)
+{
+    return {_mm256_castsi256_ps(_mm256_cmpeq_epi32(a.v, b.v))};
+}
+
+inline UInt8 One(Mask8 mask)
+{
+    return _mm256_and_si256(_mm256_castps_si256(mask.v), _mm256_set1_epi32(1));
+}
+
+// Only used on small rank counts, so a signed compare is exact
+inline UInt8 AtLeast(UInt8 value, uint32_t limit)
+{
+    return _mm256_and_si256(_mm256_cmpgt_epi32(value.v, UInt8(limit - 1).v), _mm256_set1_epi32(1));
+}
+
+inline Float8 ToFloat(UInt8 value)
+{
+    return _mm256_cvtepi32_ps(value.v);
+}
+
+template <>
+struct Lanes<Float8>
+{
+    using UInt = UInt8;
+};
+#endif
+
+template <typename F>
+F Fade(F t)
+{
+    return t * t * t * (t * (t * F(6.0f) - F(15.0f)) + F(10.0f));
+}
+
+template <typename F>
+F Lerp(F t, F a, F b)
+{
+    return a + t * (b - a);
+}
+
+// Lattice hashes from integer coordinates; the final avalanche mixes the
+// high bits into the low bits that pick gradients
+template <typename U>
+U Mix(U h)
+{
+    h = h ^ (h >> 15);
+    h = h * U(0x2C1B3C6Du);
+    h = h ^ (h >> 12);
+    h = h * U(0x297A2D39u);
+    return h ^ (h >> 15);
+}
+
+template <typename U>
+U Hash(U x, U y, U seed)
+{
+    return Mix(x * U(0x8DA6B343u) ^ y * U(0xD8163841u) ^ seed);
+}
+
+template <typename U>
+U Hash(U x, U y, U z, U seed)
+{
+    return Mix(x * U(0x8DA6B343u) ^ y * U(0xD8163841u) ^ z * U(0xCB1AB31Fu) ^ seed);
+}
+
+template <typename U>
+U Hash(U x, U y, U z, U w, U seed)
+{
+    return Mix(x * U(0x8DA6B343u) ^ y * U(0xD8163841u) ^ z * U(0xCB1AB31Fu) ^ w * U(0x9E3779B1u) ^ seed);
+}
+
+inline uint32_t SeedHash(uint32_t seed)
+{
+    return seed * 0x85EBCA6Bu + 0x68E31DA4u;
+}
+
+// Dot products with the gradient chosen by the hash
+template <typename F, typename U>
+F Gradient(U hash, F x, F y)
+{
+    const U h = hash & U(7);
+    const auto low = Below(h, 4);
+    const F u = Select(low, x, y);
+    const F v = Select(low, y, x) * F(2.0f);
+    return Select(HasBit(h, 1), -u, u) + Select(HasBit(h, 2), -v, v);
+}
+
+template <typename F, typename U>
+F Gradient(U hash, F x, F y, F z)
+{
+    const U h = hash & U(15);
+    const F u = Select(Below(h, 8), x, y);
+    const F v = Select(Below(h, 4), y, Select(Equal(h & U(13), U(12)), x, z));
+    return Select(HasBit(h, 1), -u, u) + Select(HasBit(h, 2), -v, v);
+}
+
+template <typename F, typename U>
+F Gradient(U hash, F x, F y, F z, F w)
+{
+    const U h = hash & U(31);
+    const F a = Select(Below(h, 24), x, y);
+    const F b = Select(Below(h, 16), y, z);
+    const F c = Select(Below(h, 8), z, w);
+    return Select(HasBit(h, 1), -a, a) + Select(HasBit(h, 2), -b, b) + Select(HasBit(h, 4), -c, c);
+}
+
+// Output scales bring the extremes close to +-1
+constexpr float PERLIN_SCALE_2D = 0.65f;
+constexpr float PERLIN_SCALE_3D = 0.96f;
+constexpr float PERLIN_SCALE_4D = 0.8f;
+constexpr float SIMPLEX_SCALE_2D = 44.0f;
+constexpr float SIMPLEX_SCALE_3D = 75.0f;
+constexpr float SIMPLEX_SCALE_4D = 61.0f;
+
+template <typename F>
+F PerlinKernel(F x, F y, uint32_t seed)
+{
+    using U = typename Lanes<F>::UInt;
+    const U seedHash = U(SeedHash(seed));
+    const F fx = Floor(x), fy = Floor(y);
+    const U cx = ToCell(fx), cy = ToCell(fy);
+    const U nx = cx + U(1), ny = cy + U(1);
+    x = x - fx;
+    y = y - fy;
+    const F x1 = x - F(1.0f), y1 = y - F(1.0f);
+    const F u = Fade(x), v = Fade(y);
+
+    const F bottom = Lerp(u, Gradient(Hash(cx, cy, seedHash), x, y), Gradient(Hash(nx, cy, seedHash), x1, y));
+    const F top = Lerp(u, Gradient(Hash(cx, ny, seedHash), x, y1), Gradient(Hash(nx, ny, seedHash), x1, y1));
+    return Lerp(v, bottom, top) * F(PERLIN_SCALE_2D);
+}
+
+template <typename F>
+F PerlinKernel(F x, F y, F z, uint32_t seed)
+{
+    using U = typename Lanes<F>::UInt;
+    const U seedHash = U(SeedHash(seed));
+    const F fx = Floor(x), fy = Floor(y), fz = Floor(z);
+    const U cx = ToCell(fx), cy = ToCell(fy), cz = ToCell(fz);
+    const U nx = cx + U(1), ny = cy + U(1), nz = cz + U(1);
+    x = x - fx;
+    y = y - fy;
+    z = z - fz;
+    const F x1 = x - F(1.0f), y1 = y - F(1.0f), z1 = z - F(1.0f);
+    const F u = Fade(x), v = Fade(y), t = Fade(z);
+
+    const F n000 = Gradient(Hash(cx, cy, cz, seedHash), x, y, z);
+    const F n100 = Gradient(Hash(nx, cy, cz, seedHash), x1, y, z);
+    const F n010 = Gradient(Hash(cx, ny, cz, seedHash), x, y1, z);
+    const F n110 = Gradient(Hash(nx, ny, cz, seedHash), x1, y1, z);
+    const F n001 = Gradient(Hash(cx, cy, nz, seedHash), x, y, z1);
+    const F n101 = Gradient(Hash(nx, cy, nz, seedHash), x1, y, z1);
+    const F n011 = Gradient(Hash(cx, ny, nz, seedHash), x, y1, z1);
+    const F n111 = Gradient(Hash(nx, ny, nz, seedHash), x1, y1, z1);
+
+    const F near = Lerp(v, Lerp(u, n000, n100), Lerp(u, n010, n110));
+    const F far = Lerp(v, Lerp(u, n001, n101), Lerp(u, n011, n111));
+    return Lerp(t, near, far) * F(PERLIN_SCALE_3D);
+}
+
+template <typename F>
+F PerlinKernel(F x, F y, F z, F w, uint32_t seed)
+{
+    using U = typename Lanes<F>::UInt;
+    const U seedHash = U(SeedHash(seed));
+    const F fx = Floor(x), fy = Floor(y), fz = Floor(z), fw = Floor(w);
+    const U cx = ToCell(fx), cy = ToCell(fy), cz = ToCell(fz), cw = ToCell(fw);
+    x = x - fx;
+    y = y - fy;
+    z = z - fz;
+    w = w - fw;
+    const F x1 = x - F(1.0f);
+    const F u = Fade(x), v = Fade(y), t = Fade(z), s = Fade(w);
+
+    // Blend the 16 corners one axis at a time, w outermost
+    F layers[2];
+    for (uint32_t dw = 0; dw < 2; ++dw)
+    {
+        const F offsetW = w - F(static_cast<float>(dw));
+        F planes[2];
+        for (uint32_t dz = 0; dz < 2; ++dz)
+        {
+            const F offsetZ = z - F(static_cast<float>(dz));
+            F rows[2];
+            for (uint32_t dy = 0; dy < 2; ++dy)
+            {
+                const F offsetY = y - F(static_cast<float>(dy));
+                const U hy = cy + U(dy), hz = cz + U(dz), hw = cw + U(dw);
+                const F n0 = Gradient(Hash(cx, hy, hz, hw, seedHash), x, offsetY, offsetZ, offsetW);
+                const F n1 = Gradient(Hash(cx + U(1), hy, hz, hw, seedHash), x1, offsetY, offsetZ, offsetW);
+                rows[dy] = Lerp(u, n0, n1);
+            }
+            planes[dz] = Lerp(v, rows[0], rows[1]);
+        }
+        layers[dw] = Lerp(t, planes[0], planes[1]);
+    }
+    return Lerp(s, layers[0], layers[1]) * F(PERLIN_SCALE_4D);
+}
+
+// Contribution weight of a simplex corner: (0.5 - d^2)^4, zero beyond. The
+// radius of 0.5 keeps the noise continuous across simplices in every dimension.
+template <typename F>
+F Falloff(F distanceSquared)
+{
+    const F t = Max(F(0.5f) - distanceSquared, F(0.0f));
+    const F t2 = t * t;
+    return t2 * t2;
+}
+
+template <typename F>
+F SimplexKernel(F x, F y, uint32_t seed)
+{
+    using U = typename Lanes<F>::UInt;
+    const float skew = 0.36602540378f;  // (sqrt(3) - 1) / 2
+    const float unskew = 0.2113248654f; // (3 - sqrt(3)) / 6
+
+    const U seedHash = U(SeedHash(seed));
+    const F s = (x + y) * F(skew);
+    const F fi = Floor(x + s), fj = Floor(y + s);
+    const F t = (fi + fj) * F(unskew);
+    const F x0 = x - (fi - t), y0 = y - (fj - t);
+    const U i = ToCell(fi), j = ToCell(fj);
+
+    // Lower or upper triangle of the skewed cell
+    const U i1 = One(x0 > y0);
+    const U j1 = U(1) - i1;
+    const F x1 = x0 - ToFloat(i1) + F(unskew), y1 = y0 - ToFloat(j1) + F(unskew);
+    const F x2 = x0 - F(1.0f - 2.0f * unskew), y2 = y0 - F(1.0f - 2.0f * unskew);
+
+    const F n0 = Falloff(x0 * x0 + y0 * y0) * Gradient(Hash(i, j, seedHash), x0, y0);
+    const F n1 = Falloff(x1 * x1 + y1 * y1) * Gradient(Hash(i + i1, j + j1, seedHash), x1, y1);
+    const F n2 = Falloff(x2 * x2 + y2 * y2) * Gradient(Hash(i + U(1), j + U(1), seedHash), x2, y2);
+    return (n0 + n1 + n2) * F(SIMPLEX_SCALE_2D);
+}
+
+template <typename F>
+F SimplexKernel(F x, F y, F z, uint32_t seed)
+{
+    using U = typename Lanes<F>::UInt;
+    const float skew = 1.0f / 3.0f;
+    const float unskew = 1.0f / 6.0f;
+
+    const U seedHash = U(SeedHash(seed));
+    const F s = (x + y + z) * F(skew);
+    const F fi = Floor(x + s), fj = Floor(y + s), fk = Floor(z + s);
+    const F t = (fi + fj + fk) * F(unskew);
+    const F x0 = x - (fi - t), y0 = y - (fj - t), z0 = z - (fk - t);
+    const U i = ToCell(fi), j = ToCell(fj), k = ToCell(fk);
+
+    // Rank the offsets to find which simplex of the cube holds the point;
+    // ties go to the earlier axis so every rank is used exactly once
+    const U rankX = One(x0 >= y0) + One(x0 >= z0);
+    const U rankY = One(y0 > x0) + One(y0 >= z0);
+    const U rankZ = One(z0 > x0) + One(z0 > y0);
+    const U i1 = AtLeast(rankX, 2), j1 = AtLeast(rankY, 2), k1 = AtLeast(rankZ, 2);
+    const U i2 = AtLeast(rankX, 1), j2 = AtLeast(rankY, 1), k2 = AtLeast(rankZ, 1);
+
+    const F x1 = x0 - ToFloat(i1) + F(unskew), y1 = y0 - ToFloat(j1) + F(unskew), z1 = z0 - ToFloat(k1) + F(unskew);
+    const F x2 = x0 - ToFloat(i2) + F(2.0f * unskew), y2 = y0 - ToFloat(j2) + F(2.0f * unskew),
+            z2 = z0 - ToFloat(k2) + F(2.0f * unskew);
+    const F x3 = x0 - F(1.0f - 3.0f * unskew), y3 = y0 - F(1.0f - 3.0f * unskew), z3 = z0 - F(1.0f - 3.0f * unskew);
+
+    const F n0 = Falloff(x0 * x0 + y0 * y0 + z0 * z0) * Gradient(Hash(i, j, k, seedHash), x0, y0, z0);
+    const F n1 =
+        Falloff(x1 * x1 + y1 * y1 + z1 * z1) * Gradient(Hash(i + i1, j + j1, k + k1, seedHash), x1, y1, z1);
+    const F n2 =
+        Falloff(x2 * x2 + y2 * y2 + z2 * z2) * Gradient(Hash(i + i2, j + j2, k + k2, seedHash), x2, y2, z2);
+    const F n3 = Falloff(x3 * x3 + y3 * y3 + z3 * z3) *
+                 Gradient(Hash(i + U(1), j + U(1), k + U(1), seedHash), x3, y3, z3);
+    return (n0 + n1 + n2 + n3) * F(SIMPLEX_SCALE_3D);
+}
+
+template <typename F>
+F SimplexKernel(F x, F y, F z, F w, uint32_t seed)
+{
+    using U = typename Lanes<F>::UInt;
+    const float skew = 0.30901699437f;   // (sqrt(5) - 1) / 4
+    const float unskew = 0.13819660113f; // (5 - sqrt(5)) / 20
+
+    const U seedHash = U(SeedHash(seed));
+    const F s = (x + y + z + w) * F(skew);
+    const F fi = Floor(x + s), fj = Floor(y + s), fk = Floor(z + s), fl = Floor(w + s);
+    const F t = (fi + fj + fk + fl) * F(unskew);
+    const F offset[4] = {x - (fi - t), y - (fj - t), z - (fk - t), w - (fl - t)};
+    const U cell[4] = {ToCell(fi), ToCell(fj), ToCell(fk), ToCell(fl)};
+
+    const U rank[4] = {One(offset[0] >= offset[1]) + One(offset[0] >= offset[2]) + One(offset[0] >= offset[3]),
+                       One(offset[1] > offset[0]) + One(offset[1] >= offset[2]) + One(offset[1] >= offset[3]),
+                       One(offset[2] > offset[0]) + One(offset[2] > offset[1]) + One(offset[2] >= offset[3]),
+                       One(offset[3] > offset[0]) + One(offset[3] > offset[1]) + One(offset[3] > offset[2])};
+
+    // Corner c steps along the axes ranked at least 4 - c
+    F sum = F(0.0f);
+    for (uint32_t corner = 0; corner < 5; ++corner)
+    {
+        U step[4];
+        F d[4];
+        for (int axis = 0; axis < 4; ++axis)
+        {
+            step[axis] = corner == 0 ? U(0) : (corner == 4 ? U(1) : AtLeast(rank[axis], 4 - corner));
+            d[axis] = offset[axis] - ToFloat(step[axis]) + F(static_cast<float>(corner) * unskew);
+        }
+
+        const U hash = Hash(cell[0] + step[0], cell[1] + step[1], cell[2] + step[2], cell[3] + step[3], seedHash);
+        const F distanceSquared = d[0] * d[0] + d[1] * d[1] + d[2] * d[2] + d[3] * d[3];
+        sum = sum + Falloff(distanceSquared) * Gradient(hash, d[0], d[1], d[2], d[3]);
+    }
+    return sum * F(SIMPLEX_SCALE_4D);
+}
+
+template <typename F>
+F NoiseKernel(NoiseType type, F x, F y, uint32_t seed)
+{
+    return type == NoiseType::Perlin ? PerlinKernel(x, y, seed) : SimplexKernel(x, y, seed);
+}
+
+template <typename F>
+F NoiseKernel(NoiseType type, F x, F y, F z, uint32_t seed)
+{
+    return type == NoiseType::Perlin ? PerlinKernel(x, y, z, seed) : SimplexKernel(x, y, z, seed);
+}
+
+template <typename F>
+F NoiseKernel(NoiseType type, F x, F y, F z, F w, uint32_t seed)
+{
+    return type == NoiseType::Perlin ? PerlinKernel(x, y, z, w, seed) : SimplexKernel(x, y, z, w, seed);
+}
+
+// Octaves get consecutive seeds so they do not line up at the origin
+template <typename F, typename... Coordinates>
+F FractalKernel(const FractalSettings& settings, Coordinates... coordinates)
+{
+    F sum = F(0.0f);
+    float amplitude = 1.0f;
+    float frequency = settings.frequency;
+    float totalAmplitude = 0.0f;
+    for (uint32_t octave = 0; octave < settings.octaves; ++octave)
+    {
+        sum = sum + F(amplitude) * NoiseKernel(settings.type, (coordinates * F(frequency))..., settings.seed + octave);
+        totalAmplitude += amplitude;
+        amplitude *= settings.gain;
+        frequency *= settings.lacunarity;
+    }
+    return totalAmplitude > 0.0f ? sum * F(1.0f / totalAmplitude) : F(0.0f);
+}
+
+inline float Component(const Vector2& point, size_t axis)
+{
+    return axis == 0 ? point.x : point.y;
+}
+
+inline float Component(const Vector3& point, size_t axis)
+{
+    return axis == 0 ? point.x : (axis == 1 ? point.y : point.z);
+}
+
+inline float Component(const Float4& point, size_t axis)
+{
+    return point[axis];
+}
+
+constexpr size_t BATCH_SIZE = Noise::BATCH_SIZE;
+constexpr size_t GRAIN_SIZE = 4096; // A multiple of BATCH_SIZE
+
+// Calls evaluate(x, y, ...) for every point and stores the results, in
+// parallel chunks and BATCH_SIZE points at a time with AVX2
+template <size_t Dimensions, typename Point, typename Evaluate>
+void EvaluatePoints(const Point* points, size_t count, float* out, Evaluate&& evaluate)
+{
+    Threading::ParallelFor(count, GRAIN_SIZE, [&](size_t begin, size_t end) {
+#if defined(HERMIT_SIMD_AVX2)
+        for (size_t i = begin; i < end; i += BATCH_SIZE)
+        {
+            const size_t lanes = std::min(BATCH_SIZE, end - i);
+            alignas(32) float coordinates[Dimensions][BATCH_SIZE] = {};
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                for (size_t axis = 0; axis < Dimensions; ++axis)
+                {
+                    coordinates[axis][lane] = Component(points[i + lane], axis);
+                }
+            }
+
+            Float8 result;
+            if constexpr (Dimensions == 2)
+                result = evaluate(Float8(_mm256_load_ps(coordinates[0])), Float8(_mm256_load_ps(coordinates[1])));
+            else if constexpr (Dimensions == 3)
+                result = evaluate(Float8(_mm256_load_ps(coordinates[0])), Float8(_mm256_load_ps(coordinates[1])),
+                                  Float8(_mm256_load_ps(coordinates[2])));
+            else
+                result = evaluate(Float8(_mm256_load_ps(coordinates[0])), Float8(_mm256_load_ps(coordinates[1])),
+                                  Float8(_mm256_load_ps(coordinates[2])), Float8(_mm256_load_ps(coordinates[3])));
+
+            if (lanes == BATCH_SIZE)
+            {
+                _mm256_storeu_ps(out + i, result.v);
+            }
+            else
+            {
+                alignas(32) float tail[BATCH_SIZE];
+                _mm256_store_ps(tail, result.v);
+                std::copy(tail, tail + lanes, out + i);
+            }
+        }
+#else
+        for (size_t i = begin; i < end; ++i)
+        {
+            const Point& point = points[i];
+            if constexpr (Dimensions == 2)
+                out[i] = evaluate(Component(point, 0), Component(point, 1));
+            else if constexpr (Dimensions == 3)
+                out[i] = evaluate(Component(point, 0), Component(point, 1), Component(point, 2));
+            else
+                out[i] = evaluate(Component(point, 0), Component(point, 1), Component(point, 2), Component(point, 3));
+        }
+#endif
+    });
+}
+} // namespace
+
+float Noise::Perlin(float x, float y, uint32_t seed)
+{
+    return PerlinKernel(x, y, seed);
+}
+
+float Noise::Perlin(float x, float y, float z, uint32_t seed)
+{
+    return PerlinKernel(x, y, z, seed);
+}
+
+float Noise::Perlin(float x, float y, float z, float w, uint32_t seed)
+{
+    return PerlinKernel(x, y, z, w, seed);
+}
+
+float Noise::Simplex(float x, float y, uint32_t seed)
+{
+    return SimplexKernel(x, y, seed);
+}
+
+float Noise::Simplex(float x, float y, float z, uint32_t seed)
+{
+    return SimplexKernel(x, y, z, seed);
+}
+
+float Noise::Simplex(float x, float y, float z, float w, uint32_t seed)
+{
+    return SimplexKernel(x, y, z, w, seed);
+}
+
+float Noise::Fractal(const FractalSettings& settings, float x, float y)
+{
+    return FractalKernel<float>(settings, x, y);
+}
+
+float Noise::Fractal(const FractalSettings& settings, float x, float y, float z)
+{
+    return FractalKernel<float>(settings, x, y, z);
+}
+
+void Noise::Evaluate(NoiseType type, const Vector2* points, size_t count, float* out, uint32_t seed)
+{
+    EvaluatePoints<2>(points, count, out, [&](auto x, auto y) { return NoiseKernel(type, x, y, seed); });
+}
+
+void Noise::Evaluate(NoiseType type, const Vector3* points, size_t count, float* out, uint32_t seed)
+{
+    EvaluatePoints<3>(points, count, out, [&](auto x, auto y, auto z) { return NoiseKernel(type, x, y, z, seed); });
+}
+
+void Noise::Evaluate(NoiseType type, const Float4* points, size_t count, float* out, uint32_t seed)
+{
+    EvaluatePoints<4>(points, count, out,
+                      [&](auto x, auto y, auto z, auto w) { return NoiseKernel(type, x, y, z, w, seed); });
+}
+
+void Noise::Fractal(const FractalSettings& settings, const Vector2* points, size_t count, float* out)
+{
+    EvaluatePoints<2>(points, count, out,
+                      [&](auto x, auto y) { return FractalKernel<decltype(x)>(settings, x, y); });
+}
+
+void Noise::Fractal(const FractalSettings& settings, const Vector3* points, size_t count, float* out)
+{
+    EvaluatePoints<3>(points, count, out,
+                      [&](auto x, auto y, auto z) { return FractalKernel<decltype(x)>(settings, x, y, z); });
+}
+
+void Noise::GenerateImage(const FractalSettings& settings, const Vector2& origin, float spacing, size_t width,
+                          size_t height, float* outPixels)
+{
+    const size_t tilesX = (width + TILE_SIZE - 1) / TILE_SIZE;
+    const size_t tilesY = (height + TILE_SIZE - 1) / TILE_SIZE;
+    const float originX = origin.x;
+    const float originY = origin.y;
+
+    Threading::ParallelFor(tilesX * tilesY, 1, [&](size_t firstTile, size_t lastTile) {
+        for (size_t tile = firstTile; tile < lastTile; ++tile)
+        {
+            const size_t beginX = (tile % tilesX) * TILE_SIZE;
+            const size_t beginY = (tile / tilesX) * TILE_SIZE;
+            const size_t endX = std::min(beginX + TILE_SIZE, width);
+            const size_t endY = std::min(beginY + TILE_SIZE, height);
+
+            for (size_t py = beginY; py < endY; ++py)
+            {
+                const float y = originY + static_cast<float>(py) * spacing;
+                float* row = outPixels + py * width;
+#if defined(HERMIT_SIMD_AVX2)
+                const __m256 laneOffsets = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+                for (size_t px = beginX; px < endX; px += BATCH_SIZE)
+                {
+                    const __m256 column = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(px)), laneOffsets);
+                    const Float8 x = Float8(originX) + Float8(column) * Float8(spacing);
+                    const Float8 result = FractalKernel<Float8>(settings, x, Float8(y));
+
+                    const size_t lanes = std::min(BATCH_SIZE, endX - px);
+                    if (lanes == BATCH_SIZE)
+                    {
+                        _mm256_storeu_ps(row + px, result.v);
+                    }
+                    else
+                    {
+                        alignas(32) float tail[BATCH_SIZE];
+                        _mm256_store_ps(tail, result.v);
+                        std::copy(tail, tail + lanes, row + px);
+                    }
+                }
+#else
+                for (size_t px = beginX; px < endX; ++px)
+                {
+                    row[px] = FractalKernel<float>(settings, originX + static_cast<float>(px) * spacing, y);
+                }
+#endif
+            }
+        }
+    });
+}
+
+} // namespace Math
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "Math/Vector.h"
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Math
+{
+enum class NoiseType
+{
+    Perlin,
+    Simplex
+};
+
+/**
+ * @brief Fractal Brownian motion: octaves of noise at rising frequency
+ */
+struct FractalSettings
+{
+    NoiseType type = NoiseType::Simplex;
+    uint32_t octaves = 5;
+    float frequency = 1.0f;  // Of the first octave
+    float lacunarity = 2.0f; // Frequency multiplier per octave
+    float gain = 0.5f;       // Amplitude multiplier per octave
+    uint32_t seed = 0;
+};
+
+/**
+ * @brief Gradient (Perlin) and simplex noise in 2, 3 and 4 dimensions
+ *
+ * Lattice points are hashed arithmetically from their integer coordinates
+ * and a seed, so there is no permutation table and the noise does not repeat.
+ * Gradients are picked from the hash bits (Perlin's improved set in 3D,
+ * Gustavson's sets in 2D and 4D). Results lie approximately in [-1, 1].
+ *
+ * The single-point functions are the scalar reference. Batch functions and
+ * GenerateImage run the same kernels on BATCH_SIZE points at once with AVX2,
+ * and fall back to the reference otherwise; the two agree to within float
+ * rounding.
+ *
+ * Seeds are uint32_t; pass unsigned literals (Perlin(x, y, z, 1u)) since a
+ * plain int is as close to a float coordinate as to the seed.
+ */
+class Noise
+{
+  public:
+    static constexpr size_t BATCH_SIZE = 8;
+    static constexpr size_t TILE_SIZE = 64; // Pixels per side of a GenerateImage() task
+
+    static float Perlin(float x, float y, uint32_t seed = 0);
+    static float Perlin(float x, float y, float z, uint32_t seed = 0);
+    static float Perlin(float x, float y, float z, float w, uint32_t seed = 0);
+
+    static float Simplex(float x, float y, uint32_t seed = 0);
+    static float Simplex(float x, float y, float z, uint32_t seed = 0);
+    static float Simplex(float x, float y, float z, float w, uint32_t seed = 0);
+
+    /**
+     * @brief Evaluate fractal noise at one point
+     * @param settings Noise type and octaves
+     * @param x X coordinate (y, z likewise)
+     * @return Sum of the octaves divided by the sum of their amplitudes
+     */
+    static float Fractal(const FractalSettings& settings, float x, float y);
+    static float Fractal(const FractalSettings& settings, float x, float y, float z);
+
+    /**
+     * @brief Evaluate noise at many points
+     * @param type Noise to evaluate
+     * @param points Sample positions
+     * @param count Number of points
+     * @param out Receives count values
+     * @param seed Seed passed to every sample
+     */
+    static void Evaluate(NoiseType type, const Vector2* points, size_t count, float* out, uint32_t seed = 0);
+    static void Evaluate(NoiseType type, const Vector3* points, size_t count, float* out, uint32_t seed = 0);
+    static void Evaluate(NoiseType type, const Float4* points, size_t count, float* out, uint32_t seed = 0);
+
+    /**
+     * @brief Evaluate fractal noise at many points
+     * @param settings Noise type and octaves
+     * @param points Sample positions
+     * @param count Number of points
+     * @param out Receives count values
+     */
+    static void Fractal(const FractalSettings& settings, const Vector2* points, size_t count, float* out);
+    static void Fractal(const FractalSettings& settings, const Vector3* points, size_t count, float* out);
+
+    /**
+     * @brief Fill a float image with 2D fractal noise, split across threads
+     * @param settings Noise type and octaves
+     * @param origin Sample position of pixel (0, 0)
+     * @param spacing Distance between neighbouring pixels' samples
+     * @param width Image width in pixels
+     * @param height Image height in pixels
+     * @param outPixels Receives width * height values, row by row
+     * @note Work is split into TILE_SIZE square tiles; rows within a tile
+     *       are generated BATCH_SIZE pixels at a time without building
+     *       coordinate arrays
+     */
+    static void GenerateImage(const FractalSettings& settings, const Vector2& origin, float spacing, size_t width,
+                              size_t height, float* outPixels);
+};
+
+} // namespace Math
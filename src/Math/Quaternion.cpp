@@ -0,0 +1,140 @@
+#include "Math/Quaternion.h"
+#include <cmath>
+
+namespace Math
+{
+
+// Constructors
+Quaternion::Quaternion()
+    : x(0.0f), y(0.0f), z(0.0f), w(1.0f)
+{
+}
+
+Quaternion::Quaternion(float x, float y, float z, float w)
+    : x(x), y(y), z(z), w(w)
+{
+}
+
+// Arithmetic operators
+Quaternion Quaternion::operator*(const Quaternion& other) const
+{
+    return Quaternion(w * other.x + x * other.w + y * other.z - z * other.y,
+                      w * other.y - x * other.z + y * other.w + z * other.x,
+                      w * other.z + x * other.y - y * other.x + z * other.w,
+                      w * other.w - x * other.x - y * other.y - z * other.z);
+}
+
+Quaternion Quaternion::operator*(float scalar) const
+{
+    return Quaternion(x * scalar, y * scalar, z * scalar, w * scalar);
+}
+
+Quaternion Quaternion::operator+(const Quaternion& other) const
+{
+    return Quaternion(x + other.x, y + other.y, z + other.z, w + other.w);
+}
+
+// Comparison operators
+bool Quaternion::operator==(const Quaternion& other) const
+{
+    return x == other.x && y == other.y && z == other.z && w == other.w;
+}
+
+bool Quaternion::operator!=(const Quaternion& other) const
+{
+    return !(*this == other);
+}
+
+// Quaternion operations
+float Quaternion::Magnitude() const
+{
+    return std::sqrt(x * x + y * y + z * z + w * w);
+}
+
+void Quaternion::Normalize()
+{
+    const float magnitude = Magnitude();
+    if (magnitude > 0.0f)
+    {
+        const float inverse = 1.0f / magnitude;
+        x *= inverse;
+        y *= inverse;
+        z *= inverse;
+        w *= inverse;
+    }
+    else
+    {
+        *this = Identity();
+    }
+}
+
+Quaternion Quaternion::Normalized() const
+{
+    Quaternion result = *this;
+    result.Normalize();
+    return result;
+}
+
+Quaternion Quaternion::Conjugate() const
+{
+    return Quaternion(-x, -y, -z, w);
+}
+
+Vector3 Quaternion::Rotate(const Vector3& vector) const
+{
+    // v' = v + 2w(u x v) + 2u x (u x v), with u the vector part
+    const float tx = 2.0f * (y * vector.z - z * vector.y);
+    const float ty = 2.0f * (z * vector.x - x * vector.z);
+    const float tz = 2.0f * (x * vector.y - y * vector.x);
+    return Vector3(vector.x + w * tx + (y * tz - z * ty), vector.y + w * ty + (z * tx - x * tz),
+                   vector.z + w * tz + (x * ty - y * tx));
+}
+
+Matrix4x4 Quaternion::ToMatrix() const
+{
+    const float xx = x * x, yy = y * y, zz = z * z;
+    const float xy = x * y, xz = x * z, yz = y * z;
+    const float wx = w * x, wy = w * y, wz = w * z;
+
+    // Rows are the rotated basis vectors
+    return Matrix4x4(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f,
+                     2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f,
+                     2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f,
+                     0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+// Static utility functions
+Quaternion Quaternion::FromAxisAngle(const Vector3& axis, float angle)
+{
+    const float s = std::sin(angle * 0.5f);
+    return Quaternion(axis.x * s, axis.y * s, axis.z * s, std::cos(angle * 0.5f));
+}
+
+float Quaternion::Dot(const Quaternion& a, const Quaternion& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+Quaternion Quaternion::Slerp(const Quaternion& a, const Quaternion& b, float t)
+{
+    float cosine = Dot(a, b);
+    const float sign = cosine < 0.0f ? -1.0f : 1.0f;
+    cosine *= sign;
+
+    // Nearly parallel: fall back to normalized linear interpolation
+    if (cosine > 0.9995f)
+        return (a * (1.0f - t) + b * (sign * t)).Normalized();
+
+    const float angle = std::acos(cosine);
+    const float inverseSine = 1.0f / std::sin(angle);
+    const float weightA = std::sin((1.0f - t) * angle) * inverseSine;
+    const float weightB = std::sin(t * angle) * inverseSine * sign;
+    return (a * weightA + b * weightB).Normalized();
+}
+
+Quaternion Quaternion::Identity()
+{
+    return Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+} // namespace Math
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+
+namespace Math
+{
+/**
+ * @brief A rotation quaternion (x, y, z, w) with w as the scalar part
+ *
+ * Rotations follow the same handedness as Matrix4x4::RotationAxis(), so
+ * FromAxisAngle(axis, angle).ToMatrix() equals RotationAxis(axis, angle).
+ * The product a * b is the Hamilton product: it rotates by b first, then
+ * by a, which is the reverse of the matrix convention.
+ */
+class Quaternion
+{
+  public:
+    // Member variables
+    float x, y, z, w;
+
+    // Constructors
+    Quaternion(); // Identity
+    Quaternion(float x, float y, float z, float w);
+
+    // Arithmetic operators
+    Quaternion operator*(const Quaternion& other) const;
+    Quaternion operator*(float scalar) const;
+    Quaternion operator+(const Quaternion& other) const;
+
+    // Comparison operators
+    bool operator==(const Quaternion& other) const;
+    bool operator!=(const Quaternion& other) const;
+
+    /**
+     * @brief Calculate the magnitude (length) of the quaternion
+     */
+    float Magnitude() const;
+
+    /**
+     * @brief Normalize this quaternion in-place
+     * @note If the quaternion has zero length, it becomes the identity
+     */
+    void Normalize();
+
+    /**
+     * @brief Return a normalized copy of this quaternion
+     */
+    Quaternion Normalized() const;
+
+    /**
+     * @brief Return the conjugate, which is the inverse of a unit quaternion
+     */
+    Quaternion Conjugate() const;
+
+    /**
+     * @brief Rotate a vector by this quaternion
+     * @param vector Vector to rotate
+     * @return Rotated vector
+     * @note The quaternion should be normalized
+     */
+    Vector3 Rotate(const Vector3& vector) const;
+
+    /**
+     * @brief Convert to a rotation matrix
+     * @return Matrix that transforms row vectors like Rotate() does
+     * @note The quaternion should be normalized
+     */
+    Matrix4x4 ToMatrix() const;
+
+    // Static utility functions
+
+    /**
+     * @brief Create a rotation about an axis
+     * @param axis Axis of rotation (should be normalized)
+     * @param angle Angle in radians
+     * @return Unit quaternion
+     */
+    static Quaternion FromAxisAngle(const Vector3& axis, float angle);
+
+    /**
+     * @brief Calculate the dot product of two quaternions
+     */
+    static float Dot(const Quaternion& a, const Quaternion& b);
+
+    /**
+     * @brief Spherical linear interpolation along the shorter arc
+     * @param a Start rotation (should be normalized)
+     * @param b End rotation (should be normalized)
+     * @param t Interpolation parameter (0.0 = a, 1.0 = b)
+     * @return Normalized interpolated rotation
+     */
+    static Quaternion Slerp(const Quaternion& a, const Quaternion& b, float t);
+
+    static Quaternion Identity();
+};
+
+} // namespace Math
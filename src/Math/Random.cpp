@@ -0,0 +1,401 @@
+#include "Math/Random.h"
+#include "Math/Simd.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Math
+{
+namespace
+{
+constexpr size_t LANES = RandomStream::LANES;
+constexpr float TWO_PI = 6.28318530718f;
+constexpr float FLOAT_UNIT = 1.0f / 16777216.0f; // 2^-24, one step of the 24-bit mantissa
+
+uint64_t SplitMix64(uint64_t& state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+#if defined(HERMIT_SIMD_AVX2)
+// One xoshiro128+ step of every lane
+__m256i Step(uint32_t (*state)[LANES])
+{
+    __m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[0]));
+    __m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[1]));
+    __m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[2]));
+    __m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(state[3]));
+
+    const __m256i result = _mm256_add_epi32(s0, s3);
+    const __m256i t = _mm256_slli_epi32(s1, 9);
+    s2 = _mm256_xor_si256(s2, s0);
+    s3 = _mm256_xor_si256(s3, s1);
+    s1 = _mm256_xor_si256(s1, s2);
+    s0 = _mm256_xor_si256(s0, s3);
+    s2 = _mm256_xor_si256(s2, t);
+    s3 = _mm256_or_si256(_mm256_slli_epi32(s3, 11), _mm256_srli_epi32(s3, 21));
+
+    _mm256_store_si256(reinterpret_cast<__m256i*>(state[0]), s0);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(state[1]), s1);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(state[2]), s2);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(state[3]), s3);
+    return result;
+}
+
+__m256 ToUnitFloat(__m256i bits)
+{
+    return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(bits, 8)), _mm256_set1_ps(FLOAT_UNIT));
+}
+
+// Natural logarithm of positive normal floats: split off the exponent, then
+// a short atanh series on the mantissa centered on 1
+__m256 Log(__m256 x)
+{
+    const __m256i bits = _mm256_castps_si256(x);
+    __m256i exponent = _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127));
+    __m256 mantissa = _mm256_castsi256_ps(
+        _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+
+    // Move the mantissa from [1, 2) to [sqrt(1/2), sqrt(2))
+    const __m256 high = _mm256_cmp_ps(mantissa, _mm256_set1_ps(1.41421356f), _CMP_GT_OQ);
+    mantissa = _mm256_blendv_ps(mantissa, _mm256_mul_ps(mantissa, _mm256_set1_ps(0.5f)), high);
+    exponent = _mm256_sub_epi32(exponent, _mm256_castps_si256(high)); // The mask is -1 where set
+
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 f = _mm256_div_ps(_mm256_sub_ps(mantissa, one), _mm256_add_ps(mantissa, one));
+    const __m256 f2 = _mm256_mul_ps(f, f);
+    __m256 series = _mm256_set1_ps(2.0f / 9.0f);
+    series = _mm256_add_ps(_mm256_mul_ps(series, f2), _mm256_set1_ps(2.0f / 7.0f));
+    series = _mm256_add_ps(_mm256_mul_ps(series, f2), _mm256_set1_ps(2.0f / 5.0f));
+    series = _mm256_add_ps(_mm256_mul_ps(series, f2), _mm256_set1_ps(2.0f / 3.0f));
+    series = _mm256_add_ps(_mm256_mul_ps(series, f2), _mm256_set1_ps(2.0f));
+
+    return _mm256_add_ps(_mm256_mul_ps(series, f),
+                         _mm256_mul_ps(_mm256_cvtepi32_ps(exponent), _mm256_set1_ps(0.69314718056f)));
+}
+
+// Sine and cosine of 2 * pi * turns. Taylor series on the half angle, which
+// lies in [-pi/2, pi/2] after wrapping, then the double-angle formulas.
+void SinCosTurns(__m256 turns, __m256& outSin, __m256& outCos)
+{
+    const __m256 wrapped =
+        _mm256_sub_ps(turns, _mm256_round_ps(turns, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    const __m256 h = _mm256_mul_ps(wrapped, _mm256_set1_ps(3.14159265359f));
+    const __m256 h2 = _mm256_mul_ps(h, h);
+
+    __m256 s = _mm256_set1_ps(-1.0f / 39916800.0f);
+    s = _mm256_add_ps(_mm256_mul_ps(s, h2), _mm256_set1_ps(1.0f / 362880.0f));
+    s = _mm256_add_ps(_mm256_mul_ps(s, h2), _mm256_set1_ps(-1.0f / 5040.0f));
+    s = _mm256_add_ps(_mm256_mul_ps(s, h2), _mm256_set1_ps(1.0f / 120.0f));
+    s = _mm256_add_ps(_mm256_mul_ps(s, h2), _mm256_set1_ps(-1.0f / 6.0f));
+    s = _mm256_add_ps(_mm256_mul_ps(s, h2), _mm256_set1_ps(1.0f));
+    s = _mm256_mul_ps(s, h);
+
+    __m256 c = _mm256_set1_ps(1.0f / 479001600.0f);
+    c = _mm256_add_ps(_mm256_mul_ps(c, h2), _mm256_set1_ps(-1.0f / 3628800.0f));
+    c = _mm256_add_ps(_mm256_mul_ps(c, h2), _mm256_set1_ps(1.0f / 40320.0f));
+    c = _mm256_add_ps(_mm256_mul_ps(c, h2), _mm256_set1_ps(-1.0f / 720.0f));
+    c = _mm256_add_ps(_mm256_mul_ps(c, h2), _mm256_set1_ps(1.0f / 24.0f));
+    c = _mm256_add_ps(_mm256_mul_ps(c, h2), _mm256_set1_ps(-0.5f));
+    c = _mm256_add_ps(_mm256_mul_ps(c, h2), _mm256_set1_ps(1.0f));
+
+    const __m256 two = _mm256_set1_ps(2.0f);
+    outSin = _mm256_mul_ps(two, _mm256_mul_ps(s, c));
+    outCos = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(two, _mm256_mul_ps(s, s)));
+}
+
+// Uniform directions from two batches of uniforms
+void DirectionBatch(const float* u, const float* v, float* x, float* y, float* z)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 height = _mm256_sub_ps(one, _mm256_mul_ps(_mm256_set1_ps(2.0f), _mm256_loadu_ps(u)));
+    const __m256 radius =
+        _mm256_sqrt_ps(_mm256_max_ps(_mm256_setzero_ps(), _mm256_sub_ps(one, _mm256_mul_ps(height, height))));
+
+    __m256 sine, cosine;
+    SinCosTurns(_mm256_loadu_ps(v), sine, cosine);
+    _mm256_storeu_ps(x, _mm256_mul_ps(radius, cosine));
+    _mm256_storeu_ps(y, _mm256_mul_ps(radius, sine));
+    _mm256_storeu_ps(z, height);
+}
+
+// Uniform points on the unit disk, lifted onto the hemisphere around +Z
+void DiskBatch(const float* u, const float* v, float* x, float* y, float* z)
+{
+    const __m256 squared = _mm256_loadu_ps(u);
+    const __m256 radius = _mm256_sqrt_ps(squared);
+
+    __m256 sine, cosine;
+    SinCosTurns(_mm256_loadu_ps(v), sine, cosine);
+    _mm256_storeu_ps(x, _mm256_mul_ps(radius, cosine));
+    _mm256_storeu_ps(y, _mm256_mul_ps(radius, sine));
+    _mm256_storeu_ps(z, _mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), squared)));
+}
+
+// Box-Muller: 2 * LANES normal samples from two batches of uniforms
+void GaussianBatch(const float* u, const float* v, float* out)
+{
+    // 1 - u lies in (0, 1], so the logarithm is finite
+    const __m256 positive = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_loadu_ps(u));
+    const __m256 radius = _mm256_sqrt_ps(_mm256_mul_ps(_mm256_set1_ps(-2.0f), Log(positive)));
+
+    __m256 sine, cosine;
+    SinCosTurns(_mm256_loadu_ps(v), sine, cosine);
+    _mm256_storeu_ps(out, _mm256_mul_ps(radius, cosine));
+    _mm256_storeu_ps(out + LANES, _mm256_mul_ps(radius, sine));
+}
+#else
+void DirectionBatch(const float* u, const float* v, float* x, float* y, float* z)
+{
+    for (size_t i = 0; i < LANES; ++i)
+    {
+        const float height = 1.0f - 2.0f * u[i];
+        const float radius = std::sqrt(std::max(0.0f, 1.0f - height * height));
+        const float angle = TWO_PI * v[i];
+        x[i] = radius * std::cos(angle);
+        y[i] = radius * std::sin(angle);
+        z[i] = height;
+    }
+}
+
+void DiskBatch(const float* u, const float* v, float* x, float* y, float* z)
+{
+    for (size_t i = 0; i < LANES; ++i)
+    {
+        const float radius = std::sqrt(u[i]);
+        const float angle = TWO_PI * v[i];
+        x[i] = radius * std::cos(angle);
+        y[i] = radius * std::sin(angle);
+        z[i] = std::sqrt(1.0f - u[i]);
+    }
+}
+
+void GaussianBatch(const float* u, const float* v, float* out)
+{
+    for (size_t i = 0; i < LANES; ++i)
+    {
+        const float radius = std::sqrt(-2.0f * std::log(1.0f - u[i]));
+        const float angle = TWO_PI * v[i];
+        out[i] = radius * std::cos(angle);
+        out[i + LANES] = radius * std::sin(angle);
+    }
+}
+#endif
+
+// Runs batch(x, y, z) on every full batch of LANES elements, then once more
+// into scratch for the remainder
+template <typename Batch>
+void ForEachBatch(float* x, float* y, float* z, size_t count, Batch&& batch)
+{
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES)
+    {
+        batch(x + i, y + i, z + i);
+    }
+
+    if (i < count)
+    {
+        float tailX[LANES], tailY[LANES], tailZ[LANES];
+        batch(tailX, tailY, tailZ);
+        std::copy(tailX, tailX + (count - i), x + i);
+        std::copy(tailY, tailY + (count - i), y + i);
+        std::copy(tailZ, tailZ + (count - i), z + i);
+    }
+}
+} // namespace
+
+RandomStream::RandomStream(uint64_t seed, uint64_t stream)
+{
+    Seed(seed, stream);
+}
+
+void RandomStream::Seed(uint64_t seed, uint64_t stream)
+{
+    uint64_t streamState = stream;
+    uint64_t state = seed ^ SplitMix64(streamState);
+    for (size_t lane = 0; lane < LANES; ++lane)
+    {
+        const uint64_t low = SplitMix64(state);
+        const uint64_t high = SplitMix64(state);
+        m_state[0][lane] = static_cast<uint32_t>(low);
+        m_state[1][lane] = static_cast<uint32_t>(low >> 32);
+        m_state[2][lane] = static_cast<uint32_t>(high);
+        m_state[3][lane] = static_cast<uint32_t>(high >> 32);
+
+        // xoshiro has a single all-zero fixed point
+        if ((low | high) == 0)
+            m_state[0][lane] = 1;
+    }
+}
+
+#if defined(HERMIT_SIMD_AVX2)
+void RandomStream::Next8(uint32_t* out)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), Step(m_state));
+}
+
+void RandomStream::NextFloat8(float* out)
+{
+    _mm256_storeu_ps(out, ToUnitFloat(Step(m_state)));
+}
+#else
+void RandomStream::Next8(uint32_t* out)
+{
+    for (size_t lane = 0; lane < LANES; ++lane)
+    {
+        uint32_t& s0 = m_state[0][lane];
+        uint32_t& s1 = m_state[1][lane];
+        uint32_t& s2 = m_state[2][lane];
+        uint32_t& s3 = m_state[3][lane];
+
+        out[lane] = s0 + s3;
+        const uint32_t t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = (s3 << 11) | (s3 >> 21);
+    }
+}
+
+void RandomStream::NextFloat8(float* out)
+{
+    uint32_t bits[LANES];
+    Next8(bits);
+    for (size_t lane = 0; lane < LANES; ++lane)
+    {
+        out[lane] = static_cast<float>(bits[lane] >> 8) * FLOAT_UNIT;
+    }
+}
+#endif
+
+void RandomStream::NextFloat16(float* out)
+{
+    NextFloat8(out);
+    NextFloat8(out + LANES);
+}
+
+void RandomStream::FillUniform(float* out, size_t count, float low, float high)
+{
+    const float scale = high - low;
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES)
+    {
+        NextFloat8(out + i);
+    }
+
+    if (i < count)
+    {
+        float tail[LANES];
+        NextFloat8(tail);
+        std::copy(tail, tail + (count - i), out + i);
+    }
+
+    for (size_t j = 0; j < count; ++j)
+    {
+        out[j] = low + out[j] * scale;
+    }
+}
+
+void Sampling::UniformBox(RandomStream& stream, const BoundingBox& box, float* x, float* y, float* z, size_t count)
+{
+    const Vector3 size = box.max - box.min;
+    ForEachBatch(x, y, z, count, [&](float* batchX, float* batchY, float* batchZ) {
+        stream.NextFloat8(batchX);
+        stream.NextFloat8(batchY);
+        stream.NextFloat8(batchZ);
+        for (size_t i = 0; i < LANES; ++i)
+        {
+            batchX[i] = box.min.x + batchX[i] * size.x;
+            batchY[i] = box.min.y + batchY[i] * size.y;
+            batchZ[i] = box.min.z + batchZ[i] * size.z;
+        }
+    });
+}
+
+void Sampling::OnUnitSphere(RandomStream& stream, float* x, float* y, float* z, size_t count)
+{
+    ForEachBatch(x, y, z, count, [&](float* batchX, float* batchY, float* batchZ) {
+        float uniforms[2 * LANES];
+        stream.NextFloat16(uniforms);
+        DirectionBatch(uniforms, uniforms + LANES, batchX, batchY, batchZ);
+    });
+}
+
+void Sampling::InUnitSphere(RandomStream& stream, float* x, float* y, float* z, size_t count)
+{
+    ForEachBatch(x, y, z, count, [&](float* batchX, float* batchY, float* batchZ) {
+        float uniforms[5 * LANES];
+        stream.NextFloat16(uniforms);
+        stream.NextFloat16(uniforms + 2 * LANES);
+        stream.NextFloat8(uniforms + 4 * LANES);
+        DirectionBatch(uniforms, uniforms + LANES, batchX, batchY, batchZ);
+
+        const float* a = uniforms + 2 * LANES;
+        const float* b = uniforms + 3 * LANES;
+        const float* c = uniforms + 4 * LANES;
+        for (size_t i = 0; i < LANES; ++i)
+        {
+            const float radius = std::max(std::max(a[i], b[i]), c[i]);
+            batchX[i] *= radius;
+            batchY[i] *= radius;
+            batchZ[i] *= radius;
+        }
+    });
+}
+
+void Sampling::CosineHemisphere(RandomStream& stream, const Vector3& normal, float* x, float* y, float* z,
+                                size_t count)
+{
+    // Orthonormal basis around the normal without branches (Duff et al. 2017)
+    const float sign = std::copysign(1.0f, normal.z);
+    const float a = -1.0f / (sign + normal.z);
+    const float b = normal.x * normal.y * a;
+    const float tangent[3] = {1.0f + sign * normal.x * normal.x * a, sign * b, -sign * normal.x};
+    const float bitangent[3] = {b, sign + normal.y * normal.y * a, -normal.y};
+    const float axis[3] = {normal.x, normal.y, normal.z};
+
+    ForEachBatch(x, y, z, count, [&](float* batchX, float* batchY, float* batchZ) {
+        float uniforms[2 * LANES];
+        float localX[LANES], localY[LANES], localZ[LANES];
+        stream.NextFloat16(uniforms);
+        DiskBatch(uniforms, uniforms + LANES, localX, localY, localZ);
+
+        for (size_t i = 0; i < LANES; ++i)
+        {
+            batchX[i] = tangent[0] * localX[i] + bitangent[0] * localY[i] + axis[0] * localZ[i];
+            batchY[i] = tangent[1] * localX[i] + bitangent[1] * localY[i] + axis[1] * localZ[i];
+            batchZ[i] = tangent[2] * localX[i] + bitangent[2] * localY[i] + axis[2] * localZ[i];
+        }
+    });
+}
+
+void Sampling::Gaussian(RandomStream& stream, float* out, size_t count, float mean, float standardDeviation)
+{
+    size_t i = 0;
+    for (; i + 2 * LANES <= count; i += 2 * LANES)
+    {
+        float uniforms[2 * LANES];
+        stream.NextFloat16(uniforms);
+        GaussianBatch(uniforms, uniforms + LANES, out + i);
+    }
+
+    if (i < count)
+    {
+        float uniforms[2 * LANES];
+        float tail[2 * LANES];
+        stream.NextFloat16(uniforms);
+        GaussianBatch(uniforms, uniforms + LANES, tail);
+        std::copy(tail, tail + (count - i), out + i);
+    }
+
+    for (size_t j = 0; j < count; ++j)
+    {
+        out[j] = mean + out[j] * standardDeviation;
+    }
+}
+
+} // namespace Math
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Math/BoundingBox.h"
+#include "Math/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Math
+{
+/**
+ * @brief Eight interleaved xoshiro128+ generators that produce values in batches
+ *
+ * Each lane is an independent 32-bit xoshiro128+ state, so one step yields
+ * eight values and maps onto a single AVX2 register (a scalar loop runs the
+ * same lanes otherwise, and both paths produce the same sequence). Floats use
+ * the top 24 bits, which avoids the weak low bits of the '+' scrambler.
+ *
+ * A stream is not thread-safe; give each thread its own, seeded with the same
+ * seed and a different stream index.
+ */
+class RandomStream
+{
+  public:
+    static constexpr size_t LANES = 8;
+
+    /**
+     * @brief Seed a stream
+     * @param seed Base seed
+     * @param stream Index that selects an independent sequence for the same seed
+     */
+    explicit RandomStream(uint64_t seed = 0x853C49E6748FEA9Bull, uint64_t stream = 0);
+
+    void Seed(uint64_t seed, uint64_t stream = 0);
+
+    /**
+     * @brief Generate one value per lane
+     * @param out Receives LANES uniformly distributed 32-bit values
+     */
+    void Next8(uint32_t* out);
+
+    /**
+     * @brief Generate uniform floats in [0, 1)
+     * @param out Receives LANES floats (NextFloat16: 2 * LANES)
+     */
+    void NextFloat8(float* out);
+    void NextFloat16(float* out);
+
+    /**
+     * @brief Fill an array with uniform floats in [low, high)
+     * @param out Destination
+     * @param count Number of floats
+     * @param low Inclusive lower bound
+     * @param high Exclusive upper bound
+     */
+    void FillUniform(float* out, size_t count, float low = 0.0f, float high = 1.0f);
+
+  private:
+    alignas(32) uint32_t m_state[4][LANES];
+};
+
+/**
+ * @brief Sampling distributions that write batches into SoA component arrays
+ *
+ * Samplers consume whole batches, so splitting a count across calls gives
+ * the same samples as one call when every part is a multiple of the batch:
+ * RandomStream::LANES points for the point and direction samplers, and
+ * 2 * LANES values for Gaussian(). Trigonometry and logarithms use polynomial
+ * approximations (error below 1e-6) on AVX2 and the standard library
+ * otherwise.
+ */
+class Sampling
+{
+  public:
+    /**
+     * @brief Points uniformly distributed inside a box
+     * @param stream Random source
+     * @param box Region to sample
+     * @param x Receives count X components (y and z likewise)
+     * @param count Number of points
+     */
+    static void UniformBox(RandomStream& stream, const BoundingBox& box, float* x, float* y, float* z, size_t count);
+
+    /**
+     * @brief Unit vectors uniformly distributed over the sphere
+     */
+    static void OnUnitSphere(RandomStream& stream, float* x, float* y, float* z, size_t count);
+
+    /**
+     * @brief Points uniformly distributed inside the unit ball
+     * @note The radius is the largest of three uniforms, whose density is
+     *       proportional to r squared, so no cube root is needed
+     */
+    static void InUnitSphere(RandomStream& stream, float* x, float* y, float* z, size_t count);
+
+    /**
+     * @brief Unit vectors with density proportional to the cosine to a normal
+     * @param normal Hemisphere axis (unit length)
+     * @note Samples a disk uniformly and projects it up (Malley's method)
+     */
+    static void CosineHemisphere(RandomStream& stream, const Vector3& normal, float* x, float* y, float* z,
+                                 size_t count);
+
+    /**
+     * @brief Normally distributed floats
+     * @param out Destination
+     * @param count Number of floats
+     * @param mean Distribution mean
+     * @param standardDeviation Distribution standard deviation
+     * @note Box-Muller; every pair of uniforms yields two samples
+     */
+    static void Gaussian(RandomStream& stream, float* out, size_t count, float mean = 0.0f,
+                         float standardDeviation = 1.0f);
+};
+
+} // namespace Math
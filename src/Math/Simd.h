@@ -0,0 +1,28 @@
+#pragma once
+
+// Compile-time SIMD feature detection shared by the vectorized kernels.
+// Every kernel keeps a scalar path, so these only select faster code.
+//
+// MSVC does not define __SSE2__/__SSSE3__; x64 always has SSE2, and
+// /arch:AVX2 defines __AVX2__ which implies the older extensions.
+
+#if defined(__AVX2__)
+#define HERMIT_SIMD_AVX2 1
+#endif
+
+// BMI2 (PDEP/PEXT) ships with every AVX2 CPU; MSVC has no __BMI2__ macro
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define HERMIT_SIMD_BMI2 1
+#endif
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+#define HERMIT_SIMD_SSSE3 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HERMIT_SIMD_SSE2 1
+#endif
+
+#if defined(HERMIT_SIMD_SSE2)
+#include <immintrin.h>
+#endif
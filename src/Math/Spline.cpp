@@ -0,0 +1,346 @@
+#include "Math/Spline.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Math
+{
+namespace
+{
+constexpr size_t GRAIN_SIZE = 4096;
+
+// Basis matrices: row k holds the weights of the four control points in the
+// coefficient of u^k
+constexpr float CATMULL_ROM_BASIS[4][4] = {
+    {0.0f, 1.0f, 0.0f, 0.0f}, {-0.5f, 0.0f, 0.5f, 0.0f}, {1.0f, -2.5f, 2.0f, -0.5f}, {-0.5f, 1.5f, -1.5f, 0.5f}};
+constexpr float BEZIER_BASIS[4][4] = {
+    {1.0f, 0.0f, 0.0f, 0.0f}, {-3.0f, 3.0f, 0.0f, 0.0f}, {3.0f, -6.0f, 3.0f, 0.0f}, {-1.0f, 3.0f, -3.0f, 1.0f}};
+constexpr float B_SPLINE_BASIS[4][4] = {{1.0f / 6.0f, 4.0f / 6.0f, 1.0f / 6.0f, 0.0f},
+                                        {-0.5f, 0.0f, 0.5f, 0.0f},
+                                        {0.5f, -1.0f, 0.5f, 0.0f},
+                                        {-1.0f / 6.0f, 0.5f, -0.5f, 1.0f / 6.0f}};
+
+// Five-point Gauss-Legendre quadrature on [-1, 1]; exact for polynomials up
+// to degree 9, which the speed of a cubic is close to on short intervals
+constexpr float GAUSS_NODES[5] = {-0.9061798459f, -0.5384693101f, 0.0f, 0.5384693101f, 0.9061798459f};
+constexpr float GAUSS_WEIGHTS[5] = {0.2369268851f, 0.4786286705f, 0.5688888889f, 0.4786286705f, 0.2369268851f};
+
+float Component(const Vector3& v, int axis)
+{
+    return axis == 0 ? v.x : (axis == 1 ? v.y : v.z);
+}
+
+void EvaluateSegment(const float (&c)[4][3], float u, Vector3* outPosition, Vector3* outTangent)
+{
+    if (outPosition)
+    {
+        outPosition->x = ((c[3][0] * u + c[2][0]) * u + c[1][0]) * u + c[0][0];
+        outPosition->y = ((c[3][1] * u + c[2][1]) * u + c[1][1]) * u + c[0][1];
+        outPosition->z = ((c[3][2] * u + c[2][2]) * u + c[1][2]) * u + c[0][2];
+    }
+    if (outTangent)
+    {
+        outTangent->x = (3.0f * c[3][0] * u + 2.0f * c[2][0]) * u + c[1][0];
+        outTangent->y = (3.0f * c[3][1] * u + 2.0f * c[2][1]) * u + c[1][1];
+        outTangent->z = (3.0f * c[3][2] * u + 2.0f * c[2][2]) * u + c[1][2];
+    }
+}
+} // namespace
+
+Spline::Spline() : m_type(SplineType::CatmullRom), m_tableResolution(DEFAULT_TABLE_RESOLUTION)
+{
+}
+
+bool Spline::Build(SplineType type, const Vector3* controlPoints, size_t count, uint32_t tableResolution)
+{
+    m_type = type;
+    m_segments.clear();
+    m_arcLengths.clear();
+    if (count < 4 || (type == SplineType::Bezier && (count - 1) % 3 != 0) || tableResolution == 0)
+    {
+        return false;
+    }
+
+    // Bezier segments advance by three points and share end points; the other
+    // types slide a four-point window by one
+    const float(*basis)[4] = type == SplineType::CatmullRom ? CATMULL_ROM_BASIS
+                             : type == SplineType::Bezier   ? BEZIER_BASIS
+                                                            : B_SPLINE_BASIS;
+    const size_t stride = type == SplineType::Bezier ? 3 : 1;
+    const size_t segmentCount = type == SplineType::Bezier ? (count - 1) / 3 : count - 3;
+
+    m_segments.resize(segmentCount);
+    for (size_t i = 0; i < segmentCount; ++i)
+    {
+        const Vector3* points = controlPoints + i * stride;
+        Segment& segment = m_segments[i];
+        for (int k = 0; k < 4; ++k)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                float sum = 0.0f;
+                for (int j = 0; j < 4; ++j)
+                {
+                    sum += basis[k][j] * Component(points[j], axis);
+                }
+                segment.c[k][axis] = sum;
+            }
+        }
+    }
+
+    BuildArcLengthTable(tableResolution);
+    return true;
+}
+
+bool Spline::Build(SplineType type, const std::vector<Vector3>& controlPoints, uint32_t tableResolution)
+{
+    return Build(type, controlPoints.data(), controlPoints.size(), tableResolution);
+}
+
+SplineType Spline::GetType() const
+{
+    return m_type;
+}
+
+size_t Spline::GetSegmentCount() const
+{
+    return m_segments.size();
+}
+
+void Spline::Locate(float t, size_t& outSegment, float& outU) const
+{
+    const float end = static_cast<float>(m_segments.size());
+    t = std::min(std::max(t, 0.0f), end);
+    outSegment = std::min(static_cast<size_t>(t), m_segments.size() - 1);
+    outU = t - static_cast<float>(outSegment);
+}
+
+Vector3 Spline::Evaluate(float t) const
+{
+    Vector3 position;
+    if (!m_segments.empty())
+    {
+        size_t segment;
+        float u;
+        Locate(t, segment, u);
+        EvaluateSegment(m_segments[segment].c, u, &position, nullptr);
+    }
+    return position;
+}
+
+Vector3 Spline::Tangent(float t) const
+{
+    Vector3 tangent;
+    if (!m_segments.empty())
+    {
+        size_t segment;
+        float u;
+        Locate(t, segment, u);
+        EvaluateSegment(m_segments[segment].c, u, nullptr, &tangent);
+    }
+    return tangent;
+}
+
+void Spline::Evaluate(const float* parameters, size_t count, Vector3* outPositions, Vector3* outTangents) const
+{
+    if (m_segments.empty())
+    {
+        std::fill(outPositions, outPositions + count, Vector3());
+        if (outTangents)
+        {
+            std::fill(outTangents, outTangents + count, Vector3());
+        }
+        return;
+    }
+
+    Threading::ParallelFor(count, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            size_t segment;
+            float u;
+            Locate(parameters[i], segment, u);
+            EvaluateSegment(m_segments[segment].c, u, outPositions + i, outTangents ? outTangents + i : nullptr);
+        }
+    });
+}
+
+float Spline::Speed(float t) const
+{
+    size_t segment;
+    float u;
+    Locate(t, segment, u);
+    const float(&c)[4][3] = m_segments[segment].c;
+    const float dx = (3.0f * c[3][0] * u + 2.0f * c[2][0]) * u + c[1][0];
+    const float dy = (3.0f * c[3][1] * u + 2.0f * c[2][1]) * u + c[1][1];
+    const float dz = (3.0f * c[3][2] * u + 2.0f * c[2][2]) * u + c[1][2];
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+float Spline::IntegrateSpeed(float t0, float t1) const
+{
+    const float halfWidth = 0.5f * (t1 - t0);
+    const float center = 0.5f * (t0 + t1);
+    float sum = 0.0f;
+    for (int i = 0; i < 5; ++i)
+    {
+        sum += GAUSS_WEIGHTS[i] * Speed(center + halfWidth * GAUSS_NODES[i]);
+    }
+    return sum * halfWidth;
+}
+
+void Spline::BuildArcLengthTable(uint32_t resolution)
+{
+    m_tableResolution = resolution;
+    const size_t sampleCount = m_segments.size() * resolution;
+    m_arcLengths.resize(sampleCount + 1);
+    m_arcLengths[0] = 0.0f;
+
+    // Accumulate in double so long paths do not lose short intervals
+    const float step = 1.0f / static_cast<float>(resolution);
+    double length = 0.0;
+    for (size_t i = 0; i < sampleCount; ++i)
+    {
+        const float t0 = static_cast<float>(i / resolution) + static_cast<float>(i % resolution) * step;
+        length += IntegrateSpeed(t0, t0 + step);
+        m_arcLengths[i + 1] = static_cast<float>(length);
+    }
+}
+
+float Spline::GetLength() const
+{
+    return m_arcLengths.empty() ? 0.0f : m_arcLengths.back();
+}
+
+float Spline::GetParameterAtDistance(float distance) const
+{
+    if (m_arcLengths.size() < 2 || distance <= 0.0f)
+    {
+        return 0.0f;
+    }
+    if (distance >= m_arcLengths.back())
+    {
+        return static_cast<float>(m_segments.size());
+    }
+
+    // Sample interval [i, i + 1] holding the distance
+    const size_t i =
+        static_cast<size_t>(std::upper_bound(m_arcLengths.begin(), m_arcLengths.end(), distance) - m_arcLengths.begin()) -
+        1;
+    const float step = 1.0f / static_cast<float>(m_tableResolution);
+    const float t0 = static_cast<float>(i / m_tableResolution) + static_cast<float>(i % m_tableResolution) * step;
+    const float intervalLength = m_arcLengths[i + 1] - m_arcLengths[i];
+    if (intervalLength <= 0.0f)
+    {
+        return t0;
+    }
+
+    // Linear guess, then one Newton step on length(t) - distance
+    float t = t0 + step * (distance - m_arcLengths[i]) / intervalLength;
+    const float speed = Speed(t);
+    if (speed > 0.0f)
+    {
+        const float error = m_arcLengths[i] + IntegrateSpeed(t0, t) - distance;
+        t = std::min(std::max(t - error / speed, t0), t0 + step);
+    }
+    return t;
+}
+
+void Spline::EvaluateAtDistances(const float* distances, size_t count, Vector3* outPositions,
+                                 Vector3* outTangents) const
+{
+    if (m_segments.empty())
+    {
+        Evaluate(distances, count, outPositions, outTangents);
+        return;
+    }
+
+    Threading::ParallelFor(count, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            size_t segment;
+            float u;
+            Locate(GetParameterAtDistance(distances[i]), segment, u);
+            EvaluateSegment(m_segments[segment].c, u, outPositions + i, outTangents ? outTangents + i : nullptr);
+        }
+    });
+}
+
+SplineStepper::SplineStepper(const Spline& spline, uint32_t stepsPerSegment)
+    : m_spline(spline), m_stepsPerSegment(std::max(stepsPerSegment, 1u)), m_segment(0), m_step(0),
+      m_finished(spline.m_segments.empty())
+{
+}
+
+void SplineStepper::StartSegment()
+{
+    // For p(u) = a + b u + c u^2 + d u^3 and step h:
+    //   d1 = b h + c h^2 + d h^3, d2 = 2 c h^2 + 6 d h^3, d3 = 6 d h^3
+    // and for the tangent p'(u) = b + 2 c u + 3 d u^2:
+    //   e1 = 2 c h + 3 d h^2, e2 = 6 d h^2
+    const float(&c)[4][3] = m_spline.m_segments[m_segment].c;
+    const float h = 1.0f / static_cast<float>(m_stepsPerSegment);
+    const float h2 = h * h;
+    const float h3 = h2 * h;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        m_position[axis] = c[0][axis];
+        m_d1[axis] = c[1][axis] * h + c[2][axis] * h2 + c[3][axis] * h3;
+        m_d2[axis] = 2.0f * c[2][axis] * h2 + 6.0f * c[3][axis] * h3;
+        m_d3[axis] = 6.0f * c[3][axis] * h3;
+
+        m_tangent[axis] = c[1][axis];
+        m_e1[axis] = 2.0f * c[2][axis] * h + 3.0f * c[3][axis] * h2;
+        m_e2[axis] = 6.0f * c[3][axis] * h2;
+    }
+}
+
+bool SplineStepper::Next(Vector3& outPosition)
+{
+    Vector3 tangent;
+    return Next(outPosition, tangent);
+}
+
+bool SplineStepper::Next(Vector3& outPosition, Vector3& outTangent)
+{
+    if (m_finished)
+    {
+        return false;
+    }
+
+    // The end point of the last segment is evaluated directly
+    if (m_segment == m_spline.m_segments.size())
+    {
+        EvaluateSegment(m_spline.m_segments.back().c, 1.0f, &outPosition, &outTangent);
+        m_finished = true;
+        return true;
+    }
+
+    if (m_step == 0)
+    {
+        StartSegment();
+    }
+
+    outPosition.x = m_position[0];
+    outPosition.y = m_position[1];
+    outPosition.z = m_position[2];
+    outTangent.x = m_tangent[0];
+    outTangent.y = m_tangent[1];
+    outTangent.z = m_tangent[2];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        m_position[axis] += m_d1[axis];
+        m_d1[axis] += m_d2[axis];
+        m_d2[axis] += m_d3[axis];
+        m_tangent[axis] += m_e1[axis];
+        m_e1[axis] += m_e2[axis];
+    }
+
+    if (++m_step == m_stepsPerSegment)
+    {
+        m_step = 0;
+        ++m_segment;
+    }
+    return true;
+}
+
+} // namespace Math
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "Math/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Math
+{
+enum class SplineType
+{
+    CatmullRom, // Passes through every control point except the first and last
+    Bezier,     // Cubic segments sharing end points: 3n + 1 control points
+    BSpline     // Uniform cubic B-spline; smooth but approximating
+};
+
+/**
+ * @brief Piecewise cubic curve over Vector3 control points
+ *
+ * Every segment is converted to power-basis coefficients when the spline is
+ * built, so all three types evaluate with the same Horner loop. The global
+ * parameter t runs from 0 to GetSegmentCount(); segment i covers [i, i + 1].
+ *
+ * Build() also tabulates arc length against t, which maps distances along
+ * the curve back to parameters for constant-speed traversal.
+ */
+class Spline
+{
+  public:
+    static constexpr uint32_t DEFAULT_TABLE_RESOLUTION = 16; // Arc-length samples per segment
+
+    Spline();
+
+    /**
+     * @brief Convert control points into segments and build the arc-length table
+     * @param type Curve type
+     * @param controlPoints Control points
+     * @param count Number of control points: at least 4, and 3n + 1 for Bezier
+     * @param tableResolution Arc-length samples per segment
+     * @return False (leaving the spline empty) if the count does not fit the type
+     */
+    bool Build(SplineType type, const Vector3* controlPoints, size_t count,
+               uint32_t tableResolution = DEFAULT_TABLE_RESOLUTION);
+    bool Build(SplineType type, const std::vector<Vector3>& controlPoints,
+               uint32_t tableResolution = DEFAULT_TABLE_RESOLUTION);
+
+    SplineType GetType() const;
+    size_t GetSegmentCount() const;
+
+    /**
+     * @brief Evaluate the curve
+     * @param t Parameter, clamped to [0, GetSegmentCount()]
+     * @return Position at t (Tangent: derivative with respect to t, not normalized)
+     */
+    Vector3 Evaluate(float t) const;
+    Vector3 Tangent(float t) const;
+
+    /**
+     * @brief Evaluate the curve at many parameters, split across threads
+     * @param parameters Parameters, in any order
+     * @param count Number of parameters
+     * @param outPositions Receives count positions
+     * @param outTangents Receives count tangents; may be null
+     */
+    void Evaluate(const float* parameters, size_t count, Vector3* outPositions, Vector3* outTangents = nullptr) const;
+
+    /**
+     * @brief Total arc length, from the table
+     */
+    float GetLength() const;
+
+    /**
+     * @brief Map a distance along the curve to a parameter
+     * @param distance Arc length from the start, clamped to [0, GetLength()]
+     * @return Parameter t at that distance
+     * @note Interpolates the table, then refines with one Newton step, so
+     *       the error is far below the table spacing except near cusps,
+     *       where the speed drops to zero
+     */
+    float GetParameterAtDistance(float distance) const;
+
+    /**
+     * @brief Evaluate the curve at many arc-length distances
+     * @param distances Distances from the start
+     * @param count Number of distances
+     * @param outPositions Receives count positions
+     * @param outTangents Receives count tangents; may be null
+     */
+    void EvaluateAtDistances(const float* distances, size_t count, Vector3* outPositions,
+                             Vector3* outTangents = nullptr) const;
+
+  private:
+    friend class SplineStepper;
+
+    // p(u) = c[0] + c[1] u + c[2] u^2 + c[3] u^3 for u in [0, 1]
+    struct Segment
+    {
+        float c[4][3];
+    };
+
+    void Locate(float t, size_t& outSegment, float& outU) const;
+    float Speed(float t) const;
+    float IntegrateSpeed(float t0, float t1) const;
+    void BuildArcLengthTable(uint32_t resolution);
+
+    SplineType m_type;
+    std::vector<Segment> m_segments;
+    std::vector<float> m_arcLengths; // Cumulative length at t = i / m_tableResolution
+    uint32_t m_tableResolution;
+};
+
+/**
+ * @brief Steps along a spline at fixed parameter increments by forward differencing
+ *
+ * Each step costs three vector additions instead of a cubic evaluation.
+ * Differences restart from the exact coefficients at every segment, so
+ * rounding does not accumulate along the whole curve.
+ */
+class SplineStepper
+{
+  public:
+    /**
+     * @brief Prepare to step through a spline
+     * @param spline Spline to traverse; must outlive the stepper
+     * @param stepsPerSegment Parameter steps per segment (at least 1)
+     * @note Produces GetSegmentCount() * stepsPerSegment + 1 points, from t = 0
+     *       to the end of the last segment inclusive
+     */
+    SplineStepper(const Spline& spline, uint32_t stepsPerSegment);
+
+    /**
+     * @brief Produce the next point
+     * @param outPosition Receives the position
+     * @param outTangent Receives the derivative with respect to t
+     * @return False once every point has been produced
+     */
+    bool Next(Vector3& outPosition);
+    bool Next(Vector3& outPosition, Vector3& outTangent);
+
+  private:
+    void StartSegment();
+
+    const Spline& m_spline;
+    uint32_t m_stepsPerSegment;
+    size_t m_segment;
+    uint32_t m_step;
+    bool m_finished;
+
+    // Position and its first three forward differences; tangent and its two
+    float m_position[3], m_d1[3], m_d2[3], m_d3[3];
+    float m_tangent[3], m_e1[3], m_e2[3];
+};
+
+} // namespace Math
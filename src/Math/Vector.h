@@ -0,0 +1,532 @@
+#pragma once
+
+#include "Math/Simd.h"
+#include "Math/Vector2.h"
+#include "Math/Vector3.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace Math
+{
+// Named component storage; x, y, z, w alias element indices 0-3
+template <typename T, size_t N>
+struct VectorStorage
+{
+    T elements[N];
+
+    constexpr T& At(size_t i) { return elements[i]; }
+    constexpr const T& At(size_t i) const { return elements[i]; }
+};
+
+template <typename T>
+struct alignas(sizeof(T) * 2 == 16 ? 16 : alignof(T)) VectorStorage<T, 2>
+{
+    T x, y;
+
+    constexpr T& At(size_t i) { return i == 0 ? x : y; }
+    constexpr const T& At(size_t i) const { return i == 0 ? x : y; }
+};
+
+template <typename T>
+struct VectorStorage<T, 3>
+{
+    T x, y, z;
+
+    constexpr T& At(size_t i) { return i == 0 ? x : (i == 1 ? y : z); }
+    constexpr const T& At(size_t i) const { return i == 0 ? x : (i == 1 ? y : z); }
+};
+
+template <typename T>
+struct alignas(sizeof(T) * 4 == 16 ? 16 : alignof(T)) VectorStorage<T, 4>
+{
+    T x, y, z, w;
+
+    constexpr T& At(size_t i) { return i == 0 ? x : (i == 1 ? y : (i == 2 ? z : w)); }
+    constexpr const T& At(size_t i) const { return i == 0 ? x : (i == 1 ? y : (i == 2 ? z : w)); }
+};
+
+/**
+ * @brief A fixed-size vector of N arithmetic components
+ *
+ * Complements the float-only Vector2/Vector3 API types: every operation is
+ * constexpr, integer vectors serve as grid and tile coordinates, and double
+ * vectors hold large-world positions. float4, int4 and double2 are 16-byte
+ * aligned and use SSE registers at run time (see VectorSimd below).
+ */
+template <typename T, size_t N>
+struct Vector : VectorStorage<T, N>
+{
+    static_assert(std::is_arithmetic<T>::value, "Vector components must be arithmetic");
+    static_assert(N >= 2, "Vector needs at least two components");
+
+    using ValueType = T;
+    static constexpr size_t SIZE = N;
+
+    // Zero vector
+    constexpr Vector() : VectorStorage<T, N>{} {}
+
+    // One value per component, e.g. Int3(x, y, z)
+    template <typename... Args, typename = std::enable_if_t<sizeof...(Args) == N && (N > 1)>>
+    constexpr Vector(Args... args) : VectorStorage<T, N>{static_cast<T>(args)...}
+    {
+    }
+
+    // Component-wise conversion from another component type
+    template <typename U>
+    constexpr explicit Vector(const Vector<U, N>& other) : VectorStorage<T, N>{}
+    {
+        for (size_t i = 0; i < N; ++i)
+        {
+            (*this)[i] = static_cast<T>(other[i]);
+        }
+    }
+
+    constexpr T& operator[](size_t i) { return this->At(i); }
+    constexpr const T& operator[](size_t i) const { return this->At(i); }
+
+    // The same value in every component
+    static constexpr Vector Splat(T value)
+    {
+        Vector result;
+        for (size_t i = 0; i < N; ++i)
+        {
+            result[i] = value;
+        }
+        return result;
+    }
+
+    static constexpr Vector Zero() { return Vector(); }
+    static constexpr Vector One() { return Splat(T(1)); }
+
+    // Compound assignment operators
+    constexpr Vector& operator+=(const Vector& other) { return *this = *this + other; }
+    constexpr Vector& operator-=(const Vector& other) { return *this = *this - other; }
+    constexpr Vector& operator*=(const Vector& other) { return *this = *this * other; }
+    constexpr Vector& operator/=(const Vector& other) { return *this = *this / other; }
+    constexpr Vector& operator*=(T scalar) { return *this = *this * scalar; }
+    constexpr Vector& operator/=(T scalar) { return *this = *this / scalar; }
+};
+
+using Float2 = Vector<float, 2>;
+using Float3 = Vector<float, 3>;
+using Float4 = Vector<float, 4>;
+using Double2 = Vector<double, 2>;
+using Double3 = Vector<double, 3>;
+using Double4 = Vector<double, 4>;
+using Int2 = Vector<int32_t, 2>;
+using Int3 = Vector<int32_t, 3>;
+using Int4 = Vector<int32_t, 4>;
+
+// ---------------------------------------------------------------------------
+// SIMD paths for the register-sized vectors
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Run-time SIMD implementations, specialized per (T, N)
+ *
+ * ENABLED is false for shapes without a dedicated path; the generic
+ * component loops are used for those and inside constant expressions.
+ */
+template <typename T, size_t N>
+struct VectorSimd
+{
+    static constexpr bool ENABLED = false;
+};
+
+#if defined(HERMIT_SIMD_SSE2)
+template <>
+struct VectorSimd<float, 4>
+{
+    static constexpr bool ENABLED = true;
+    using V = Float4;
+
+    static __m128 Load(const V& v) { return _mm_load_ps(&v.x); }
+    static V Store(__m128 r)
+    {
+        V v;
+        _mm_store_ps(&v.x, r);
+        return v;
+    }
+
+    static V Add(const V& a, const V& b) { return Store(_mm_add_ps(Load(a), Load(b))); }
+    static V Subtract(const V& a, const V& b) { return Store(_mm_sub_ps(Load(a), Load(b))); }
+    static V Multiply(const V& a, const V& b) { return Store(_mm_mul_ps(Load(a), Load(b))); }
+    static V Divide(const V& a, const V& b) { return Store(_mm_div_ps(Load(a), Load(b))); }
+    static V Min(const V& a, const V& b) { return Store(_mm_min_ps(Load(a), Load(b))); }
+    static V Max(const V& a, const V& b) { return Store(_mm_max_ps(Load(a), Load(b))); }
+
+    static float Dot(const V& a, const V& b)
+    {
+        __m128 product = _mm_mul_ps(Load(a), Load(b));
+        product = _mm_add_ps(product, _mm_shuffle_ps(product, product, _MM_SHUFFLE(2, 3, 0, 1)));
+        product = _mm_add_ps(product, _mm_movehl_ps(product, product));
+        return _mm_cvtss_f32(product);
+    }
+};
+
+template <>
+struct VectorSimd<double, 2>
+{
+    static constexpr bool ENABLED = true;
+    using V = Double2;
+
+    static __m128d Load(const V& v) { return _mm_load_pd(&v.x); }
+    static V Store(__m128d r)
+    {
+        V v;
+        _mm_store_pd(&v.x, r);
+        return v;
+    }
+
+    static V Add(const V& a, const V& b) { return Store(_mm_add_pd(Load(a), Load(b))); }
+    static V Subtract(const V& a, const V& b) { return Store(_mm_sub_pd(Load(a), Load(b))); }
+    static V Multiply(const V& a, const V& b) { return Store(_mm_mul_pd(Load(a), Load(b))); }
+    static V Divide(const V& a, const V& b) { return Store(_mm_div_pd(Load(a), Load(b))); }
+    static V Min(const V& a, const V& b) { return Store(_mm_min_pd(Load(a), Load(b))); }
+    static V Max(const V& a, const V& b) { return Store(_mm_max_pd(Load(a), Load(b))); }
+
+    static double Dot(const V& a, const V& b)
+    {
+        const __m128d product = _mm_mul_pd(Load(a), Load(b));
+        return _mm_cvtsd_f64(_mm_add_sd(product, _mm_unpackhi_pd(product, product)));
+    }
+};
+
+template <>
+struct VectorSimd<int32_t, 4>
+{
+    static constexpr bool ENABLED = true;
+    using V = Int4;
+
+    static __m128i Load(const V& v) { return _mm_load_si128(reinterpret_cast<const __m128i*>(&v.x)); }
+    static V Store(__m128i r)
+    {
+        V v;
+        _mm_store_si128(reinterpret_cast<__m128i*>(&v.x), r);
+        return v;
+    }
+
+    static V Add(const V& a, const V& b) { return Store(_mm_add_epi32(Load(a), Load(b))); }
+    static V Subtract(const V& a, const V& b) { return Store(_mm_sub_epi32(Load(a), Load(b))); }
+
+    // SSE2 has no packed 32-bit multiply, min or max; AVX2 builds get SSE4.1
+#if defined(HERMIT_SIMD_AVX2)
+    static V Multiply(const V& a, const V& b) { return Store(_mm_mullo_epi32(Load(a), Load(b))); }
+    static V Min(const V& a, const V& b) { return Store(_mm_min_epi32(Load(a), Load(b))); }
+    static V Max(const V& a, const V& b) { return Store(_mm_max_epi32(Load(a), Load(b))); }
+#else
+    static V Multiply(const V& a, const V& b) { return V(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w); }
+    static V Min(const V& a, const V& b)
+    {
+        // Select with a compare mask: b where b < a, otherwise a
+        const __m128i va = Load(a);
+        const __m128i vb = Load(b);
+        const __m128i mask = _mm_cmplt_epi32(vb, va);
+        return Store(_mm_or_si128(_mm_and_si128(mask, vb), _mm_andnot_si128(mask, va)));
+    }
+    static V Max(const V& a, const V& b)
+    {
+        const __m128i va = Load(a);
+        const __m128i vb = Load(b);
+        const __m128i mask = _mm_cmpgt_epi32(vb, va);
+        return Store(_mm_or_si128(_mm_and_si128(mask, vb), _mm_andnot_si128(mask, va)));
+    }
+#endif
+
+    // Integer division has no SIMD instruction
+    static V Divide(const V& a, const V& b) { return V(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w); }
+
+    static int32_t Dot(const V& a, const V& b)
+    {
+        const V product = Multiply(a, b);
+        return product.x + product.y + product.z + product.w;
+    }
+};
+#endif
+
+template <typename T, size_t N>
+constexpr bool UseVectorSimd()
+{
+    return VectorSimd<T, N>::ENABLED;
+}
+
+// ---------------------------------------------------------------------------
+// Operators and functions
+// ---------------------------------------------------------------------------
+
+// Applies a binary operation component-wise, preferring the SIMD path at run time;
+// std::is_constant_evaluated() keeps the loop for constant expressions
+#define HERMIT_VECTOR_BINARY(Name, Expression)                                                                        \
+    template <typename T, size_t N>                                                                                   \
+    constexpr Vector<T, N> Name(const Vector<T, N>& a, const Vector<T, N>& b)                                         \
+    {                                                                                                                 \
+        if constexpr (UseVectorSimd<T, N>())                                                                          \
+        {                                                                                                             \
+            if (!std::is_constant_evaluated())                                                                        \
+                return VectorSimd<T, N>::Name(a, b);                                                                  \
+        }                                                                                                             \
+        Vector<T, N> result;                                                                                          \
+        for (size_t i = 0; i < N; ++i)                                                                                \
+        {                                                                                                             \
+            result[i] = Expression;                                                                                   \
+        }                                                                                                             \
+        return result;                                                                                                \
+    }
+
+HERMIT_VECTOR_BINARY(Add, a[i] + b[i])
+HERMIT_VECTOR_BINARY(Subtract, a[i] - b[i])
+HERMIT_VECTOR_BINARY(Multiply, a[i] * b[i])
+HERMIT_VECTOR_BINARY(Divide, a[i] / b[i])
+HERMIT_VECTOR_BINARY(Min, b[i] < a[i] ? b[i] : a[i])
+HERMIT_VECTOR_BINARY(Max, a[i] < b[i] ? b[i] : a[i])
+
+#undef HERMIT_VECTOR_BINARY
+
+template <typename T, size_t N>
+constexpr Vector<T, N> operator+(const Vector<T, N>& a, const Vector<T, N>& b)
+{
+    return Add(a, b);
+}
+
+template <typename T, size_t N>
+constexpr Vector<T, N> operator-(const Vector<T, N>& a, const Vector<T, N>& b)
+{
+    return Subtract(a, b);
+}
+
+template <typename T, size_t N>
+constexpr Vector<T, N> operator*(const Vector<T, N>& a, const Vector<T, N>& b)
+{
+    return Multiply(a, b);
+}
+
+template <typename T, size_t N>
+constexpr Vector<T, N> operator/(const Vector<T, N>& a, const Vector<T, N>& b)
+{
+    return Divide(a, b);
+}
+
+template <typename T, size_t N>
+constexpr Vector<T, N> operator*(const Vector<T, N>& v, typename Vector<T, N>::ValueType scalar)
+{
+    return Multiply(v, Vector<T, N>::Splat(scalar));
+}
+
+template <typename T, size_t N>
+constexpr Vector<T, N> operator*(typename Vector<T, N>::ValueType scalar, const Vector<T, N>& v)
+{
+    return Multiply(Vector<T, N>::Splat(scalar), v);
+}
+
+template <typename T, size_t N>
+constexpr Vector<T, N> operator/(const Vector<T, N>& v, typename Vector<T, N>::ValueType scalar)
+{
+    return Divide(v, Vector<T, N>::Splat(scalar));
+}
+
+template <typename T, size_t N>
+constexpr Vector<T, N> operator-(const Vector<T, N>& v)
+{
+    return Subtract(Vector<T, N>(), v);
+}
+
+template <typename T, size_t N>
+constexpr bool operator==(const Vector<T, N>& a, const Vector<T, N>& b)
+{
+    for (size_t i = 0; i < N; ++i)
+    {
+        if (a[i] != b[i])
+            return false;
+    }
+    return true;
+}
+
+template <typename T, size_t N>
+constexpr bool operator!=(const Vector<T, N>& a, const Vector<T, N>& b)
+{
+    return !(a == b);
+}
+
+template <typename T, size_t N>
+constexpr T Dot(const Vector<T, N>& a, const Vector<T, N>& b)
+{
+    if constexpr (UseVectorSimd<T, N>())
+    {
+        if (!std::is_constant_evaluated())
+            return VectorSimd<T, N>::Dot(a, b);
+    }
+    T sum = T(0);
+    for (size_t i = 0; i < N; ++i)
+    {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+template <typename T>
+constexpr Vector<T, 3> Cross(const Vector<T, 3>& a, const Vector<T, 3>& b)
+{
+    return Vector<T, 3>(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+}
+
+template <typename T, size_t N>
+constexpr T MagnitudeSquared(const Vector<T, N>& v)
+{
+    return Dot(v, v);
+}
+
+template <typename T, size_t N>
+T Magnitude(const Vector<T, N>& v)
+{
+    static_assert(std::is_floating_point<T>::value, "Magnitude requires floating-point components");
+    return std::sqrt(MagnitudeSquared(v));
+}
+
+/**
+ * @brief Return a unit-length copy of a vector
+ * @note Like Vector3::Normalized, a (near) zero vector is returned unchanged
+ */
+template <typename T, size_t N>
+Vector<T, N> Normalized(const Vector<T, N>& v)
+{
+    const T magnitude = Magnitude(v);
+    return magnitude > std::numeric_limits<T>::epsilon() ? v / magnitude : v;
+}
+
+template <typename T, size_t N>
+constexpr Vector<T, N> Abs(const Vector<T, N>& v)
+{
+    return Max(v, -v);
+}
+
+template <typename T, size_t N>
+constexpr Vector<T, N> Clamp(const Vector<T, N>& v, const Vector<T, N>& low, const Vector<T, N>& high)
+{
+    return Min(Max(v, low), high);
+}
+
+template <typename T, size_t N>
+constexpr Vector<T, N> Lerp(const Vector<T, N>& a, const Vector<T, N>& b, typename Vector<T, N>::ValueType t)
+{
+    return a + (b - a) * t;
+}
+
+// ---------------------------------------------------------------------------
+// Grid and tile coordinates
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Convert a position to the integer cell containing it
+ * @param position Position in cell units
+ * @return Cell coordinates, rounding toward negative infinity
+ */
+template <typename I = int32_t, typename F, size_t N>
+Vector<I, N> FloorToInt(const Vector<F, N>& position)
+{
+    static_assert(std::is_integral<I>::value && std::is_floating_point<F>::value, "FloorToInt maps float to int");
+    Vector<I, N> result;
+    for (size_t i = 0; i < N; ++i)
+    {
+        result[i] = static_cast<I>(std::floor(position[i]));
+    }
+    return result;
+}
+
+/**
+ * @brief Integer division that rounds toward negative infinity
+ * @param cell Cell coordinates
+ * @param tileSize Cells per tile along each axis (positive)
+ * @return Coordinates of the tile containing the cell, so cell -1 lies in
+ *         tile -1 rather than tile 0
+ */
+template <typename T, size_t N>
+constexpr Vector<T, N> FloorDivide(const Vector<T, N>& cell, typename Vector<T, N>::ValueType tileSize)
+{
+    static_assert(std::is_integral<T>::value, "FloorDivide requires integer components");
+    Vector<T, N> result;
+    for (size_t i = 0; i < N; ++i)
+    {
+        const T quotient = cell[i] / tileSize;
+        result[i] = (cell[i] % tileSize != 0 && cell[i] < 0) ? quotient - 1 : quotient;
+    }
+    return result;
+}
+
+// ---------------------------------------------------------------------------
+// Interop with Vector2/Vector3 and large-world positions
+// ---------------------------------------------------------------------------
+
+inline Float2 ToFloat2(const Vector2& v)
+{
+    return Float2(v.x, v.y);
+}
+
+inline Float3 ToFloat3(const Vector3& v)
+{
+    return Float3(v.x, v.y, v.z);
+}
+
+inline Vector2 ToVector2(const Float2& v)
+{
+    return Vector2(v.x, v.y);
+}
+
+inline Vector3 ToVector3(const Float3& v)
+{
+    return Vector3(v.x, v.y, v.z);
+}
+
+/**
+ * @brief Express a double-precision world position relative to the camera
+ * @param worldPosition Position in world space
+ * @param cameraPosition Camera position in world space
+ * @return Offset from the camera in float, suitable for rendering
+ * @note The subtraction happens in double, so precision is lost only in the
+ *       final float conversion and is relative to the distance from the
+ *       camera rather than from the world origin
+ */
+inline Vector3 ToCameraRelative(const Double3& worldPosition, const Double3& cameraPosition)
+{
+    const Double3 offset = worldPosition - cameraPosition;
+    return Vector3(static_cast<float>(offset.x), static_cast<float>(offset.y), static_cast<float>(offset.z));
+}
+
+/**
+ * @brief Batch form of ToCameraRelative
+ * @param worldPositions Positions in world space
+ * @param count Number of positions
+ * @param cameraPosition Camera position in world space
+ * @param output Receives count camera-relative positions
+ */
+inline void ToCameraRelative(const Double3* worldPositions, size_t count, const Double3& cameraPosition,
+                             Vector3* output)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        output[i] = ToCameraRelative(worldPositions[i], cameraPosition);
+    }
+}
+
+} // namespace Math
+
+namespace std
+{
+// Lets integer vectors key unordered containers (e.g. sparse grids)
+template <typename T, size_t N>
+struct hash<Math::Vector<T, N>>
+{
+    size_t operator()(const Math::Vector<T, N>& v) const
+    {
+        size_t h = 0;
+        for (size_t i = 0; i < N; ++i)
+        {
+            h ^= std::hash<T>()(v[i]) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+        }
+        return h;
+    }
+};
+} // namespace std
@@ -0,0 +1,215 @@
+#include "Memory/AllocationTracker.h"
+#include <cstdlib>
+#include <new>
+
+#if defined(HERMIT_TRACK_ALLOCATIONS)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define HERMIT_RETURN_ADDRESS() _ReturnAddress()
+#else
+#define HERMIT_RETURN_ADDRESS() __builtin_return_address(0)
+#endif
+
+// Replacements for every global operator new/delete. Each records its own
+// return address, so the call site is the code that asked for the memory.
+namespace
+{
+const bool g_hooksInstalled = (Memory::AllocationTracker::MarkHooksInstalled(), true);
+
+void* TrackedAllocate(size_t bytes, const void* callSite)
+{
+    void* memory = std::malloc(bytes > 0 ? bytes : 1);
+    if (memory)
+        Memory::AllocationTracker::RecordAllocation(bytes, callSite);
+    return memory;
+}
+
+void* TrackedAllocateAligned(size_t bytes, std::align_val_t alignment, const void* callSite)
+{
+    const size_t size = bytes > 0 ? bytes : 1;
+#if defined(_WIN32)
+    void* memory = _aligned_malloc(size, static_cast<size_t>(alignment));
+#else
+    void* memory = nullptr;
+    if (posix_memalign(&memory, static_cast<size_t>(alignment), size) != 0)
+        memory = nullptr;
+#endif
+    if (memory)
+        Memory::AllocationTracker::RecordAllocation(bytes, callSite);
+    return memory;
+}
+
+// The standard loop: retry after each new_handler call, and throw once no
+// handler is installed
+void* AllocateOrThrow(size_t bytes, const void* callSite)
+{
+    for (;;)
+    {
+        if (void* memory = TrackedAllocate(bytes, callSite))
+            return memory;
+        const std::new_handler handler = std::get_new_handler();
+        if (!handler)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+void* AllocateAlignedOrThrow(size_t bytes, std::align_val_t alignment, const void* callSite)
+{
+    for (;;)
+    {
+        if (void* memory = TrackedAllocateAligned(bytes, alignment, callSite))
+            return memory;
+        const std::new_handler handler = std::get_new_handler();
+        if (!handler)
+            throw std::bad_alloc();
+        handler();
+    }
+}
+
+// The nothrow forms run the same loop, as the handler may itself throw
+void* AllocateOrNull(size_t bytes, const void* callSite) noexcept
+{
+    try
+    {
+        return AllocateOrThrow(bytes, callSite);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* AllocateAlignedOrNull(size_t bytes, std::align_val_t alignment, const void* callSite) noexcept
+{
+    try
+    {
+        return AllocateAlignedOrThrow(bytes, alignment, callSite);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void TrackedFree(void* memory)
+{
+    if (!memory)
+        return;
+    Memory::AllocationTracker::RecordFree();
+    std::free(memory);
+}
+
+void TrackedFreeAligned(void* memory)
+{
+    if (!memory)
+        return;
+    Memory::AllocationTracker::RecordFree();
+#if defined(_WIN32)
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+} // namespace
+
+void* operator new(size_t bytes)
+{
+    return AllocateOrThrow(bytes, HERMIT_RETURN_ADDRESS());
+}
+
+void* operator new[](size_t bytes)
+{
+    return AllocateOrThrow(bytes, HERMIT_RETURN_ADDRESS());
+}
+
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept
+{
+    return AllocateOrNull(bytes, HERMIT_RETURN_ADDRESS());
+}
+
+void* operator new[](size_t bytes, const std::nothrow_t&) noexcept
+{
+    return AllocateOrNull(bytes, HERMIT_RETURN_ADDRESS());
+}
+
+void* operator new(size_t bytes, std::align_val_t alignment)
+{
+    return AllocateAlignedOrThrow(bytes, alignment, HERMIT_RETURN_ADDRESS());
+}
+
+void* operator new[](size_t bytes, std::align_val_t alignment)
+{
+    return AllocateAlignedOrThrow(bytes, alignment, HERMIT_RETURN_ADDRESS());
+}
+
+void* operator new(size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateAlignedOrNull(bytes, alignment, HERMIT_RETURN_ADDRESS());
+}
+
+void* operator new[](size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return AllocateAlignedOrNull(bytes, alignment, HERMIT_RETURN_ADDRESS());
+}
+
+void operator delete(void* memory) noexcept
+{
+    TrackedFree(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    TrackedFree(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    TrackedFree(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    TrackedFree(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    TrackedFree(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+    TrackedFree(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    TrackedFreeAligned(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    TrackedFreeAligned(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    TrackedFreeAligned(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    TrackedFreeAligned(memory);
+}
+
+void operator delete(void* memory, size_t, std::align_val_t) noexcept
+{
+    TrackedFreeAligned(memory);
+}
+
+void operator delete[](void* memory, size_t, std::align_val_t) noexcept
+{
+    TrackedFreeAligned(memory);
+}
+#endif
@@ -0,0 +1,240 @@
+#include "Memory/AllocationTracker.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+namespace Memory
+{
+namespace
+{
+// Open-addressed by address; sites past capacity still count in the totals
+constexpr size_t SITE_CAPACITY = 1024;
+
+struct SiteSlot
+{
+    std::atomic<uintptr_t> address{0};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> bytes{0};
+};
+
+SiteSlot g_sites[SITE_CAPACITY];
+
+std::atomic<bool> g_hooksInstalled{false};
+std::atomic<bool> g_enabled{true};
+std::atomic<NoAllocPolicy> g_policy{NoAllocPolicy::Record};
+
+std::atomic<uint64_t> g_frameIndex{0};
+std::atomic<uint64_t> g_allocations{0};
+std::atomic<uint64_t> g_frees{0};
+std::atomic<uint64_t> g_bytes{0};
+std::atomic<uint64_t> g_callSites{0};
+std::atomic<uint64_t> g_frameViolations{0};
+std::atomic<uint64_t> g_totalViolations{0};
+
+std::mutex g_lastFrameMutex;
+AllocationFrameStats g_lastFrame;
+
+// Plain thread_locals: the hooks may run before or after any dynamic initialiser
+thread_local uint32_t t_noAllocDepth = 0;
+thread_local uint64_t t_violations = 0;
+thread_local const void* t_violationSite = nullptr;
+
+uint64_t HashAddress(uintptr_t address)
+{
+    uint64_t hash = static_cast<uint64_t>(address);
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+    return hash ^ (hash >> 31);
+}
+
+void RecordCallSite(size_t bytes, const void* callSite)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(callSite);
+    const size_t start = static_cast<size_t>(HashAddress(address)) & (SITE_CAPACITY - 1);
+    for (size_t probe = 0; probe < SITE_CAPACITY; ++probe)
+    {
+        SiteSlot& slot = g_sites[(start + probe) & (SITE_CAPACITY - 1)];
+        uintptr_t current = slot.address.load(std::memory_order_relaxed);
+        if (current == 0)
+        {
+            if (slot.address.compare_exchange_strong(current, address, std::memory_order_relaxed))
+            {
+                g_callSites.fetch_add(1, std::memory_order_relaxed);
+                current = address;
+            }
+        }
+        if (current != address)
+            continue;
+
+        slot.allocations.fetch_add(1, std::memory_order_relaxed);
+        slot.bytes.fetch_add(bytes, std::memory_order_relaxed);
+        return;
+    }
+}
+
+void RecordViolation(size_t bytes, const void* callSite)
+{
+    ++t_violations;
+    t_violationSite = callSite;
+    g_frameViolations.fetch_add(1, std::memory_order_relaxed);
+    g_totalViolations.fetch_add(1, std::memory_order_relaxed);
+    if (g_policy.load(std::memory_order_relaxed) != NoAllocPolicy::Abort)
+        return;
+
+    // Leave the scope first so nothing below can recurse into here
+    t_noAllocDepth = 0;
+    char message[160];
+    std::snprintf(message, sizeof(message), "NoAllocScope: %zu byte allocation inside a no-alloc scope from %p\n",
+                  bytes, callSite);
+    std::fputs(message, stderr);
+    std::abort();
+}
+} // namespace
+
+namespace AllocationTracker
+{
+bool IsAvailable()
+{
+    return g_hooksInstalled.load(std::memory_order_relaxed);
+}
+
+void SetEnabled(bool enabled)
+{
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool IsEnabled()
+{
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+void BeginFrame()
+{
+    AllocationFrameStats last;
+    last.frameIndex = g_frameIndex.fetch_add(1, std::memory_order_relaxed);
+    last.allocations = g_allocations.exchange(0, std::memory_order_relaxed);
+    last.frees = g_frees.exchange(0, std::memory_order_relaxed);
+    last.bytes = g_bytes.exchange(0, std::memory_order_relaxed);
+    last.callSites = g_callSites.exchange(0, std::memory_order_relaxed);
+    last.violations = g_frameViolations.exchange(0, std::memory_order_relaxed);
+
+    if (last.callSites > 0)
+    {
+        for (SiteSlot& slot : g_sites)
+        {
+            slot.allocations.store(0, std::memory_order_relaxed);
+            slot.bytes.store(0, std::memory_order_relaxed);
+            slot.address.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(g_lastFrameMutex);
+    g_lastFrame = last;
+}
+
+AllocationFrameStats GetFrameStats()
+{
+    AllocationFrameStats stats;
+    stats.frameIndex = g_frameIndex.load(std::memory_order_relaxed);
+    stats.allocations = g_allocations.load(std::memory_order_relaxed);
+    stats.frees = g_frees.load(std::memory_order_relaxed);
+    stats.bytes = g_bytes.load(std::memory_order_relaxed);
+    stats.callSites = g_callSites.load(std::memory_order_relaxed);
+    stats.violations = g_frameViolations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+AllocationFrameStats GetLastFrameStats()
+{
+    std::lock_guard<std::mutex> lock(g_lastFrameMutex);
+    return g_lastFrame;
+}
+
+size_t GetCallSites(AllocationCallSite* sites, size_t maxCount)
+{
+    // Insertion into the caller's array keeps the top maxCount without a heap
+    size_t count = 0;
+    for (const SiteSlot& slot : g_sites)
+    {
+        const uintptr_t address = slot.address.load(std::memory_order_relaxed);
+        const uint64_t allocations = slot.allocations.load(std::memory_order_relaxed);
+        if (address == 0 || allocations == 0)
+            continue;
+        if (count == maxCount && (count == 0 || sites[count - 1].allocations >= allocations))
+            continue;
+
+        size_t position = count < maxCount ? count++ : count - 1;
+        while (position > 0 && sites[position - 1].allocations < allocations)
+        {
+            sites[position] = sites[position - 1];
+            --position;
+        }
+        sites[position].hash = HashAddress(address);
+        sites[position].address = reinterpret_cast<const void*>(address);
+        sites[position].allocations = allocations;
+        sites[position].bytes = slot.bytes.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+void SetNoAllocPolicy(NoAllocPolicy policy)
+{
+    g_policy.store(policy, std::memory_order_relaxed);
+}
+
+NoAllocPolicy GetNoAllocPolicy()
+{
+    return g_policy.load(std::memory_order_relaxed);
+}
+
+uint64_t GetViolationCount()
+{
+    return g_totalViolations.load(std::memory_order_relaxed);
+}
+
+void MarkHooksInstalled()
+{
+    g_hooksInstalled.store(true, std::memory_order_relaxed);
+}
+
+void RecordAllocation(size_t bytes, const void* callSite)
+{
+    if (!g_enabled.load(std::memory_order_relaxed))
+        return;
+
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    RecordCallSite(bytes, callSite);
+    if (t_noAllocDepth > 0)
+        RecordViolation(bytes, callSite);
+}
+
+void RecordFree()
+{
+    if (g_enabled.load(std::memory_order_relaxed))
+        g_frees.fetch_add(1, std::memory_order_relaxed);
+}
+} // namespace AllocationTracker
+
+NoAllocScope::NoAllocScope() : m_startViolations(t_violations)
+{
+    ++t_noAllocDepth;
+}
+
+NoAllocScope::~NoAllocScope()
+{
+    if (t_noAllocDepth > 0)
+        --t_noAllocDepth;
+}
+
+uint64_t NoAllocScope::GetViolationCount() const
+{
+    return t_violations - m_startViolations;
+}
+
+const void* NoAllocScope::GetViolationSite() const
+{
+    return GetViolationCount() > 0 ? t_violationSite : nullptr;
+}
+} // namespace Memory
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Memory
+{
+/**
+ * @brief Traffic through the global operator new/delete over one frame
+ *
+ * Only filled in when the binary links the replaced global operators from
+ * AllocationHooks.cpp built with HERMIT_TRACK_ALLOCATIONS (the
+ * allocation_tracking xmake option, off by default). Counts come from every
+ * thread; allocations racing BeginFrame() may land in either frame.
+ */
+struct AllocationFrameStats
+{
+    uint64_t frameIndex = 0;
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    uint64_t bytes = 0;      // Bytes requested by the allocations
+    uint64_t callSites = 0;  // Distinct call sites that allocated
+    uint64_t violations = 0; // Allocations made inside a NoAllocScope
+};
+
+/**
+ * @brief One place that allocated during the current frame
+ * @note address is the return address in the caller of operator new, to be
+ *       resolved with a debugger or addr2line; hash is a mix of it, stable
+ *       for the life of the process
+ */
+struct AllocationCallSite
+{
+    uint64_t hash = 0;
+    const void* address = nullptr;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+/**
+ * @brief What an allocation inside a NoAllocScope does
+ */
+enum class NoAllocPolicy : uint8_t
+{
+    Record, // Count it against the scope and the frame
+    Abort   // Print the call site and abort, failing the test that hit it
+};
+
+namespace AllocationTracker
+{
+/**
+ * @brief Whether the global operators were replaced in this binary
+ * @note Without them every query below returns zeros
+ */
+bool IsAvailable();
+
+/**
+ * @brief Pause or resume recording; on by default
+ */
+void SetEnabled(bool enabled);
+bool IsEnabled();
+
+/**
+ * @brief Close the current frame and start counting the next
+ * @note Call once per frame from the thread driving the frame loop
+ */
+void BeginFrame();
+
+/**
+ * @brief The frame in progress, or the last one closed by BeginFrame()
+ */
+AllocationFrameStats GetFrameStats();
+AllocationFrameStats GetLastFrameStats();
+
+/**
+ * @brief Copy the busiest call sites of the frame in progress
+ * @param sites Output, sorted by allocation count, most first
+ * @param maxCount Capacity of sites
+ * @return Number of sites written
+ * @note Does not allocate, so it may be called inside a NoAllocScope
+ */
+size_t GetCallSites(AllocationCallSite* sites, size_t maxCount);
+
+void SetNoAllocPolicy(NoAllocPolicy policy);
+NoAllocPolicy GetNoAllocPolicy();
+
+/**
+ * @brief Violations on every thread since the process started
+ */
+uint64_t GetViolationCount();
+
+// Called by the replaced operators; must not allocate
+void MarkHooksInstalled();
+void RecordAllocation(size_t bytes, const void* callSite);
+void RecordFree();
+} // namespace AllocationTracker
+
+/**
+ * @brief Marks code on this thread that must not touch the general heap
+ *
+ * Scopes nest. Jobs must not wait inside one: a job that resumes on another
+ * thread leaves the mark behind.
+ */
+class NoAllocScope
+{
+  public:
+    NoAllocScope();
+    ~NoAllocScope();
+
+    NoAllocScope(const NoAllocScope&) = delete;
+    NoAllocScope& operator=(const NoAllocScope&) = delete;
+
+    /**
+     * @brief Allocations this thread made since the scope opened
+     */
+    uint64_t GetViolationCount() const;
+
+    /**
+     * @brief Call site of the latest violation, or nullptr if there was none
+     */
+    const void* GetViolationSite() const;
+
+  private:
+    uint64_t m_startViolations;
+};
+} // namespace Memory
@@ -0,0 +1,72 @@
+#include "Memory/FrameArena.h"
+#include <algorithm>
+
+namespace Memory
+{
+FrameArena::FrameArena(size_t capacityPerFrame, MemoryTag tag) : m_tag(tag)
+{
+    for (Buffer& buffer : m_buffers)
+    {
+        buffer.capacity = std::max<size_t>(capacityPerFrame, LinearArena::DEFAULT_ALIGNMENT);
+        buffer.data = static_cast<unsigned char*>(HeapAllocate(m_tag, buffer.capacity));
+    }
+}
+
+FrameArena::~FrameArena()
+{
+    for (Buffer& buffer : m_buffers)
+    {
+        HeapFree(m_tag, buffer.data, buffer.capacity);
+    }
+}
+
+void FrameArena::BeginFrame()
+{
+    ++m_frameIndex;
+    m_current ^= 1;
+    Buffer& buffer = m_buffers[m_current];
+
+    // The last frame in this buffer spilled: regrow it to hold that frame whole
+    const size_t needed = buffer.offset.load(std::memory_order_relaxed) + buffer.overflowBytes;
+    if (buffer.overflowBytes > 0)
+    {
+        const size_t capacity = std::max(buffer.capacity * 2, needed + needed / 4);
+        HeapFree(m_tag, buffer.data, buffer.capacity);
+        buffer.data = static_cast<unsigned char*>(HeapAllocate(m_tag, capacity));
+        buffer.capacity = capacity;
+        buffer.overflow->Reset();
+    }
+    buffer.offset.store(0, std::memory_order_relaxed);
+    buffer.overflowBytes = 0;
+}
+
+void* FrameArena::Allocate(size_t size, size_t alignment)
+{
+    RecordRequest(m_tag, size);
+    Buffer& buffer = m_buffers[m_current];
+
+    // Claim an aligned range with a CAS, so a failed claim leaves no gap
+    const uintptr_t base = reinterpret_cast<uintptr_t>(buffer.data);
+    size_t offset = buffer.offset.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        const size_t aligned = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+        if (aligned + size > buffer.capacity)
+            break;
+        if (buffer.offset.compare_exchange_weak(offset, aligned + size, std::memory_order_relaxed))
+            return buffer.data + aligned;
+    }
+
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    if (!buffer.overflow)
+        buffer.overflow = std::make_unique<LinearArena>(buffer.capacity, m_tag);
+    buffer.overflowBytes += size + alignment;
+    return buffer.overflow->Allocate(size, alignment);
+}
+
+size_t FrameArena::GetUsedBytes() const
+{
+    const Buffer& buffer = m_buffers[m_current];
+    return buffer.offset.load(std::memory_order_relaxed) + buffer.overflowBytes;
+}
+} // namespace Memory
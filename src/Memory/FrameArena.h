@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Memory/LinearArena.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace Memory
+{
+/**
+ * @brief Double-buffered per-frame bump allocator, safe to allocate from any thread
+ *
+ * Memory allocated during frame N stays valid through frame N + 1, so one
+ * frame's draw lists can be consumed while the next is being built, and is
+ * reclaimed wholesale by the BeginFrame() that starts frame N + 2.
+ *
+ * Each buffer is one block claimed by an atomic bump. A frame that runs out
+ * spills into an overflow arena under a lock; the next time that buffer
+ * comes around it is regrown to hold the whole frame, so steady-state
+ * frames make no heap calls. Destructors are not run.
+ */
+class FrameArena
+{
+  public:
+    /**
+     * @param capacityPerFrame Initial bytes in each of the two buffers
+     * @param tag Subsystem charged for the buffers and requests
+     */
+    explicit FrameArena(size_t capacityPerFrame = 1024 * 1024, MemoryTag tag = MemoryTag::Frame);
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @brief Switch buffers, releasing what was allocated two frames ago
+     * @note Not concurrent with Allocate()
+     */
+    void BeginFrame();
+
+    /**
+     * @brief Allocate uninitialized memory valid until the next-but-one BeginFrame()
+     * @param alignment Power of two
+     */
+    void* Allocate(size_t size, size_t alignment = LinearArena::DEFAULT_ALIGNMENT);
+
+    template <typename T>
+    T* AllocateArray(size_t count)
+    {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    // Bytes allocated in the current frame, including overflow; call between frames
+    size_t GetUsedBytes() const;
+    size_t GetCapacity() const { return m_buffers[m_current].capacity; }
+    uint64_t GetFrameIndex() const { return m_frameIndex; }
+    MemoryTag GetTag() const { return m_tag; }
+
+  private:
+    struct Buffer
+    {
+        unsigned char* data = nullptr;
+        size_t capacity = 0;
+        std::atomic<size_t> offset{0};
+        std::unique_ptr<LinearArena> overflow; // Created on first spill
+        size_t overflowBytes = 0;              // Guarded by m_overflowMutex
+    };
+
+    Buffer m_buffers[2];
+    uint32_t m_current = 0;
+    uint64_t m_frameIndex = 0;
+    MemoryTag m_tag;
+    std::mutex m_overflowMutex;
+};
+} // namespace Memory
@@ -0,0 +1,149 @@
+#include "Memory/LinearArena.h"
+#include <algorithm>
+
+namespace Memory
+{
+namespace
+{
+constexpr size_t SCRATCH_CAPACITY = 256 * 1024;
+
+size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+} // namespace
+
+LinearArena::LinearArena(size_t initialCapacity, MemoryTag tag)
+    : m_initialCapacity(std::max<size_t>(initialCapacity, 1)), m_tag(tag)
+{
+}
+
+LinearArena::~LinearArena()
+{
+    FreeChunks();
+}
+
+void* LinearArena::Allocate(size_t size, size_t alignment)
+{
+    RecordRequest(m_tag, size);
+
+    // Chunk data is DEFAULT_ALIGNMENT-aligned, so offsets align the same way
+    // up to that; larger alignments align the address
+    for (;;)
+    {
+        if (m_current)
+        {
+            const uintptr_t base = reinterpret_cast<uintptr_t>(GetData(m_current));
+            const size_t offset = AlignUp(base + m_current->used, alignment) - base;
+            if (offset + size <= m_current->size)
+            {
+                m_current->used = offset + size;
+                return GetData(m_current) + offset;
+            }
+
+            // Move on to a kept chunk that fits, else add one
+            if (m_current->next && m_current->next->size >= size + alignment)
+            {
+                m_current = m_current->next;
+                m_current->used = 0;
+                continue;
+            }
+        }
+
+        const size_t grown = m_current ? m_current->size * 2 : m_initialCapacity;
+        Chunk* chunk = CreateChunk(std::max(grown, size + alignment));
+        if (m_current)
+        {
+            // Chunks past the current one are too small for this; keep them after it
+            chunk->next = m_current->next;
+            m_current->next = chunk;
+        }
+        else
+        {
+            chunk->next = m_first;
+            m_first = chunk;
+        }
+        m_current = chunk;
+    }
+}
+
+LinearArena::Marker LinearArena::GetMarker() const
+{
+    Marker marker;
+    marker.chunk = m_current;
+    marker.offset = m_current ? m_current->used : 0;
+    return marker;
+}
+
+void LinearArena::ResetTo(const Marker& marker)
+{
+    if (!marker.chunk)
+    {
+        // Taken before the first allocation: back to the start
+        m_current = m_first;
+        if (m_current)
+            m_current->used = 0;
+        return;
+    }
+    m_current = static_cast<Chunk*>(marker.chunk);
+    m_current->used = marker.offset;
+}
+
+void LinearArena::Reset()
+{
+    if (m_first && m_first->next)
+    {
+        // Grew past one chunk: replace the chain with one chunk for it all
+        const size_t total = m_capacity;
+        FreeChunks();
+        m_first = CreateChunk(total);
+        m_first->next = nullptr;
+    }
+    m_current = m_first;
+    if (m_current)
+        m_current->used = 0;
+}
+
+size_t LinearArena::GetUsedBytes() const
+{
+    size_t used = 0;
+    for (Chunk* chunk = m_first; chunk; chunk = chunk->next)
+    {
+        if (chunk == m_current)
+            return used + chunk->used;
+        used += chunk->size;
+    }
+    return used;
+}
+
+LinearArena::Chunk* LinearArena::CreateChunk(size_t size)
+{
+    size = AlignUp(size, DEFAULT_ALIGNMENT);
+    Chunk* chunk = static_cast<Chunk*>(HeapAllocate(m_tag, HEADER_SIZE + size));
+    chunk->next = nullptr;
+    chunk->size = size;
+    chunk->used = 0;
+    m_capacity += size;
+    return chunk;
+}
+
+void LinearArena::FreeChunks()
+{
+    Chunk* chunk = m_first;
+    while (chunk)
+    {
+        Chunk* next = chunk->next;
+        HeapFree(m_tag, chunk, HEADER_SIZE + chunk->size);
+        chunk = next;
+    }
+    m_first = nullptr;
+    m_current = nullptr;
+    m_capacity = 0;
+}
+
+LinearArena& GetScratchArena()
+{
+    thread_local LinearArena arena(SCRATCH_CAPACITY, MemoryTag::Scratch);
+    return arena;
+}
+} // namespace Memory
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Memory/MemoryStats.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Memory
+{
+/**
+ * @brief Single-threaded bump allocator over a chain of chunks
+ *
+ * Allocate() advances an offset; nothing is freed individually. Reset()
+ * or ResetTo() a marker releases everything allocated since, keeping the
+ * chunks. When one pass outgrew the first chunk, Reset() replaces the
+ * chain with a single chunk large enough for the whole pass, so a
+ * repeating workload settles on one chunk and no heap calls.
+ *
+ * Destructors are not run; keep trivially destructible data here, or
+ * destroy objects before resetting.
+ */
+class LinearArena
+{
+  public:
+    // Alignment of Allocate() when none is given
+    static constexpr size_t DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+    /**
+     * @param initialCapacity Bytes in the first chunk, allocated on first use
+     * @param tag Subsystem charged for the chunks and requests
+     */
+    explicit LinearArena(size_t initialCapacity = 64 * 1024, MemoryTag tag = MemoryTag::General);
+    ~LinearArena();
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    /**
+     * @brief Allocate uninitialized memory
+     * @param alignment Power of two
+     * @return Never null; grows by a new chunk when needed
+     */
+    void* Allocate(size_t size, size_t alignment = DEFAULT_ALIGNMENT);
+
+    template <typename T>
+    T* AllocateArray(size_t count)
+    {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    /**
+     * @brief A point to roll back to
+     */
+    struct Marker
+    {
+        void* chunk = nullptr;
+        size_t offset = 0;
+    };
+
+    Marker GetMarker() const;
+
+    /**
+     * @brief Release everything allocated since the marker was taken
+     */
+    void ResetTo(const Marker& marker);
+
+    /**
+     * @brief Release everything, consolidating the chunks if the arena grew
+     */
+    void Reset();
+
+    // Bytes handed out since the last Reset(), including alignment padding
+    size_t GetUsedBytes() const;
+    size_t GetCapacity() const { return m_capacity; }
+    MemoryTag GetTag() const { return m_tag; }
+
+  private:
+    struct Chunk
+    {
+        Chunk* next;
+        size_t size; // Usable bytes after the header
+        size_t used;
+    };
+
+    static constexpr size_t HEADER_SIZE = (sizeof(Chunk) + DEFAULT_ALIGNMENT - 1) & ~(DEFAULT_ALIGNMENT - 1);
+
+    static unsigned char* GetData(Chunk* chunk) { return reinterpret_cast<unsigned char*>(chunk) + HEADER_SIZE; }
+    Chunk* CreateChunk(size_t size);
+    void FreeChunks();
+
+    Chunk* m_first = nullptr;
+    Chunk* m_current = nullptr;
+    size_t m_initialCapacity;
+    size_t m_capacity = 0;
+    MemoryTag m_tag;
+};
+
+/**
+ * @brief The calling thread's scratch arena
+ *
+ * For temporaries that die before the function returns; take a ScratchScope
+ * rather than allocating from it directly. Jobs that wait on a fiber may
+ * resume on another thread, so a scope must not span a wait.
+ */
+LinearArena& GetScratchArena();
+
+/**
+ * @brief Rolls the thread's scratch arena back to where it was on construction
+ */
+class ScratchScope
+{
+  public:
+    ScratchScope() : m_arena(GetScratchArena()), m_marker(m_arena.GetMarker()) {}
+    ~ScratchScope() { m_arena.ResetTo(m_marker); }
+
+    ScratchScope(const ScratchScope&) = delete;
+    ScratchScope& operator=(const ScratchScope&) = delete;
+
+    LinearArena& GetArena() { return m_arena; }
+
+    void* Allocate(size_t size, size_t alignment = LinearArena::DEFAULT_ALIGNMENT)
+    {
+        return m_arena.Allocate(size, alignment);
+    }
+
+    template <typename T>
+    T* AllocateArray(size_t count)
+    {
+        return m_arena.AllocateArray<T>(count);
+    }
+
+  private:
+    LinearArena& m_arena;
+    LinearArena::Marker m_marker;
+};
+} // namespace Memory
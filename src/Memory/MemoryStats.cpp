@@ -0,0 +1,119 @@
+#include "Memory/MemoryStats.h"
+#include <atomic>
+#include <new>
+
+namespace Memory
+{
+namespace
+{
+// One cache line per tag, so subsystems on different threads do not contend
+struct alignas(64) TagCounters
+{
+    std::atomic<uint64_t> requests{0};
+    std::atomic<uint64_t> requestedBytes{0};
+    std::atomic<uint64_t> heapAllocations{0};
+    std::atomic<uint64_t> heapBytes{0};
+    std::atomic<int64_t> residentBytes{0};
+    std::atomic<int64_t> peakResidentBytes{0};
+};
+
+TagCounters g_counters[MEMORY_TAG_COUNT];
+
+constexpr const char* TAG_NAMES[MEMORY_TAG_COUNT] = {"General", "Frame",   "Scratch",   "Rendering", "Geometry",
+                                                     "Animation", "Spatial", "Physics", "Particles", "Threading"};
+
+TagCounters& GetCounters(MemoryTag tag)
+{
+    return g_counters[static_cast<size_t>(tag)];
+}
+} // namespace
+
+MemoryTagStats GetStats(MemoryTag tag)
+{
+    const TagCounters& counters = GetCounters(tag);
+    MemoryTagStats stats;
+    stats.requests = counters.requests.load(std::memory_order_relaxed);
+    stats.requestedBytes = counters.requestedBytes.load(std::memory_order_relaxed);
+    stats.heapAllocations = counters.heapAllocations.load(std::memory_order_relaxed);
+    stats.heapBytes = counters.heapBytes.load(std::memory_order_relaxed);
+    stats.residentBytes = counters.residentBytes.load(std::memory_order_relaxed);
+    stats.peakResidentBytes = counters.peakResidentBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+MemoryTagStats GetTotalStats()
+{
+    MemoryTagStats total;
+    for (size_t tag = 0; tag < MEMORY_TAG_COUNT; ++tag)
+    {
+        const MemoryTagStats stats = GetStats(static_cast<MemoryTag>(tag));
+        total.requests += stats.requests;
+        total.requestedBytes += stats.requestedBytes;
+        total.heapAllocations += stats.heapAllocations;
+        total.heapBytes += stats.heapBytes;
+        total.residentBytes += stats.residentBytes;
+        total.peakResidentBytes += stats.peakResidentBytes;
+    }
+    return total;
+}
+
+const char* GetTagName(MemoryTag tag)
+{
+    const size_t index = static_cast<size_t>(tag);
+    return index < MEMORY_TAG_COUNT ? TAG_NAMES[index] : "Unknown";
+}
+
+void ResetStats()
+{
+    for (TagCounters& counters : g_counters)
+    {
+        counters.requests.store(0, std::memory_order_relaxed);
+        counters.requestedBytes.store(0, std::memory_order_relaxed);
+        counters.heapAllocations.store(0, std::memory_order_relaxed);
+        counters.heapBytes.store(0, std::memory_order_relaxed);
+        counters.peakResidentBytes.store(counters.residentBytes.load(std::memory_order_relaxed),
+                                         std::memory_order_relaxed);
+    }
+}
+
+void RecordRequest(MemoryTag tag, size_t bytes)
+{
+    TagCounters& counters = GetCounters(tag);
+    counters.requests.fetch_add(1, std::memory_order_relaxed);
+    counters.requestedBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void RecordHeapAllocation(MemoryTag tag, size_t bytes)
+{
+    TagCounters& counters = GetCounters(tag);
+    counters.heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.heapBytes.fetch_add(bytes, std::memory_order_relaxed);
+    const int64_t resident =
+        counters.residentBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) +
+        static_cast<int64_t>(bytes);
+    int64_t peak = counters.peakResidentBytes.load(std::memory_order_relaxed);
+    while (resident > peak &&
+           !counters.peakResidentBytes.compare_exchange_weak(peak, resident, std::memory_order_relaxed))
+    {
+    }
+}
+
+void RecordHeapFree(MemoryTag tag, size_t bytes)
+{
+    GetCounters(tag).residentBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+}
+
+void* HeapAllocate(MemoryTag tag, size_t bytes)
+{
+    RecordHeapAllocation(tag, bytes);
+    return ::operator new(bytes);
+}
+
+void HeapFree(MemoryTag tag, void* memory, size_t bytes)
+{
+    if (!memory)
+        return;
+    RecordHeapFree(tag, bytes);
+    ::operator delete(memory);
+}
+} // namespace Memory
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Memory
+{
+/**
+ * @brief Subsystem an allocation is charged to
+ */
+enum class MemoryTag : uint8_t
+{
+    General,
+    Frame,   // Per-frame temporaries, reset every frame
+    Scratch, // Thread-local temporaries, reset per scope
+    Rendering,
+    Geometry,
+    Animation,
+    Spatial,
+    Physics,
+    Particles,
+    Threading,
+    Count
+};
+
+constexpr size_t MEMORY_TAG_COUNT = static_cast<size_t>(MemoryTag::Count);
+
+/**
+ * @brief What one tag has allocated
+ *
+ * Requests are what callers asked the Memory allocators for; heap figures
+ * are what those allocators in turn took from the general heap, for their
+ * own backing memory or for requests they could not serve. Once a frame
+ * loop has warmed up, heapAllocations should stop moving.
+ */
+struct MemoryTagStats
+{
+    uint64_t requests = 0;
+    uint64_t requestedBytes = 0;
+    uint64_t heapAllocations = 0;
+    uint64_t heapBytes = 0;
+    int64_t residentBytes = 0;     // Heap memory currently held
+    int64_t peakResidentBytes = 0;
+};
+
+/**
+ * @brief Statistics for one tag, or summed over all tags
+ */
+MemoryTagStats GetStats(MemoryTag tag);
+MemoryTagStats GetTotalStats();
+
+const char* GetTagName(MemoryTag tag);
+
+/**
+ * @brief Zero the counters of every tag, keeping resident bytes
+ * @note Peaks restart from the current resident bytes
+ */
+void ResetStats();
+
+// Called by the allocators; relaxed atomics, safe from any thread
+void RecordRequest(MemoryTag tag, size_t bytes);
+void RecordHeapAllocation(MemoryTag tag, size_t bytes);
+void RecordHeapFree(MemoryTag tag, size_t bytes);
+
+/**
+ * @brief Take memory from the general heap and charge it to a tag
+ * @note Aligned to alignof(std::max_align_t); release with HeapFree() and
+ *       the same size
+ */
+void* HeapAllocate(MemoryTag tag, size_t bytes);
+void HeapFree(MemoryTag tag, void* memory, size_t bytes);
+} // namespace Memory
@@ -0,0 +1,110 @@
+#include "Memory/PoolAllocator.h"
+#include <algorithm>
+
+namespace Memory
+{
+namespace
+{
+size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+} // namespace
+
+FixedPool::FixedPool(size_t blockSize, size_t blocksPerPage, MemoryTag tag, size_t alignment)
+    : m_blockSize(AlignUp(std::max(blockSize, sizeof(FreeBlock)), std::max(alignment, alignof(FreeBlock)))),
+      m_blocksPerPage(std::max<size_t>(blocksPerPage, 1)),
+      m_pageHeader(AlignUp(sizeof(Page), alignof(std::max_align_t))), m_tag(tag)
+{
+}
+
+FixedPool::~FixedPool()
+{
+    Page* page = m_pages;
+    while (page)
+    {
+        Page* next = page->next;
+        HeapFree(m_tag, page, m_pageHeader + m_blockSize * m_blocksPerPage);
+        page = next;
+    }
+}
+
+void* FixedPool::Allocate()
+{
+    RecordRequest(m_tag, m_blockSize);
+    if (!m_free)
+        AddPage();
+
+    FreeBlock* block = m_free;
+    m_free = block->next;
+    ++m_liveCount;
+    return block;
+}
+
+void FixedPool::Free(void* block)
+{
+    if (!block)
+        return;
+
+    FreeBlock* freed = static_cast<FreeBlock*>(block);
+    freed->next = m_free;
+    m_free = freed;
+    --m_liveCount;
+}
+
+void FixedPool::AddPage()
+{
+    Page* page = static_cast<Page*>(HeapAllocate(m_tag, m_pageHeader + m_blockSize * m_blocksPerPage));
+    page->next = m_pages;
+    m_pages = page;
+
+    // Thread the new blocks so they are handed out in address order
+    unsigned char* blocks = reinterpret_cast<unsigned char*>(page) + m_pageHeader;
+    for (size_t i = m_blocksPerPage; i-- > 0;)
+    {
+        FreeBlock* block = reinterpret_cast<FreeBlock*>(blocks + i * m_blockSize);
+        block->next = m_free;
+        m_free = block;
+    }
+    m_capacity += m_blocksPerPage;
+}
+
+PoolSet::PoolSet(MemoryTag tag, size_t blocksPerPage) : m_tag(tag)
+{
+    for (size_t sizeClass = 0; sizeClass < CLASS_COUNT; ++sizeClass)
+    {
+        const size_t blockSize = size_t(1) << (MIN_CLASS_SHIFT + sizeClass);
+        m_pools[sizeClass] = std::make_unique<FixedPool>(blockSize, blocksPerPage, tag);
+    }
+}
+
+void* PoolSet::Allocate(size_t size)
+{
+    if (size > MAX_POOLED_SIZE)
+    {
+        RecordRequest(m_tag, size);
+        return HeapAllocate(m_tag, size);
+    }
+    return m_pools[GetSizeClass(size)]->Allocate();
+}
+
+void PoolSet::Free(void* block, size_t size)
+{
+    if (size > MAX_POOLED_SIZE)
+    {
+        HeapFree(m_tag, block, size);
+        return;
+    }
+    m_pools[GetSizeClass(size)]->Free(block);
+}
+
+size_t PoolSet::GetSizeClass(size_t size)
+{
+    size_t sizeClass = 0;
+    while ((size_t(1) << (MIN_CLASS_SHIFT + sizeClass)) < size)
+    {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+} // namespace Memory
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Memory/MemoryStats.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Memory
+{
+/**
+ * @brief Single-threaded allocator of equal-sized blocks
+ *
+ * Blocks come from pages of blocksPerPage blocks and return to an
+ * intrusive free list, so Allocate() and Free() are a few instructions and
+ * the heap is touched only when every page is full. Pages are kept until
+ * the pool is destroyed.
+ */
+class FixedPool
+{
+  public:
+    /**
+     * @param blockSize Bytes per block; raised to hold a pointer and to the alignment
+     * @param blocksPerPage Blocks taken from the heap at a time
+     * @param tag Subsystem charged for the pages and requests
+     * @param alignment Power of two, at most alignof(std::max_align_t)
+     */
+    explicit FixedPool(size_t blockSize, size_t blocksPerPage = 256, MemoryTag tag = MemoryTag::General,
+                       size_t alignment = alignof(std::max_align_t));
+    ~FixedPool();
+
+    FixedPool(const FixedPool&) = delete;
+    FixedPool& operator=(const FixedPool&) = delete;
+
+    void* Allocate();
+
+    /**
+     * @param block From Allocate() on this pool; null is ignored
+     */
+    void Free(void* block);
+
+    size_t GetBlockSize() const { return m_blockSize; }
+    size_t GetLiveCount() const { return m_liveCount; }
+    size_t GetCapacity() const { return m_capacity; }
+
+  private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    struct Page
+    {
+        Page* next;
+    };
+
+    void AddPage();
+
+    FreeBlock* m_free = nullptr;
+    Page* m_pages = nullptr;
+    size_t m_blockSize;
+    size_t m_blocksPerPage;
+    size_t m_pageHeader;
+    size_t m_liveCount = 0;
+    size_t m_capacity = 0;
+    MemoryTag m_tag;
+};
+
+/**
+ * @brief Typed front end to a FixedPool
+ */
+template <typename T>
+class ObjectPool
+{
+  public:
+    explicit ObjectPool(size_t objectsPerPage = 256, MemoryTag tag = MemoryTag::General)
+        : m_pool(sizeof(T), objectsPerPage, tag, alignof(T))
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not pooled");
+    }
+
+    template <typename... Args>
+    T* Create(Args&&... args)
+    {
+        return new (m_pool.Allocate()) T(std::forward<Args>(args)...);
+    }
+
+    void Destroy(T* object)
+    {
+        if (!object)
+            return;
+        object->~T();
+        m_pool.Free(object);
+    }
+
+    size_t GetLiveCount() const { return m_pool.GetLiveCount(); }
+
+  private:
+    FixedPool m_pool;
+};
+
+/**
+ * @brief Fixed pools for power-of-two sizes from 16 to MAX_POOLED_SIZE bytes
+ *
+ * Backs node-based containers through PoolAllocator (see StlAllocators.h):
+ * each request goes to the smallest class that fits, and larger ones to
+ * the heap. Single-threaded, like FixedPool.
+ */
+class PoolSet
+{
+  public:
+    static constexpr size_t MAX_POOLED_SIZE = 512;
+
+    explicit PoolSet(MemoryTag tag = MemoryTag::General, size_t blocksPerPage = 128);
+
+    PoolSet(const PoolSet&) = delete;
+    PoolSet& operator=(const PoolSet&) = delete;
+
+    void* Allocate(size_t size);
+
+    /**
+     * @param size As passed to Allocate()
+     */
+    void Free(void* block, size_t size);
+
+    MemoryTag GetTag() const { return m_tag; }
+
+  private:
+    static constexpr size_t MIN_CLASS_SHIFT = 4;
+    static constexpr size_t CLASS_COUNT = 6;
+
+    static size_t GetSizeClass(size_t size);
+
+    std::unique_ptr<FixedPool> m_pools[CLASS_COUNT];
+    MemoryTag m_tag;
+};
+} // namespace Memory
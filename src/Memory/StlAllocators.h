@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Memory/FrameArena.h"
+#include "Memory/LinearArena.h"
+#include "Memory/MemoryStats.h"
+#include "Memory/PoolAllocator.h"
+#include <cstddef>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Memory
+{
+/**
+ * @brief STL allocator drawing from a LinearArena or FrameArena
+ *
+ * deallocate() does nothing; the arena reclaims everything on reset. A
+ * growing vector leaves its old buffers behind, so reserve() up front.
+ */
+template <typename T, typename Arena>
+class ArenaAllocator
+{
+  public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena& arena) noexcept : m_arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U, Arena>& other) noexcept : m_arena(other.GetArena())
+    {
+    }
+
+    T* allocate(size_t count) { return static_cast<T*>(m_arena->Allocate(sizeof(T) * count, alignof(T))); }
+    void deallocate(T*, size_t) noexcept {}
+
+    Arena* GetArena() const noexcept { return m_arena; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U, Arena>& other) const noexcept
+    {
+        return m_arena == other.GetArena();
+    }
+
+  private:
+    Arena* m_arena;
+};
+
+/**
+ * @brief STL allocator over a PoolSet, for node-based containers
+ *
+ * Single nodes come from the pool's size classes; arrays (hash buckets,
+ * vector storage) larger than PoolSet::MAX_POOLED_SIZE go to the heap.
+ */
+template <typename T>
+class PoolAllocator
+{
+  public:
+    using value_type = T;
+
+    explicit PoolAllocator(PoolSet& pools) noexcept : m_pools(&pools) {}
+
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : m_pools(other.GetPools())
+    {
+    }
+
+    T* allocate(size_t count) { return static_cast<T*>(m_pools->Allocate(sizeof(T) * count)); }
+    void deallocate(T* memory, size_t count) noexcept { m_pools->Free(memory, sizeof(T) * count); }
+
+    PoolSet* GetPools() const noexcept { return m_pools; }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U>& other) const noexcept
+    {
+        return m_pools == other.GetPools();
+    }
+
+  private:
+    PoolSet* m_pools;
+};
+
+/**
+ * @brief STL allocator on the general heap that charges a subsystem's statistics
+ */
+template <typename T, MemoryTag Tag>
+class TaggedAllocator
+{
+  public:
+    using value_type = T;
+
+    TaggedAllocator() noexcept = default;
+
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U, Tag>&) noexcept
+    {
+    }
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TaggedAllocator<U, Tag>;
+    };
+
+    T* allocate(size_t count)
+    {
+        RecordRequest(Tag, sizeof(T) * count);
+        return static_cast<T*>(HeapAllocate(Tag, sizeof(T) * count));
+    }
+    void deallocate(T* memory, size_t count) noexcept { HeapFree(Tag, memory, sizeof(T) * count); }
+
+    template <typename U>
+    bool operator==(const TaggedAllocator<U, Tag>&) const noexcept
+    {
+        return true;
+    }
+};
+
+// Containers for per-frame and scratch temporaries; construct with the arena
+template <typename T>
+using FrameVector = std::vector<T, ArenaAllocator<T, FrameArena>>;
+using FrameString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char, FrameArena>>;
+
+template <typename T>
+using ScratchVector = std::vector<T, ArenaAllocator<T, LinearArena>>;
+using ScratchString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char, LinearArena>>;
+
+// Node containers on a PoolSet
+template <typename T>
+using PoolList = std::list<T, PoolAllocator<T>>;
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+using PoolMap = std::map<Key, Value, Compare, PoolAllocator<std::pair<const Key, Value>>>;
+
+// Long-lived containers charged to a subsystem
+template <typename T, MemoryTag Tag>
+using TaggedVector = std::vector<T, TaggedAllocator<T, Tag>>;
+} // namespace Memory
@@ -0,0 +1,178 @@
+#include "Particles/ParticleBuffer.h"
+#include "Math/Simd.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cstddef>
+
+namespace Particles
+{
+namespace
+{
+constexpr size_t BILLBOARD_GRAIN = 8192;
+
+// The SSE path writes each vertex as four 16-byte rows:
+// [position, r] [g, b, a, normal.x] [normal.yz, tangent.xy] [tangent.zw, texCoord]
+static_assert(sizeof(Renderer::Vertex) == 16 * sizeof(float), "Billboards are written as four float4 rows");
+static_assert(offsetof(Renderer::Vertex, color) == 3 * sizeof(float), "Unexpected vertex layout");
+static_assert(offsetof(Renderer::Vertex, normal) == 7 * sizeof(float), "Unexpected vertex layout");
+static_assert(offsetof(Renderer::Vertex, tangent) == 10 * sizeof(float), "Unexpected vertex layout");
+static_assert(offsetof(Renderer::Vertex, texCoord) == 14 * sizeof(float), "Unexpected vertex layout");
+// Rows are written with non-temporal stores, which need 16-byte alignment
+static_assert(__STDCPP_DEFAULT_NEW_ALIGNMENT__ >= 16, "Vertex arrays must be 16-byte aligned");
+
+// Top left, top right, bottom left, bottom right
+constexpr float CORNER_RIGHT[4] = {-1.0f, 1.0f, -1.0f, 1.0f};
+constexpr float CORNER_UP[4] = {1.0f, 1.0f, -1.0f, -1.0f};
+constexpr float CORNER_U[4] = {0.0f, 1.0f, 0.0f, 1.0f};
+constexpr float CORNER_V[4] = {0.0f, 0.0f, 1.0f, 1.0f};
+
+// What every billboard of one Update() shares
+struct BillboardFrame
+{
+    Math::Vector3 offsets[4]; // Unit-size corner offsets from the center
+    Math::Vector3 normal;
+    Math::Vector3 tangent;
+    BillboardStyle style;
+};
+
+void WriteBillboards(const Math::Vector3* positions, const float* ages, size_t begin, size_t end,
+                     const BillboardFrame& frame, Renderer::Vertex* vertices)
+{
+    const BillboardStyle& style = frame.style;
+    const float sizeStep = style.endSize - style.startSize;
+
+#if defined(HERMIT_SIMD_SSE2)
+    const __m128 startColor = _mm_loadu_ps(&style.startColor.x);
+    const __m128 colorStep = _mm_sub_ps(_mm_loadu_ps(&style.endColor.x), startColor);
+    const __m128 normalX = _mm_setr_ps(0.0f, 0.0f, 0.0f, frame.normal.x);
+    const __m128 shared = _mm_setr_ps(frame.normal.y, frame.normal.z, frame.tangent.x, frame.tangent.y);
+    __m128 offsets[4], lastRows[4];
+    for (int k = 0; k < 4; ++k)
+    {
+        const Math::Vector3& offset = frame.offsets[k];
+        offsets[k] = _mm_setr_ps(offset.x, offset.y, offset.z, 0.0f);
+        lastRows[k] = _mm_setr_ps(frame.tangent.z, 1.0f, CORNER_U[k], CORNER_V[k]);
+    }
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        const float age = ages[i];
+        const __m128 color = _mm_add_ps(startColor, _mm_mul_ps(colorStep, _mm_set1_ps(age)));
+        const __m128 halfSize = _mm_set1_ps(0.5f * (style.startSize + sizeStep * age));
+        const Math::Vector3& position = positions[i];
+        // [x, y, z, r] and [g, b, a, normal.x] by shifting the color across lanes
+        const __m128 center = _mm_add_ps(_mm_setr_ps(position.x, position.y, position.z, 0.0f),
+                                         _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(color), 12)));
+        const __m128 second = _mm_add_ps(_mm_castsi128_ps(_mm_srli_si128(_mm_castps_si128(color), 4)), normalX);
+
+        // The vertices are only read again by the upload, so bypass the cache
+        float* out = &vertices[ParticleBuffer::VERTICES_PER_PARTICLE * i].position.x;
+        for (int k = 0; k < 4; ++k)
+        {
+            _mm_stream_ps(out, _mm_add_ps(center, _mm_mul_ps(offsets[k], halfSize)));
+            _mm_stream_ps(out + 4, second);
+            _mm_stream_ps(out + 8, shared);
+            _mm_stream_ps(out + 12, lastRows[k]);
+            out += 16;
+        }
+    }
+    // Non-temporal stores are weakly ordered; publish them before the task ends
+    _mm_sfence();
+#else
+    for (size_t i = begin; i < end; ++i)
+    {
+        const float age = ages[i];
+        const Math::Float4 color = style.startColor + (style.endColor - style.startColor) * age;
+        const float halfSize = 0.5f * (style.startSize + sizeStep * age);
+
+        Renderer::Vertex* out = vertices + ParticleBuffer::VERTICES_PER_PARTICLE * i;
+        for (int k = 0; k < 4; ++k)
+        {
+            Renderer::Vertex& vertex = out[k];
+            vertex.position = positions[i] + frame.offsets[k] * halfSize;
+            vertex.color = {color.x, color.y, color.z, color.w};
+            vertex.normal = frame.normal;
+            vertex.tangent = {frame.tangent.x, frame.tangent.y, frame.tangent.z, 1.0f};
+            vertex.texCoord = Math::Vector2(CORNER_U[k], CORNER_V[k]);
+        }
+    }
+#endif
+}
+} // namespace
+
+ParticleBuffer::ParticleBuffer(Renderer::IRenderer& renderer, size_t capacity)
+    : m_renderer(renderer), m_capacity(std::min(capacity, MAX_CAPACITY)),
+      m_vertices(m_capacity * VERTICES_PER_PARTICLE)
+{
+    // Two clockwise triangles per quad: top left, top right, bottom left and
+    // bottom left, top right, bottom right
+    std::vector<uint32_t> indices(m_capacity * INDICES_PER_PARTICLE);
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+        const uint32_t first = static_cast<uint32_t>(i * VERTICES_PER_PARTICLE);
+        uint32_t* quad = indices.data() + i * INDICES_PER_PARTICLE;
+        quad[0] = first;
+        quad[1] = first + 1;
+        quad[2] = first + 2;
+        quad[3] = first + 2;
+        quad[4] = first + 1;
+        quad[5] = first + 3;
+    }
+
+    const uint32_t vertexBytes = static_cast<uint32_t>(m_vertices.size() * sizeof(Renderer::Vertex));
+    const uint32_t indexBytes = static_cast<uint32_t>(indices.size() * sizeof(uint32_t));
+    m_vertexBuffer = m_renderer.CreateBuffer(Renderer::BufferType::VertexBuffer, Renderer::BufferUsage::Dynamic,
+                                             vertexBytes, nullptr);
+    m_indexBuffer = m_renderer.CreateBuffer(Renderer::BufferType::IndexBuffer, Renderer::BufferUsage::Immutable,
+                                            indexBytes, indices.data());
+}
+
+ParticleBuffer::~ParticleBuffer()
+{
+    if (m_vertexBuffer)
+        m_renderer.DestroyBuffer(m_vertexBuffer);
+    if (m_indexBuffer)
+        m_renderer.DestroyBuffer(m_indexBuffer);
+}
+
+size_t ParticleBuffer::Update(const ParticleSystem& system, const Math::Vector3& cameraRight,
+                              const Math::Vector3& cameraUp, const BillboardStyle& style)
+{
+    m_particleCount = std::min(system.GetCount(), m_capacity);
+    if (m_particleCount == 0)
+        return 0;
+
+    BillboardFrame frame;
+    for (int k = 0; k < 4; ++k)
+    {
+        frame.offsets[k] = cameraRight * CORNER_RIGHT[k] + cameraUp * CORNER_UP[k];
+    }
+    frame.normal = Math::Vector3::Cross(cameraUp, cameraRight);
+    frame.tangent = cameraRight;
+    frame.style = style;
+
+    const Math::Vector3* positions = system.GetPositions();
+    const float* ages = system.GetAges();
+    Renderer::Vertex* vertices = m_vertices.data();
+    Threading::ParallelFor(m_particleCount, BILLBOARD_GRAIN, [&](size_t begin, size_t end) {
+        WriteBillboards(positions, ages, begin, end, frame, vertices);
+    });
+
+    const uint32_t vertexBytes =
+        static_cast<uint32_t>(m_particleCount * VERTICES_PER_PARTICLE * sizeof(Renderer::Vertex));
+    m_renderer.UpdateBuffer(m_vertexBuffer, 0, vertexBytes, m_vertices.data());
+    return m_particleCount;
+}
+
+void ParticleBuffer::Draw()
+{
+    if (m_particleCount == 0)
+        return;
+
+    m_renderer.SetVertexBuffer(m_vertexBuffer, sizeof(Renderer::Vertex));
+    m_renderer.SetIndexBuffer(m_indexBuffer);
+    m_renderer.SetPrimitiveTopology(Renderer::PrimitiveTopology::TriangleList);
+    m_renderer.DrawIndexed(static_cast<uint32_t>(m_particleCount * INDICES_PER_PARTICLE));
+}
+
+} // namespace Particles
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Math/Vector.h"
+#include "Math/Vector3.h"
+#include "Particles/ParticleSystem.h"
+#include "Renderer/IRenderer.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Particles
+{
+/**
+ * @brief How a particle's billboard changes over its normalized age
+ *
+ * Size and color are interpolated linearly from the start value at age 0 to
+ * the end value at age 1.
+ */
+struct BillboardStyle
+{
+    float startSize = 0.1f; // Full width of the quad in world units
+    float endSize = 0.1f;
+    Math::Float4 startColor = Math::Float4(1.0f, 1.0f, 1.0f, 1.0f);
+    Math::Float4 endColor = Math::Float4(1.0f, 1.0f, 1.0f, 0.0f);
+};
+
+/**
+ * @brief Camera-facing quads for a ParticleSystem in a dynamic vertex buffer
+ *
+ * Owns a BufferUsage::Dynamic vertex buffer of four vertices per particle
+ * and an immutable index buffer of two triangles per particle, both sized
+ * for a fixed capacity. Update() writes the billboards of the live particles
+ * in parallel straight into the CPU vertex array in upload layout, then
+ * uploads only the part that is in use with one UpdateBuffer; Draw() issues
+ * one DrawIndexed for all of them.
+ *
+ * Quads span cameraRight and cameraUp with their normal along
+ * Cross(cameraUp, cameraRight), toward the viewer, and wind clockwise as
+ * seen from it. Texture coordinates run from (0, 0) at the top left to
+ * (1, 1) at the bottom right. Buffer sizes are 32-bit, which limits the
+ * capacity to MAX_CAPACITY.
+ */
+class ParticleBuffer
+{
+  public:
+    static constexpr uint32_t VERTICES_PER_PARTICLE = 4;
+    static constexpr uint32_t INDICES_PER_PARTICLE = 6;
+    static constexpr size_t MAX_CAPACITY = 0xFFFFFFFFu / (VERTICES_PER_PARTICLE * sizeof(Renderer::Vertex));
+
+    /**
+     * @brief Create the GPU buffers
+     * @param renderer Renderer that owns the buffers; must outlive this object
+     * @param capacity Maximum number of particles drawn; clamped to MAX_CAPACITY
+     */
+    ParticleBuffer(Renderer::IRenderer& renderer, size_t capacity);
+    ~ParticleBuffer();
+
+    ParticleBuffer(const ParticleBuffer&) = delete;
+    ParticleBuffer& operator=(const ParticleBuffer&) = delete;
+
+    /**
+     * @brief Write and upload billboards for the live particles
+     * @param system Particles to draw
+     * @param cameraRight World-space right axis of the view (unit length)
+     * @param cameraUp World-space up axis of the view (unit length)
+     * @param style Size and color over age
+     * @return Number of particles written; at most the capacity
+     */
+    size_t Update(const ParticleSystem& system, const Math::Vector3& cameraRight, const Math::Vector3& cameraUp,
+                  const BillboardStyle& style);
+
+    // Bind the buffers and draw the particles of the last Update(); nothing when empty
+    void Draw();
+
+    size_t GetCapacity() const { return m_capacity; }
+    size_t GetParticleCount() const { return m_particleCount; }
+
+    // CPU-side vertices in upload layout; the first 4 * GetParticleCount() are current
+    const std::vector<Renderer::Vertex>& GetVertices() const
+    {
+        return m_vertices;
+    }
+
+  private:
+    Renderer::IRenderer& m_renderer;
+    size_t m_capacity;
+    size_t m_particleCount = 0;
+    std::vector<Renderer::Vertex> m_vertices;
+    Renderer::BufferHandle m_vertexBuffer = nullptr;
+    Renderer::BufferHandle m_indexBuffer = nullptr;
+};
+
+} // namespace Particles
@@ -0,0 +1,334 @@
+#include "Particles/ParticleSystem.h"
+#include "Math/Simd.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+
+namespace Particles
+{
+namespace
+{
+// Particles sampled per Emit() batch; a multiple of RandomStream::LANES
+constexpr size_t EMIT_BATCH = 256;
+// Particles per Update() task; a multiple of SIMD_WIDTH keeps tasks on whole blocks
+constexpr size_t SIMULATE_GRAIN = 16384;
+
+static_assert(sizeof(Math::Vector3) == 3 * sizeof(float), "Vector3 streams are walked as float arrays");
+static_assert(EMIT_BATCH % Math::RandomStream::LANES == 0, "Emission batches must not split random batches");
+static_assert(SIMULATE_GRAIN % ParticleSystem::SIMD_WIDTH == 0, "Tasks must start on a SIMD block");
+
+#if defined(HERMIT_SIMD_AVX2)
+// Eight Vector3 are 24 floats in three registers. These convert between that
+// layout and one register per component.
+void Deinterleave(const float* source, __m256& x, __m256& y, __m256& z)
+{
+    const __m256 a = _mm256_loadu_ps(source);
+    const __m256 b = _mm256_loadu_ps(source + 8);
+    const __m256 c = _mm256_loadu_ps(source + 16);
+    // Each blend gathers one component, in a rotated lane order the permute undoes
+    const __m256 xs = _mm256_blend_ps(_mm256_blend_ps(a, b, 0x92), c, 0x24);
+    const __m256 ys = _mm256_blend_ps(_mm256_blend_ps(a, b, 0x24), c, 0x49);
+    const __m256 zs = _mm256_blend_ps(_mm256_blend_ps(a, b, 0x49), c, 0x92);
+    x = _mm256_permutevar8x32_ps(xs, _mm256_setr_epi32(0, 3, 6, 1, 4, 7, 2, 5));
+    y = _mm256_permutevar8x32_ps(ys, _mm256_setr_epi32(1, 4, 7, 2, 5, 0, 3, 6));
+    z = _mm256_permutevar8x32_ps(zs, _mm256_setr_epi32(2, 5, 0, 3, 6, 1, 4, 7));
+}
+
+void Interleave(__m256 x, __m256 y, __m256 z, float* destination)
+{
+    const __m256 xs = _mm256_permutevar8x32_ps(x, _mm256_setr_epi32(0, 3, 6, 1, 4, 7, 2, 5));
+    const __m256 ys = _mm256_permutevar8x32_ps(y, _mm256_setr_epi32(5, 0, 3, 6, 1, 4, 7, 2));
+    const __m256 zs = _mm256_permutevar8x32_ps(z, _mm256_setr_epi32(2, 5, 0, 3, 6, 1, 4, 7));
+    _mm256_storeu_ps(destination, _mm256_blend_ps(_mm256_blend_ps(xs, ys, 0x92), zs, 0x24));
+    _mm256_storeu_ps(destination + 8, _mm256_blend_ps(_mm256_blend_ps(xs, ys, 0x24), zs, 0x49));
+    _mm256_storeu_ps(destination + 16, _mm256_blend_ps(_mm256_blend_ps(xs, ys, 0x49), zs, 0x92));
+}
+
+// For each 8-bit survivor mask: the source lanes of the survivors packed into
+// bytes (first survivor in the low byte), and how many there are
+struct CompactTable
+{
+    uint64_t lanes[256];
+    uint8_t counts[256];
+};
+
+constexpr CompactTable MakeCompactTable()
+{
+    CompactTable table{};
+    for (uint32_t mask = 0; mask < 256; ++mask)
+    {
+        uint64_t lanes = 0;
+        uint8_t count = 0;
+        for (uint32_t lane = 0; lane < 8; ++lane)
+        {
+            if (mask & (1u << lane))
+            {
+                lanes |= static_cast<uint64_t>(lane) << (8 * count);
+                ++count;
+            }
+        }
+        table.lanes[mask] = lanes;
+        table.counts[mask] = count;
+    }
+    return table;
+}
+
+constexpr CompactTable COMPACT_TABLE = MakeCompactTable();
+
+// Pack the lanes selected by order to the front of a block of eight Vector3
+void CompactVectors(const float* source, __m256i order, float* destination)
+{
+    __m256 x, y, z;
+    Deinterleave(source, x, y, z);
+    Interleave(_mm256_permutevar8x32_ps(x, order), _mm256_permutevar8x32_ps(y, order),
+               _mm256_permutevar8x32_ps(z, order), destination);
+}
+#endif
+
+// Interleave SoA emission samples into a Vector3 stream
+void StoreVectors(const float* x, const float* y, const float* z, size_t count, Math::Vector3* destination)
+{
+    size_t i = 0;
+#if defined(HERMIT_SIMD_AVX2)
+    for (; i + 8 <= count; i += 8)
+    {
+        Interleave(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), _mm256_loadu_ps(z + i), &destination[i].x);
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        destination[i] = Math::Vector3(x[i], y[i], z[i]);
+    }
+}
+} // namespace
+
+ParticleSystem::ParticleSystem(size_t capacity, uint64_t seed)
+    : m_positions(capacity), m_velocities(capacity), m_ages(capacity), m_agingRates(capacity), m_random(seed),
+      m_scratch(3 * EMIT_BATCH)
+{
+}
+
+void ParticleSystem::SetCollisionResponse(float restitution, float friction)
+{
+    m_restitution = std::max(restitution, 0.0f);
+    m_friction = std::clamp(friction, 0.0f, 1.0f);
+}
+
+size_t ParticleSystem::Emit(const ParticleEmitter& emitter, size_t count)
+{
+    if (emitter.region.IsEmpty() || !(emitter.minLifetime > 0.0f) || emitter.maxLifetime < emitter.minLifetime)
+        return 0;
+
+    count = std::min(count, GetCapacity() - m_count);
+    float* x = m_scratch.data();
+    float* y = x + EMIT_BATCH;
+    float* z = y + EMIT_BATCH;
+    const Math::Vector3& velocity = emitter.velocity;
+    const float spread = emitter.velocitySpread;
+
+    for (size_t done = 0; done < count;)
+    {
+        const size_t batch = std::min(EMIT_BATCH, count - done);
+        const size_t first = m_count + done;
+
+        Math::Sampling::UniformBox(m_random, emitter.region, x, y, z, batch);
+        StoreVectors(x, y, z, batch, &m_positions[first]);
+
+        Math::Sampling::InUnitSphere(m_random, x, y, z, batch);
+        for (size_t i = 0; i < batch; ++i)
+        {
+            x[i] = velocity.x + x[i] * spread;
+            y[i] = velocity.y + y[i] * spread;
+            z[i] = velocity.z + z[i] * spread;
+        }
+        StoreVectors(x, y, z, batch, &m_velocities[first]);
+
+        m_random.FillUniform(x, batch, emitter.minLifetime, emitter.maxLifetime);
+        for (size_t i = 0; i < batch; ++i)
+        {
+            m_ages[first + i] = 0.0f;
+            m_agingRates[first + i] = 1.0f / x[i];
+        }
+        done += batch;
+    }
+
+    m_count += count;
+    return count;
+}
+
+void ParticleSystem::Update(float deltaTime)
+{
+    if (m_count == 0)
+        return;
+
+    Threading::ParallelFor(m_count, SIMULATE_GRAIN,
+                           [this, deltaTime](size_t begin, size_t end) { Simulate(begin, end, deltaTime); });
+    Compact();
+}
+
+void ParticleSystem::Simulate(size_t begin, size_t end, float deltaTime)
+{
+    float* positions = &m_positions[0].x;
+    float* velocities = &m_velocities[0].x;
+    float* ages = m_ages.data();
+    const float* rates = m_agingRates.data();
+    const Math::Vector3 gravity = m_gravity * deltaTime;
+    // Implicit linear damping: stable for any drag and step
+    const float damping = 1.0f / (1.0f + m_drag * deltaTime);
+    // Sliding speed kept, and the factor on the normal speed removed, on a hit
+    const float keep = 1.0f - m_friction;
+    const float rebound = keep + m_restitution;
+
+    size_t i = begin;
+#if defined(HERMIT_SIMD_AVX2)
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 steps = _mm256_set1_ps(deltaTime);
+    const __m256 dampings = _mm256_set1_ps(damping);
+    const __m256 keeps = _mm256_set1_ps(keep);
+    const __m256 rebounds = _mm256_set1_ps(rebound);
+    const __m256 gravityX = _mm256_set1_ps(gravity.x);
+    const __m256 gravityY = _mm256_set1_ps(gravity.y);
+    const __m256 gravityZ = _mm256_set1_ps(gravity.z);
+    for (; i + 8 <= end; i += 8)
+    {
+        float* position = positions + 3 * i;
+        float* velocity = velocities + 3 * i;
+        __m256 px, py, pz, vx, vy, vz;
+        Deinterleave(position, px, py, pz);
+        Deinterleave(velocity, vx, vy, vz);
+
+        vx = _mm256_mul_ps(_mm256_add_ps(vx, gravityX), dampings);
+        vy = _mm256_mul_ps(_mm256_add_ps(vy, gravityY), dampings);
+        vz = _mm256_mul_ps(_mm256_add_ps(vz, gravityZ), dampings);
+        px = _mm256_add_ps(px, _mm256_mul_ps(vx, steps));
+        py = _mm256_add_ps(py, _mm256_mul_ps(vy, steps));
+        pz = _mm256_add_ps(pz, _mm256_mul_ps(vz, steps));
+
+        for (const Math::Plane& plane : m_planes)
+        {
+            const __m256 nx = _mm256_set1_ps(plane.normal.x);
+            const __m256 ny = _mm256_set1_ps(plane.normal.y);
+            const __m256 nz = _mm256_set1_ps(plane.normal.z);
+            const __m256 distance = _mm256_add_ps(
+                _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, px), _mm256_mul_ps(ny, py)), _mm256_mul_ps(nz, pz)),
+                _mm256_set1_ps(plane.distance));
+            const __m256 inside = _mm256_cmp_ps(distance, zero, _CMP_LT_OQ);
+            if (_mm256_movemask_ps(inside) == 0)
+                continue;
+
+            // Back onto the plane
+            const __m256 push = _mm256_and_ps(distance, inside);
+            px = _mm256_sub_ps(px, _mm256_mul_ps(nx, push));
+            py = _mm256_sub_ps(py, _mm256_mul_ps(ny, push));
+            pz = _mm256_sub_ps(pz, _mm256_mul_ps(nz, push));
+
+            // Only particles still moving into the plane respond
+            const __m256 normalSpeed =
+                _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, vx), _mm256_mul_ps(ny, vy)), _mm256_mul_ps(nz, vz));
+            const __m256 hit = _mm256_and_ps(inside, _mm256_cmp_ps(normalSpeed, zero, _CMP_LT_OQ));
+            const __m256 removed = _mm256_mul_ps(normalSpeed, rebounds);
+            vx = _mm256_blendv_ps(vx, _mm256_sub_ps(_mm256_mul_ps(vx, keeps), _mm256_mul_ps(nx, removed)), hit);
+            vy = _mm256_blendv_ps(vy, _mm256_sub_ps(_mm256_mul_ps(vy, keeps), _mm256_mul_ps(ny, removed)), hit);
+            vz = _mm256_blendv_ps(vz, _mm256_sub_ps(_mm256_mul_ps(vz, keeps), _mm256_mul_ps(nz, removed)), hit);
+        }
+
+        Interleave(px, py, pz, position);
+        Interleave(vx, vy, vz, velocity);
+        const __m256 aged = _mm256_add_ps(_mm256_loadu_ps(ages + i), _mm256_mul_ps(_mm256_loadu_ps(rates + i), steps));
+        _mm256_storeu_ps(ages + i, aged);
+    }
+#endif
+
+    for (; i < end; ++i)
+    {
+        float* position = positions + 3 * i;
+        float* velocity = velocities + 3 * i;
+        float vx = (velocity[0] + gravity.x) * damping;
+        float vy = (velocity[1] + gravity.y) * damping;
+        float vz = (velocity[2] + gravity.z) * damping;
+        float px = position[0] + vx * deltaTime;
+        float py = position[1] + vy * deltaTime;
+        float pz = position[2] + vz * deltaTime;
+
+        for (const Math::Plane& plane : m_planes)
+        {
+            const Math::Vector3& n = plane.normal;
+            const float distance = n.x * px + n.y * py + n.z * pz + plane.distance;
+            if (!(distance < 0.0f))
+                continue;
+
+            px -= n.x * distance;
+            py -= n.y * distance;
+            pz -= n.z * distance;
+            const float normalSpeed = n.x * vx + n.y * vy + n.z * vz;
+            if (normalSpeed < 0.0f)
+            {
+                const float removed = normalSpeed * rebound;
+                vx = vx * keep - n.x * removed;
+                vy = vy * keep - n.y * removed;
+                vz = vz * keep - n.z * removed;
+            }
+        }
+
+        position[0] = px;
+        position[1] = py;
+        position[2] = pz;
+        velocity[0] = vx;
+        velocity[1] = vy;
+        velocity[2] = vz;
+        ages[i] += rates[i] * deltaTime;
+    }
+}
+
+void ParticleSystem::Compact()
+{
+    float* ages = m_ages.data();
+    float* rates = m_agingRates.data();
+
+    // Survivors only ever move down, and each block is read before anything
+    // is written over it, so the packing runs in place
+    size_t write = 0;
+    size_t read = 0;
+#if defined(HERMIT_SIMD_AVX2)
+    float* positions = &m_positions[0].x;
+    float* velocities = &m_velocities[0].x;
+    const __m256 one = _mm256_set1_ps(1.0f);
+    for (; read + 8 <= m_count; read += 8)
+    {
+        const __m256 age = _mm256_loadu_ps(ages + read);
+        const uint32_t alive = static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(age, one, _CMP_LT_OQ)));
+        if (alive == 0xFF && write == read)
+        {
+            write += 8;
+            continue;
+        }
+        if (alive == 0)
+            continue;
+
+        // Lanes past the survivors land on slots that are rewritten or dead
+        const __m256i order =
+            _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(&COMPACT_TABLE.lanes[alive])));
+        const __m256 rate = _mm256_loadu_ps(rates + read);
+        _mm256_storeu_ps(ages + write, _mm256_permutevar8x32_ps(age, order));
+        _mm256_storeu_ps(rates + write, _mm256_permutevar8x32_ps(rate, order));
+        CompactVectors(positions + 3 * read, order, positions + 3 * write);
+        CompactVectors(velocities + 3 * read, order, velocities + 3 * write);
+        write += COMPACT_TABLE.counts[alive];
+    }
+#endif
+
+    for (; read < m_count; ++read)
+    {
+        if (!(ages[read] < 1.0f))
+            continue;
+
+        m_positions[write] = m_positions[read];
+        m_velocities[write] = m_velocities[read];
+        ages[write] = ages[read];
+        rates[write] = rates[read];
+        ++write;
+    }
+    m_count = write;
+}
+
+} // namespace Particles
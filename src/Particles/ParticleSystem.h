@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Math/BoundingBox.h"
+#include "Math/Frustum.h"
+#include "Math/Random.h"
+#include "Math/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Particles
+{
+/**
+ * @brief Where and how a batch of particles starts
+ */
+struct ParticleEmitter
+{
+    Math::BoundingBox region;       // Start positions are uniform in this box
+    Math::Vector3 velocity;         // Shared start velocity
+    float velocitySpread = 0.0f;    // Radius of a uniform random ball added to the velocity
+    float minLifetime = 1.0f;       // Seconds; each particle picks uniformly in [min, max)
+    float maxLifetime = 1.0f;
+};
+
+/**
+ * @brief A fixed-capacity pool of particles stored as parallel streams
+ *
+ * Positions and velocities are Math::Vector3 streams and age is a float
+ * stream normalized to [0, 1) over each particle's lifetime. Update() walks
+ * the streams eight particles at a time with AVX2: gravity, drag and
+ * integration, then collision against every plane, then aging. A second pass
+ * removes expired particles by packing the survivors to the front, keeping
+ * their order. Both passes have scalar paths that give the same results.
+ *
+ * Collision planes are Math::Plane; particles stay on the side the normal
+ * points to. A particle that crosses a plane is moved back onto it and its
+ * velocity into the plane is reflected, scaled by the restitution, while
+ * its sliding velocity loses the friction fraction.
+ *
+ * Emit() and Update() do not allocate. Emit() draws from a Math::RandomStream
+ * seeded at construction, so a run is reproducible.
+ */
+class ParticleSystem
+{
+  public:
+    static constexpr size_t SIMD_WIDTH = 8;
+
+    /**
+     * @param capacity Maximum number of live particles
+     * @param seed Seed of the emission random stream
+     */
+    explicit ParticleSystem(size_t capacity, uint64_t seed = 0x853C49E6748FEA9Bull);
+
+    /**
+     * @brief Spawn particles with age zero
+     * @param emitter Start region, velocity and lifetime range
+     * @param count Number of particles wanted
+     * @return Number spawned: fewer when the pool is full, zero if the region
+     *         is empty or the lifetime range is not positive
+     */
+    size_t Emit(const ParticleEmitter& emitter, size_t count);
+
+    /**
+     * @brief Advance every particle and remove the ones that expired
+     * @param deltaTime Seconds to advance
+     */
+    void Update(float deltaTime);
+
+    /**
+     * @brief Remove every particle
+     */
+    void Clear() { m_count = 0; }
+
+    void SetGravity(const Math::Vector3& gravity) { m_gravity = gravity; }
+
+    /**
+     * @param drag Fraction of velocity lost per second (linear damping)
+     */
+    void SetDrag(float drag) { m_drag = drag; }
+
+    /**
+     * @brief Set how particles leave a plane they hit
+     * @param restitution Fraction of the normal speed kept, reflected
+     * @param friction Fraction of the sliding speed removed, in [0, 1]
+     */
+    void SetCollisionResponse(float restitution, float friction);
+
+    void AddPlane(const Math::Plane& plane) { m_planes.push_back(plane); }
+    void ClearPlanes() { m_planes.clear(); }
+
+    size_t GetCount() const { return m_count; }
+    size_t GetCapacity() const { return m_positions.size(); }
+
+    // Streams; the first GetCount() entries are live
+    const Math::Vector3* GetPositions() const { return m_positions.data(); }
+    const Math::Vector3* GetVelocities() const { return m_velocities.data(); }
+    const float* GetAges() const { return m_ages.data(); }
+
+  private:
+    void Simulate(size_t begin, size_t end, float deltaTime);
+    void Compact();
+
+    size_t m_count = 0;
+    std::vector<Math::Vector3> m_positions;
+    std::vector<Math::Vector3> m_velocities;
+    std::vector<float> m_ages;       // Normalized; expired at 1
+    std::vector<float> m_agingRates; // 1 / lifetime
+
+    Math::Vector3 m_gravity = Math::Vector3(0.0f, -9.81f, 0.0f);
+    float m_drag = 0.0f;
+    float m_restitution = 0.5f;
+    float m_friction = 0.1f;
+    std::vector<Math::Plane> m_planes;
+
+    Math::RandomStream m_random;
+    std::vector<float> m_scratch; // Emission batches as separate x, y and z arrays
+};
+
+} // namespace Particles
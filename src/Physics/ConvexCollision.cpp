@@ -0,0 +1,786 @@
+#include "Physics/ConvexCollision.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+namespace Physics
+{
+namespace
+{
+// Squared core distance below which GJK reports overlap
+constexpr float OVERLAP_DISTANCE_SQUARED = 1e-10f;
+// GJK stops when a new support point improves the distance by less than this
+constexpr float GJK_RELATIVE_TOLERANCE = 1e-5f;
+// EPA stops when the polytope is within this of the Minkowski boundary
+constexpr float EPA_TOLERANCE = 1e-4f;
+constexpr uint32_t MAX_EPA_VERTICES = 64;
+constexpr uint32_t MAX_EPA_FACES = 128;
+
+// Inline vector math; Math::Vector3 operations are out of line
+struct Vec
+{
+    float x, y, z;
+};
+
+Vec operator+(const Vec& a, const Vec& b)
+{
+    return {a.x + b.x, a.y + b.y, a.z + b.z};
+}
+
+Vec operator-(const Vec& a, const Vec& b)
+{
+    return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+Vec operator-(const Vec& a)
+{
+    return {-a.x, -a.y, -a.z};
+}
+
+Vec operator*(const Vec& a, float s)
+{
+    return {a.x * s, a.y * s, a.z * s};
+}
+
+float Dot(const Vec& a, const Vec& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+Vec Cross(const Vec& a, const Vec& b)
+{
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+Math::Vector3 ToVector3(const Vec& v)
+{
+    return Math::Vector3(v.x, v.y, v.z);
+}
+
+// A shape with its transform unpacked for support queries
+struct Proxy
+{
+    Proxy(const ConvexShape& shape, const Math::Matrix4x4& transform) : shape(shape), margin(shape.GetMargin())
+    {
+        for (int row = 0; row < 3; ++row)
+        {
+            rotation[row] = {transform.m[row][0], transform.m[row][1], transform.m[row][2]};
+        }
+        translation = {transform.m[3][0], transform.m[3][1], transform.m[3][2]};
+    }
+
+    // Rows of the rotation are the local axes in world space, so the local
+    // direction is the world direction projected onto each row
+    uint32_t Support(const Vec& direction) const
+    {
+        return shape.Support(Dot(rotation[0], direction), Dot(rotation[1], direction), Dot(rotation[2], direction));
+    }
+
+    Vec Vertex(uint32_t index) const
+    {
+        const Math::Vector3 local = shape.GetVertex(index);
+        return rotation[0] * local.x + rotation[1] * local.y + rotation[2] * local.z + translation;
+    }
+
+    const ConvexShape& shape;
+    Vec rotation[3];
+    Vec translation;
+    float margin;
+};
+
+struct SimplexVertex
+{
+    Vec a; // Support point on A
+    Vec b; // Support point on B
+    Vec w; // a - b
+    uint32_t indexA;
+    uint32_t indexB;
+    float lambda; // Barycentric weight of the closest point
+};
+
+struct Simplex
+{
+    SimplexVertex v[4];
+    uint32_t count = 0;
+
+    Vec ClosestPoint() const
+    {
+        Vec result = {0.0f, 0.0f, 0.0f};
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            result = result + v[i].w * v[i].lambda;
+        }
+        return result;
+    }
+
+    void Witnesses(Vec& outA, Vec& outB) const
+    {
+        outA = outB = {0.0f, 0.0f, 0.0f};
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            outA = outA + v[i].a * v[i].lambda;
+            outB = outB + v[i].b * v[i].lambda;
+        }
+    }
+};
+
+SimplexVertex MakeVertex(const Proxy& proxyA, const Proxy& proxyB, uint32_t indexA, uint32_t indexB)
+{
+    SimplexVertex vertex;
+    vertex.a = proxyA.Vertex(indexA);
+    vertex.b = proxyB.Vertex(indexB);
+    vertex.w = vertex.a - vertex.b;
+    vertex.indexA = indexA;
+    vertex.indexB = indexB;
+    vertex.lambda = 1.0f;
+    return vertex;
+}
+
+// Each solver finds the point of the simplex closest to the origin, drops
+// the vertices that do not contribute and sets the weights of the rest
+
+void SolveSegment(Simplex& s)
+{
+    const Vec edge = s.v[1].w - s.v[0].w;
+    const float t = -Dot(s.v[0].w, edge);
+    const float lengthSquared = Dot(edge, edge);
+    if (t <= 0.0f || lengthSquared <= 0.0f)
+    {
+        s.v[0].lambda = 1.0f;
+        s.count = 1;
+    }
+    else if (t >= lengthSquared)
+    {
+        s.v[0] = s.v[1];
+        s.v[0].lambda = 1.0f;
+        s.count = 1;
+    }
+    else
+    {
+        s.v[1].lambda = t / lengthSquared;
+        s.v[0].lambda = 1.0f - s.v[1].lambda;
+    }
+}
+
+void KeepVertex(Simplex& s, uint32_t i)
+{
+    s.v[0] = s.v[i];
+    s.v[0].lambda = 1.0f;
+    s.count = 1;
+}
+
+void KeepEdge(Simplex& s, uint32_t i, uint32_t j, float t)
+{
+    const SimplexVertex first = s.v[i], second = s.v[j];
+    s.v[0] = first;
+    s.v[1] = second;
+    s.v[0].lambda = 1.0f - t;
+    s.v[1].lambda = t;
+    s.count = 2;
+}
+
+// Voronoi regions of a triangle (Ericson, Real-Time Collision Detection 5.1.5)
+void SolveTriangle(Simplex& s)
+{
+    const Vec a = s.v[0].w, b = s.v[1].w, c = s.v[2].w;
+    const Vec ab = b - a, ac = c - a;
+
+    const float d1 = -Dot(ab, a), d2 = -Dot(ac, a);
+    if (d1 <= 0.0f && d2 <= 0.0f)
+    {
+        return KeepVertex(s, 0);
+    }
+    const float d3 = -Dot(ab, b), d4 = -Dot(ac, b);
+    if (d3 >= 0.0f && d4 <= d3)
+    {
+        return KeepVertex(s, 1);
+    }
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+    {
+        return KeepEdge(s, 0, 1, d1 / (d1 - d3));
+    }
+    const float d5 = -Dot(ab, c), d6 = -Dot(ac, c);
+    if (d6 >= 0.0f && d5 <= d6)
+    {
+        return KeepVertex(s, 2);
+    }
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+    {
+        return KeepEdge(s, 0, 2, d2 / (d2 - d6));
+    }
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+    {
+        return KeepEdge(s, 1, 2, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    const float sum = va + vb + vc;
+    if (sum <= 0.0f)
+    {
+        // Degenerate triangle: fall back to its nearest edge
+        Simplex best = s;
+        float bestDistance = FLT_MAX;
+        const uint32_t edges[3][2] = {{0, 1}, {1, 2}, {2, 0}};
+        for (const auto& edge : edges)
+        {
+            Simplex candidate;
+            candidate.v[0] = s.v[edge[0]];
+            candidate.v[1] = s.v[edge[1]];
+            candidate.count = 2;
+            SolveSegment(candidate);
+            const Vec closest = candidate.ClosestPoint();
+            const float distance = Dot(closest, closest);
+            if (distance < bestDistance)
+            {
+                bestDistance = distance;
+                best = candidate;
+            }
+        }
+        s = best;
+        return;
+    }
+    s.v[1].lambda = vb / sum;
+    s.v[2].lambda = vc / sum;
+    s.v[0].lambda = 1.0f - s.v[1].lambda - s.v[2].lambda;
+}
+
+// Returns false if the origin is inside the tetrahedron; otherwise reduces
+// to the closest face the origin lies outside of
+bool SolveTetrahedron(Simplex& s)
+{
+    static const uint32_t faces[4][4] = {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+    Simplex best;
+    float bestDistance = FLT_MAX;
+    bool outside = false;
+    for (const auto& face : faces)
+    {
+        const Vec a = s.v[face[0]].w, b = s.v[face[1]].w, c = s.v[face[2]].w, d = s.v[face[3]].w;
+        const Vec normal = Cross(b - a, c - a);
+        const float originSide = -Dot(a, normal);
+        const float oppositeSide = Dot(d - a, normal);
+        // A flat tetrahedron encloses nothing, so every face is a candidate
+        const bool flat = std::fabs(oppositeSide) <= FLT_EPSILON * Dot(normal, normal);
+        if (!flat && originSide * oppositeSide >= 0.0f)
+        {
+            continue;
+        }
+
+        outside = true;
+        Simplex candidate;
+        candidate.v[0] = s.v[face[0]];
+        candidate.v[1] = s.v[face[1]];
+        candidate.v[2] = s.v[face[2]];
+        candidate.count = 3;
+        SolveTriangle(candidate);
+        const Vec closest = candidate.ClosestPoint();
+        const float distance = Dot(closest, closest);
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+            best = candidate;
+        }
+    }
+
+    if (outside)
+    {
+        s = best;
+    }
+    return outside;
+}
+
+struct GjkOutput
+{
+    bool overlap = false;
+    float distance = 0.0f; // Between the cores
+    Vec pointA = {0.0f, 0.0f, 0.0f};
+    Vec pointB = {0.0f, 0.0f, 0.0f};
+    uint32_t iterations = 0;
+};
+
+// GJK on the cores. Stops early once the cores are provably farther apart
+// than earlyOutDistance.
+void RunGjk(const Proxy& proxyA, const Proxy& proxyB, Simplex& s, SimplexCache* cache, float earlyOutDistance,
+            GjkOutput& out)
+{
+    s.count = 0;
+    if (cache && cache->count > 0 && cache->count <= 4)
+    {
+        for (uint32_t i = 0; i < cache->count; ++i)
+        {
+            s.v[i] = MakeVertex(proxyA, proxyB, cache->indexA[i], cache->indexB[i]);
+        }
+        s.count = cache->count;
+    }
+    else
+    {
+        const Vec direction = proxyB.translation - proxyA.translation;
+        s.v[0] = MakeVertex(proxyA, proxyB, proxyA.Support(direction), proxyB.Support(-direction));
+        s.count = 1;
+    }
+
+    bool separated = false;
+    while (true)
+    {
+        switch (s.count)
+        {
+        case 2:
+            SolveSegment(s);
+            break;
+        case 3:
+            SolveTriangle(s);
+            break;
+        case 4:
+            out.overlap = !SolveTetrahedron(s);
+            break;
+        default:
+            s.v[0].lambda = 1.0f;
+            break;
+        }
+        if (out.overlap)
+        {
+            break;
+        }
+
+        const Vec v = s.ClosestPoint();
+        const float vv = Dot(v, v);
+        if (vv <= OVERLAP_DISTANCE_SQUARED)
+        {
+            out.overlap = true;
+            break;
+        }
+        if (out.iterations == ConvexCollision::MAX_GJK_ITERATIONS)
+        {
+            break;
+        }
+
+        const Vec direction = -v;
+        const uint32_t indexA = proxyA.Support(direction);
+        const uint32_t indexB = proxyB.Support(v);
+        const SimplexVertex vertex = MakeVertex(proxyA, proxyB, indexA, indexB);
+        ++out.iterations;
+
+        // The support plane bounds the distance from below
+        const float vw = Dot(v, vertex.w);
+        if (vw > 0.0f && vw * vw > earlyOutDistance * earlyOutDistance * vv)
+        {
+            separated = true;
+            break;
+        }
+        if (vv - vw <= GJK_RELATIVE_TOLERANCE * vv)
+        {
+            break;
+        }
+        bool duplicate = false;
+        for (uint32_t i = 0; i < s.count; ++i)
+        {
+            duplicate |= s.v[i].indexA == indexA && s.v[i].indexB == indexB;
+        }
+        if (duplicate)
+        {
+            break;
+        }
+        s.v[s.count++] = vertex;
+    }
+
+    if (cache)
+    {
+        cache->count = s.count;
+        for (uint32_t i = 0; i < s.count; ++i)
+        {
+            cache->indexA[i] = s.v[i].indexA;
+            cache->indexB[i] = s.v[i].indexB;
+        }
+    }
+
+    if (out.overlap)
+    {
+        out.distance = 0.0f;
+        return;
+    }
+    s.Witnesses(out.pointA, out.pointB);
+    const Vec difference = out.pointB - out.pointA;
+    out.distance = std::sqrt(Dot(difference, difference));
+    if (separated)
+    {
+        out.distance = std::max(out.distance, earlyOutDistance);
+    }
+}
+
+struct EpaVertex
+{
+    Vec a, b, w;
+};
+
+struct EpaFace
+{
+    uint32_t v[3];
+    Vec normal;
+    float distance;
+    bool live;
+};
+
+class Epa
+{
+  public:
+    Epa(const Proxy& proxyA, const Proxy& proxyB) : m_proxyA(proxyA), m_proxyB(proxyB) {}
+
+    // Expands GJK's final simplex into the penetration normal and depth of
+    // the cores; returns false if the overlap is too shallow to resolve
+    bool Run(const Simplex& s, Vec& outNormal, float& outDepth, Vec& outPointA, Vec& outPointB,
+             uint32_t& outIterations);
+
+  private:
+    uint32_t AddVertex(const Vec& direction)
+    {
+        const SimplexVertex vertex =
+            MakeVertex(m_proxyA, m_proxyB, m_proxyA.Support(direction), m_proxyB.Support(-direction));
+        m_vertices[m_vertexCount] = {vertex.a, vertex.b, vertex.w};
+        return m_vertexCount++;
+    }
+
+    bool AddFace(uint32_t a, uint32_t b, uint32_t c);
+    bool BuildTetrahedron(const Simplex& s);
+
+    const Proxy& m_proxyA;
+    const Proxy& m_proxyB;
+    EpaVertex m_vertices[MAX_EPA_VERTICES];
+    EpaFace m_faces[MAX_EPA_FACES];
+    uint32_t m_vertexCount = 0;
+    uint32_t m_faceCount = 0;
+};
+
+bool Epa::AddFace(uint32_t a, uint32_t b, uint32_t c)
+{
+    // Reuse a removed slot before growing
+    uint32_t slot = m_faceCount;
+    for (uint32_t i = 0; i < m_faceCount; ++i)
+    {
+        if (!m_faces[i].live)
+        {
+            slot = i;
+            break;
+        }
+    }
+    if (slot == MAX_EPA_FACES)
+    {
+        return false;
+    }
+    m_faceCount = std::max(m_faceCount, slot + 1);
+
+    EpaFace& face = m_faces[slot];
+    face.v[0] = a;
+    face.v[1] = b;
+    face.v[2] = c;
+    face.live = true;
+    const Vec normal = Cross(m_vertices[b].w - m_vertices[a].w, m_vertices[c].w - m_vertices[a].w);
+    const float length = std::sqrt(Dot(normal, normal));
+    if (length <= 0.0f)
+    {
+        // A sliver never becomes the closest face
+        face.normal = {0.0f, 0.0f, 0.0f};
+        face.distance = FLT_MAX;
+        return true;
+    }
+    face.normal = normal * (1.0f / length);
+    face.distance = Dot(face.normal, m_vertices[a].w);
+    return true;
+}
+
+bool Epa::BuildTetrahedron(const Simplex& s)
+{
+    m_vertexCount = 0;
+    for (uint32_t i = 0; i < s.count; ++i)
+    {
+        m_vertices[m_vertexCount++] = {s.v[i].a, s.v[i].b, s.v[i].w};
+    }
+
+    // GJK can stop on a point, segment or triangle touching the origin;
+    // grow it into a tetrahedron with support points in new directions
+    const float tolerance = EPA_TOLERANCE * EPA_TOLERANCE;
+    if (m_vertexCount == 1)
+    {
+        const Vec axes[6] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+        for (const Vec& axis : axes)
+        {
+            const uint32_t added = AddVertex(axis);
+            const Vec offset = m_vertices[added].w - m_vertices[0].w;
+            if (Dot(offset, offset) > tolerance)
+            {
+                break;
+            }
+            --m_vertexCount;
+        }
+    }
+    if (m_vertexCount == 2)
+    {
+        const Vec edge = m_vertices[1].w - m_vertices[0].w;
+        const Vec axis = std::fabs(edge.x) < std::fabs(edge.y)
+                             ? (std::fabs(edge.x) < std::fabs(edge.z) ? Vec{1, 0, 0} : Vec{0, 0, 1})
+                             : (std::fabs(edge.y) < std::fabs(edge.z) ? Vec{0, 1, 0} : Vec{0, 0, 1});
+        const Vec first = Cross(edge, axis);
+        const Vec second = Cross(edge, first);
+        const Vec directions[4] = {first, -first, second, -second};
+        for (const Vec& direction : directions)
+        {
+            const uint32_t added = AddVertex(direction);
+            const Vec offset = Cross(m_vertices[added].w - m_vertices[0].w, edge);
+            if (Dot(offset, offset) > tolerance * Dot(edge, edge))
+            {
+                break;
+            }
+            --m_vertexCount;
+        }
+    }
+    if (m_vertexCount == 3)
+    {
+        const Vec normal = Cross(m_vertices[1].w - m_vertices[0].w, m_vertices[2].w - m_vertices[0].w);
+        const float scale = std::sqrt(Dot(normal, normal));
+        for (const Vec& direction : {normal, -normal})
+        {
+            const uint32_t added = AddVertex(direction);
+            if (std::fabs(Dot(m_vertices[added].w - m_vertices[0].w, normal)) > EPA_TOLERANCE * scale)
+            {
+                break;
+            }
+            --m_vertexCount;
+        }
+    }
+    if (m_vertexCount != 4)
+    {
+        return false;
+    }
+
+    // Wind every face away from the opposite vertex
+    m_faceCount = 0;
+    const uint32_t faces[4][4] = {{0, 1, 2, 3}, {0, 3, 1, 2}, {0, 2, 3, 1}, {1, 3, 2, 0}};
+    const Vec a = m_vertices[0].w;
+    const float volume = Dot(Cross(m_vertices[1].w - a, m_vertices[2].w - a), m_vertices[3].w - a);
+    if (std::fabs(volume) <= FLT_EPSILON)
+    {
+        return false;
+    }
+    for (const auto& face : faces)
+    {
+        if (volume > 0.0f)
+        {
+            AddFace(face[0], face[2], face[1]);
+        }
+        else
+        {
+            AddFace(face[0], face[1], face[2]);
+        }
+    }
+    return true;
+}
+
+bool Epa::Run(const Simplex& s, Vec& outNormal, float& outDepth, Vec& outPointA, Vec& outPointB,
+              uint32_t& outIterations)
+{
+    if (!BuildTetrahedron(s))
+    {
+        return false;
+    }
+
+    struct Edge
+    {
+        uint32_t a, b;
+    };
+    Edge horizon[3 * MAX_EPA_FACES];
+
+    uint32_t closest = 0;
+    for (uint32_t iteration = 0;; ++iteration)
+    {
+        closest = MAX_EPA_FACES;
+        float closestDistance = FLT_MAX;
+        for (uint32_t i = 0; i < m_faceCount; ++i)
+        {
+            if (m_faces[i].live && m_faces[i].distance < closestDistance)
+            {
+                closestDistance = m_faces[i].distance;
+                closest = i;
+            }
+        }
+        if (closest == MAX_EPA_FACES)
+        {
+            return false;
+        }
+        outIterations = iteration;
+        if (iteration == ConvexCollision::MAX_EPA_ITERATIONS || m_vertexCount == MAX_EPA_VERTICES)
+        {
+            break;
+        }
+
+        // Converged once the boundary is no farther than the closest face
+        const Vec normal = m_faces[closest].normal;
+        const uint32_t added = AddVertex(normal);
+        const Vec w = m_vertices[added].w;
+        if (Dot(w, normal) - closestDistance <= EPA_TOLERANCE * std::max(1.0f, closestDistance))
+        {
+            --m_vertexCount;
+            break;
+        }
+
+        // Remove the faces the new point sees; edges shared by two removed
+        // faces cancel, leaving the horizon
+        uint32_t edgeCount = 0;
+        for (uint32_t i = 0; i < m_faceCount; ++i)
+        {
+            EpaFace& face = m_faces[i];
+            if (!face.live || Dot(face.normal, w - m_vertices[face.v[0]].w) <= 0.0f)
+            {
+                continue;
+            }
+            face.live = false;
+            for (uint32_t k = 0; k < 3; ++k)
+            {
+                const Edge edge = {face.v[k], face.v[(k + 1) % 3]};
+                bool cancelled = false;
+                for (uint32_t e = 0; e < edgeCount; ++e)
+                {
+                    if (horizon[e].a == edge.b && horizon[e].b == edge.a)
+                    {
+                        horizon[e] = horizon[--edgeCount];
+                        cancelled = true;
+                        break;
+                    }
+                }
+                if (!cancelled)
+                {
+                    horizon[edgeCount++] = edge;
+                }
+            }
+        }
+
+        bool full = false;
+        for (uint32_t e = 0; e < edgeCount && !full; ++e)
+        {
+            full = !AddFace(horizon[e].a, horizon[e].b, added);
+        }
+        if (full)
+        {
+            break;
+        }
+    }
+
+    // Project the origin onto the closest face and carry its barycentric
+    // coordinates over to the support points on A and B
+    for (uint32_t i = 0; i < m_faceCount; ++i)
+    {
+        if (m_faces[i].live && m_faces[i].distance < m_faces[closest].distance)
+        {
+            closest = i;
+        }
+    }
+    const EpaFace& face = m_faces[closest];
+    const EpaVertex& v0 = m_vertices[face.v[0]];
+    const EpaVertex& v1 = m_vertices[face.v[1]];
+    const EpaVertex& v2 = m_vertices[face.v[2]];
+    const Vec p = face.normal * face.distance;
+    const Vec e0 = v1.w - v0.w, e1 = v2.w - v0.w, offset = p - v0.w;
+    const float d00 = Dot(e0, e0), d01 = Dot(e0, e1), d11 = Dot(e1, e1);
+    const float d20 = Dot(offset, e0), d21 = Dot(offset, e1);
+    const float denominator = d00 * d11 - d01 * d01;
+    float u = 1.0f / 3.0f, v = 1.0f / 3.0f;
+    if (denominator > 0.0f)
+    {
+        u = (d11 * d20 - d01 * d21) / denominator;
+        v = (d00 * d21 - d01 * d20) / denominator;
+    }
+    const float t = 1.0f - u - v;
+
+    outNormal = face.normal;
+    outDepth = face.distance;
+    outPointA = v0.a * t + v1.a * u + v2.a * v;
+    outPointB = v0.b * t + v1.b * u + v2.b * v;
+    return true;
+}
+} // namespace
+
+bool ConvexCollision::Distance(const ConvexShape& a, const Math::Matrix4x4& transformA, const ConvexShape& b,
+                               const Math::Matrix4x4& transformB, DistanceResult& outResult, SimplexCache* cache)
+{
+    const Proxy proxyA(a, transformA), proxyB(b, transformB);
+    Simplex simplex;
+    GjkOutput gjk;
+    RunGjk(proxyA, proxyB, simplex, cache, FLT_MAX, gjk);
+
+    outResult.iterations = gjk.iterations;
+    const float margins = proxyA.margin + proxyB.margin;
+    if (gjk.overlap || gjk.distance <= margins)
+    {
+        outResult.distance = 0.0f;
+        outResult.pointA = ToVector3(gjk.pointA);
+        outResult.pointB = ToVector3(gjk.pointB);
+        return false;
+    }
+
+    // Move the core points out to the swept surfaces
+    const Vec normal = (gjk.pointB - gjk.pointA) * (1.0f / gjk.distance);
+    outResult.distance = gjk.distance - margins;
+    outResult.pointA = ToVector3(gjk.pointA + normal * proxyA.margin);
+    outResult.pointB = ToVector3(gjk.pointB - normal * proxyB.margin);
+    return true;
+}
+
+bool ConvexCollision::Intersect(const ConvexShape& a, const Math::Matrix4x4& transformA, const ConvexShape& b,
+                                const Math::Matrix4x4& transformB, SimplexCache* cache)
+{
+    const Proxy proxyA(a, transformA), proxyB(b, transformB);
+    Simplex simplex;
+    GjkOutput gjk;
+    const float margins = proxyA.margin + proxyB.margin;
+    RunGjk(proxyA, proxyB, simplex, cache, margins, gjk);
+    return gjk.overlap || gjk.distance <= margins;
+}
+
+bool ConvexCollision::Penetration(const ConvexShape& a, const Math::Matrix4x4& transformA, const ConvexShape& b,
+                                  const Math::Matrix4x4& transformB, ContactResult& outContact, SimplexCache* cache)
+{
+    const Proxy proxyA(a, transformA), proxyB(b, transformB);
+    Simplex simplex;
+    GjkOutput gjk;
+    const float margins = proxyA.margin + proxyB.margin;
+    RunGjk(proxyA, proxyB, simplex, cache, margins, gjk);
+    outContact.iterations = gjk.iterations;
+
+    Vec normal, pointA, pointB;
+    float depth;
+    if (!gjk.overlap)
+    {
+        if (gjk.distance > margins)
+        {
+            return false;
+        }
+        // Only the margins overlap: the normal joins the closest core points
+        normal = (gjk.pointB - gjk.pointA) * (1.0f / gjk.distance);
+        depth = margins - gjk.distance;
+        pointA = gjk.pointA;
+        pointB = gjk.pointB;
+    }
+    else
+    {
+        Epa epa(proxyA, proxyB);
+        uint32_t epaIterations = 0;
+        if (!epa.Run(simplex, normal, depth, pointA, pointB, epaIterations))
+        {
+            // The cores only touch; push apart along the line between centres
+            normal = proxyB.translation - proxyA.translation;
+            const float length = std::sqrt(Dot(normal, normal));
+            normal = length > 0.0f ? normal * (1.0f / length) : Vec{0.0f, 1.0f, 0.0f};
+            depth = 0.0f;
+            simplex.Witnesses(pointA, pointB);
+        }
+        depth += margins;
+        outContact.iterations += epaIterations;
+    }
+
+    outContact.normal = ToVector3(normal);
+    outContact.depth = depth;
+    outContact.pointA = ToVector3(pointA + normal * proxyA.margin);
+    outContact.pointB = ToVector3(pointB - normal * proxyB.margin);
+    return true;
+}
+
+} // namespace Physics
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Math/Matrix4x4.h"
+#include "Math/Vector3.h"
+#include "Physics/ConvexShape.h"
+#include <cstdint>
+
+namespace Physics
+{
+/**
+ * @brief GJK simplex from a previous query, identified by support vertex indices
+ *
+ * Keep one per shape pair and pass it back the next frame; GJK then starts
+ * from last frame's simplex at the new transforms and usually needs one or
+ * two iterations instead of several.
+ */
+struct SimplexCache
+{
+    uint32_t count = 0;
+    uint32_t indexA[4] = {};
+    uint32_t indexB[4] = {};
+};
+
+struct DistanceResult
+{
+    float distance = 0.0f;  // Between the surfaces; 0 when the shapes overlap
+    Math::Vector3 pointA;   // Closest point on A, world space
+    Math::Vector3 pointB;   // Closest point on B, world space
+    uint32_t iterations = 0;
+};
+
+struct ContactResult
+{
+    Math::Vector3 normal;  // Unit direction from A to B; moving B by normal * depth separates the shapes
+    float depth = 0.0f;
+    Math::Vector3 pointA;  // Deepest point of A inside B, world space
+    Math::Vector3 pointB;  // Deepest point of B inside A, world space
+    uint32_t iterations = 0; // GJK plus EPA iterations
+};
+
+/**
+ * @brief GJK distance and intersection queries with EPA penetration depth
+ *
+ * Transforms are rigid (rotation and translation, no scale) in the row-vector
+ * convention of Math::Matrix4x4. GJK works on the shapes' core polytopes and
+ * adds the margins of spheres and capsules at the end; EPA only runs when
+ * the cores themselves overlap. Neither allocates.
+ */
+class ConvexCollision
+{
+  public:
+    static constexpr uint32_t MAX_GJK_ITERATIONS = 32;
+    static constexpr uint32_t MAX_EPA_ITERATIONS = 64;
+
+    /**
+     * @brief Compute the distance and closest points between two shapes
+     * @param a First shape
+     * @param transformA Local-to-world transform of a
+     * @param b Second shape
+     * @param transformB Local-to-world transform of b
+     * @param outResult Receives the distance and closest points
+     * @param cache Simplex to start from and to update; may be null
+     * @return True if the shapes are separated
+     * @note When the shapes overlap, the points are only meaningful for
+     *       margin-only overlap; use Penetration() for contact data
+     */
+    static bool Distance(const ConvexShape& a, const Math::Matrix4x4& transformA, const ConvexShape& b,
+                         const Math::Matrix4x4& transformB, DistanceResult& outResult, SimplexCache* cache = nullptr);
+
+    /**
+     * @brief Test whether two shapes overlap
+     * @return True if they overlap or touch
+     * @note Stops as soon as GJK finds a separating direction
+     */
+    static bool Intersect(const ConvexShape& a, const Math::Matrix4x4& transformA, const ConvexShape& b,
+                          const Math::Matrix4x4& transformB, SimplexCache* cache = nullptr);
+
+    /**
+     * @brief Compute the penetration normal, depth and contact points
+     * @param outContact Receives the contact when the shapes overlap
+     * @return True if the shapes overlap
+     */
+    static bool Penetration(const ConvexShape& a, const Math::Matrix4x4& transformA, const ConvexShape& b,
+                            const Math::Matrix4x4& transformB, ContactResult& outContact,
+                            SimplexCache* cache = nullptr);
+};
+
+} // namespace Physics
@@ -0,0 +1,175 @@
+#include "Physics/ConvexShape.h"
+#include "Math/Simd.h"
+#include <cassert>
+
+namespace Physics
+{
+bool ConvexPolytope::Build(const Math::Vector3* points, size_t count)
+{
+    Geometry::ConvexHull hull;
+    if (!Geometry::ConvexHullBuilder::Build(points, count, hull))
+    {
+        m_count = 0;
+        m_x.clear();
+        m_y.clear();
+        m_z.clear();
+        return false;
+    }
+    Build(hull);
+    return true;
+}
+
+void ConvexPolytope::Build(const Geometry::ConvexHull& hull)
+{
+    m_count = hull.vertices.size();
+    const size_t padded = (m_count + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH;
+    m_x.resize(padded);
+    m_y.resize(padded);
+    m_z.resize(padded);
+    for (size_t i = 0; i < padded; ++i)
+    {
+        const Math::Vector3& vertex = hull.vertices[i < m_count ? i : m_count - 1];
+        m_x[i] = vertex.x;
+        m_y[i] = vertex.y;
+        m_z[i] = vertex.z;
+    }
+}
+
+size_t ConvexPolytope::GetVertexCount() const
+{
+    return m_count;
+}
+
+Math::Vector3 ConvexPolytope::GetVertex(uint32_t index) const
+{
+    return Math::Vector3(m_x[index], m_y[index], m_z[index]);
+}
+
+uint32_t ConvexPolytope::Support(float dx, float dy, float dz) const
+{
+    assert(m_count > 0 && "Support() needs at least one vertex");
+    const size_t padded = m_x.size();
+#if defined(HERMIT_SIMD_AVX2)
+    // Per-lane running maximum, then a reduction that prefers lower indices.
+    // Padding repeats the last vertex, so it never beats the original.
+    const __m256 directionX = _mm256_set1_ps(dx), directionY = _mm256_set1_ps(dy), directionZ = _mm256_set1_ps(dz);
+    __m256 best = _mm256_set1_ps(-3.402823466e38f);
+    __m256i bestIndex = _mm256_setzero_si256();
+    __m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i step = _mm256_set1_epi32(static_cast<int>(SIMD_WIDTH));
+    for (size_t i = 0; i < padded; i += SIMD_WIDTH)
+    {
+        const __m256 dot = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(m_x.data() + i), directionX),
+                          _mm256_mul_ps(_mm256_loadu_ps(m_y.data() + i), directionY)),
+            _mm256_mul_ps(_mm256_loadu_ps(m_z.data() + i), directionZ));
+        const __m256 greater = _mm256_cmp_ps(dot, best, _CMP_GT_OQ);
+        best = _mm256_blendv_ps(best, dot, greater);
+        bestIndex = _mm256_blendv_epi8(bestIndex, index, _mm256_castps_si256(greater));
+        index = _mm256_add_epi32(index, step);
+    }
+
+    alignas(32) float values[SIMD_WIDTH];
+    alignas(32) uint32_t indices[SIMD_WIDTH];
+    _mm256_store_ps(values, best);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(indices), bestIndex);
+    uint32_t result = indices[0];
+    float resultValue = values[0];
+    for (size_t lane = 1; lane < SIMD_WIDTH; ++lane)
+    {
+        if (values[lane] > resultValue || (values[lane] == resultValue && indices[lane] < result))
+        {
+            resultValue = values[lane];
+            result = indices[lane];
+        }
+    }
+    return result;
+#else
+    uint32_t result = 0;
+    float resultValue = -3.402823466e38f;
+    for (size_t i = 0; i < padded; ++i)
+    {
+        const float dot = m_x[i] * dx + m_y[i] * dy + m_z[i] * dz;
+        if (dot > resultValue)
+        {
+            resultValue = dot;
+            result = static_cast<uint32_t>(i);
+        }
+    }
+    return result;
+#endif
+}
+
+ConvexShape ConvexShape::Sphere(float radius)
+{
+    ConvexShape shape;
+    shape.type = ShapeType::Sphere;
+    shape.radius = radius;
+    return shape;
+}
+
+ConvexShape ConvexShape::Box(const Math::Vector3& halfExtents)
+{
+    ConvexShape shape;
+    shape.type = ShapeType::Box;
+    shape.halfExtents = halfExtents;
+    return shape;
+}
+
+ConvexShape ConvexShape::Capsule(float radius, float halfHeight)
+{
+    ConvexShape shape;
+    shape.type = ShapeType::Capsule;
+    shape.radius = radius;
+    shape.halfHeight = halfHeight;
+    return shape;
+}
+
+ConvexShape ConvexShape::Hull(const ConvexPolytope& polytope)
+{
+    ConvexShape shape;
+    shape.type = ShapeType::Hull;
+    shape.polytope = polytope.GetVertexCount() > 0 ? &polytope : nullptr;
+    return shape;
+}
+
+float ConvexShape::GetMargin() const
+{
+    return type == ShapeType::Sphere || type == ShapeType::Capsule ? radius : 0.0f;
+}
+
+uint32_t ConvexShape::Support(float dx, float dy, float dz) const
+{
+    switch (type)
+    {
+    case ShapeType::Box:
+        // Corner bits select the positive side of x, y and z
+        return (dx >= 0.0f ? 1u : 0u) | (dy >= 0.0f ? 2u : 0u) | (dz >= 0.0f ? 4u : 0u);
+    case ShapeType::Capsule:
+        return dy >= 0.0f ? 1u : 0u;
+    case ShapeType::Hull:
+        return polytope->Support(dx, dy, dz);
+    case ShapeType::Sphere:
+    default:
+        return 0;
+    }
+}
+
+Math::Vector3 ConvexShape::GetVertex(uint32_t index) const
+{
+    switch (type)
+    {
+    case ShapeType::Box:
+        return Math::Vector3(index & 1 ? halfExtents.x : -halfExtents.x, index & 2 ? halfExtents.y : -halfExtents.y,
+                             index & 4 ? halfExtents.z : -halfExtents.z);
+    case ShapeType::Capsule:
+        return Math::Vector3(0.0f, index ? halfHeight : -halfHeight, 0.0f);
+    case ShapeType::Hull:
+        return polytope->GetVertex(index);
+    case ShapeType::Sphere:
+    default:
+        return Math::Vector3();
+    }
+}
+
+} // namespace Physics
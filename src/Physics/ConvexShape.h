@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Geometry/ConvexHull.h"
+#include "Math/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Physics
+{
+/**
+ * @brief Vertices of a convex polytope laid out for fast support queries
+ *
+ * Coordinates are stored as separate x, y and z arrays padded to a multiple
+ * of SIMD_WIDTH with copies of the last vertex, so Support() tests eight
+ * vertices per AVX2 step without a scalar tail.
+ */
+class ConvexPolytope
+{
+  public:
+    static constexpr size_t SIMD_WIDTH = 8;
+
+    /**
+     * @brief Keep the hull vertices of a point cloud
+     * @param points Input points; interior points are discarded
+     * @param count Number of points
+     * @return False (leaving the polytope empty) if the points span no volume
+     */
+    bool Build(const Math::Vector3* points, size_t count);
+
+    /**
+     * @brief Use the vertices of an existing hull
+     */
+    void Build(const Geometry::ConvexHull& hull);
+
+    size_t GetVertexCount() const;
+    Math::Vector3 GetVertex(uint32_t index) const;
+
+    /**
+     * @brief Index of the vertex farthest along a direction
+     * @param dx Direction X (dy, dz likewise); need not be normalized
+     * @return Lowest index among equally far vertices
+     * @note The polytope must not be empty
+     */
+    uint32_t Support(float dx, float dy, float dz) const;
+
+  private:
+    size_t m_count = 0;
+    std::vector<float> m_x, m_y, m_z; // Padded to a multiple of SIMD_WIDTH
+};
+
+enum class ShapeType
+{
+    Sphere,
+    Box,
+    Capsule,
+    Hull
+};
+
+/**
+ * @brief A convex shape described by its support mapping in local space
+ *
+ * Each shape is a core polytope (a point, a segment, a box or a hull) swept
+ * by a sphere of GetMargin(). GJK runs on the cores and adds the margins
+ * afterwards, which keeps spheres and capsules exact and lets the simplex
+ * cache identify support points by vertex index.
+ */
+struct ConvexShape
+{
+    ShapeType type = ShapeType::Sphere;
+    Math::Vector3 halfExtents;                 // Box
+    float radius = 0.0f;                       // Sphere and capsule
+    float halfHeight = 0.0f;                   // Capsule: core segment spans local Y +-halfHeight
+    const ConvexPolytope* polytope = nullptr;  // Hull; not owned
+
+    static ConvexShape Sphere(float radius);
+    static ConvexShape Box(const Math::Vector3& halfExtents);
+    static ConvexShape Capsule(float radius, float halfHeight);
+    // An empty polytope leaves the shape without one, which AddBody() rejects
+    static ConvexShape Hull(const ConvexPolytope& polytope);
+
+    /**
+     * @brief Radius of the sphere swept over the core
+     */
+    float GetMargin() const;
+
+    /**
+     * @brief Index of the core vertex farthest along a local direction
+     */
+    uint32_t Support(float dx, float dy, float dz) const;
+
+    /**
+     * @brief Core vertex in local space
+     * @param index Value previously returned by Support()
+     */
+    Math::Vector3 GetVertex(uint32_t index) const;
+};
+
+} // namespace Physics
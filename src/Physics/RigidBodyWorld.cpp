@@ -0,0 +1,893 @@
+#include "Physics/RigidBodyWorld.h"
+#include "Math/BoundingBox.h"
+#include "Math/Simd.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Physics
+{
+namespace
+{
+// Boxes are grown by this much, and manifold points are kept while they
+// stay within it, so contacts exist slightly before the shapes touch
+constexpr float SPECULATIVE_DISTANCE = 0.02f;
+// New points closer than this to a cached one replace it
+constexpr float MERGE_DISTANCE_SQUARED = 0.02f * 0.02f;
+// Penetration left uncorrected so that resting contacts persist
+constexpr float ALLOWED_PENETRATION = 0.005f;
+// Fraction of the remaining penetration removed per step
+constexpr float BAUMGARTE = 0.2f;
+// Slower approaches do not bounce
+constexpr float RESTITUTION_THRESHOLD = 1.0f;
+constexpr float LINEAR_DAMPING = 0.01f;
+constexpr float ANGULAR_DAMPING = 0.05f;
+// Tilt applied to the smaller body to find more manifold points
+constexpr float PERTURBATION_ANGLE = 0.05f;
+constexpr uint32_t PERTURBATION_COUNT = 4;
+// Start the tilt axes off the tangent basis, which often lines up with box edges
+constexpr float PERTURBATION_OFFSET = 0.3f;
+constexpr float HALF_PI = 1.57079632679f;
+constexpr size_t BODY_GRAIN = 1024;
+constexpr size_t MANIFOLD_GRAIN = 32;
+
+static_assert(sizeof(Math::Vector3) == 3 * sizeof(float), "Vector3 streams are integrated as float arrays");
+static_assert(sizeof(Math::Quaternion) == 4 * sizeof(float), "Quaternion streams are integrated as float arrays");
+
+// Inline vector math; Math::Vector3 operations are out of line
+struct Vec
+{
+    float x, y, z;
+};
+
+Vec operator+(const Vec& a, const Vec& b)
+{
+    return {a.x + b.x, a.y + b.y, a.z + b.z};
+}
+
+Vec operator-(const Vec& a, const Vec& b)
+{
+    return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+Vec operator*(const Vec& a, float s)
+{
+    return {a.x * s, a.y * s, a.z * s};
+}
+
+float Dot(const Vec& a, const Vec& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+Vec Cross(const Vec& a, const Vec& b)
+{
+    return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+Vec ToVec(const Math::Vector3& v)
+{
+    return {v.x, v.y, v.z};
+}
+
+Vec ToVec(const float* v)
+{
+    return {v[0], v[1], v[2]};
+}
+
+Math::Vector3 ToVector3(const Vec& v)
+{
+    return Math::Vector3(v.x, v.y, v.z);
+}
+
+void Store(const Vec& v, float* out)
+{
+    out[0] = v.x;
+    out[1] = v.y;
+    out[2] = v.z;
+}
+
+Vec Multiply(const float m[3][3], const Vec& v)
+{
+    return {m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z, m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+            m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z};
+}
+
+// Two unit vectors perpendicular to a unit normal and to each other
+void TangentBasis(const Vec& normal, Vec& outFirst, Vec& outSecond)
+{
+    const Vec axis = std::fabs(normal.x) >= 0.57735f ? Vec{normal.y, -normal.x, 0.0f}
+                                                     : Vec{0.0f, normal.z, -normal.y};
+    outFirst = axis * (1.0f / std::sqrt(Dot(axis, axis)));
+    outSecond = Cross(normal, outFirst);
+}
+
+// Proportional to the area spanned by four points, in whichever order
+float QuadArea(const Vec& a, const Vec& b, const Vec& c, const Vec& d)
+{
+    const Vec first = Cross(a - b, c - d);
+    const Vec second = Cross(a - c, b - d);
+    const Vec third = Cross(a - d, b - c);
+    return std::max({Dot(first, first), Dot(second, second), Dot(third, third)});
+}
+
+uint64_t PairKey(uint32_t a, uint32_t b)
+{
+    return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+}
+
+Math::Matrix4x4 MakeTransform(const Math::Quaternion& orientation, const Math::Vector3& position)
+{
+    Math::Matrix4x4 transform = orientation.ToMatrix();
+    transform.m[3][0] = position.x;
+    transform.m[3][1] = position.y;
+    transform.m[3][2] = position.z;
+    return transform;
+}
+
+// World box of a local box under a rigid transform, grown on every side
+Math::BoundingBox WorldBounds(const Math::Matrix4x4& transform, const Math::Vector3& center,
+                              const Math::Vector3& extents, float grow)
+{
+    const Math::Vector3 worldCenter = transform.TransformPoint(center);
+    float worldExtents[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        worldExtents[axis] = std::fabs(transform.m[0][axis]) * extents.x +
+                             std::fabs(transform.m[1][axis]) * extents.y +
+                             std::fabs(transform.m[2][axis]) * extents.z + grow;
+    }
+    return Math::BoundingBox::FromCenterExtents(worldCenter,
+                                                Math::Vector3(worldExtents[0], worldExtents[1], worldExtents[2]));
+}
+
+} // namespace
+
+RigidBodyWorld::RigidBodyWorld(float timeStep)
+    : m_timeStep(timeStep > 0.0f ? timeStep : 1.0f / 60.0f)
+{
+}
+
+uint32_t RigidBodyWorld::AddBody(const RigidBodyDesc& desc)
+{
+    const ConvexShape& shape = desc.shape;
+    if (!(desc.mass >= 0.0f) ||
+        (shape.type == ShapeType::Hull && (!shape.polytope || shape.polytope->GetVertexCount() == 0)))
+        return INVALID_INDEX;
+
+    // Local bounding box of the core
+    Math::Vector3 center, extents;
+    switch (shape.type)
+    {
+    case ShapeType::Sphere:
+        break;
+    case ShapeType::Box:
+        extents = shape.halfExtents;
+        break;
+    case ShapeType::Capsule:
+        extents = Math::Vector3(0.0f, shape.halfHeight, 0.0f);
+        break;
+    case ShapeType::Hull: {
+        Math::BoundingBox bounds;
+        for (uint32_t i = 0; i < shape.polytope->GetVertexCount(); ++i)
+        {
+            bounds.Expand(shape.polytope->GetVertex(i));
+        }
+        if (!bounds.IsEmpty())
+        {
+            center = bounds.GetCenter();
+            extents = bounds.GetExtents();
+        }
+        break;
+    }
+    }
+
+    // Diagonal inertia about the local axes
+    const float mass = desc.mass;
+    Math::Vector3 inertia;
+    if (shape.type == ShapeType::Sphere)
+    {
+        const float value = 0.4f * mass * shape.radius * shape.radius;
+        inertia = Math::Vector3(value, value, value);
+    }
+    else if (shape.type == ShapeType::Capsule)
+    {
+        // A cylinder plus two hemispheres, with mass split by volume
+        const float r = shape.radius, h = shape.halfHeight;
+        const float cylinderVolume = 2.0f * h * r * r;
+        const float sphereVolume = 4.0f / 3.0f * r * r * r;
+        const float cylinderMass = mass * cylinderVolume / std::max(cylinderVolume + sphereVolume, 1e-12f);
+        const float sphereMass = mass - cylinderMass;
+        const float axial = 0.5f * cylinderMass * r * r + 0.4f * sphereMass * r * r;
+        const float transverse = cylinderMass * (h * h / 3.0f + r * r / 4.0f) +
+                                 sphereMass * (0.4f * r * r + h * h + 0.75f * h * r);
+        inertia = Math::Vector3(transverse, axial, transverse);
+    }
+    else
+    {
+        const float x2 = extents.x * extents.x, y2 = extents.y * extents.y, z2 = extents.z * extents.z;
+        inertia = Math::Vector3(mass / 3.0f * (y2 + z2), mass / 3.0f * (x2 + z2), mass / 3.0f * (x2 + y2));
+    }
+
+    const float margin = shape.GetMargin();
+    extents += Math::Vector3(margin, margin, margin);
+
+    const bool dynamic = mass > 0.0f;
+    const Math::Quaternion orientation = desc.orientation.Normalized();
+    const uint32_t id = static_cast<uint32_t>(m_positions.size());
+    m_positions.push_back(desc.position);
+    m_orientations.push_back(orientation);
+    m_linearVelocities.push_back(dynamic ? desc.linearVelocity : Math::Vector3());
+    m_angularVelocities.push_back(dynamic ? desc.angularVelocity : Math::Vector3());
+    m_inverseMasses.push_back(dynamic ? 1.0f / mass : 0.0f);
+    m_localInverseInertias.emplace_back(inertia.x > 0.0f ? 1.0f / inertia.x : 0.0f,
+                                        inertia.y > 0.0f ? 1.0f / inertia.y : 0.0f,
+                                        inertia.z > 0.0f ? 1.0f / inertia.z : 0.0f);
+    m_shapes.push_back(shape);
+    m_localCenters.push_back(center);
+    m_localExtents.push_back(extents);
+    m_frictions.push_back(desc.friction);
+    m_restitutions.push_back(desc.restitution);
+    m_transforms.push_back(MakeTransform(orientation, desc.position));
+    m_inverseInertias.emplace_back();
+
+    m_broadphase.Insert(id, WorldBounds(m_transforms[id], center, extents, SPECULATIVE_DISTANCE));
+    return id;
+}
+
+bool RigidBodyWorld::SetVelocity(uint32_t id, const Math::Vector3& linear, const Math::Vector3& angular)
+{
+    if (id >= m_positions.size() || !IsDynamic(id))
+        return false;
+
+    m_linearVelocities[id] = linear;
+    m_angularVelocities[id] = angular;
+    return true;
+}
+
+Math::Matrix4x4 RigidBodyWorld::GetTransform(uint32_t id) const
+{
+    return MakeTransform(m_orientations[id], m_positions[id]);
+}
+
+uint32_t RigidBodyWorld::Update(float elapsed)
+{
+    m_accumulator += elapsed;
+    uint32_t steps = 0;
+    while (m_accumulator >= m_timeStep)
+    {
+        if (steps == MAX_STEPS_PER_UPDATE)
+        {
+            m_accumulator = std::fmod(m_accumulator, m_timeStep);
+            break;
+        }
+        Step();
+        m_accumulator -= m_timeStep;
+        ++steps;
+    }
+    return steps;
+}
+
+void RigidBodyWorld::Step()
+{
+    const size_t count = m_positions.size();
+    Threading::ParallelFor(count, BODY_GRAIN, [this](size_t begin, size_t end) { PrepareBodies(begin, end); });
+
+    UpdateBroadphase();
+    Threading::ParallelFor(m_manifolds.size(), MANIFOLD_GRAIN, [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            UpdateManifold(m_manifolds[i]);
+        }
+    });
+
+    Threading::ParallelFor(count, BODY_GRAIN, [this](size_t begin, size_t end) { IntegrateVelocities(begin, end); });
+
+    BuildIslands();
+    Threading::ParallelFor(m_islandOrder.size(), 1, [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            SolveIsland(m_islands[m_islandOrder[i]]);
+        }
+    });
+
+    Threading::ParallelFor(count, BODY_GRAIN, [this](size_t begin, size_t end) { IntegratePositions(begin, end); });
+}
+
+void RigidBodyWorld::PrepareBodies(size_t begin, size_t end)
+{
+    for (size_t id = begin; id < end; ++id)
+    {
+        const Math::Matrix4x4& transform = m_transforms[id] = MakeTransform(m_orientations[id], m_positions[id]);
+
+        // I^-1 = R D R^T, where the rows of the transform are the columns of R
+        InverseInertia& inverseInertia = m_inverseInertias[id];
+        const Math::Vector3& diagonal = m_localInverseInertias[id];
+        for (int row = 0; row < 3; ++row)
+        {
+            for (int column = 0; column < 3; ++column)
+            {
+                inverseInertia.m[row][column] = transform.m[0][row] * diagonal.x * transform.m[0][column] +
+                                                transform.m[1][row] * diagonal.y * transform.m[1][column] +
+                                                transform.m[2][row] * diagonal.z * transform.m[2][column];
+            }
+        }
+    }
+}
+
+void RigidBodyWorld::UpdateBroadphase()
+{
+    // Static bodies never move, so their boxes stay as inserted
+    for (uint32_t id = 0; id < m_positions.size(); ++id)
+    {
+        if (!IsDynamic(id))
+            continue;
+
+        const float sweep = m_linearVelocities[id].Magnitude() * m_timeStep;
+        m_broadphase.Move(id, WorldBounds(m_transforms[id], m_localCenters[id], m_localExtents[id],
+                                          SPECULATIVE_DISTANCE + sweep));
+    }
+    m_broadphase.UpdatePairs();
+
+    for (const BroadphasePair& pair : m_broadphase.GetRemovedPairs())
+    {
+        const auto found = m_manifoldIndices.find(PairKey(pair.idA, pair.idB));
+        if (found == m_manifoldIndices.end())
+            continue;
+
+        const uint32_t index = found->second;
+        m_manifoldIndices.erase(found);
+        if (index + 1 != m_manifolds.size())
+        {
+            m_manifolds[index] = m_manifolds.back();
+            m_manifoldIndices[PairKey(m_manifolds[index].idA, m_manifolds[index].idB)] = index;
+        }
+        m_manifolds.pop_back();
+    }
+
+    for (const BroadphasePair& pair : m_broadphase.GetAddedPairs())
+    {
+        if (!IsDynamic(pair.idA) && !IsDynamic(pair.idB))
+            continue;
+
+        Manifold manifold = {};
+        manifold.idA = pair.idA;
+        manifold.idB = pair.idB;
+        manifold.friction = std::sqrt(m_frictions[pair.idA] * m_frictions[pair.idB]);
+        manifold.restitution = std::max(m_restitutions[pair.idA], m_restitutions[pair.idB]);
+        m_manifoldIndices.emplace(PairKey(pair.idA, pair.idB), static_cast<uint32_t>(m_manifolds.size()));
+        m_manifolds.push_back(manifold);
+    }
+}
+
+void RigidBodyWorld::UpdateManifold(Manifold& manifold) const
+{
+    const uint32_t a = manifold.idA, b = manifold.idB;
+    const Math::Matrix4x4& transformA = m_transforms[a];
+    const Math::Matrix4x4& transformB = m_transforms[b];
+
+    ContactResult contact;
+    const bool touching =
+        ConvexCollision::Penetration(m_shapes[a], transformA, m_shapes[b], transformB, contact, &manifold.cache);
+    if (touching)
+        manifold.normal = contact.normal;
+    const Vec normal = ToVec(manifold.normal);
+
+    // Refresh the cached points; drop those that separated or slid apart
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < manifold.count; ++i)
+    {
+        ContactPoint& point = manifold.points[i];
+        const Vec offset =
+            ToVec(transformB.TransformPoint(point.localB)) - ToVec(transformA.TransformPoint(point.localA));
+        const float separation = Dot(offset, normal);
+        const Vec drift = offset - normal * separation;
+        if (separation > SPECULATIVE_DISTANCE || Dot(drift, drift) > SPECULATIVE_DISTANCE * SPECULATIVE_DISTANCE)
+            continue;
+
+        point.separation = separation;
+        manifold.points[kept++] = point;
+    }
+    manifold.count = kept;
+    if (!touching)
+        return;
+
+    const auto toLocal = [this](uint32_t id, const Math::Vector3& world) {
+        return m_orientations[id].Conjugate().Rotate(world - m_positions[id]);
+    };
+    AddManifoldPoint(manifold, toLocal(a, contact.pointA), toLocal(b, contact.pointB), -contact.depth);
+
+    // EPA finds one point per step, which lets a flat face rock on it until
+    // the other corners are found. Tilting the smaller body a little about
+    // axes across the normal exposes them now. Spheres have a single point.
+    if (manifold.count >= MAX_MANIFOLD_POINTS || m_shapes[a].type == ShapeType::Sphere ||
+        m_shapes[b].type == ShapeType::Sphere)
+        return;
+
+    const bool tiltA = m_localExtents[a].MagnitudeSquared() < m_localExtents[b].MagnitudeSquared();
+    const uint32_t tilted = tiltA ? a : b;
+    const float planeA = Dot(ToVec(contact.pointA), normal); // A's supporting plane along the normal
+    const float planeB = Dot(ToVec(contact.pointB), normal);
+    Vec tangent, bitangent;
+    TangentBasis(normal, tangent, bitangent);
+
+    for (uint32_t i = 0; i < PERTURBATION_COUNT; ++i)
+    {
+        const float angle = PERTURBATION_OFFSET + i * HALF_PI;
+        const Vec axis = tangent * std::cos(angle) + bitangent * std::sin(angle);
+        const Math::Quaternion orientation =
+            Math::Quaternion::FromAxisAngle(ToVector3(axis), PERTURBATION_ANGLE) * m_orientations[tilted];
+        const Math::Matrix4x4 transform = MakeTransform(orientation, m_positions[tilted]);
+
+        ContactResult perturbed;
+        if (!ConvexCollision::Penetration(m_shapes[a], tiltA ? transform : transformA, m_shapes[b],
+                                          tiltA ? transformB : transform, perturbed))
+            continue;
+
+        // Take the tilted body's deepest point back to its real pose and
+        // measure it against the other body's supporting plane
+        const Math::Vector3& deepest = tiltA ? perturbed.pointA : perturbed.pointB;
+        const Math::Vector3 local = orientation.Conjugate().Rotate(deepest - m_positions[tilted]);
+        const Vec world = ToVec((tiltA ? transformA : transformB).TransformPoint(local));
+        const float separation = tiltA ? planeB - Dot(world, normal) : Dot(world, normal) - planeA;
+        if (separation > SPECULATIVE_DISTANCE)
+            continue;
+
+        if (tiltA)
+            AddManifoldPoint(manifold, local, toLocal(b, ToVector3(world + normal * separation)), separation);
+        else
+            AddManifoldPoint(manifold, toLocal(a, ToVector3(world - normal * separation)), local, separation);
+    }
+}
+
+void RigidBodyWorld::AddManifoldPoint(Manifold& manifold, const Math::Vector3& localA, const Math::Vector3& localB,
+                                      float separation) const
+{
+    const Vec anchor = ToVec(localA);
+    for (uint32_t i = 0; i < manifold.count; ++i)
+    {
+        const Vec offset = ToVec(manifold.points[i].localA) - anchor;
+        if (Dot(offset, offset) < MERGE_DISTANCE_SQUARED)
+        {
+            // Same feature: move the anchors and keep the impulses for warm starting
+            manifold.points[i].localA = localA;
+            manifold.points[i].localB = localB;
+            manifold.points[i].separation = separation;
+            return;
+        }
+    }
+
+    const ContactPoint point = {localA, localB, separation, 0.0f, {0.0f, 0.0f}};
+    if (manifold.count < MAX_MANIFOLD_POINTS)
+    {
+        manifold.points[manifold.count++] = point;
+        return;
+    }
+
+    // Full: keep the deepest point, then drop the one whose removal leaves
+    // the largest area
+    ContactPoint candidates[MAX_MANIFOLD_POINTS + 1];
+    std::copy(manifold.points, manifold.points + MAX_MANIFOLD_POINTS, candidates);
+    candidates[MAX_MANIFOLD_POINTS] = point;
+
+    uint32_t deepest = 0;
+    for (uint32_t i = 1; i <= MAX_MANIFOLD_POINTS; ++i)
+    {
+        if (candidates[i].separation < candidates[deepest].separation)
+            deepest = i;
+    }
+
+    uint32_t dropped = deepest == 0 ? 1 : 0;
+    float bestArea = -1.0f;
+    for (uint32_t i = 0; i <= MAX_MANIFOLD_POINTS; ++i)
+    {
+        if (i == deepest)
+            continue;
+
+        Vec rest[MAX_MANIFOLD_POINTS];
+        uint32_t restCount = 0;
+        for (uint32_t j = 0; j <= MAX_MANIFOLD_POINTS; ++j)
+        {
+            if (j != i)
+                rest[restCount++] = ToVec(candidates[j].localA);
+        }
+        const float area = QuadArea(rest[0], rest[1], rest[2], rest[3]);
+        if (area > bestArea)
+        {
+            bestArea = area;
+            dropped = i;
+        }
+    }
+
+    uint32_t count = 0;
+    for (uint32_t i = 0; i <= MAX_MANIFOLD_POINTS; ++i)
+    {
+        if (i != dropped)
+            manifold.points[count++] = candidates[i];
+    }
+}
+
+uint32_t RigidBodyWorld::FindRoot(uint32_t id)
+{
+    while (m_parents[id] != id)
+    {
+        m_parents[id] = m_parents[m_parents[id]];
+        id = m_parents[id];
+    }
+    return id;
+}
+
+void RigidBodyWorld::BuildIslands()
+{
+    const size_t count = m_positions.size();
+    m_parents.resize(count);
+    std::iota(m_parents.begin(), m_parents.end(), 0u);
+
+    // Join dynamic bodies in touching pairs; the lower id becomes the root so
+    // islands come out in the same order every run
+    for (const Manifold& manifold : m_manifolds)
+    {
+        if (manifold.count == 0 || !IsDynamic(manifold.idA) || !IsDynamic(manifold.idB))
+            continue;
+
+        const uint32_t rootA = FindRoot(manifold.idA);
+        const uint32_t rootB = FindRoot(manifold.idB);
+        if (rootA != rootB)
+            m_parents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+    }
+
+    // Count manifolds and points per island
+    m_islandOf.assign(count, INVALID_INDEX);
+    m_islands.clear();
+    size_t manifoldTotal = 0;
+    for (const Manifold& manifold : m_manifolds)
+    {
+        if (manifold.count == 0)
+            continue;
+
+        uint32_t& island = m_islandOf[FindRoot(IsDynamic(manifold.idA) ? manifold.idA : manifold.idB)];
+        if (island == INVALID_INDEX)
+        {
+            island = static_cast<uint32_t>(m_islands.size());
+            m_islands.push_back({0, 0, 0, 0});
+        }
+        ++m_islands[island].manifoldCount;
+        m_islands[island].constraintCount += manifold.count;
+        ++manifoldTotal;
+    }
+
+    uint32_t manifoldBegin = 0, constraintBegin = 0;
+    for (Island& island : m_islands)
+    {
+        island.manifoldBegin = manifoldBegin;
+        island.constraintBegin = constraintBegin;
+        manifoldBegin += island.manifoldCount;
+        constraintBegin += island.constraintCount;
+        island.manifoldCount = 0; // Refilled below
+    }
+
+    m_islandManifolds.resize(manifoldTotal);
+    for (uint32_t index = 0; index < m_manifolds.size(); ++index)
+    {
+        const Manifold& manifold = m_manifolds[index];
+        if (manifold.count == 0)
+            continue;
+
+        Island& island = m_islands[m_islandOf[FindRoot(IsDynamic(manifold.idA) ? manifold.idA : manifold.idB)]];
+        m_islandManifolds[island.manifoldBegin + island.manifoldCount++] = index;
+    }
+
+    m_constraintCount = constraintBegin;
+    if (m_constraints.size() < m_constraintCount)
+        m_constraints.resize(m_constraintCount);
+
+    // Largest islands first so that a big pile does not start last
+    m_islandOrder.resize(m_islands.size());
+    std::iota(m_islandOrder.begin(), m_islandOrder.end(), 0u);
+    std::sort(m_islandOrder.begin(), m_islandOrder.end(), [this](uint32_t a, uint32_t b) {
+        if (m_islands[a].constraintCount != m_islands[b].constraintCount)
+            return m_islands[a].constraintCount > m_islands[b].constraintCount;
+        return a < b;
+    });
+}
+
+void RigidBodyWorld::SolveIsland(const Island& island)
+{
+    ContactConstraint* constraints = m_constraints.data() + island.constraintBegin;
+    const float inverseStep = 1.0f / m_timeStep;
+    static const float NO_INERTIA[3][3] = {};
+
+    // Velocities of a static body read as zero and are never written, so
+    // islands that share one do not race
+    const auto load = [this](uint32_t id, Vec& outLinear, Vec& outAngular) {
+        if (id == INVALID_INDEX)
+        {
+            outLinear = outAngular = {0.0f, 0.0f, 0.0f};
+            return;
+        }
+        outLinear = ToVec(m_linearVelocities[id]);
+        outAngular = ToVec(m_angularVelocities[id]);
+    };
+    const auto store = [this](uint32_t id, const Vec& linear, const Vec& angular) {
+        if (id == INVALID_INDEX)
+            return;
+        Store(linear, &m_linearVelocities[id].x);
+        Store(angular, &m_angularVelocities[id].x);
+    };
+
+    // Applies an impulse along one row to B and its opposite to A
+    const auto apply = [](const ContactConstraint& constraint, int row, float impulse, Vec& linearA, Vec& angularA,
+                          Vec& linearB, Vec& angularB) {
+        const Vec direction = ToVec(constraint.direction[row]);
+        linearA = linearA - direction * (impulse * constraint.inverseMassA);
+        angularA = angularA - ToVec(constraint.angularA[row]) * impulse;
+        linearB = linearB + direction * (impulse * constraint.inverseMassB);
+        angularB = angularB + ToVec(constraint.angularB[row]) * impulse;
+    };
+    const auto velocity = [](const ContactConstraint& constraint, int row, const Vec& linearA, const Vec& angularA,
+                             const Vec& linearB, const Vec& angularB) {
+        return Dot(linearB - linearA, ToVec(constraint.direction[row])) + Dot(angularB, ToVec(constraint.armB[row])) -
+               Dot(angularA, ToVec(constraint.armA[row]));
+    };
+
+    // Build the constraints and apply last step's impulses
+    uint32_t constraintIndex = 0;
+    for (uint32_t k = 0; k < island.manifoldCount; ++k)
+    {
+        const uint32_t manifoldIndex = m_islandManifolds[island.manifoldBegin + k];
+        const Manifold& manifold = m_manifolds[manifoldIndex];
+        const uint32_t bodyA = IsDynamic(manifold.idA) ? manifold.idA : INVALID_INDEX;
+        const uint32_t bodyB = IsDynamic(manifold.idB) ? manifold.idB : INVALID_INDEX;
+        const float(*inertiaA)[3] = bodyA == INVALID_INDEX ? NO_INERTIA : m_inverseInertias[bodyA].m;
+        const float(*inertiaB)[3] = bodyB == INVALID_INDEX ? NO_INERTIA : m_inverseInertias[bodyB].m;
+        Vec directions[3];
+        directions[0] = ToVec(manifold.normal);
+        TangentBasis(directions[0], directions[1], directions[2]);
+
+        Vec linearA, angularA, linearB, angularB;
+        load(bodyA, linearA, angularA);
+        load(bodyB, linearB, angularB);
+
+        for (uint32_t p = 0; p < manifold.count; ++p)
+        {
+            const ContactPoint& point = manifold.points[p];
+            ContactConstraint& constraint = constraints[constraintIndex++];
+            constraint.bodyA = bodyA;
+            constraint.bodyB = bodyB;
+            constraint.manifold = manifoldIndex;
+            constraint.point = p;
+            constraint.inverseMassA = m_inverseMasses[manifold.idA];
+            constraint.inverseMassB = m_inverseMasses[manifold.idB];
+
+            const Vec rA =
+                ToVec(m_transforms[manifold.idA].TransformPoint(point.localA)) - ToVec(m_positions[manifold.idA]);
+            const Vec rB =
+                ToVec(m_transforms[manifold.idB].TransformPoint(point.localB)) - ToVec(m_positions[manifold.idB]);
+            for (int row = 0; row < 3; ++row)
+            {
+                const Vec armA = Cross(rA, directions[row]);
+                const Vec armB = Cross(rB, directions[row]);
+                const Vec angularDeltaA = Multiply(inertiaA, armA);
+                const Vec angularDeltaB = Multiply(inertiaB, armB);
+                Store(directions[row], constraint.direction[row]);
+                Store(armA, constraint.armA[row]);
+                Store(armB, constraint.armB[row]);
+                Store(angularDeltaA, constraint.angularA[row]);
+                Store(angularDeltaB, constraint.angularB[row]);
+                const float k = constraint.inverseMassA + constraint.inverseMassB + Dot(armA, angularDeltaA) +
+                                Dot(armB, angularDeltaB);
+                constraint.mass[row] = k > 0.0f ? 1.0f / k : 0.0f;
+            }
+
+            // Speculative contacts may close their gap this step; penetrating
+            // ones are pushed apart gradually; fast approaches bounce
+            const float separation = point.separation;
+            constraint.bias = separation > 0.0f
+                                  ? separation * inverseStep
+                                  : -BAUMGARTE * inverseStep * std::max(-separation - ALLOWED_PENETRATION, 0.0f);
+            const float approach = velocity(constraint, 0, linearA, angularA, linearB, angularB);
+            if (approach < -RESTITUTION_THRESHOLD)
+                constraint.bias = std::min(constraint.bias, manifold.restitution * approach);
+
+            constraint.friction = manifold.friction;
+            constraint.impulse[0] = point.normalImpulse;
+            constraint.impulse[1] = point.tangentImpulse[0];
+            constraint.impulse[2] = point.tangentImpulse[1];
+            for (int row = 0; row < 3; ++row)
+            {
+                apply(constraint, row, constraint.impulse[row], linearA, angularA, linearB, angularB);
+            }
+        }
+
+        store(bodyA, linearA, angularA);
+        store(bodyB, linearB, angularB);
+    }
+
+    for (uint32_t iteration = 0; iteration < m_solverIterations; ++iteration)
+    {
+        for (uint32_t c = 0; c < island.constraintCount; ++c)
+        {
+            ContactConstraint& constraint = constraints[c];
+            Vec linearA, angularA, linearB, angularB;
+            load(constraint.bodyA, linearA, angularA);
+            load(constraint.bodyB, linearB, angularB);
+
+            // Friction first, bounded by the current normal impulse
+            const float maxFriction = constraint.friction * constraint.impulse[0];
+            for (int row = 1; row < 3; ++row)
+            {
+                const float previous = constraint.impulse[row];
+                const float relative = velocity(constraint, row, linearA, angularA, linearB, angularB);
+                constraint.impulse[row] =
+                    std::max(-maxFriction, std::min(previous - constraint.mass[row] * relative, maxFriction));
+                apply(constraint, row, constraint.impulse[row] - previous, linearA, angularA, linearB, angularB);
+            }
+
+            const float previous = constraint.impulse[0];
+            const float relative = velocity(constraint, 0, linearA, angularA, linearB, angularB);
+            constraint.impulse[0] = std::max(previous - constraint.mass[0] * (relative + constraint.bias), 0.0f);
+            apply(constraint, 0, constraint.impulse[0] - previous, linearA, angularA, linearB, angularB);
+
+            store(constraint.bodyA, linearA, angularA);
+            store(constraint.bodyB, linearB, angularB);
+        }
+    }
+
+    // Keep the impulses for next step's warm start
+    for (uint32_t c = 0; c < island.constraintCount; ++c)
+    {
+        const ContactConstraint& constraint = constraints[c];
+        ContactPoint& point = m_manifolds[constraint.manifold].points[constraint.point];
+        point.normalImpulse = constraint.impulse[0];
+        point.tangentImpulse[0] = constraint.impulse[1];
+        point.tangentImpulse[1] = constraint.impulse[2];
+    }
+}
+
+void RigidBodyWorld::IntegrateVelocities(size_t begin, size_t end)
+{
+    const float linearScale = 1.0f / (1.0f + m_timeStep * LINEAR_DAMPING);
+    const float angularScale = 1.0f / (1.0f + m_timeStep * ANGULAR_DAMPING);
+    const float gravity[3] = {m_gravity.x * m_timeStep, m_gravity.y * m_timeStep, m_gravity.z * m_timeStep};
+    float* linear = &m_linearVelocities[0].x;
+    float* angular = &m_angularVelocities[0].x;
+    size_t id = begin;
+
+#if defined(HERMIT_SIMD_AVX2)
+    // Eight bodies are 24 floats: three blocks where lane j of block k holds
+    // component (8k + j) % 3 of body (8k + j) / 3
+    const __m256i spread[3] = {_mm256_setr_epi32(0, 0, 0, 1, 1, 1, 2, 2), _mm256_setr_epi32(2, 3, 3, 3, 4, 4, 4, 5),
+                               _mm256_setr_epi32(5, 5, 6, 6, 6, 7, 7, 7)};
+    const __m256 gravityBlocks[3] = {
+        _mm256_setr_ps(gravity[0], gravity[1], gravity[2], gravity[0], gravity[1], gravity[2], gravity[0], gravity[1]),
+        _mm256_setr_ps(gravity[2], gravity[0], gravity[1], gravity[2], gravity[0], gravity[1], gravity[2], gravity[0]),
+        _mm256_setr_ps(gravity[1], gravity[2], gravity[0], gravity[1], gravity[2], gravity[0], gravity[1], gravity[2])};
+    const __m256 linearScales = _mm256_set1_ps(linearScale);
+    const __m256 angularScales = _mm256_set1_ps(angularScale);
+    const __m256 zero = _mm256_setzero_ps();
+    for (; id + 8 <= end; id += 8)
+    {
+        // Gravity only reaches dynamic bodies; static velocities stay zero
+        const __m256 dynamic = _mm256_cmp_ps(_mm256_loadu_ps(m_inverseMasses.data() + id), zero, _CMP_GT_OQ);
+        for (int k = 0; k < 3; ++k)
+        {
+            float* velocity = linear + 3 * id + 8 * k;
+            const __m256 mask = _mm256_permutevar8x32_ps(dynamic, spread[k]);
+            const __m256 accelerated =
+                _mm256_add_ps(_mm256_loadu_ps(velocity), _mm256_and_ps(gravityBlocks[k], mask));
+            _mm256_storeu_ps(velocity, _mm256_mul_ps(accelerated, linearScales));
+
+            float* spin = angular + 3 * id + 8 * k;
+            _mm256_storeu_ps(spin, _mm256_mul_ps(_mm256_loadu_ps(spin), angularScales));
+        }
+    }
+#endif
+
+    for (; id < end; ++id)
+    {
+        if (!IsDynamic(static_cast<uint32_t>(id)))
+            continue;
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            linear[3 * id + axis] = (linear[3 * id + axis] + gravity[axis]) * linearScale;
+            angular[3 * id + axis] *= angularScale;
+        }
+    }
+}
+
+void RigidBodyWorld::IntegratePositions(size_t begin, size_t end)
+{
+    const float step = m_timeStep;
+    const float halfStep = 0.5f * m_timeStep;
+    float* positions = &m_positions[0].x;
+    const float* linear = &m_linearVelocities[0].x;
+    size_t id = begin;
+
+#if defined(HERMIT_SIMD_AVX2)
+    float* orientations = &m_orientations[0].x;
+    const float* angular = &m_angularVelocities[0].x;
+    const __m256 steps = _mm256_set1_ps(step);
+    const __m256 halfSteps = _mm256_set1_ps(halfStep);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    // The quaternion transpose below leaves bodies in lanes 0, 2, 4, 6, 1, 3, 5, 7
+    const __m256i spinOffsets = _mm256_setr_epi32(0, 6, 12, 18, 3, 9, 15, 21);
+    for (; id + 8 <= end; id += 8)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            float* position = positions + 3 * id + 8 * k;
+            const __m256 velocity = _mm256_loadu_ps(linear + 3 * id + 8 * k);
+            _mm256_storeu_ps(position, _mm256_add_ps(_mm256_loadu_ps(position), _mm256_mul_ps(velocity, steps)));
+        }
+
+        // Transpose eight quaternions into x, y, z and w lanes
+        float* q = orientations + 4 * id;
+        const __m256 q01 = _mm256_loadu_ps(q);
+        const __m256 q23 = _mm256_loadu_ps(q + 8);
+        const __m256 q45 = _mm256_loadu_ps(q + 16);
+        const __m256 q67 = _mm256_loadu_ps(q + 24);
+        const __m256 xy0 = _mm256_unpacklo_ps(q01, q23);
+        const __m256 zw0 = _mm256_unpackhi_ps(q01, q23);
+        const __m256 xy1 = _mm256_unpacklo_ps(q45, q67);
+        const __m256 zw1 = _mm256_unpackhi_ps(q45, q67);
+        __m256 x = _mm256_shuffle_ps(xy0, xy1, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 y = _mm256_shuffle_ps(xy0, xy1, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 z = _mm256_shuffle_ps(zw0, zw1, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 w = _mm256_shuffle_ps(zw0, zw1, _MM_SHUFFLE(3, 2, 3, 2));
+
+        const float* spin = angular + 3 * id;
+        const __m256 wx = _mm256_mul_ps(_mm256_i32gather_ps(spin, spinOffsets, 4), halfSteps);
+        const __m256 wy = _mm256_mul_ps(_mm256_i32gather_ps(spin + 1, spinOffsets, 4), halfSteps);
+        const __m256 wz = _mm256_mul_ps(_mm256_i32gather_ps(spin + 2, spinOffsets, 4), halfSteps);
+
+        // q += (dt / 2) * (omega, 0) * q
+        const __m256 dx =
+            _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(wx, w), _mm256_mul_ps(wy, z)), _mm256_mul_ps(wz, y));
+        const __m256 dy =
+            _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(wy, w), _mm256_mul_ps(wz, x)), _mm256_mul_ps(wx, z));
+        const __m256 dz =
+            _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(wz, w), _mm256_mul_ps(wx, y)), _mm256_mul_ps(wy, x));
+        const __m256 dw =
+            _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(wx, x), _mm256_mul_ps(wy, y)), _mm256_mul_ps(wz, z));
+        x = _mm256_add_ps(x, dx);
+        y = _mm256_add_ps(y, dy);
+        z = _mm256_add_ps(z, dz);
+        w = _mm256_sub_ps(w, dw);
+
+        const __m256 lengthSquared = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)),
+                                                   _mm256_add_ps(_mm256_mul_ps(z, z), _mm256_mul_ps(w, w)));
+        const __m256 inverseLength = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSquared));
+        x = _mm256_mul_ps(x, inverseLength);
+        y = _mm256_mul_ps(y, inverseLength);
+        z = _mm256_mul_ps(z, inverseLength);
+        w = _mm256_mul_ps(w, inverseLength);
+
+        // And back
+        const __m256 xy2 = _mm256_unpacklo_ps(x, y);
+        const __m256 xy3 = _mm256_unpackhi_ps(x, y);
+        const __m256 zw2 = _mm256_unpacklo_ps(z, w);
+        const __m256 zw3 = _mm256_unpackhi_ps(z, w);
+        _mm256_storeu_ps(q, _mm256_shuffle_ps(xy2, zw2, _MM_SHUFFLE(1, 0, 1, 0)));
+        _mm256_storeu_ps(q + 8, _mm256_shuffle_ps(xy2, zw2, _MM_SHUFFLE(3, 2, 3, 2)));
+        _mm256_storeu_ps(q + 16, _mm256_shuffle_ps(xy3, zw3, _MM_SHUFFLE(1, 0, 1, 0)));
+        _mm256_storeu_ps(q + 24, _mm256_shuffle_ps(xy3, zw3, _MM_SHUFFLE(3, 2, 3, 2)));
+    }
+#endif
+
+    for (; id < end; ++id)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            positions[3 * id + axis] += linear[3 * id + axis] * step;
+        }
+
+        const Math::Vector3& spin = m_angularVelocities[id];
+        const Math::Quaternion& orientation = m_orientations[id];
+        const Math::Quaternion derivative = Math::Quaternion(spin.x, spin.y, spin.z, 0.0f) * orientation;
+        m_orientations[id] = (orientation + derivative * halfStep).Normalized();
+    }
+}
+
+} // namespace Physics
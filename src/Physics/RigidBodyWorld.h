@@ -0,0 +1,222 @@
+#pragma once
+
+#include "Math/Matrix4x4.h"
+#include "Math/Quaternion.h"
+#include "Math/Vector3.h"
+#include "Physics/ConvexCollision.h"
+#include "Physics/ConvexShape.h"
+#include "Physics/SweepAndPrune.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Physics
+{
+struct RigidBodyDesc
+{
+    ConvexShape shape;
+    Math::Vector3 position;
+    Math::Quaternion orientation;
+    Math::Vector3 linearVelocity;
+    Math::Vector3 angularVelocity; // Radians per second about each world axis
+    float mass = 1.0f;             // Zero makes the body static
+    float friction = 0.5f;         // Combined per contact as the geometric mean
+    float restitution = 0.0f;      // Combined per contact as the maximum
+};
+
+/**
+ * @brief Fixed-step rigid-body simulation with a sequential-impulse contact solver
+ *
+ * Body state is kept as parallel streams indexed by body id: positions and
+ * velocities as Math::Vector3 arrays and orientations as Math::Quaternion.
+ * The integrator walks these streams eight bodies at a time with AVX2,
+ * treating each Vector3 stream as a flat float array; a scalar loop covers
+ * the remainder and non-AVX2 builds.
+ *
+ * Each step moves the dynamic bodies' boxes in a SweepAndPrune broadphase,
+ * refreshes a persistent contact manifold of up to MAX_MANIFOLD_POINTS per
+ * overlapping pair with GJK/EPA, and groups bodies that touch into islands.
+ * Static bodies do not join islands, so a floor does not merge everything
+ * resting on it. Islands share no dynamic body, so each one runs the whole
+ * sequential-impulse solve (warm started from last step's impulses) on its
+ * own worker, largest first.
+ *
+ * Inertia is diagonal in the shape's local frame. Hulls use the inertia of
+ * their local bounding box. Bodies cannot be removed; ids are dense.
+ */
+class RigidBodyWorld
+{
+  public:
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+    static constexpr uint32_t MAX_MANIFOLD_POINTS = 4;
+    // Update() drops time beyond this many steps instead of falling further behind
+    static constexpr uint32_t MAX_STEPS_PER_UPDATE = 8;
+
+    /**
+     * @param timeStep Duration of one fixed step in seconds
+     */
+    explicit RigidBodyWorld(float timeStep = 1.0f / 60.0f);
+
+    /**
+     * @brief Add a body
+     * @param desc Shape, initial state and material
+     * @return Id of the new body, or INVALID_INDEX if the mass is negative or
+     *         a hull has no polytope or an empty one
+     * @note A hull's polytope must outlive the world
+     */
+    uint32_t AddBody(const RigidBodyDesc& desc);
+
+    size_t GetBodyCount() const { return m_positions.size(); }
+    float GetTimeStep() const { return m_timeStep; }
+
+    void SetGravity(const Math::Vector3& gravity) { m_gravity = gravity; }
+    void SetSolverIterations(uint32_t iterations) { m_solverIterations = iterations > 0 ? iterations : 1; }
+
+    /**
+     * @brief Set the velocity of a dynamic body
+     * @return False if the id is invalid or the body is static
+     */
+    bool SetVelocity(uint32_t id, const Math::Vector3& linear, const Math::Vector3& angular);
+
+    /**
+     * @brief Advance by elapsed time in whole fixed steps
+     * @param elapsed Seconds since the last call
+     * @return Number of steps taken
+     * @note The remainder carries over to the next call
+     */
+    uint32_t Update(float elapsed);
+
+    /**
+     * @brief Advance by exactly one fixed step
+     */
+    void Step();
+
+    const std::vector<Math::Vector3>& GetPositions() const { return m_positions; }
+    const std::vector<Math::Quaternion>& GetOrientations() const { return m_orientations; }
+    const std::vector<Math::Vector3>& GetLinearVelocities() const { return m_linearVelocities; }
+    const std::vector<Math::Vector3>& GetAngularVelocities() const { return m_angularVelocities; }
+
+    /**
+     * @brief Local-to-world transform of a body for rendering
+     */
+    Math::Matrix4x4 GetTransform(uint32_t id) const;
+
+    /**
+     * @brief Contact points solved in the last step
+     */
+    size_t GetContactCount() const { return m_constraintCount; }
+
+    /**
+     * @brief Islands solved in the last step
+     */
+    size_t GetIslandCount() const { return m_islands.size(); }
+
+  private:
+    // Anchors are kept in each body's local frame, so they follow the bodies
+    // between steps; impulses are kept to warm start the solver
+    struct ContactPoint
+    {
+        Math::Vector3 localA;
+        Math::Vector3 localB;
+        float separation; // Along the manifold normal as of this step; negative when penetrating
+        float normalImpulse;
+        float tangentImpulse[2];
+    };
+
+    struct Manifold
+    {
+        uint32_t idA;
+        uint32_t idB;
+        float friction;
+        float restitution;
+        Math::Vector3 normal; // From A to B
+        uint32_t count;
+        ContactPoint points[MAX_MANIFOLD_POINTS];
+        SimplexCache cache;
+    };
+
+    // One contact point as three rows (normal and two friction directions),
+    // with everything the iterations need precomputed
+    struct ContactConstraint
+    {
+        uint32_t bodyA; // INVALID_INDEX when static
+        uint32_t bodyB;
+        uint32_t manifold;
+        uint32_t point;
+        float inverseMassA;
+        float inverseMassB;
+        float direction[3][3];
+        float armA[3][3];     // rA x direction
+        float armB[3][3];
+        float angularA[3][3]; // Angular velocity change of A per unit impulse
+        float angularB[3][3];
+        float mass[3];        // Effective mass along each row
+        float impulse[3];     // Accumulated over the step
+        float bias;
+        float friction;
+    };
+
+    struct Island
+    {
+        uint32_t manifoldBegin;
+        uint32_t manifoldCount;
+        uint32_t constraintBegin;
+        uint32_t constraintCount;
+    };
+
+    // World-space inverse inertia, row-major
+    struct InverseInertia
+    {
+        float m[3][3];
+    };
+
+    void PrepareBodies(size_t begin, size_t end);
+    void UpdateBroadphase();
+    void UpdateManifold(Manifold& manifold) const;
+    void AddManifoldPoint(Manifold& manifold, const Math::Vector3& localA, const Math::Vector3& localB,
+                          float separation) const;
+    void BuildIslands();
+    void SolveIsland(const Island& island);
+    void IntegrateVelocities(size_t begin, size_t end);
+    void IntegratePositions(size_t begin, size_t end);
+
+    bool IsDynamic(uint32_t id) const { return m_inverseMasses[id] > 0.0f; }
+    uint32_t FindRoot(uint32_t id);
+
+    float m_timeStep;
+    float m_accumulator = 0.0f;
+    Math::Vector3 m_gravity = Math::Vector3(0.0f, -9.81f, 0.0f);
+    uint32_t m_solverIterations = 10;
+
+    // Body streams, indexed by id
+    std::vector<Math::Vector3> m_positions;
+    std::vector<Math::Quaternion> m_orientations;
+    std::vector<Math::Vector3> m_linearVelocities;
+    std::vector<Math::Vector3> m_angularVelocities;
+    std::vector<float> m_inverseMasses;
+    std::vector<Math::Vector3> m_localInverseInertias; // Diagonal
+    std::vector<ConvexShape> m_shapes;
+    std::vector<Math::Vector3> m_localCenters;  // Of the shape's local bounding box
+    std::vector<Math::Vector3> m_localExtents;  // Including the margin
+    std::vector<float> m_frictions;
+    std::vector<float> m_restitutions;
+
+    // Per-step body data
+    std::vector<Math::Matrix4x4> m_transforms;
+    std::vector<InverseInertia> m_inverseInertias;
+
+    SweepAndPrune m_broadphase;
+    std::vector<Manifold> m_manifolds;
+    std::unordered_map<uint64_t, uint32_t> m_manifoldIndices; // Pair key to index in m_manifolds
+
+    std::vector<uint32_t> m_parents; // Union-find over dynamic bodies
+    std::vector<uint32_t> m_islandOf;
+    std::vector<Island> m_islands;
+    std::vector<uint32_t> m_islandManifolds;
+    std::vector<uint32_t> m_islandOrder; // Largest first
+    std::vector<ContactConstraint> m_constraints;
+    size_t m_constraintCount = 0;
+};
+
+} // namespace Physics
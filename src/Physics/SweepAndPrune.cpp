@@ -0,0 +1,488 @@
+#include "Physics/SweepAndPrune.h"
+#include "Math/Simd.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Physics
+{
+namespace
+{
+constexpr size_t MIN_TABLE_SIZE = 64;
+constexpr size_t SWEEP_WIDTH = 8;
+// Slabs are about this many average box sizes wide, so few boxes span two
+constexpr float SLAB_WIDTH_IN_BOXES = 4.0f;
+constexpr size_t MIN_BODIES_PER_SLAB = 32;
+// More arrivals than this, or more shifts per listed box, switch a slab
+// from insertion sort to a full sort
+constexpr size_t MAX_INSERTION_ARRIVALS = 32;
+constexpr size_t MAX_INSERTION_SHIFTS_PER_BOX = 8;
+
+constexpr float INFINITY_VALUE = std::numeric_limits<float>::infinity();
+
+uint64_t PairKey(uint32_t a, uint32_t b)
+{
+    return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+}
+
+uint32_t HashPair(uint64_t key, size_t mask)
+{
+    return static_cast<uint32_t>(((key * 0x9E3779B97F4A7C15ull) >> 32) & mask);
+}
+
+// The sweeps stop at +inf sentinels, so an infinite or NaN bound would run past them
+bool IsFinite(const Math::BoundingBox& bounds)
+{
+    return std::isfinite(bounds.min.x) && std::isfinite(bounds.min.y) && std::isfinite(bounds.min.z) &&
+           std::isfinite(bounds.max.x) && std::isfinite(bounds.max.y) && std::isfinite(bounds.max.z);
+}
+
+#if defined(HERMIT_SIMD_AVX2)
+// Only called with a nonzero SIMD lane mask
+uint32_t CountTrailingZeros(uint32_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+}
+#endif
+} // namespace
+
+bool SweepAndPrune::Contains(uint32_t id) const
+{
+    return id < m_state.size() && m_state[id] == BodyState::Active;
+}
+
+bool SweepAndPrune::Insert(uint32_t id, const Math::BoundingBox& bounds)
+{
+    if (bounds.IsEmpty() || !IsFinite(bounds) || Contains(id))
+        return false;
+
+    if (id >= m_state.size())
+    {
+        const size_t size = static_cast<size_t>(id) + 1;
+        m_state.resize(size, BodyState::Absent);
+        m_bodies.resize(size, Body{{}, {}, INVALID_INDEX, 0});
+    }
+
+    // A body removed since the last update is still listed; it simply moves
+    m_state[id] = BodyState::Active;
+    ++m_bodyCount;
+    return Move(id, bounds);
+}
+
+bool SweepAndPrune::Move(uint32_t id, const Math::BoundingBox& bounds)
+{
+    if (bounds.IsEmpty() || !IsFinite(bounds) || !Contains(id))
+        return false;
+
+    Body& body = m_bodies[id];
+    body.min[0] = bounds.min.x;
+    body.min[1] = bounds.min.y;
+    body.min[2] = bounds.min.z;
+    body.max[0] = bounds.max.x;
+    body.max[1] = bounds.max.y;
+    body.max[2] = bounds.max.z;
+    return true;
+}
+
+bool SweepAndPrune::Remove(uint32_t id)
+{
+    if (!Contains(id))
+        return false;
+
+    m_state[id] = BodyState::Removed;
+    --m_bodyCount;
+    return true;
+}
+
+void SweepAndPrune::Clear()
+{
+    m_bodyCount = 0;
+    m_state.clear();
+    m_bodies.clear();
+    m_layoutCount = 0;
+    m_outsideCount = 0;
+    m_slabs.clear();
+    m_pairs.clear();
+    m_pairStamps.clear();
+    m_table.clear();
+    m_added.clear();
+    m_removed.clear();
+}
+
+void SweepAndPrune::UpdatePairs()
+{
+    m_added.clear();
+    m_removed.clear();
+    ++m_frame;
+    if (m_table.empty())
+        m_table.assign(MIN_TABLE_SIZE, INVALID_INDEX);
+
+    if (m_slabs.empty() || m_bodyCount > m_layoutCount * 2 || m_bodyCount * 2 < m_layoutCount ||
+        m_outsideCount * 4 > m_bodyCount)
+        Layout();
+
+    AssignSlabs();
+
+    Threading::ParallelFor(m_slabs.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t slab = begin; slab < end; ++slab)
+        {
+            UpdateSlab(static_cast<uint32_t>(slab));
+            SweepSlab(static_cast<uint32_t>(slab));
+        }
+    });
+
+    // Stamp every pair found this frame; the rest stopped overlapping
+    for (Slab& slab : m_slabs)
+    {
+        for (const BroadphasePair& pair : slab.found)
+        {
+            const uint32_t slot = FindSlot(PairKey(pair.idA, pair.idB));
+            if (m_table[slot] != INVALID_INDEX)
+            {
+                m_pairStamps[m_table[slot]] = m_frame;
+            }
+            else if (AddPair(pair.idA, pair.idB))
+            {
+                m_added.push_back(m_pairs.back());
+            }
+        }
+        slab.found.clear();
+    }
+
+    // Walking backwards, the pair moved into an erased slot is already stamped
+    for (size_t i = m_pairs.size(); i-- > 0;)
+    {
+        if (m_pairStamps[i] == m_frame)
+            continue;
+        const BroadphasePair pair = m_pairs[i];
+        m_removed.push_back(pair);
+        ErasePair(FindSlot(PairKey(pair.idA, pair.idB)));
+    }
+}
+
+void SweepAndPrune::Layout()
+{
+    // Sweep along the axis where the centers spread most, cut slabs along
+    // the next one
+    double sum[3] = {}, sumSquares[3] = {}, size[3] = {};
+    float low[3] = {INFINITY_VALUE, INFINITY_VALUE, INFINITY_VALUE};
+    float high[3] = {-INFINITY_VALUE, -INFINITY_VALUE, -INFINITY_VALUE};
+    for (uint32_t id = 0; id < m_state.size(); ++id)
+    {
+        if (m_state[id] != BodyState::Active)
+            continue;
+        const Body& body = m_bodies[id];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const float center = 0.5f * (body.min[axis] + body.max[axis]);
+            sum[axis] += center;
+            sumSquares[axis] += static_cast<double>(center) * center;
+            size[axis] += body.max[axis] - body.min[axis];
+            low[axis] = std::min(low[axis], center);
+            high[axis] = std::max(high[axis], center);
+        }
+    }
+
+    const double count = static_cast<double>(std::max<size_t>(m_bodyCount, 1));
+    double variance[3];
+    for (int axis = 0; axis < 3; ++axis)
+        variance[axis] = sumSquares[axis] / count - (sum[axis] / count) * (sum[axis] / count);
+    m_axes[0] = 0;
+    m_axes[1] = 1;
+    m_axes[2] = 2;
+    std::sort(m_axes, m_axes + 3, [&](int a, int b) { return variance[a] > variance[b]; });
+
+    const int slabAxis = m_axes[1];
+    uint32_t slabCount = 1;
+    m_slabOrigin = 0.0f;
+    m_inverseSlabWidth = 0.0f;
+    if (m_bodyCount > 0 && high[slabAxis] > low[slabAxis])
+    {
+        const float range = high[slabAxis] - low[slabAxis];
+        const float averageSize = static_cast<float>(size[slabAxis] / count);
+        const float wanted = averageSize > 0.0f ? range / (SLAB_WIDTH_IN_BOXES * averageSize) : float(MAX_SLABS);
+        const size_t limit = std::min<size_t>(MAX_SLABS, m_bodyCount / MIN_BODIES_PER_SLAB + 1);
+        slabCount = static_cast<uint32_t>(std::max(1.0f, std::min(wanted, static_cast<float>(limit))));
+        m_slabOrigin = low[slabAxis];
+        m_inverseSlabWidth = static_cast<float>(slabCount) / range;
+    }
+
+    m_slabs.resize(slabCount);
+    for (Slab& slab : m_slabs)
+    {
+        slab.ids.clear();
+        slab.incoming.clear();
+    }
+    for (Body& body : m_bodies)
+    {
+        body.firstSlab = INVALID_INDEX;
+        body.lastSlab = 0;
+    }
+    m_layoutCount = m_bodyCount;
+}
+
+uint32_t SweepAndPrune::SlabOf(float value) const
+{
+    // Clamp in float first so values far outside the range cannot overflow
+    const float slab = (value - m_slabOrigin) * m_inverseSlabWidth;
+    const float last = static_cast<float>(m_slabs.size() - 1);
+    return static_cast<uint32_t>(slab > 0.0f ? std::min(slab, last) : 0.0f);
+}
+
+void SweepAndPrune::AssignSlabs()
+{
+    const int slabAxis = m_axes[1];
+    const float low = m_slabOrigin;
+    const float high = m_inverseSlabWidth > 0.0f ? m_slabOrigin + m_slabs.size() / m_inverseSlabWidth : low;
+    m_outsideCount = 0;
+    for (uint32_t id = 0; id < m_state.size(); ++id)
+    {
+        Body& body = m_bodies[id];
+        if (m_state[id] != BodyState::Active)
+        {
+            // An empty range makes every slab drop the body
+            m_state[id] = BodyState::Absent;
+            body.firstSlab = INVALID_INDEX;
+            body.lastSlab = 0;
+            continue;
+        }
+
+        const float minimum = body.min[slabAxis], maximum = body.max[slabAxis];
+        const float center = 0.5f * (minimum + maximum);
+        m_outsideCount += center < low || center > high;
+
+        const uint32_t first = SlabOf(minimum), last = SlabOf(maximum);
+        const uint32_t oldFirst = body.firstSlab, oldLast = body.lastSlab;
+        if (first == oldFirst && last == oldLast)
+            continue;
+        for (uint32_t slab = first; slab <= last; ++slab)
+        {
+            if (slab < oldFirst || slab > oldLast)
+                m_slabs[slab].incoming.push_back(id);
+        }
+        body.firstSlab = first;
+        body.lastSlab = last;
+    }
+}
+
+void SweepAndPrune::UpdateSlab(uint32_t index)
+{
+    Slab& slab = m_slabs[index];
+    const int sweepAxis = m_axes[0], slabAxis = m_axes[1], otherAxis = m_axes[2];
+    const size_t capacity = slab.ids.size() + slab.incoming.size() + SWEEP_WIDTH;
+    for (std::vector<float>& bounds : slab.bounds)
+    {
+        if (bounds.size() < capacity)
+            bounds.resize(capacity);
+    }
+    float* const b[6] = {slab.bounds[0].data(), slab.bounds[1].data(), slab.bounds[2].data(),
+                         slab.bounds[3].data(), slab.bounds[4].data(), slab.bounds[5].data()};
+
+    const auto gather = [&](size_t i, uint32_t id, const Body& body) {
+        slab.ids[i] = id;
+        b[0][i] = body.min[sweepAxis];
+        b[1][i] = body.max[sweepAxis];
+        b[2][i] = body.min[slabAxis];
+        b[3][i] = body.max[slabAxis];
+        b[4][i] = body.min[otherAxis];
+        b[5][i] = body.max[otherAxis];
+    };
+
+    // Keep the bodies still in this slab, in last frame's order
+    size_t count = 0;
+    for (size_t i = 0; i < slab.ids.size(); ++i)
+    {
+        const uint32_t id = slab.ids[i];
+        const Body& body = m_bodies[id];
+        if (body.firstSlab <= index && index <= body.lastSlab)
+            gather(count++, id, body);
+    }
+    const size_t arrivals = slab.incoming.size();
+    slab.ids.resize(count + arrivals);
+    for (uint32_t id : slab.incoming)
+        gather(count++, id, m_bodies[id]);
+    slab.incoming.clear();
+
+    // Insertion sort by min on the sweep axis, giving up if motion was not coherent
+    bool sorted = arrivals <= MAX_INSERTION_ARRIVALS;
+    size_t budget = count * MAX_INSERTION_SHIFTS_PER_BOX;
+    for (size_t i = 1; i < count && sorted; ++i)
+    {
+        if (!(b[0][i] < b[0][i - 1]))
+            continue;
+        const uint32_t id = slab.ids[i];
+        const float value[6] = {b[0][i], b[1][i], b[2][i], b[3][i], b[4][i], b[5][i]};
+        size_t j = i;
+        do
+        {
+            slab.ids[j] = slab.ids[j - 1];
+            for (int k = 0; k < 6; ++k)
+                b[k][j] = b[k][j - 1];
+            --j;
+        } while (j > 0 && value[0] < b[0][j - 1]);
+        slab.ids[j] = id;
+        for (int k = 0; k < 6; ++k)
+            b[k][j] = value[k];
+
+        const size_t shifts = i - j;
+        sorted = shifts <= budget;
+        budget -= std::min(shifts, budget);
+    }
+
+    if (!sorted)
+    {
+        slab.order.resize(count);
+        std::iota(slab.order.begin(), slab.order.end(), 0u);
+        std::sort(slab.order.begin(), slab.order.end(), [&](uint32_t l, uint32_t r) { return b[0][l] < b[0][r]; });
+        slab.scratch.assign(slab.ids.begin(), slab.ids.end());
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint32_t id = slab.scratch[slab.order[i]];
+            gather(i, id, m_bodies[id]);
+        }
+    }
+
+    // Boxes starting at infinity let the sweep read whole blocks past the end
+    for (size_t i = count; i < count + SWEEP_WIDTH; ++i)
+    {
+        for (int k = 0; k < 6; ++k)
+            b[k][i] = INFINITY_VALUE;
+    }
+}
+
+void SweepAndPrune::SweepSlab(uint32_t index)
+{
+    Slab& slab = m_slabs[index];
+    const size_t count = slab.ids.size();
+    const float* minS = slab.bounds[0].data();
+    const float* maxS = slab.bounds[1].data();
+    const float* minT = slab.bounds[2].data();
+    const float* maxT = slab.bounds[3].data();
+    const float* minU = slab.bounds[4].data();
+    const float* maxU = slab.bounds[5].data();
+
+    // Boxes spanning several slabs meet in each; only the slab holding the
+    // start of their overlap reports the pair
+    const auto found = [&](size_t i, size_t j) {
+        if (SlabOf(std::max(minT[i], minT[j])) == index)
+            slab.found.push_back({slab.ids[i], slab.ids[j]});
+    };
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t j = i + 1;
+#if defined(HERMIT_SIMD_AVX2)
+        const __m256 boxMaxS = _mm256_set1_ps(maxS[i]);
+        const __m256 boxMinT = _mm256_set1_ps(minT[i]), boxMaxT = _mm256_set1_ps(maxT[i]);
+        const __m256 boxMinU = _mm256_set1_ps(minU[i]), boxMaxU = _mm256_set1_ps(maxU[i]);
+        while (true)
+        {
+            // Later boxes start no earlier, so the sweep axis only needs their min
+            const uint32_t inS = static_cast<uint32_t>(
+                _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(minS + j), boxMaxS, _CMP_LE_OQ)));
+            if (!inS)
+                break;
+            const __m256 inT = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minT + j), boxMaxT, _CMP_LE_OQ),
+                                             _mm256_cmp_ps(boxMinT, _mm256_loadu_ps(maxT + j), _CMP_LE_OQ));
+            const __m256 inU = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minU + j), boxMaxU, _CMP_LE_OQ),
+                                             _mm256_cmp_ps(boxMinU, _mm256_loadu_ps(maxU + j), _CMP_LE_OQ));
+            for (uint32_t mask = inS & static_cast<uint32_t>(_mm256_movemask_ps(_mm256_and_ps(inT, inU))); mask;
+                 mask &= mask - 1)
+                found(i, j + CountTrailingZeros(mask));
+            if (inS != 0xFF)
+                break;
+            j += SWEEP_WIDTH;
+        }
+#else
+        for (; minS[j] <= maxS[i]; ++j)
+        {
+            if (minT[j] <= maxT[i] && minT[i] <= maxT[j] && minU[j] <= maxU[i] && minU[i] <= maxU[j])
+                found(i, j);
+        }
+#endif
+    }
+}
+
+uint32_t SweepAndPrune::FindSlot(uint64_t key) const
+{
+    const size_t mask = m_table.size() - 1;
+    for (uint32_t slot = HashPair(key, mask);; slot = (slot + 1) & mask)
+    {
+        const uint32_t index = m_table[slot];
+        if (index == INVALID_INDEX || PairKey(m_pairs[index].idA, m_pairs[index].idB) == key)
+            return slot;
+    }
+}
+
+bool SweepAndPrune::AddPair(uint32_t a, uint32_t b)
+{
+    const uint32_t slot = FindSlot(PairKey(a, b));
+    if (m_table[slot] != INVALID_INDEX)
+        return false;
+
+    m_table[slot] = static_cast<uint32_t>(m_pairs.size());
+    m_pairs.push_back({std::min(a, b), std::max(a, b)});
+    m_pairStamps.push_back(m_frame);
+    if (m_pairs.size() * 2 > m_table.size())
+        GrowTable();
+    return true;
+}
+
+void SweepAndPrune::ErasePair(uint32_t slot)
+{
+    const uint32_t index = m_table[slot];
+    const size_t mask = m_table.size() - 1;
+
+    // Backward-shift deletion keeps probe sequences intact without tombstones
+    uint32_t hole = slot;
+    for (uint32_t next = (hole + 1) & mask; m_table[next] != INVALID_INDEX; next = (next + 1) & mask)
+    {
+        const BroadphasePair& pair = m_pairs[m_table[next]];
+        const uint32_t home = HashPair(PairKey(pair.idA, pair.idB), mask);
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            m_table[hole] = m_table[next];
+            hole = next;
+        }
+    }
+    m_table[hole] = INVALID_INDEX;
+
+    // Keep the dense arrays packed by moving the last pair into the gap
+    const uint32_t last = static_cast<uint32_t>(m_pairs.size() - 1);
+    if (index != last)
+    {
+        const BroadphasePair moved = m_pairs[last];
+        m_table[FindSlot(PairKey(moved.idA, moved.idB))] = index;
+        m_pairs[index] = moved;
+        m_pairStamps[index] = m_pairStamps[last];
+    }
+    m_pairs.pop_back();
+    m_pairStamps.pop_back();
+}
+
+void SweepAndPrune::GrowTable()
+{
+    m_table.assign(m_table.size() * 2, INVALID_INDEX);
+    const size_t mask = m_table.size() - 1;
+    for (uint32_t i = 0; i < m_pairs.size(); ++i)
+    {
+        uint32_t slot = HashPair(PairKey(m_pairs[i].idA, m_pairs[i].idB), mask);
+        while (m_table[slot] != INVALID_INDEX)
+            slot = (slot + 1) & mask;
+        m_table[slot] = i;
+    }
+}
+
+} // namespace Physics
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "Math/BoundingBox.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Physics
+{
+/**
+ * @brief Two bodies whose boxes overlap, with idA < idB
+ */
+struct BroadphasePair
+{
+    uint32_t idA = 0;
+    uint32_t idB = 0;
+};
+
+/**
+ * @brief Sweep-and-prune broadphase over axis-aligned boxes
+ *
+ * Boxes are swept along the axis where their centers spread the most, and
+ * the space is cut into slabs along the axis with the second largest spread
+ * so that each sweep only meets boxes that are near on two axes. A box is
+ * listed in every slab it spans; a pair is reported by the slab that holds
+ * the start of its overlap on the slab axis, so it is found exactly once.
+ *
+ * Every slab keeps its boxes ordered by their min on the sweep axis between
+ * updates. Bodies move little per frame, so insertion sort restores the
+ * order in close to linear time; the sweep then tests eight boxes at a time
+ * on all three axes with SIMD. Slabs are independent and update in parallel.
+ *
+ * The pair cache stamps every pair found by the sweep. New pairs are
+ * reported as added and pairs that were not found again as removed.
+ *
+ * The axes and slabs are chosen again on the first update, whenever the body
+ * count has doubled or halved since, and when many boxes have left the slab
+ * range. Bodies are identified by caller-chosen ids, which should be dense.
+ * Touching boxes count as overlapping.
+ */
+class SweepAndPrune
+{
+  public:
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+    static constexpr uint32_t MAX_SLABS = 256;
+
+    /**
+     * @brief Add a body; its pairs appear at the next UpdatePairs()
+     * @param id Identifier reported in pairs
+     * @param bounds World-space box (must be finite and not empty)
+     * @return False if the id is already present or the box is empty or not finite
+     */
+    bool Insert(uint32_t id, const Math::BoundingBox& bounds);
+
+    /**
+     * @brief Set a body's box; pairs change at the next UpdatePairs()
+     * @return False if the id is not present or the box is empty or not finite
+     */
+    bool Move(uint32_t id, const Math::BoundingBox& bounds);
+
+    /**
+     * @brief Remove a body; its pairs are reported removed at the next UpdatePairs()
+     * @return False if the id is not present
+     * @note Removing and re-inserting an id before the update behaves like a move
+     */
+    bool Remove(uint32_t id);
+
+    bool Contains(uint32_t id) const;
+    size_t GetCount() const { return m_bodyCount; }
+    uint32_t GetSlabCount() const { return static_cast<uint32_t>(m_slabs.size()); }
+
+    /**
+     * @brief Remove every body and pair without reporting events
+     */
+    void Clear();
+
+    /**
+     * @brief Bring the pair cache up to date with the current boxes
+     * @note Replaces the added and removed pair lists
+     */
+    void UpdatePairs();
+
+    /**
+     * @brief Every overlapping pair as of the last UpdatePairs(), in no particular order
+     */
+    const std::vector<BroadphasePair>& GetPairs() const { return m_pairs; }
+
+    /**
+     * @brief Pairs that started overlapping in the last UpdatePairs()
+     */
+    const std::vector<BroadphasePair>& GetAddedPairs() const { return m_added; }
+
+    /**
+     * @brief Pairs that stopped overlapping (or lost a body) in the last UpdatePairs()
+     */
+    const std::vector<BroadphasePair>& GetRemovedPairs() const { return m_removed; }
+
+  private:
+    enum class BodyState : uint8_t
+    {
+        Absent,
+        Active,
+        Removed // Still listed in slabs until the next update
+    };
+
+    // Everything a slab reads about a body, in one place
+    struct Body
+    {
+        float min[3];
+        float max[3];
+        uint32_t firstSlab; // Slab range the body is listed in; first > last when none
+        uint32_t lastSlab;
+    };
+
+    // Bounds of the listed boxes in sweep order, as min/max pairs for the
+    // sweep, slab and remaining axis, padded for whole SIMD blocks
+    struct Slab
+    {
+        std::vector<uint32_t> ids;
+        std::vector<float> bounds[6];
+        std::vector<uint32_t> incoming; // Bodies that entered since the last update
+        std::vector<BroadphasePair> found;
+        std::vector<uint32_t> order;    // Sort scratch
+        std::vector<uint32_t> scratch;
+    };
+
+    void Layout();
+    void AssignSlabs();
+    void UpdateSlab(uint32_t slab);
+    void SweepSlab(uint32_t slab);
+    uint32_t SlabOf(float value) const;
+
+    bool AddPair(uint32_t a, uint32_t b);
+    uint32_t FindSlot(uint64_t key) const;
+    void ErasePair(uint32_t slot);
+    void GrowTable();
+
+    size_t m_bodyCount = 0;
+    std::vector<BodyState> m_state;
+    std::vector<Body> m_bodies;
+
+    // Axis order: sweep, slab, remaining
+    int m_axes[3] = {0, 1, 2};
+    float m_slabOrigin = 0.0f;
+    float m_inverseSlabWidth = 0.0f;
+    size_t m_layoutCount = 0;
+    size_t m_outsideCount = 0; // Centers beyond the slab range at the last update
+    std::vector<Slab> m_slabs;
+
+    // Pair cache: dense pairs plus an open-addressed table of indices into them
+    std::vector<BroadphasePair> m_pairs;
+    std::vector<uint32_t> m_pairStamps;
+    std::vector<uint32_t> m_table;
+    uint32_t m_frame = 0;
+    std::vector<BroadphasePair> m_added;
+    std::vector<BroadphasePair> m_removed;
+};
+
+} // namespace Physics
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../Math/Vector2.h"
 #include "../Math/Vector3.h"
 #include <cstdint>
 #include <vector>
@@ -11,11 +12,17 @@ namespace Renderer
 struct Vertex
 {
     Math::Vector3 position;
-    // Add color for now, can expand with UVs, normals later
     struct
     {
         float r, g, b, a;
     } color;
+    Math::Vector3 normal;
+    // xyz is the tangent direction, w the bitangent sign (+1 or -1)
+    struct
+    {
+        float x = 1.0f, y = 0.0f, z = 0.0f, w = 1.0f;
+    } tangent;
+    Math::Vector2 texCoord;
 };
 
 // Primitive Topology
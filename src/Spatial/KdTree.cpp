@@ -0,0 +1,245 @@
+#include "Spatial/KdTree.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+
+namespace Spatial
+{
+namespace
+{
+constexpr size_t GRAIN_SIZE = 16384;
+constexpr size_t QUERY_GRAIN_SIZE = 256;
+constexpr size_t SUBTREES_PER_WORKER = 8;
+
+uint32_t Median(uint32_t begin, uint32_t end)
+{
+    return begin + (end - begin) / 2;
+}
+} // namespace
+
+void KdTree::Build(const std::vector<Math::Vector3>& points)
+{
+    Build(points.data(), points.size());
+}
+
+void KdTree::Build(const Math::Vector3* points, size_t count)
+{
+    m_entries.resize(count);
+    m_axes.resize(count);
+
+    Threading::ParallelFor(count, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            Entry& entry = m_entries[i];
+            entry.position[0] = points[i].x;
+            entry.position[1] = points[i].y;
+            entry.position[2] = points[i].z;
+            entry.index = static_cast<uint32_t>(i);
+        }
+    });
+
+    // Split the top levels serially until there are enough independent
+    // subtrees to keep every worker busy, then finish them in parallel
+    const size_t targetSubtrees = Threading::GetWorkerCount() * SUBTREES_PER_WORKER;
+    m_ranges.clear();
+    m_ranges.push_back({0, static_cast<uint32_t>(count)});
+    bool split = true;
+    while (split && m_ranges.size() < targetSubtrees)
+    {
+        split = false;
+        m_nextRanges.clear();
+        for (const Range& range : m_ranges)
+        {
+            if (range.end - range.begin <= LEAF_SIZE)
+            {
+                m_nextRanges.push_back(range);
+                continue;
+            }
+
+            const uint32_t median = SplitRange(range.begin, range.end);
+            m_nextRanges.push_back({range.begin, median});
+            m_nextRanges.push_back({median + 1, range.end});
+            split = true;
+        }
+        m_ranges.swap(m_nextRanges);
+    }
+
+    Threading::ParallelFor(m_ranges.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            BuildRange(m_ranges[i]);
+        }
+    });
+}
+
+uint32_t KdTree::SplitRange(uint32_t begin, uint32_t end)
+{
+    float low[3] = {m_entries[begin].position[0], m_entries[begin].position[1], m_entries[begin].position[2]};
+    float high[3] = {low[0], low[1], low[2]};
+    for (uint32_t i = begin + 1; i < end; ++i)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            low[axis] = std::min(low[axis], m_entries[i].position[axis]);
+            high[axis] = std::max(high[axis], m_entries[i].position[axis]);
+        }
+    }
+
+    const float extent[3] = {high[0] - low[0], high[1] - low[1], high[2] - low[2]};
+    const int axis = extent[0] >= extent[1] ? (extent[0] >= extent[2] ? 0 : 2) : (extent[1] >= extent[2] ? 1 : 2);
+
+    const uint32_t median = Median(begin, end);
+    std::nth_element(m_entries.begin() + begin, m_entries.begin() + median, m_entries.begin() + end,
+                     [axis](const Entry& a, const Entry& b) { return a.position[axis] < b.position[axis]; });
+    m_axes[median] = static_cast<uint8_t>(axis);
+    return median;
+}
+
+void KdTree::BuildRange(Range range)
+{
+    Range stack[MAX_DEPTH];
+    size_t stackSize = 0;
+    stack[stackSize++] = range;
+
+    while (stackSize > 0)
+    {
+        const Range current = stack[--stackSize];
+        if (current.end - current.begin <= LEAF_SIZE)
+            continue;
+
+        const uint32_t median = SplitRange(current.begin, current.end);
+        stack[stackSize++] = {current.begin, median};
+        stack[stackSize++] = {median + 1, current.end};
+    }
+}
+
+template <typename Visit>
+void KdTree::Search(const float* position, float& limitSquared, Visit&& visit) const
+{
+    if (m_entries.empty())
+        return;
+
+    // Ranges still to visit, with a lower bound on their squared distance
+    struct Pending
+    {
+        uint32_t begin;
+        uint32_t end;
+        float distanceSquared;
+    };
+
+    auto distanceSquared = [position](const Entry& entry) {
+        const float dx = entry.position[0] - position[0];
+        const float dy = entry.position[1] - position[1];
+        const float dz = entry.position[2] - position[2];
+        return dx * dx + dy * dy + dz * dz;
+    };
+
+    Pending stack[MAX_DEPTH];
+    size_t stackSize = 0;
+    stack[stackSize++] = {0, static_cast<uint32_t>(m_entries.size()), 0.0f};
+
+    while (stackSize > 0)
+    {
+        const Pending pending = stack[--stackSize];
+        if (pending.distanceSquared > limitSquared)
+            continue;
+
+        if (pending.end - pending.begin <= LEAF_SIZE)
+        {
+            for (uint32_t i = pending.begin; i < pending.end; ++i)
+            {
+                const float d = distanceSquared(m_entries[i]);
+                if (d <= limitSquared)
+                    visit(m_entries[i], d);
+            }
+            continue;
+        }
+
+        const uint32_t median = Median(pending.begin, pending.end);
+        const Entry& node = m_entries[median];
+        const float d = distanceSquared(node);
+        if (d <= limitSquared)
+            visit(node, d);
+
+        const int axis = m_axes[median];
+        const float offset = position[axis] - node.position[axis];
+        const Pending low = {pending.begin, median, pending.distanceSquared};
+        const Pending high = {median + 1, pending.end, pending.distanceSquared};
+
+        // Push the far side first so the near side is searched next and
+        // tightens the limit before the far side is popped
+        Pending far = offset < 0.0f ? high : low;
+        far.distanceSquared = std::max(pending.distanceSquared, offset * offset);
+        if (far.begin < far.end && far.distanceSquared <= limitSquared)
+            stack[stackSize++] = far;
+
+        const Pending& near = offset < 0.0f ? low : high;
+        if (near.begin < near.end)
+            stack[stackSize++] = near;
+    }
+}
+
+size_t KdTree::FindNearest(const Math::Vector3& position, size_t k, uint32_t* outIndices, float* outDistancesSquared,
+                           float maxDistance) const
+{
+    if (k == 0)
+        return 0;
+
+    const float query[3] = {position.x, position.y, position.z};
+    float limitSquared = maxDistance * maxDistance;
+    size_t found = 0;
+
+    // The output arrays hold the best candidates sorted by distance; k is
+    // usually small, so insertion beats a heap
+    Search(query, limitSquared, [&](const Entry& entry, float d) {
+        if (found == k && d >= limitSquared)
+            return;
+
+        size_t slot = found < k ? found++ : k - 1;
+        for (; slot > 0 && outDistancesSquared[slot - 1] > d; --slot)
+        {
+            outIndices[slot] = outIndices[slot - 1];
+            outDistancesSquared[slot] = outDistancesSquared[slot - 1];
+        }
+        outIndices[slot] = entry.index;
+        outDistancesSquared[slot] = d;
+
+        if (found == k)
+            limitSquared = outDistancesSquared[k - 1];
+    });
+
+    return found;
+}
+
+void KdTree::QueryRadius(const Math::Vector3& center, float radius, std::vector<uint32_t>& outIndices) const
+{
+    const float query[3] = {center.x, center.y, center.z};
+    float limitSquared = radius * radius;
+    Search(query, limitSquared, [&](const Entry& entry, float) { outIndices.push_back(entry.index); });
+}
+
+void KdTree::FindNearestBatch(const Math::Vector3* positions, size_t positionCount, size_t k, uint32_t* outIndices,
+                              float* outDistancesSquared, uint32_t* outCounts, float maxDistance) const
+{
+    Threading::ParallelFor(positionCount, QUERY_GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            outCounts[i] = static_cast<uint32_t>(
+                FindNearest(positions[i], k, outIndices + i * k, outDistancesSquared + i * k, maxDistance));
+        }
+    });
+}
+
+void KdTree::QueryRadiusBatch(const Math::Vector3* centers, size_t centerCount, float radius,
+                              std::vector<std::vector<uint32_t>>& outIndices) const
+{
+    outIndices.resize(centerCount);
+    Threading::ParallelFor(centerCount, QUERY_GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            outIndices[i].clear();
+            QueryRadius(centers[i], radius, outIndices[i]);
+        }
+    });
+}
+
+} // namespace Spatial
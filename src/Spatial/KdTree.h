@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Math/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Spatial
+{
+/**
+ * @brief Static k-d tree over a point cloud for nearest-neighbour queries
+ *
+ * The tree is implicit: Build() copies the points once and partitions the
+ * copy in place around medians, so each node is the median point of its
+ * range and its children are the halves on either side. There are no child
+ * pointers, every subtree occupies one contiguous range (the lower levels of
+ * a search therefore stay within a few cache lines whatever the line size),
+ * and ranges of LEAF_SIZE points or fewer are scanned linearly. Each split
+ * is along the widest axis of the range's points.
+ *
+ * Rebuild when the points change; queries are const and thread-safe.
+ */
+class KdTree
+{
+  public:
+    static constexpr size_t LEAF_SIZE = 8;
+
+    // Deeper than any tree Build() can produce for 32-bit indices
+    static constexpr size_t MAX_DEPTH = 64;
+
+    /**
+     * @brief Rebuild the tree
+     * @param points Points to index; indices into this array are what queries report
+     * @param count Number of points
+     * @note Top-level splits run serially and the subtrees below them in
+     *       parallel. Internal buffers are reused, so rebuilding a cloud of
+     *       similar size does not allocate.
+     */
+    void Build(const Math::Vector3* points, size_t count);
+    void Build(const std::vector<Math::Vector3>& points);
+
+    size_t GetCount() const { return m_entries.size(); }
+
+    /**
+     * @brief Find the k points closest to a position
+     * @param position Query position
+     * @param k Number of neighbours wanted
+     * @param outIndices Receives up to k point indices, closest first
+     * @param outDistancesSquared Receives the matching squared distances
+     * @param maxDistance Ignore points further than this
+     * @return Number of neighbours found (less than k if fewer points are in range)
+     */
+    size_t FindNearest(const Math::Vector3& position, size_t k, uint32_t* outIndices, float* outDistancesSquared,
+                       float maxDistance = std::numeric_limits<float>::infinity()) const;
+
+    /**
+     * @brief Collect the points within a distance of a center
+     * @param center Query center
+     * @param radius Query radius (inclusive)
+     * @param outIndices Receives matching point indices (appended)
+     */
+    void QueryRadius(const Math::Vector3& center, float radius, std::vector<uint32_t>& outIndices) const;
+
+    /**
+     * @brief Run FindNearest() for many positions in parallel
+     * @param positions Query positions
+     * @param positionCount Number of queries
+     * @param k Neighbours per query
+     * @param outIndices positionCount * k indices; query i writes from i * k
+     * @param outDistancesSquared positionCount * k squared distances, laid out the same way
+     * @param outCounts Receives the number of neighbours found per query
+     * @param maxDistance Ignore points further than this
+     * @note Queries close to each other in the input share cache lines, so
+     *       spatially sorted batches run faster
+     */
+    void FindNearestBatch(const Math::Vector3* positions, size_t positionCount, size_t k, uint32_t* outIndices,
+                          float* outDistancesSquared, uint32_t* outCounts,
+                          float maxDistance = std::numeric_limits<float>::infinity()) const;
+
+    /**
+     * @brief Run QueryRadius() for many centers in parallel
+     * @param centers Query centers
+     * @param centerCount Number of queries
+     * @param radius Query radius (inclusive)
+     * @param outIndices Resized to centerCount; each list is cleared then
+     *                   filled, so reusing it across calls keeps its capacity
+     */
+    void QueryRadiusBatch(const Math::Vector3* centers, size_t centerCount, float radius,
+                          std::vector<std::vector<uint32_t>>& outIndices) const;
+
+  private:
+    struct Entry
+    {
+        float position[3];
+        uint32_t index; // Into the array passed to Build()
+    };
+
+    struct Range
+    {
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    template <typename Visit>
+    void Search(const float* position, float& limitSquared, Visit&& visit) const;
+
+    uint32_t SplitRange(uint32_t begin, uint32_t end);
+    void BuildRange(Range range);
+
+    std::vector<Entry> m_entries;
+    std::vector<uint8_t> m_axes; // Split axis of the node at each range's median
+
+    // Build scratch, kept between builds
+    std::vector<Range> m_ranges;
+    std::vector<Range> m_nextRanges;
+};
+
+} // namespace Spatial
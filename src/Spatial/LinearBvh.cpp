@@ -0,0 +1,254 @@
+#include "Spatial/LinearBvh.h"
+#include "Spatial/Morton.h"
+#include "Spatial/RadixSort.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Spatial
+{
+namespace
+{
+constexpr size_t GRAIN_SIZE = 16384;
+constexpr size_t SUBTREES_PER_WORKER = 8;
+
+int CountLeadingZeros(uint32_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    return _BitScanReverse(&index, value) ? 31 - static_cast<int>(index) : 32;
+#else
+    return value ? __builtin_clz(value) : 32;
+#endif
+}
+
+// Length of the common prefix of the keys at sorted positions i and j, or -1
+// if j is out of range. Equal codes fall back to comparing the positions so
+// that duplicate centroids still split.
+int CommonPrefix(const uint32_t* codes, int64_t count, int64_t i, int64_t j)
+{
+    if (j < 0 || j >= count)
+        return -1;
+
+    const uint32_t a = codes[i];
+    const uint32_t b = codes[j];
+    if (a == b)
+        return 32 + CountLeadingZeros(static_cast<uint32_t>(i ^ j));
+    return CountLeadingZeros(a ^ b);
+}
+
+// Per-node bounds writes go component by component; Vector3's copy and
+// constructors are out of line and dominated the bottom-up pass
+void StoreBox(Math::BoundingBox& output, const Math::BoundingBox& box)
+{
+    output.min.x = box.min.x;
+    output.min.y = box.min.y;
+    output.min.z = box.min.z;
+    output.max.x = box.max.x;
+    output.max.y = box.max.y;
+    output.max.z = box.max.z;
+}
+
+void StoreUnion(Math::BoundingBox& output, const Math::BoundingBox& a, const Math::BoundingBox& b)
+{
+    output.min.x = std::min(a.min.x, b.min.x);
+    output.min.y = std::min(a.min.y, b.min.y);
+    output.min.z = std::min(a.min.z, b.min.z);
+    output.max.x = std::max(a.max.x, b.max.x);
+    output.max.y = std::max(a.max.y, b.max.y);
+    output.max.z = std::max(a.max.z, b.max.z);
+}
+} // namespace
+
+void LinearBvh::Build(const std::vector<Math::BoundingBox>& primitiveBounds)
+{
+    Build(primitiveBounds.data(), primitiveBounds.size());
+}
+
+void LinearBvh::Build(const Math::BoundingBox* primitiveBounds, size_t count)
+{
+    m_primitiveCount = count;
+    if (count == 0)
+    {
+        m_nodes.clear();
+        return;
+    }
+
+    m_centroids.resize(count);
+    m_codes.resize(count);
+    m_order.resize(count);
+    m_codeScratch.resize(count);
+    m_orderScratch.resize(count);
+
+    // Centroid bounds, reduced per chunk so the pass stays parallel
+    const size_t chunkCount = (count + GRAIN_SIZE - 1) / GRAIN_SIZE;
+    m_chunkBounds.assign(chunkCount, Math::BoundingBox());
+    Threading::ParallelFor(chunkCount, 1, [&](size_t firstChunk, size_t lastChunk) {
+        for (size_t chunk = firstChunk; chunk < lastChunk; ++chunk)
+        {
+            const size_t end = std::min((chunk + 1) * GRAIN_SIZE, count);
+            Math::BoundingBox bounds;
+            for (size_t i = chunk * GRAIN_SIZE; i < end; ++i)
+            {
+                const Math::BoundingBox& box = primitiveBounds[i];
+                Math::Vector3& centroid = m_centroids[i];
+                centroid.x = (box.min.x + box.max.x) * 0.5f;
+                centroid.y = (box.min.y + box.max.y) * 0.5f;
+                centroid.z = (box.min.z + box.max.z) * 0.5f;
+                m_order[i] = static_cast<uint32_t>(i);
+                StoreUnion(bounds, bounds, Math::BoundingBox(centroid, centroid));
+            }
+            StoreBox(m_chunkBounds[chunk], bounds);
+        }
+    });
+
+    Math::BoundingBox centroidBounds;
+    for (const Math::BoundingBox& bounds : m_chunkBounds)
+    {
+        centroidBounds.Expand(bounds);
+    }
+
+    Morton::EncodePoints(m_centroids.data(), count, centroidBounds, m_codes.data());
+    RadixSort::SortPairs(m_codes.data(), m_order.data(), count, m_codeScratch.data(), m_orderScratch.data(),
+                         Morton::CODE_BITS, &m_sortHistograms);
+
+    m_nodes.resize(2 * count - 1);
+
+    BuildHierarchy();
+    ComputeBounds(primitiveBounds);
+}
+
+void LinearBvh::BuildHierarchy()
+{
+    const int64_t count = static_cast<int64_t>(m_primitiveCount);
+    const uint32_t firstLeaf = static_cast<uint32_t>(count - 1);
+    const uint32_t* codes = m_codes.data();
+
+    Threading::ParallelFor(m_primitiveCount - 1, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t node = begin; node < end; ++node)
+        {
+            const int64_t i = static_cast<int64_t>(node);
+
+            // The range grows towards the neighbour sharing the longer prefix
+            const int direction = CommonPrefix(codes, count, i, i + 1) > CommonPrefix(codes, count, i, i - 1) ? 1 : -1;
+            const int minPrefix = CommonPrefix(codes, count, i, i - direction);
+
+            // Exponential then binary search for the other end of the range
+            int64_t maxLength = 2;
+            while (CommonPrefix(codes, count, i, i + maxLength * direction) > minPrefix)
+            {
+                maxLength *= 2;
+            }
+            int64_t length = 0;
+            for (int64_t step = maxLength / 2; step >= 1; step /= 2)
+            {
+                if (CommonPrefix(codes, count, i, i + (length + step) * direction) > minPrefix)
+                    length += step;
+            }
+            const int64_t j = i + length * direction;
+
+            // Binary search for the last key sharing the node's prefix
+            const int nodePrefix = CommonPrefix(codes, count, i, j);
+            int64_t split = 0;
+            for (int shift = 1;; ++shift)
+            {
+                const int64_t step = (length + (int64_t(1) << shift) - 1) >> shift;
+                if (CommonPrefix(codes, count, i, i + (split + step) * direction) > nodePrefix)
+                    split += step;
+                if (step <= 1)
+                    break;
+            }
+            const int64_t gamma = i + split * direction + std::min(direction, 0);
+
+            BvhNode& output = m_nodes[node];
+            output.left = static_cast<uint32_t>(std::min(i, j) == gamma ? firstLeaf + gamma : gamma);
+            output.right = static_cast<uint32_t>(std::max(i, j) == gamma + 1 ? firstLeaf + gamma + 1 : gamma + 1);
+        }
+    });
+}
+
+void LinearBvh::ComputeBounds(const Math::BoundingBox* primitiveBounds)
+{
+    const size_t firstLeaf = m_primitiveCount - 1;
+    Threading::ParallelFor(m_primitiveCount, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t leaf = begin; leaf < end; ++leaf)
+        {
+            BvhNode& output = m_nodes[firstLeaf + leaf];
+            output.left = m_order[leaf];
+            output.right = BvhNode::INVALID_INDEX;
+            StoreBox(output.bounds, primitiveBounds[output.left]);
+        }
+    });
+
+    // Expand the tree breadth-first until there are enough independent
+    // subtrees to keep every worker busy. The subtrees are merged in
+    // parallel, then the few nodes above them serially, children first.
+    // Unlike a leaf-to-root walk this needs no per-node atomic counter,
+    // which measured slower than the merge itself.
+    const size_t targetSubtrees = Threading::GetWorkerCount() * SUBTREES_PER_WORKER;
+    m_upperNodes.clear();
+    m_subtrees.assign(1, 0);
+    while (m_subtrees.size() < targetSubtrees)
+    {
+        m_nextSubtrees.clear();
+        for (uint32_t node : m_subtrees)
+        {
+            if (m_nodes[node].IsLeaf())
+            {
+                m_nextSubtrees.push_back(node);
+                continue;
+            }
+            m_upperNodes.push_back(node);
+            m_nextSubtrees.push_back(m_nodes[node].left);
+            m_nextSubtrees.push_back(m_nodes[node].right);
+        }
+        if (m_nextSubtrees.size() == m_subtrees.size())
+            break;
+        m_subtrees.swap(m_nextSubtrees);
+    }
+
+    Threading::ParallelFor(m_subtrees.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            MergeSubtree(m_subtrees[i]);
+        }
+    });
+
+    for (auto it = m_upperNodes.rbegin(); it != m_upperNodes.rend(); ++it)
+    {
+        BvhNode& node = m_nodes[*it];
+        StoreUnion(node.bounds, m_nodes[node.left].bounds, m_nodes[node.right].bounds);
+    }
+}
+
+void LinearBvh::MergeSubtree(uint32_t node)
+{
+    // Recursion depth is bounded by MAX_DEPTH
+    BvhNode& output = m_nodes[node];
+    if (output.IsLeaf())
+        return;
+
+    MergeSubtree(output.left);
+    MergeSubtree(output.right);
+    StoreUnion(output.bounds, m_nodes[output.left].bounds, m_nodes[output.right].bounds);
+}
+
+void LinearBvh::QueryBox(const Math::BoundingBox& box, std::vector<uint32_t>& outPrimitives) const
+{
+    Query([&](const Math::BoundingBox& bounds) { return bounds.Intersects(box); }, outPrimitives);
+}
+
+void LinearBvh::QueryFrustum(const Math::Frustum& frustum, std::vector<uint32_t>& outPrimitives) const
+{
+    Query([&](const Math::BoundingBox& bounds) { return frustum.IntersectsBox(bounds); }, outPrimitives);
+}
+
+Math::BoundingBox LinearBvh::GetBounds() const
+{
+    return m_nodes.empty() ? Math::BoundingBox() : m_nodes[0].bounds;
+}
+
+} // namespace Spatial
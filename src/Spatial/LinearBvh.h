@@ -0,0 +1,222 @@
+#pragma once
+
+#include "Math/BoundingBox.h"
+#include "Math/Frustum.h"
+#include "Math/Vector3.h"
+#include "Spatial/RaycastHit.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Spatial
+{
+/**
+ * @brief A BVH node; leaves hold exactly one primitive
+ */
+struct BvhNode
+{
+    Math::BoundingBox bounds;
+    uint32_t left = 0;  // Left child, or the primitive index for leaves
+    uint32_t right = 0; // Right child, or INVALID_INDEX for leaves
+
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+    bool IsLeaf() const { return right == INVALID_INDEX; }
+};
+
+/**
+ * @brief Linear BVH (LBVH) built from Morton-sorted primitive centroids
+ *
+ * Construction sorts centroids along a Z-curve and derives the whole
+ * hierarchy from the sorted codes (Karras 2012): every internal node finds
+ * its key range and split independently, then bounds are merged bottom-up
+ * over independent subtrees. All stages run in parallel and the tree
+ * quality is lower than SAH, which suits dynamic scenes that rebuild every
+ * frame. Internal nodes occupy [0, n - 1) with the root at 0, and leaves
+ * occupy [n - 1, 2n - 1) in Morton order.
+ */
+class LinearBvh
+{
+  public:
+    // Deeper than any tree Build() can produce (keys plus index tie-breaks are 64 bits)
+    static constexpr size_t MAX_DEPTH = 96;
+
+    /**
+     * @brief Rebuild the hierarchy
+     * @param primitiveBounds Bounds of each primitive; indices into this array
+     *                        are what queries report
+     * @param count Number of primitives
+     * @note Internal buffers are reused, so rebuilding a scene of similar size
+     *       every frame does not allocate
+     */
+    void Build(const Math::BoundingBox* primitiveBounds, size_t count);
+    void Build(const std::vector<Math::BoundingBox>& primitiveBounds);
+
+    /**
+     * @brief Collect primitives whose bounds overlap a box
+     * @param box Query box
+     * @param outPrimitives Receives primitive indices (appended)
+     */
+    void QueryBox(const Math::BoundingBox& box, std::vector<uint32_t>& outPrimitives) const;
+
+    /**
+     * @brief Collect primitives whose bounds overlap a frustum
+     * @param frustum View frustum in the primitives' space
+     * @param outPrimitives Receives primitive indices (appended)
+     * @note Uses Frustum::IntersectsBox, so it is conservative near corners
+     */
+    void QueryFrustum(const Math::Frustum& frustum, std::vector<uint32_t>& outPrimitives) const;
+
+    /**
+     * @brief Find the closest primitive hit by a ray
+     * @param origin Ray origin
+     * @param direction Ray direction (need not be normalized; distances are in its units)
+     * @param maxDistance Ignore hits further than this
+     * @param intersect Called as intersect(primitive, distance) for primitives whose
+     *                  bounds the ray enters. distance holds the closest hit so far;
+     *                  return true after storing a closer hit in it
+     * @param outHit Receives the closest hit
+     * @return True if any primitive was hit
+     * @note Children are visited near-first and skipped once their entry distance
+     *       exceeds the closest hit
+     */
+    template <typename Intersect>
+    bool Raycast(const Math::Vector3& origin, const Math::Vector3& direction, float maxDistance, Intersect&& intersect,
+                 RaycastHit& outHit) const;
+
+    const std::vector<BvhNode>& GetNodes() const { return m_nodes; }
+    size_t GetPrimitiveCount() const { return m_primitiveCount; }
+
+    /**
+     * @brief Bounds of every primitive
+     * @return The root bounds, or an empty box for an empty tree
+     */
+    Math::BoundingBox GetBounds() const;
+
+  private:
+    template <typename Overlaps>
+    void Query(Overlaps&& overlaps, std::vector<uint32_t>& outPrimitives) const;
+
+    void BuildHierarchy();
+    void ComputeBounds(const Math::BoundingBox* primitiveBounds);
+    void MergeSubtree(uint32_t node);
+
+    size_t m_primitiveCount = 0;
+    std::vector<BvhNode> m_nodes;
+
+    // Build scratch, kept between builds
+    std::vector<Math::Vector3> m_centroids;
+    std::vector<uint32_t> m_codes;
+    std::vector<uint32_t> m_order;
+    std::vector<uint32_t> m_codeScratch;
+    std::vector<uint32_t> m_orderScratch;
+    std::vector<size_t> m_sortHistograms;
+    std::vector<Math::BoundingBox> m_chunkBounds;
+    std::vector<uint32_t> m_upperNodes;
+    std::vector<uint32_t> m_subtrees;
+    std::vector<uint32_t> m_nextSubtrees;
+};
+
+template <typename Overlaps>
+void LinearBvh::Query(Overlaps&& overlaps, std::vector<uint32_t>& outPrimitives) const
+{
+    if (m_nodes.empty())
+        return;
+
+    uint32_t stack[MAX_DEPTH];
+    size_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const BvhNode& node = m_nodes[stack[--stackSize]];
+        if (!overlaps(node.bounds))
+            continue;
+
+        if (node.IsLeaf())
+        {
+            outPrimitives.push_back(node.left);
+        }
+        else
+        {
+            stack[stackSize++] = node.right;
+            stack[stackSize++] = node.left;
+        }
+    }
+}
+
+template <typename Intersect>
+bool LinearBvh::Raycast(const Math::Vector3& origin, const Math::Vector3& direction, float maxDistance,
+                        Intersect&& intersect, RaycastHit& outHit) const
+{
+    if (m_nodes.empty())
+        return false;
+
+    // Zero components give infinite reciprocals, which the slab test handles
+    const float inf = std::numeric_limits<float>::infinity();
+    const Math::Vector3 inverseDirection(direction.x != 0.0f ? 1.0f / direction.x : inf,
+                                         direction.y != 0.0f ? 1.0f / direction.y : inf,
+                                         direction.z != 0.0f ? 1.0f / direction.z : inf);
+
+    struct Entry
+    {
+        uint32_t node;
+        float distance;
+    };
+
+    float closest = maxDistance;
+    bool hit = false;
+
+    Entry stack[MAX_DEPTH];
+    size_t stackSize = 0;
+    float rootDistance;
+    if (!m_nodes[0].bounds.IntersectsRay(origin, inverseDirection, closest, rootDistance))
+        return false;
+    stack[stackSize++] = {0, rootDistance};
+
+    while (stackSize > 0)
+    {
+        const Entry entry = stack[--stackSize];
+        if (entry.distance > closest)
+            continue;
+
+        const BvhNode& node = m_nodes[entry.node];
+        if (node.IsLeaf())
+        {
+            float distance = closest;
+            if (intersect(node.left, distance) && distance <= closest)
+            {
+                closest = distance;
+                outHit.id = node.left;
+                outHit.distance = distance;
+                hit = true;
+            }
+            continue;
+        }
+
+        float leftDistance, rightDistance;
+        const bool hitLeft = m_nodes[node.left].bounds.IntersectsRay(origin, inverseDirection, closest, leftDistance);
+        const bool hitRight = m_nodes[node.right].bounds.IntersectsRay(origin, inverseDirection, closest, rightDistance);
+
+        // Push the far child first so the near one is popped next
+        if (hitLeft && hitRight)
+        {
+            const bool leftFirst = leftDistance <= rightDistance;
+            stack[stackSize++] = leftFirst ? Entry{node.right, rightDistance} : Entry{node.left, leftDistance};
+            stack[stackSize++] = leftFirst ? Entry{node.left, leftDistance} : Entry{node.right, rightDistance};
+        }
+        else if (hitLeft)
+        {
+            stack[stackSize++] = {node.left, leftDistance};
+        }
+        else if (hitRight)
+        {
+            stack[stackSize++] = {node.right, rightDistance};
+        }
+    }
+
+    return hit;
+}
+
+} // namespace Spatial
@@ -0,0 +1,334 @@
+#include "Spatial/LooseOctree.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+
+namespace Spatial
+{
+namespace
+{
+constexpr size_t GRAIN_SIZE = 4096;
+constexpr uint32_t CHILD_COUNT = 8;
+
+// Relocation states for UpdateBatch
+constexpr uint8_t BATCH_STAYS = 0;
+constexpr uint8_t BATCH_RELOCATES = 1;
+constexpr uint8_t BATCH_MISSING = 2;
+} // namespace
+
+Math::BoundingBox LooseOctree::Node::GetLooseBounds() const
+{
+    const float looseHalfSize = halfSize * 2.0f;
+    return Math::BoundingBox::FromCenterExtents(center, Math::Vector3(looseHalfSize, looseHalfSize, looseHalfSize));
+}
+
+LooseOctree::LooseOctree(const Math::BoundingBox& worldBounds, uint32_t maxDepth)
+    : m_maxDepth(std::min(maxDepth, MAX_DEPTH_LIMIT))
+{
+    const Math::Vector3 size = worldBounds.IsEmpty() ? Math::Vector3::One() : worldBounds.GetSize();
+    const float halfSize = std::max(std::max(std::max(size.x, size.y), size.z) * 0.5f, 1e-6f);
+
+    Node root;
+    root.center = worldBounds.IsEmpty() ? Math::Vector3::Zero() : worldBounds.GetCenter();
+    root.halfSize = halfSize;
+    m_origin = root.center - Math::Vector3(halfSize, halfSize, halfSize);
+    m_nodes.push_back(root);
+}
+
+bool LooseOctree::Contains(uint32_t id) const
+{
+    return id < m_slotOf.size() && m_slotOf[id] != INVALID_INDEX;
+}
+
+bool LooseOctree::Insert(uint32_t id, const Math::BoundingBox& bounds)
+{
+    if (Contains(id))
+        return false;
+
+    if (id >= m_slotOf.size())
+        m_slotOf.resize(static_cast<size_t>(id) + 1, INVALID_INDEX);
+
+    const uint32_t slot = static_cast<uint32_t>(m_ids.size());
+    m_bounds.push_back(bounds);
+    m_ids.push_back(id);
+    m_nodeOf.push_back(INVALID_INDEX);
+    m_next.push_back(INVALID_INDEX);
+    m_previous.push_back(INVALID_INDEX);
+    m_slotOf[id] = slot;
+
+    Link(slot, FindOrCreateNode(ComputePlacement(bounds)));
+    return true;
+}
+
+bool LooseOctree::Update(uint32_t id, const Math::BoundingBox& bounds)
+{
+    if (!Contains(id))
+        return false;
+
+    const uint32_t slot = m_slotOf[id];
+    const Placement placement = ComputePlacement(bounds);
+    m_bounds[slot] = bounds;
+
+    if (!IsInNode(m_nodeOf[slot], placement))
+    {
+        Unlink(slot);
+        Link(slot, FindOrCreateNode(placement));
+    }
+    return true;
+}
+
+bool LooseOctree::UpdateBatch(const uint32_t* ids, const Math::BoundingBox* bounds, size_t count)
+{
+    m_batchPlacements.resize(count);
+    m_batchRelocate.resize(count);
+
+    // Objects that stay in their node touch only their own slot
+    Threading::ParallelFor(count, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            if (!Contains(ids[i]))
+            {
+                m_batchRelocate[i] = BATCH_MISSING;
+                continue;
+            }
+
+            const uint32_t slot = m_slotOf[ids[i]];
+            m_batchPlacements[i] = ComputePlacement(bounds[i]);
+            m_bounds[slot] = bounds[i];
+            m_batchRelocate[i] = IsInNode(m_nodeOf[slot], m_batchPlacements[i]) ? BATCH_STAYS : BATCH_RELOCATES;
+        }
+    });
+
+    bool allPresent = true;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (m_batchRelocate[i] == BATCH_MISSING)
+        {
+            allPresent = false;
+        }
+        else if (m_batchRelocate[i] == BATCH_RELOCATES)
+        {
+            const uint32_t slot = m_slotOf[ids[i]];
+            Unlink(slot);
+            Link(slot, FindOrCreateNode(m_batchPlacements[i]));
+        }
+    }
+    return allPresent;
+}
+
+bool LooseOctree::Remove(uint32_t id)
+{
+    if (!Contains(id))
+        return false;
+
+    const uint32_t slot = m_slotOf[id];
+    const uint32_t last = static_cast<uint32_t>(m_ids.size() - 1);
+    Unlink(slot);
+    if (slot != last)
+        MoveSlot(last, slot);
+
+    m_bounds.pop_back();
+    m_ids.pop_back();
+    m_nodeOf.pop_back();
+    m_next.pop_back();
+    m_previous.pop_back();
+    m_slotOf[id] = INVALID_INDEX;
+    return true;
+}
+
+void LooseOctree::Clear()
+{
+    m_nodes.resize(1);
+    m_nodes[0].firstChild = INVALID_INDEX;
+    m_nodes[0].objectHead = INVALID_INDEX;
+    m_nodes[0].objectCount = 0;
+    m_nodes[0].subtreeCount = 0;
+    m_freeBlocks.clear();
+
+    m_bounds.clear();
+    m_ids.clear();
+    m_nodeOf.clear();
+    m_next.clear();
+    m_previous.clear();
+    m_slotOf.clear();
+}
+
+void LooseOctree::QueryBox(const Math::BoundingBox& box, std::vector<uint32_t>& outIds) const
+{
+    Query([&](const Math::BoundingBox& bounds) { return bounds.Intersects(box); }, outIds);
+}
+
+void LooseOctree::QuerySphere(const Math::Vector3& center, float radius, std::vector<uint32_t>& outIds) const
+{
+    Query([&](const Math::BoundingBox& bounds) { return bounds.IntersectsSphere(center, radius); }, outIds);
+}
+
+void LooseOctree::QueryFrustum(const Math::Frustum& frustum, std::vector<uint32_t>& outIds) const
+{
+    Query([&](const Math::BoundingBox& bounds) { return frustum.IntersectsBox(bounds); }, outIds);
+}
+
+LooseOctree::Placement LooseOctree::ComputePlacement(const Math::BoundingBox& bounds) const
+{
+    const Node& root = m_nodes[0];
+    Placement placement;
+    if (!root.GetLooseBounds().Contains(bounds))
+        return placement;
+
+    // Deepest level whose cells are at least as large as the object, so the
+    // object fits in the loose bounds of the cell containing its center
+    const Math::Vector3 extents = bounds.GetExtents();
+    const float extent = std::max(std::max(extents.x, extents.y), extents.z);
+    uint32_t depth = 0;
+    float halfSize = root.halfSize;
+    while (depth < m_maxDepth && halfSize * 0.5f >= extent)
+    {
+        halfSize *= 0.5f;
+        ++depth;
+    }
+
+    // Centers outside the root cell clamp to a border cell, which may then
+    // be too small; step up until the loose bounds contain the object
+    const Math::Float3 center = Math::ToFloat3(bounds.GetCenter() - m_origin);
+    for (; depth > 0; --depth, halfSize *= 2.0f)
+    {
+        const int32_t maxCell = (1 << depth) - 1;
+        const Math::Int3 cell = Math::Clamp(Math::FloorToInt(center / (halfSize * 2.0f)), Math::Int3::Zero(),
+                                            Math::Int3::Splat(maxCell));
+
+        const Math::Vector3 cellCenter =
+            m_origin + Math::ToVector3((Math::Float3(cell) + Math::Float3::Splat(0.5f)) * (halfSize * 2.0f));
+        const float looseHalfSize = halfSize * 2.0f;
+        const Math::BoundingBox loose =
+            Math::BoundingBox::FromCenterExtents(cellCenter, Math::Vector3(looseHalfSize, looseHalfSize, looseHalfSize));
+        if (loose.Contains(bounds))
+        {
+            placement.depth = depth;
+            placement.cell = cell;
+            return placement;
+        }
+    }
+    return placement;
+}
+
+bool LooseOctree::IsInNode(uint32_t node, const Placement& placement) const
+{
+    return m_nodes[node].depth == placement.depth && m_nodes[node].cell == placement.cell;
+}
+
+uint32_t LooseOctree::FindOrCreateNode(const Placement& placement)
+{
+    uint32_t node = 0;
+    for (uint32_t depth = 1; depth <= placement.depth; ++depth)
+    {
+        const uint32_t shift = placement.depth - depth;
+        const uint32_t octant = ((placement.cell.x >> shift) & 1) | (((placement.cell.y >> shift) & 1) << 1) |
+                                (((placement.cell.z >> shift) & 1) << 2);
+
+        if (m_nodes[node].firstChild == INVALID_INDEX)
+            AllocateChildren(node);
+        node = m_nodes[node].firstChild + octant;
+    }
+    return node;
+}
+
+uint32_t LooseOctree::AllocateChildren(uint32_t parent)
+{
+    uint32_t block;
+    if (!m_freeBlocks.empty())
+    {
+        block = m_freeBlocks.back();
+        m_freeBlocks.pop_back();
+    }
+    else
+    {
+        block = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.resize(m_nodes.size() + CHILD_COUNT);
+    }
+
+    const Node& owner = m_nodes[parent];
+    const float halfSize = owner.halfSize * 0.5f;
+    for (uint32_t octant = 0; octant < CHILD_COUNT; ++octant)
+    {
+        const Math::Int3 bits(octant & 1, (octant >> 1) & 1, (octant >> 2) & 1);
+
+        Node child;
+        child.halfSize = halfSize;
+        child.center = owner.center + Math::ToVector3((Math::Float3(bits) * 2.0f - Math::Float3::One()) * halfSize);
+        child.cell = owner.cell * 2 + bits;
+        child.depth = owner.depth + 1;
+        child.parent = parent;
+        m_nodes[block + octant] = child;
+    }
+
+    m_nodes[parent].firstChild = block;
+    return block;
+}
+
+void LooseOctree::Link(uint32_t slot, uint32_t node)
+{
+    Node& target = m_nodes[node];
+    m_nodeOf[slot] = node;
+    m_previous[slot] = INVALID_INDEX;
+    m_next[slot] = target.objectHead;
+    if (target.objectHead != INVALID_INDEX)
+        m_previous[target.objectHead] = slot;
+    target.objectHead = slot;
+    target.objectCount++;
+
+    for (uint32_t ancestor = node; ancestor != INVALID_INDEX; ancestor = m_nodes[ancestor].parent)
+    {
+        m_nodes[ancestor].subtreeCount++;
+    }
+}
+
+void LooseOctree::Unlink(uint32_t slot)
+{
+    const uint32_t node = m_nodeOf[slot];
+    const uint32_t previous = m_previous[slot];
+    const uint32_t next = m_next[slot];
+
+    if (previous != INVALID_INDEX)
+        m_next[previous] = next;
+    else
+        m_nodes[node].objectHead = next;
+
+    if (next != INVALID_INDEX)
+        m_previous[next] = previous;
+
+    m_nodes[node].objectCount--;
+
+    // Walking up, release child blocks whose subtrees just emptied; lower
+    // blocks are released first, so a released block never owns children
+    for (uint32_t ancestor = node; ancestor != INVALID_INDEX; ancestor = m_nodes[ancestor].parent)
+    {
+        Node& current = m_nodes[ancestor];
+        current.subtreeCount--;
+        if (current.firstChild != INVALID_INDEX && current.subtreeCount == current.objectCount)
+        {
+            m_freeBlocks.push_back(current.firstChild);
+            current.firstChild = INVALID_INDEX;
+        }
+    }
+}
+
+void LooseOctree::MoveSlot(uint32_t from, uint32_t to)
+{
+    // Relink neighbours in place; unlinking could release the node's block
+    const uint32_t previous = m_previous[from];
+    const uint32_t next = m_next[from];
+    if (previous != INVALID_INDEX)
+        m_next[previous] = to;
+    else
+        m_nodes[m_nodeOf[from]].objectHead = to;
+    if (next != INVALID_INDEX)
+        m_previous[next] = to;
+
+    m_bounds[to] = m_bounds[from];
+    m_ids[to] = m_ids[from];
+    m_nodeOf[to] = m_nodeOf[from];
+    m_next[to] = next;
+    m_previous[to] = previous;
+    m_slotOf[m_ids[to]] = to;
+}
+
+} // namespace Spatial
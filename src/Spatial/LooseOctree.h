@@ -0,0 +1,275 @@
+#pragma once
+
+#include "Math/BoundingBox.h"
+#include "Math/Frustum.h"
+#include "Math/Vector.h"
+#include "Math/Vector3.h"
+#include "Spatial/RaycastHit.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Spatial
+{
+/**
+ * @brief Loose octree over axis-aligned boxes, for culling and picking
+ *
+ * Every node's loose bounds are twice its cell, so an object is stored in
+ * the node at the depth matching its size whose cell contains its center.
+ * Placement is computed directly rather than by descending and testing, and
+ * an object that moves only needs relocating when its center leaves the
+ * cell or its size changes depth. Objects that do not fit inside the root's
+ * loose bounds are kept at the root, which queries never cull.
+ *
+ * Nodes live in a pool and are allocated in blocks of eight siblings, so a
+ * node's children are adjacent in memory. Blocks whose subtree empties are
+ * returned to a free list.
+ */
+class LooseOctree
+{
+  public:
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+    static constexpr uint32_t DEFAULT_MAX_DEPTH = 5;
+    static constexpr uint32_t MAX_DEPTH_LIMIT = 20; // Cell coordinates must fit 21 bits
+
+    /**
+     * @brief Create an empty octree
+     * @param worldBounds Region where objects are expected; the root becomes
+     *                    the smallest cube around it
+     * @param maxDepth Depth of the smallest nodes (clamped to MAX_DEPTH_LIMIT)
+     * @note Pick a depth whose smallest cells each hold a few objects; deeper
+     *       trees of sparse objects mostly add empty sibling nodes
+     */
+    explicit LooseOctree(const Math::BoundingBox& worldBounds, uint32_t maxDepth = DEFAULT_MAX_DEPTH);
+
+    /**
+     * @brief Add an object
+     * @param id Identifier reported by queries (ids should be dense)
+     * @param bounds Object bounds
+     * @return False if the id is already present
+     */
+    bool Insert(uint32_t id, const Math::BoundingBox& bounds);
+
+    /**
+     * @brief Update an object's bounds, relocating it only when needed
+     * @param id Identifier passed to Insert()
+     * @param bounds New bounds
+     * @return False if the id is not present
+     */
+    bool Update(uint32_t id, const Math::BoundingBox& bounds);
+
+    /**
+     * @brief Update many objects at once
+     * @param ids Identifiers to update
+     * @param bounds New bounds, one per id
+     * @param count Number of updates
+     * @return False if any id was not present (the others are still updated)
+     * @note Placement is computed in parallel and objects that stay in their
+     *       node are updated in parallel; only relocations run serially.
+     *       Each id may appear at most once per batch.
+     */
+    bool UpdateBatch(const uint32_t* ids, const Math::BoundingBox* bounds, size_t count);
+
+    /**
+     * @brief Remove an object
+     * @param id Identifier to remove
+     * @return False if the id is not present
+     */
+    bool Remove(uint32_t id);
+
+    bool Contains(uint32_t id) const;
+    size_t GetCount() const { return m_ids.size(); }
+
+    /**
+     * @brief Number of allocated nodes, including the root
+     * @return Nodes in use (freed blocks excluded)
+     */
+    size_t GetNodeCount() const { return m_nodes.size() - m_freeBlocks.size() * 8; }
+
+    /**
+     * @brief Remove every object and node except the root
+     */
+    void Clear();
+
+    /**
+     * @brief Collect objects whose bounds overlap a box
+     * @param box Query box
+     * @param outIds Receives matching ids (appended)
+     */
+    void QueryBox(const Math::BoundingBox& box, std::vector<uint32_t>& outIds) const;
+
+    /**
+     * @brief Collect objects whose bounds overlap a sphere
+     * @param center Sphere center
+     * @param radius Sphere radius
+     * @param outIds Receives matching ids (appended)
+     */
+    void QuerySphere(const Math::Vector3& center, float radius, std::vector<uint32_t>& outIds) const;
+
+    /**
+     * @brief Collect objects whose bounds overlap a frustum
+     * @param frustum View frustum in world space
+     * @param outIds Receives matching ids (appended)
+     */
+    void QueryFrustum(const Math::Frustum& frustum, std::vector<uint32_t>& outIds) const;
+
+    /**
+     * @brief Find the closest object hit by a ray
+     * @param origin Ray origin
+     * @param direction Ray direction (distances are in its units)
+     * @param maxDistance Ignore hits further than this
+     * @param intersect Called as intersect(id, distance) for objects whose bounds
+     *                  the ray enters. distance holds the closest hit so far;
+     *                  return true after storing a closer hit in it
+     * @param outHit Receives the closest hit
+     * @return True if any object was hit
+     */
+    template <typename Intersect>
+    bool Raycast(const Math::Vector3& origin, const Math::Vector3& direction, float maxDistance, Intersect&& intersect,
+                 RaycastHit& outHit) const;
+
+  private:
+    struct Node
+    {
+        Math::Vector3 center;
+        float halfSize = 0.0f; // Of the cell; the loose bounds are twice as large
+        Math::Int3 cell;       // Cell coordinates at this depth
+        uint32_t depth = 0;
+        uint32_t parent = INVALID_INDEX;
+        uint32_t firstChild = INVALID_INDEX; // Block of eight, or INVALID_INDEX
+        uint32_t objectHead = INVALID_INDEX;
+        uint32_t objectCount = 0;
+        uint32_t subtreeCount = 0; // Objects in this node and below
+
+        Math::BoundingBox GetLooseBounds() const;
+    };
+
+    // Where an object belongs: the root, or a cell at some depth
+    struct Placement
+    {
+        uint32_t depth = 0;
+        Math::Int3 cell;
+    };
+
+    template <typename Overlaps>
+    void Query(Overlaps&& overlaps, std::vector<uint32_t>& outIds) const;
+
+    Placement ComputePlacement(const Math::BoundingBox& bounds) const;
+    bool IsInNode(uint32_t node, const Placement& placement) const;
+    uint32_t FindOrCreateNode(const Placement& placement);
+    uint32_t AllocateChildren(uint32_t parent);
+    void Link(uint32_t slot, uint32_t node);
+    void Unlink(uint32_t slot);
+
+    void MoveSlot(uint32_t from, uint32_t to);
+
+    uint32_t m_maxDepth;
+    Math::Vector3 m_origin; // Minimum corner of the root cell
+    std::vector<Node> m_nodes; // Root at 0, then blocks of eight siblings
+    std::vector<uint32_t> m_freeBlocks;
+
+    // Per-slot object data, stored contiguously
+    std::vector<Math::BoundingBox> m_bounds;
+    std::vector<uint32_t> m_ids;
+    std::vector<uint32_t> m_nodeOf;
+    std::vector<uint32_t> m_next;
+    std::vector<uint32_t> m_previous;
+
+    // id -> slot, INVALID_INDEX when absent
+    std::vector<uint32_t> m_slotOf;
+
+    // Batch update scratch
+    std::vector<Placement> m_batchPlacements;
+    std::vector<uint8_t> m_batchRelocate;
+};
+
+template <typename Overlaps>
+void LooseOctree::Query(Overlaps&& overlaps, std::vector<uint32_t>& outIds) const
+{
+    uint32_t stack[MAX_DEPTH_LIMIT * 8 + 1];
+    size_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const uint32_t index = stack[--stackSize];
+        const Node& node = m_nodes[index];
+
+        // The root also holds objects outside the world bounds, so it is never culled
+        if (index != 0 && !overlaps(node.GetLooseBounds()))
+            continue;
+
+        for (uint32_t slot = node.objectHead; slot != INVALID_INDEX; slot = m_next[slot])
+        {
+            if (overlaps(m_bounds[slot]))
+                outIds.push_back(m_ids[slot]);
+        }
+
+        if (node.firstChild == INVALID_INDEX)
+            continue;
+
+        for (uint32_t child = node.firstChild; child < node.firstChild + 8; ++child)
+        {
+            if (m_nodes[child].subtreeCount > 0)
+                stack[stackSize++] = child;
+        }
+    }
+}
+
+template <typename Intersect>
+bool LooseOctree::Raycast(const Math::Vector3& origin, const Math::Vector3& direction, float maxDistance,
+                          Intersect&& intersect, RaycastHit& outHit) const
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    const Math::Vector3 inverseDirection(direction.x != 0.0f ? 1.0f / direction.x : inf,
+                                         direction.y != 0.0f ? 1.0f / direction.y : inf,
+                                         direction.z != 0.0f ? 1.0f / direction.z : inf);
+
+    float closest = maxDistance;
+    bool hit = false;
+
+    uint32_t stack[MAX_DEPTH_LIMIT * 8 + 1];
+    size_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const uint32_t index = stack[--stackSize];
+        const Node& node = m_nodes[index];
+
+        // Loose nodes overlap, so this is a pruned depth-first search rather
+        // than a strict front-to-back walk
+        float entry;
+        if (index != 0 && !node.GetLooseBounds().IntersectsRay(origin, inverseDirection, closest, entry))
+            continue;
+
+        for (uint32_t slot = node.objectHead; slot != INVALID_INDEX; slot = m_next[slot])
+        {
+            if (!m_bounds[slot].IntersectsRay(origin, inverseDirection, closest, entry))
+                continue;
+
+            float distance = closest;
+            if (intersect(m_ids[slot], distance) && distance <= closest)
+            {
+                closest = distance;
+                outHit.id = m_ids[slot];
+                outHit.distance = distance;
+                hit = true;
+            }
+        }
+
+        if (node.firstChild == INVALID_INDEX)
+            continue;
+
+        for (uint32_t child = node.firstChild; child < node.firstChild + 8; ++child)
+        {
+            if (m_nodes[child].subtreeCount > 0)
+                stack[stackSize++] = child;
+        }
+    }
+
+    return hit;
+}
+
+} // namespace Spatial
@@ -0,0 +1,108 @@
+#include "Spatial/Morton.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+
+namespace Spatial
+{
+namespace
+{
+constexpr size_t GRAIN_SIZE = 16384;
+constexpr float GRID_SIZE = static_cast<float>(Morton::MAX_COORDINATE + 1);
+
+static_assert(sizeof(Math::Vector3) == 3 * sizeof(float), "Point gathers assume a packed Vector3");
+
+// Grid cells per unit length along each axis; flat axes map to cell 0
+Math::Vector3 GetQuantizationScale(const Math::BoundingBox& bounds)
+{
+    const Math::Vector3 size = bounds.GetSize();
+    return Math::Vector3(size.x > 0.0f ? GRID_SIZE / size.x : 0.0f, size.y > 0.0f ? GRID_SIZE / size.y : 0.0f,
+                         size.z > 0.0f ? GRID_SIZE / size.z : 0.0f);
+}
+
+uint32_t Quantize(float value, float origin, float scale)
+{
+    const float cell = std::min(std::max((value - origin) * scale, 0.0f), static_cast<float>(Morton::MAX_COORDINATE));
+    return static_cast<uint32_t>(cell);
+}
+
+uint32_t EncodeQuantized(const Math::Vector3& point, const Math::Vector3& origin, const Math::Vector3& scale)
+{
+    return Morton::Encode(Quantize(point.x, origin.x, scale.x), Quantize(point.y, origin.y, scale.y),
+                          Quantize(point.z, origin.z, scale.z));
+}
+
+#if defined(HERMIT_SIMD_AVX2)
+__m256i QuantizeLanes(__m256 value, __m256 origin, __m256 scale)
+{
+    const __m256 maxCell = _mm256_set1_ps(static_cast<float>(Morton::MAX_COORDINATE));
+    const __m256 cell = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(value, origin), scale),
+                                                    _mm256_setzero_ps()),
+                                      maxCell);
+    return _mm256_cvttps_epi32(cell);
+}
+
+__m256i SpreadLanes(__m256i v)
+{
+    v = _mm256_and_si256(_mm256_or_si256(v, _mm256_slli_epi32(v, 16)), _mm256_set1_epi32(0x030000FF));
+    v = _mm256_and_si256(_mm256_or_si256(v, _mm256_slli_epi32(v, 8)), _mm256_set1_epi32(0x0300F00F));
+    v = _mm256_and_si256(_mm256_or_si256(v, _mm256_slli_epi32(v, 4)), _mm256_set1_epi32(0x030C30C3));
+    v = _mm256_and_si256(_mm256_or_si256(v, _mm256_slli_epi32(v, 2)), _mm256_set1_epi32(0x09249249));
+    return v;
+}
+
+void EncodeRange(const Math::Vector3* points, const Math::Vector3& origin, const Math::Vector3& scale,
+                 uint32_t* outCodes, size_t begin, size_t end)
+{
+    const __m256i stride = _mm256_setr_epi32(0, 3, 6, 9, 12, 15, 18, 21);
+    const __m256 originX = _mm256_set1_ps(origin.x);
+    const __m256 originY = _mm256_set1_ps(origin.y);
+    const __m256 originZ = _mm256_set1_ps(origin.z);
+    const __m256 scaleX = _mm256_set1_ps(scale.x);
+    const __m256 scaleY = _mm256_set1_ps(scale.y);
+    const __m256 scaleZ = _mm256_set1_ps(scale.z);
+
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        const float* base = &points[i].x;
+        const __m256i x = SpreadLanes(QuantizeLanes(_mm256_i32gather_ps(base, stride, 4), originX, scaleX));
+        const __m256i y = SpreadLanes(QuantizeLanes(_mm256_i32gather_ps(base + 1, stride, 4), originY, scaleY));
+        const __m256i z = SpreadLanes(QuantizeLanes(_mm256_i32gather_ps(base + 2, stride, 4), originZ, scaleZ));
+        const __m256i code = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(x, 2), _mm256_slli_epi32(y, 1)), z);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(outCodes + i), code);
+    }
+
+    for (; i < end; ++i)
+    {
+        outCodes[i] = EncodeQuantized(points[i], origin, scale);
+    }
+}
+#else
+void EncodeRange(const Math::Vector3* points, const Math::Vector3& origin, const Math::Vector3& scale,
+                 uint32_t* outCodes, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; ++i)
+    {
+        outCodes[i] = EncodeQuantized(points[i], origin, scale);
+    }
+}
+#endif
+} // namespace
+
+uint32_t Morton::EncodePoint(const Math::Vector3& point, const Math::BoundingBox& bounds)
+{
+    return EncodeQuantized(point, bounds.min, GetQuantizationScale(bounds));
+}
+
+void Morton::EncodePoints(const Math::Vector3* points, size_t count, const Math::BoundingBox& bounds,
+                          uint32_t* outCodes)
+{
+    const Math::Vector3 origin = bounds.min;
+    const Math::Vector3 scale = GetQuantizationScale(bounds);
+
+    Threading::ParallelFor(count, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        EncodeRange(points, origin, scale, outCodes, begin, end);
+    });
+}
+
+} // namespace Spatial
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Math/BoundingBox.h"
+#include "Math/Simd.h"
+#include "Math/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace Spatial
+{
+/**
+ * @brief 30-bit 3D Morton (Z-order) codes
+ *
+ * Interleaves 10 bits per axis as ...x1y1z1x0y0z0, so sorting codes orders
+ * points along a Z-curve and nearby points share long code prefixes. This is
+ * the key the linear BVH builder sorts on.
+ */
+class Morton
+{
+  public:
+    static constexpr uint32_t BITS_PER_AXIS = 10;
+    static constexpr uint32_t MAX_COORDINATE = (1u << BITS_PER_AXIS) - 1;
+    static constexpr uint32_t CODE_BITS = BITS_PER_AXIS * 3;
+
+    /**
+     * @brief Interleave three quantized coordinates
+     * @param x Coordinate in [0, MAX_COORDINATE]
+     * @param y Coordinate in [0, MAX_COORDINATE]
+     * @param z Coordinate in [0, MAX_COORDINATE]
+     * @return The Morton code; higher bits of the inputs are ignored
+     */
+    static uint32_t Encode(uint32_t x, uint32_t y, uint32_t z)
+    {
+#if defined(HERMIT_SIMD_BMI2)
+        return _pdep_u32(x, X_MASK) | _pdep_u32(y, Y_MASK) | _pdep_u32(z, Z_MASK);
+#else
+        return (SpreadBits(x) << 2) | (SpreadBits(y) << 1) | SpreadBits(z);
+#endif
+    }
+
+    /**
+     * @brief Split a Morton code back into its coordinates
+     * @param code Code produced by Encode()
+     * @param x Receives the x coordinate
+     * @param y Receives the y coordinate
+     * @param z Receives the z coordinate
+     */
+    static void Decode(uint32_t code, uint32_t& x, uint32_t& y, uint32_t& z)
+    {
+#if defined(HERMIT_SIMD_BMI2)
+        x = _pext_u32(code, X_MASK);
+        y = _pext_u32(code, Y_MASK);
+        z = _pext_u32(code, Z_MASK);
+#else
+        x = CompactBits(code >> 2);
+        y = CompactBits(code >> 1);
+        z = CompactBits(code);
+#endif
+    }
+
+    /**
+     * @brief Quantize a point to the 1024^3 grid spanning bounds and encode it
+     * @param point Point to encode; points outside bounds are clamped
+     * @param bounds Non-empty quantization bounds
+     * @return The Morton code
+     */
+    static uint32_t EncodePoint(const Math::Vector3& point, const Math::BoundingBox& bounds);
+
+    /**
+     * @brief Encode many points at once
+     * @param points Points to encode
+     * @param count Number of points
+     * @param bounds Non-empty quantization bounds, usually of the points themselves
+     * @param outCodes Receives count codes
+     * @note Runs in parallel; the AVX2 path quantizes and spreads 8 points
+     *       per iteration
+     */
+    static void EncodePoints(const Math::Vector3* points, size_t count, const Math::BoundingBox& bounds,
+                             uint32_t* outCodes);
+
+  private:
+    static constexpr uint32_t X_MASK = 0x24924924;
+    static constexpr uint32_t Y_MASK = 0x12492492;
+    static constexpr uint32_t Z_MASK = 0x09249249;
+
+    // Insert two zero bits between each of the low 10 bits
+    static uint32_t SpreadBits(uint32_t v)
+    {
+        v &= 0x3FF;
+        v = (v | (v << 16)) & 0x030000FF;
+        v = (v | (v << 8)) & 0x0300F00F;
+        v = (v | (v << 4)) & 0x030C30C3;
+        v = (v | (v << 2)) & 0x09249249;
+        return v;
+    }
+
+    // Inverse of SpreadBits
+    static uint32_t CompactBits(uint32_t v)
+    {
+        v &= 0x09249249;
+        v = (v | (v >> 2)) & 0x030C30C3;
+        v = (v | (v >> 4)) & 0x0300F00F;
+        v = (v | (v >> 8)) & 0x030000FF;
+        v = (v | (v >> 16)) & 0x3FF;
+        return v;
+    }
+};
+
+} // namespace Spatial
@@ -0,0 +1,121 @@
+#include "Spatial/RadixSort.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <utility>
+
+namespace Spatial
+{
+namespace
+{
+// Chunks must be large enough that the per-chunk histograms stay cheap to
+// prefix-sum, and numerous enough to balance across workers
+constexpr size_t MIN_CHUNK_SIZE = 16384;
+constexpr size_t CHUNKS_PER_WORKER = 4;
+
+// Run func(chunk, begin, end) for each fixed-size chunk in parallel. Unlike a
+// plain ParallelFor grain, the chunk boundaries do not depend on the thread
+// count, so histograms and scatter offsets line up between passes.
+template <typename Func>
+void ForEachChunk(size_t count, size_t chunkSize, Func&& func)
+{
+    const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+    Threading::ParallelFor(chunkCount, 1, [&](size_t first, size_t last) {
+        for (size_t chunk = first; chunk < last; ++chunk)
+        {
+            const size_t begin = chunk * chunkSize;
+            func(chunk, begin, std::min(begin + chunkSize, count));
+        }
+    });
+}
+} // namespace
+
+void RadixSort::SortPairs(uint32_t* keys, uint32_t* values, size_t count, uint32_t* keyScratch,
+                          uint32_t* valueScratch, uint32_t keyBits, std::vector<size_t>* histogramScratch)
+{
+    keyBits = std::min<uint32_t>(keyBits, 32);
+    if (count < 2 || keyBits == 0)
+        return;
+
+    const size_t workerChunks = Threading::GetWorkerCount() * CHUNKS_PER_WORKER;
+    const size_t chunkSize = std::max(MIN_CHUNK_SIZE, (count + workerChunks - 1) / workerChunks);
+    const size_t chunkCount = (count + chunkSize - 1) / chunkSize;
+
+    // histograms[chunk * BUCKET_COUNT + digit], rewritten in place as scatter offsets
+    std::vector<size_t> localHistograms;
+    std::vector<size_t>& histograms = histogramScratch ? *histogramScratch : localHistograms;
+    histograms.resize(chunkCount * BUCKET_COUNT);
+
+    uint32_t* sourceKeys = keys;
+    uint32_t* sourceValues = values;
+    uint32_t* targetKeys = keyScratch;
+    uint32_t* targetValues = valueScratch;
+
+    for (uint32_t shift = 0; shift < keyBits; shift += RADIX_BITS)
+    {
+        const uint32_t digitBits = std::min(RADIX_BITS, keyBits - shift);
+        const uint32_t mask = (1u << digitBits) - 1;
+
+        ForEachChunk(count, chunkSize, [&](size_t chunk, size_t begin, size_t end) {
+            size_t* histogram = &histograms[chunk * BUCKET_COUNT];
+            std::fill(histogram, histogram + BUCKET_COUNT, size_t(0));
+            for (size_t i = begin; i < end; ++i)
+            {
+                histogram[(sourceKeys[i] >> shift) & mask]++;
+            }
+        });
+
+        // Digit-major exclusive prefix sum: all chunks' 0s, then all 1s, ...
+        size_t running = 0;
+        bool singleDigit = false;
+        for (uint32_t digit = 0; digit < BUCKET_COUNT && !singleDigit; ++digit)
+        {
+            const size_t digitStart = running;
+            for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+            {
+                size_t& entry = histograms[chunk * BUCKET_COUNT + digit];
+                const size_t chunkDigitCount = entry;
+                entry = running;
+                running += chunkDigitCount;
+            }
+            singleDigit = running - digitStart == count;
+        }
+
+        // Every key has the same digit, so the scatter would be a copy
+        if (singleDigit)
+            continue;
+
+        ForEachChunk(count, chunkSize, [&](size_t chunk, size_t begin, size_t end) {
+            size_t* offsets = &histograms[chunk * BUCKET_COUNT];
+            for (size_t i = begin; i < end; ++i)
+            {
+                const size_t target = offsets[(sourceKeys[i] >> shift) & mask]++;
+                targetKeys[target] = sourceKeys[i];
+                targetValues[target] = sourceValues[i];
+            }
+        });
+
+        std::swap(sourceKeys, targetKeys);
+        std::swap(sourceValues, targetValues);
+    }
+
+    if (sourceKeys != keys)
+    {
+        Threading::ParallelFor(count, chunkSize, [&](size_t begin, size_t end) {
+            std::copy(sourceKeys + begin, sourceKeys + end, keys + begin);
+            std::copy(sourceValues + begin, sourceValues + end, values + begin);
+        });
+    }
+}
+
+bool RadixSort::SortPairs(std::vector<uint32_t>& keys, std::vector<uint32_t>& values, uint32_t keyBits)
+{
+    if (keys.size() != values.size())
+        return false;
+
+    std::vector<uint32_t> keyScratch(keys.size());
+    std::vector<uint32_t> valueScratch(values.size());
+    SortPairs(keys.data(), values.data(), keys.size(), keyScratch.data(), valueScratch.data(), keyBits);
+    return true;
+}
+
+} // namespace Spatial
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Spatial
+{
+/**
+ * @brief Parallel LSD radix sort for 32-bit keys with 32-bit payloads
+ *
+ * Sorts 8 bits per pass. Each pass splits the input into fixed chunks,
+ * histograms the chunks in parallel, turns the per-chunk histograms into
+ * scatter offsets and scatters the chunks in parallel, so the sort is stable.
+ * Passes whose digit is the same for every key are skipped, which makes
+ * narrow keys such as 30-bit Morton codes cheaper.
+ */
+class RadixSort
+{
+  public:
+    static constexpr uint32_t RADIX_BITS = 8;
+    static constexpr uint32_t BUCKET_COUNT = 1u << RADIX_BITS;
+
+    /**
+     * @brief Sort key/value pairs by key
+     * @param keys Keys to sort in place
+     * @param values Payload moved along with each key (e.g. a primitive index)
+     * @param count Number of pairs
+     * @param keyScratch Scratch space for count keys
+     * @param valueScratch Scratch space for count values
+     * @param keyBits Only the low keyBits bits of each key are compared
+     * @param histogramScratch Holds the per-chunk histograms if given;
+     *                         otherwise they are allocated for the call
+     * @note The scratch buffers let callers that sort every frame avoid
+     *       reallocating them
+     */
+    static void SortPairs(uint32_t* keys, uint32_t* values, size_t count, uint32_t* keyScratch,
+                          uint32_t* valueScratch, uint32_t keyBits = 32,
+                          std::vector<size_t>* histogramScratch = nullptr);
+
+    /**
+     * @brief Sort key/value pairs by key, allocating scratch space
+     * @param keys Keys to sort in place
+     * @param values Payload, one per key
+     * @param keyBits Only the low keyBits bits of each key are compared
+     * @return False (leaving both untouched) if the sizes differ
+     */
+    static bool SortPairs(std::vector<uint32_t>& keys, std::vector<uint32_t>& values, uint32_t keyBits = 32);
+};
+
+} // namespace Spatial
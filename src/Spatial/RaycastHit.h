@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Spatial
+{
+/**
+ * @brief Closest hit reported by the spatial indices' Raycast()
+ */
+struct RaycastHit
+{
+    uint32_t id = 0xFFFFFFFF; // Primitive index or object id that was hit
+    float distance = 0.0f;    // In units of the ray direction's length
+};
+
+} // namespace Spatial
@@ -0,0 +1,358 @@
+#include "Spatial/SpatialHashGrid.h"
+#include "Spatial/RadixSort.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+
+namespace Spatial
+{
+namespace
+{
+constexpr size_t GRAIN_SIZE = 8192;
+constexpr size_t MIN_TABLE_SIZE = 64;
+
+uint32_t HashCell(const Math::Int3& cell)
+{
+    const uint32_t h = static_cast<uint32_t>(cell.x) * 0x8DA6B343u ^ static_cast<uint32_t>(cell.y) * 0xD8163841u ^
+                       static_cast<uint32_t>(cell.z) * 0xCB1AB31Fu;
+    return h ^ (h >> 16);
+}
+} // namespace
+
+SpatialHashGrid::SpatialHashGrid(float cellSize)
+    : m_cellSize(cellSize > 0.0f ? cellSize : 1.0f), m_inverseCellSize(1.0f / m_cellSize),
+      m_table(MIN_TABLE_SIZE, INVALID_INDEX)
+{
+}
+
+Math::Int3 SpatialHashGrid::GetCell(const Math::Vector3& position) const
+{
+    return Math::FloorToInt(Math::ToFloat3(position) * m_inverseCellSize);
+}
+
+bool SpatialHashGrid::Contains(uint32_t id) const
+{
+    return id < m_slotOf.size() && m_slotOf[id] != INVALID_INDEX;
+}
+
+template <typename Visit>
+void SpatialHashGrid::VisitCells(const Math::Int3& first, const Math::Int3& last, Visit&& visit) const
+{
+    if (first.x > last.x || first.y > last.y || first.z > last.z)
+        return;
+
+    // Large queries are cheaper as a scan over the occupied cells (a double
+    // keeps huge ranges from overflowing)
+    const double volume = (double(last.x) - first.x + 1.0) * (double(last.y) - first.y + 1.0) *
+                          (double(last.z) - first.z + 1.0);
+    if (volume > static_cast<double>(m_cells.size()))
+    {
+        for (const Cell& cell : m_cells)
+        {
+            const Math::Int3& c = cell.coordinate;
+            if (cell.count > 0 && c.x >= first.x && c.x <= last.x && c.y >= first.y && c.y <= last.y &&
+                c.z >= first.z && c.z <= last.z)
+                visit(cell);
+        }
+        return;
+    }
+
+    for (int32_t z = first.z; z <= last.z; ++z)
+    {
+        for (int32_t y = first.y; y <= last.y; ++y)
+        {
+            for (int32_t x = first.x; x <= last.x; ++x)
+            {
+                const uint32_t cell = FindCell(Math::Int3(x, y, z));
+                if (cell != INVALID_INDEX)
+                    visit(m_cells[cell]);
+            }
+        }
+    }
+}
+
+bool SpatialHashGrid::Insert(uint32_t id, const Math::Vector3& position)
+{
+    if (Contains(id))
+        return false;
+
+    if (id >= m_slotOf.size())
+        m_slotOf.resize(static_cast<size_t>(id) + 1, INVALID_INDEX);
+
+    const uint32_t slot = static_cast<uint32_t>(m_ids.size());
+    m_positions.push_back(position);
+    m_ids.push_back(id);
+    m_cellOf.push_back(INVALID_INDEX);
+    m_next.push_back(INVALID_INDEX);
+    m_previous.push_back(INVALID_INDEX);
+    m_slotOf[id] = slot;
+
+    Link(slot, FindOrAddCell(GetCell(position)));
+    return true;
+}
+
+bool SpatialHashGrid::Move(uint32_t id, const Math::Vector3& position)
+{
+    if (!Contains(id))
+        return false;
+
+    const uint32_t slot = m_slotOf[id];
+    const Math::Int3 cell = GetCell(position);
+    m_positions[slot] = position;
+
+    const uint32_t previousCell = m_cellOf[slot];
+    if (m_cells[previousCell].coordinate != cell)
+    {
+        Unlink(slot);
+        ReleaseIfEmpty(previousCell);
+        Link(slot, FindOrAddCell(cell));
+    }
+    return true;
+}
+
+bool SpatialHashGrid::Remove(uint32_t id)
+{
+    if (!Contains(id))
+        return false;
+
+    const uint32_t slot = m_slotOf[id];
+    const uint32_t last = static_cast<uint32_t>(m_ids.size() - 1);
+    const uint32_t cell = m_cellOf[slot];
+    Unlink(slot);
+
+    // Keep slots dense by moving the last slot into the hole
+    if (slot != last)
+    {
+        const uint32_t lastCell = m_cellOf[last];
+        Unlink(last);
+        m_positions[slot] = m_positions[last];
+        m_ids[slot] = m_ids[last];
+        m_slotOf[m_ids[slot]] = slot;
+        Link(slot, lastCell);
+    }
+
+    m_positions.pop_back();
+    m_ids.pop_back();
+    m_cellOf.pop_back();
+    m_next.pop_back();
+    m_previous.pop_back();
+    m_slotOf[id] = INVALID_INDEX;
+
+    // Only now, as the last slot may have been relinked into the same cell
+    ReleaseIfEmpty(cell);
+    return true;
+}
+
+void SpatialHashGrid::Clear()
+{
+    m_table.assign(MIN_TABLE_SIZE, INVALID_INDEX);
+    m_cells.clear();
+    m_freeCells.clear();
+    m_positions.clear();
+    m_ids.clear();
+    m_cellOf.clear();
+    m_next.clear();
+    m_previous.clear();
+    m_slotOf.clear();
+}
+
+void SpatialHashGrid::Rebuild(const Math::Vector3* positions, size_t count)
+{
+    // Keep the table's capacity; the previous frame's cell count is a good guess
+    std::fill(m_table.begin(), m_table.end(), INVALID_INDEX);
+    m_cells.clear();
+    m_freeCells.clear();
+
+    m_positions.resize(count);
+    m_ids.resize(count);
+    m_cellOf.resize(count);
+    m_next.resize(count);
+    m_previous.resize(count);
+    m_slotOf.assign(count, INVALID_INDEX);
+
+    m_rebuildCells.resize(count);
+    m_rebuildKeys.resize(count);
+    m_rebuildOrder.resize(count);
+    m_keyScratch.resize(count);
+    m_orderScratch.resize(count);
+
+    Threading::ParallelFor(count, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            m_rebuildCells[i] = GetCell(positions[i]);
+            m_rebuildKeys[i] = HashCell(m_rebuildCells[i]);
+            m_rebuildOrder[i] = static_cast<uint32_t>(i);
+        }
+    });
+
+    // Sorting by cell hash makes every cell's points adjacent (cells whose
+    // hashes collide may interleave, which the lists below tolerate)
+    RadixSort::SortPairs(m_rebuildKeys.data(), m_rebuildOrder.data(), count, m_keyScratch.data(),
+                         m_orderScratch.data());
+
+    Threading::ParallelFor(count, GRAIN_SIZE, [&](size_t begin, size_t end) {
+        for (size_t slot = begin; slot < end; ++slot)
+        {
+            const uint32_t id = m_rebuildOrder[slot];
+            m_ids[slot] = id;
+            m_slotOf[id] = static_cast<uint32_t>(slot);
+            m_positions[slot] = positions[id];
+        }
+    });
+
+    // Linking to the front in reverse keeps each list in ascending slot order
+    uint32_t cell = INVALID_INDEX;
+    for (size_t slot = count; slot-- > 0;)
+    {
+        const Math::Int3& coordinate = m_rebuildCells[m_ids[slot]];
+        if (cell == INVALID_INDEX || m_cells[cell].coordinate != coordinate)
+            cell = FindOrAddCell(coordinate);
+        Link(static_cast<uint32_t>(slot), cell);
+    }
+}
+
+void SpatialHashGrid::QueryRadius(const Math::Vector3& center, float radius, std::vector<uint32_t>& outIds) const
+{
+    const Math::Vector3 reach(radius, radius, radius);
+    const float radiusSquared = radius * radius;
+
+    VisitCells(GetCell(center - reach), GetCell(center + reach), [&](const Cell& cell) {
+        for (uint32_t slot = cell.head; slot != INVALID_INDEX; slot = m_next[slot])
+        {
+            const Math::Vector3& position = m_positions[slot];
+            const float dx = position.x - center.x;
+            const float dy = position.y - center.y;
+            const float dz = position.z - center.z;
+            if (dx * dx + dy * dy + dz * dz <= radiusSquared)
+                outIds.push_back(m_ids[slot]);
+        }
+    });
+}
+
+void SpatialHashGrid::QueryBox(const Math::BoundingBox& box, std::vector<uint32_t>& outIds) const
+{
+    VisitCells(GetCell(box.min), GetCell(box.max), [&](const Cell& cell) {
+        for (uint32_t slot = cell.head; slot != INVALID_INDEX; slot = m_next[slot])
+        {
+            if (box.Contains(m_positions[slot]))
+                outIds.push_back(m_ids[slot]);
+        }
+    });
+}
+
+uint32_t SpatialHashGrid::FindCell(const Math::Int3& coordinate) const
+{
+    const size_t mask = m_table.size() - 1;
+    for (size_t i = HashCell(coordinate) & mask;; i = (i + 1) & mask)
+    {
+        const uint32_t cell = m_table[i];
+        if (cell == INVALID_INDEX || m_cells[cell].coordinate == coordinate)
+            return cell;
+    }
+}
+
+uint32_t SpatialHashGrid::FindOrAddCell(const Math::Int3& coordinate)
+{
+    // Keep the load factor at or below one half
+    if ((m_cells.size() - m_freeCells.size() + 1) * 2 > m_table.size())
+        GrowTable();
+
+    const size_t mask = m_table.size() - 1;
+    size_t i = HashCell(coordinate) & mask;
+    for (; m_table[i] != INVALID_INDEX; i = (i + 1) & mask)
+    {
+        if (m_cells[m_table[i]].coordinate == coordinate)
+            return m_table[i];
+    }
+
+    uint32_t cell;
+    if (!m_freeCells.empty())
+    {
+        cell = m_freeCells.back();
+        m_freeCells.pop_back();
+    }
+    else
+    {
+        cell = static_cast<uint32_t>(m_cells.size());
+        m_cells.push_back(Cell());
+    }
+    m_cells[cell].coordinate = coordinate;
+    m_table[i] = cell;
+    return cell;
+}
+
+void SpatialHashGrid::ReleaseIfEmpty(uint32_t cell)
+{
+    if (m_cells[cell].count > 0)
+        return;
+
+    const size_t mask = m_table.size() - 1;
+    size_t hole = HashCell(m_cells[cell].coordinate) & mask;
+    while (m_table[hole] != cell)
+    {
+        hole = (hole + 1) & mask;
+    }
+
+    // Backward-shift deletion: pull later entries of the probe run into the
+    // hole unless that would move them before their home slot
+    for (size_t i = (hole + 1) & mask; m_table[i] != INVALID_INDEX; i = (i + 1) & mask)
+    {
+        const size_t home = HashCell(m_cells[m_table[i]].coordinate) & mask;
+        if (((i - home) & mask) >= ((i - hole) & mask))
+        {
+            m_table[hole] = m_table[i];
+            hole = i;
+        }
+    }
+    m_table[hole] = INVALID_INDEX;
+    m_freeCells.push_back(cell);
+}
+
+void SpatialHashGrid::GrowTable()
+{
+    m_table.assign(m_table.size() * 2, INVALID_INDEX);
+    const size_t mask = m_table.size() - 1;
+    for (uint32_t cell = 0; cell < m_cells.size(); ++cell)
+    {
+        // Free cells are empty; every cell in the table holds a point
+        if (m_cells[cell].count == 0)
+            continue;
+
+        size_t i = HashCell(m_cells[cell].coordinate) & mask;
+        while (m_table[i] != INVALID_INDEX)
+        {
+            i = (i + 1) & mask;
+        }
+        m_table[i] = cell;
+    }
+}
+
+void SpatialHashGrid::Link(uint32_t slot, uint32_t cell)
+{
+    Cell& target = m_cells[cell];
+    m_cellOf[slot] = cell;
+    m_previous[slot] = INVALID_INDEX;
+    m_next[slot] = target.head;
+    if (target.head != INVALID_INDEX)
+        m_previous[target.head] = slot;
+    target.head = slot;
+    target.count++;
+}
+
+void SpatialHashGrid::Unlink(uint32_t slot)
+{
+    Cell& cell = m_cells[m_cellOf[slot]];
+    const uint32_t previous = m_previous[slot];
+    const uint32_t next = m_next[slot];
+
+    if (previous != INVALID_INDEX)
+        m_next[previous] = next;
+    else
+        cell.head = next;
+
+    if (next != INVALID_INDEX)
+        m_previous[next] = previous;
+
+    cell.count--;
+}
+
+} // namespace Spatial
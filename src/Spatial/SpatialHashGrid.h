@@ -0,0 +1,152 @@
+#pragma once
+
+#include "Math/BoundingBox.h"
+#include "Math/Vector.h"
+#include "Math/Vector3.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Spatial
+{
+/**
+ * @brief Uniform grid over hashed integer cells for point proximity queries
+ *
+ * Points are identified by caller-chosen ids (typically entity indices, so
+ * they should be dense). Each occupied cell keeps a linked list of slots,
+ * and slot data is stored contiguously: after Rebuild() every cell's points
+ * are adjacent in memory, while Insert/Move/Remove patch the lists in O(1)
+ * and gradually scatter them until the next rebuild.
+ *
+ * Pick a cell size close to the typical query radius so a query visits
+ * about 27 cells.
+ */
+class SpatialHashGrid
+{
+  public:
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+    /**
+     * @brief Create an empty grid
+     * @param cellSize Edge length of a cell (positive)
+     */
+    explicit SpatialHashGrid(float cellSize);
+
+    /**
+     * @brief Add a point
+     * @param id Identifier reported by queries
+     * @param position Point position
+     * @return False if the id is already present
+     */
+    bool Insert(uint32_t id, const Math::Vector3& position);
+
+    /**
+     * @brief Update a point's position
+     * @param id Identifier passed to Insert() or Rebuild()
+     * @param position New position
+     * @return False if the id is not present
+     * @note Moves within the same cell only store the position
+     */
+    bool Move(uint32_t id, const Math::Vector3& position);
+
+    /**
+     * @brief Remove a point
+     * @param id Identifier to remove
+     * @return False if the id is not present
+     */
+    bool Remove(uint32_t id);
+
+    bool Contains(uint32_t id) const;
+    size_t GetCount() const { return m_ids.size(); }
+    float GetCellSize() const { return m_cellSize; }
+
+    /**
+     * @brief Cells allocated, both occupied and emptied ones kept for reuse
+     */
+    size_t GetCellCount() const { return m_cells.size(); }
+
+    /**
+     * @brief Remove every point and forget every cell
+     */
+    void Clear();
+
+    /**
+     * @brief Replace the contents with one point per array element
+     * @param positions Positions; ids are the array indices
+     * @param count Number of positions
+     * @note Cells are computed and points are ordered by cell in parallel,
+     *       which is faster than moving every point when most of them move
+     *       each frame and restores memory locality
+     */
+    void Rebuild(const Math::Vector3* positions, size_t count);
+
+    /**
+     * @brief Collect the points within a distance of a center
+     * @param center Query center
+     * @param radius Query radius (inclusive)
+     * @param outIds Receives matching ids (appended)
+     */
+    void QueryRadius(const Math::Vector3& center, float radius, std::vector<uint32_t>& outIds) const;
+
+    /**
+     * @brief Collect the points inside a box
+     * @param box Query box (inclusive)
+     * @param outIds Receives matching ids (appended)
+     */
+    void QueryBox(const Math::BoundingBox& box, std::vector<uint32_t>& outIds) const;
+
+    /**
+     * @brief Cell containing a position
+     * @param position Position to locate
+     * @return Integer cell coordinates
+     */
+    Math::Int3 GetCell(const Math::Vector3& position) const;
+
+  private:
+    struct Cell
+    {
+        Math::Int3 coordinate;
+        uint32_t head = INVALID_INDEX; // First slot in the cell
+        uint32_t count = 0;
+    };
+
+    template <typename Visit>
+    void VisitCells(const Math::Int3& first, const Math::Int3& last, Visit&& visit) const;
+
+    uint32_t FindCell(const Math::Int3& coordinate) const;
+    uint32_t FindOrAddCell(const Math::Int3& coordinate);
+    void ReleaseIfEmpty(uint32_t cell);
+    void GrowTable();
+
+    void Link(uint32_t slot, uint32_t cell);
+    void Unlink(uint32_t slot);
+
+    float m_cellSize;
+    float m_inverseCellSize;
+
+    // Open-addressed table from cell hash to an index into m_cells. Cells
+    // that become empty leave the table and wait in m_freeCells for reuse,
+    // so m_cells never outgrows the most cells occupied at once.
+    std::vector<uint32_t> m_table;
+    std::vector<Cell> m_cells;
+    std::vector<uint32_t> m_freeCells;
+
+    // Per-slot data, stored contiguously
+    std::vector<Math::Vector3> m_positions;
+    std::vector<uint32_t> m_ids;
+    std::vector<uint32_t> m_cellOf;
+    std::vector<uint32_t> m_next;
+    std::vector<uint32_t> m_previous;
+
+    // id -> slot, INVALID_INDEX when absent
+    std::vector<uint32_t> m_slotOf;
+
+    // Rebuild scratch, kept between rebuilds
+    std::vector<Math::Int3> m_rebuildCells;
+    std::vector<uint32_t> m_rebuildKeys;
+    std::vector<uint32_t> m_rebuildOrder;
+    std::vector<uint32_t> m_keyScratch;
+    std::vector<uint32_t> m_orderScratch;
+};
+
+} // namespace Spatial
@@ -0,0 +1,180 @@
+#include "Threading/Fiber.h"
+#include <cstdint>
+#include <cstdlib>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+#if defined(__SANITIZE_THREAD__)
+#define HERMIT_THREAD_SANITIZER 1
+#elif defined(__has_feature)
+#if __has_feature(thread_sanitizer)
+#define HERMIT_THREAD_SANITIZER 1
+#endif
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+#define HERMIT_ADDRESS_SANITIZER 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define HERMIT_ADDRESS_SANITIZER 1
+#endif
+#endif
+
+#if defined(HERMIT_THREAD_SANITIZER)
+extern "C"
+{
+void* __tsan_get_current_fiber();
+void* __tsan_create_fiber(unsigned flags);
+void __tsan_destroy_fiber(void* fiber);
+void __tsan_switch_to_fiber(void* fiber, unsigned flags);
+}
+#endif
+
+#if defined(HERMIT_ADDRESS_SANITIZER)
+#include <sanitizer/common_interface_defs.h>
+#endif
+
+namespace Threading
+{
+namespace
+{
+#if defined(HERMIT_ADDRESS_SANITIZER)
+// The fiber being left, so the one starting or resuming can record its stack
+thread_local Fiber* t_switchingFrom = nullptr;
+
+// Completes the switch and returns the fiber switched from, with the stack
+// it ran on. Out of line: a fiber may resume on another thread, and
+// thread_local addresses computed before the switch would be the old one's
+__attribute__((noinline)) Fiber* FinishSwitch(void* fakeStack, const void** bottom, size_t* size)
+{
+    __sanitizer_finish_switch_fiber(fakeStack, bottom, size);
+    return t_switchingFrom;
+}
+#endif
+} // namespace
+
+Fiber::~Fiber()
+{
+#if defined(_WIN32)
+    if (m_handle && !m_converted)
+        DeleteFiber(m_handle);
+#endif
+#if defined(HERMIT_THREAD_SANITIZER)
+    if (m_sanitizerFiber && !m_converted)
+        __tsan_destroy_fiber(m_sanitizerFiber);
+#endif
+}
+
+bool Fiber::Create(size_t stackSize, Entry entry, void* argument)
+{
+    m_entry = entry;
+    m_argument = argument;
+    m_converted = false;
+#if defined(_WIN32)
+    m_handle = CreateFiber(stackSize, &Fiber::Start, this);
+    if (!m_handle)
+        return false;
+#else
+    m_stack.reset(new char[stackSize]);
+    if (getcontext(&m_context) != 0)
+        return false;
+    m_context.uc_stack.ss_sp = m_stack.get();
+    m_context.uc_stack.ss_size = stackSize;
+    m_context.uc_link = nullptr;
+
+    // makecontext passes int arguments, so the pointer travels in two halves
+    const uint64_t self = reinterpret_cast<uintptr_t>(this);
+    makecontext(&m_context, reinterpret_cast<void (*)()>(&Fiber::Start), 2, static_cast<unsigned int>(self),
+                static_cast<unsigned int>(self >> 32));
+    m_stackBottom = m_stack.get();
+#endif
+    m_stackSize = stackSize;
+#if defined(HERMIT_THREAD_SANITIZER)
+    m_sanitizerFiber = __tsan_create_fiber(0);
+#endif
+    return true;
+}
+
+bool Fiber::ConvertThread()
+{
+    m_converted = true;
+#if defined(_WIN32)
+    m_handle = ConvertThreadToFiber(nullptr);
+    if (!m_handle)
+        return false;
+#endif
+#if defined(HERMIT_THREAD_SANITIZER)
+    m_sanitizerFiber = __tsan_get_current_fiber();
+#endif
+    return true;
+}
+
+void Fiber::RevertThread()
+{
+#if defined(_WIN32)
+    if (m_handle)
+        ConvertFiberToThread();
+    m_handle = nullptr;
+#endif
+}
+
+void Fiber::SwitchTo(Fiber& target)
+{
+#if defined(HERMIT_ADDRESS_SANITIZER)
+    void* fakeStack = nullptr;
+    t_switchingFrom = this;
+    __sanitizer_start_switch_fiber(&fakeStack, target.m_stackBottom, target.m_stackSize);
+#endif
+#if defined(HERMIT_THREAD_SANITIZER)
+    __tsan_switch_to_fiber(target.m_sanitizerFiber, 0);
+#endif
+
+#if defined(_WIN32)
+    SwitchToFiber(target.m_handle);
+#else
+    swapcontext(&m_context, &target.m_context);
+#endif
+
+#if defined(HERMIT_ADDRESS_SANITIZER)
+    const void* bottom = nullptr;
+    size_t size = 0;
+    Fiber* from = FinishSwitch(fakeStack, &bottom, &size);
+    if (from->m_converted)
+    {
+        from->m_stackBottom = bottom;
+        from->m_stackSize = size;
+    }
+#endif
+}
+
+#if defined(_WIN32)
+void __stdcall Fiber::Start(void* fiber)
+{
+    Fiber* self = static_cast<Fiber*>(fiber);
+#else
+void Fiber::Start(unsigned int low, unsigned int high)
+{
+    Fiber* self = reinterpret_cast<Fiber*>(static_cast<uintptr_t>((static_cast<uint64_t>(high) << 32) | low));
+#endif
+#if defined(HERMIT_ADDRESS_SANITIZER)
+    // A converted thread learns its stack bounds when it switches away
+    const void* bottom = nullptr;
+    size_t size = 0;
+    Fiber* from = FinishSwitch(nullptr, &bottom, &size);
+    if (from->m_converted)
+    {
+        from->m_stackBottom = bottom;
+        from->m_stackSize = size;
+    }
+#endif
+    self->m_entry(self->m_argument);
+
+    // Returning from the first frame of a fiber would end its thread
+    std::abort();
+}
+} // namespace Threading
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#if !defined(_WIN32)
+#include <ucontext.h>
+#endif
+
+namespace Threading
+{
+/**
+ * @brief A user-mode execution context with its own stack
+ *
+ * Wraps Windows fibers, or ucontext elsewhere. A thread must adopt its own
+ * context with ConvertThread() before it can switch to a created fiber;
+ * after that, fibers may be switched to from any converted thread, so a
+ * suspended fiber can resume on a different thread than the one it left.
+ *
+ * Switches are annotated for ThreadSanitizer and AddressSanitizer when they
+ * are enabled. Stacks have no guard page, so size them for the deepest job.
+ */
+class Fiber
+{
+  public:
+    using Entry = void (*)(void* argument);
+
+    Fiber() = default;
+    ~Fiber();
+
+    Fiber(const Fiber&) = delete;
+    Fiber& operator=(const Fiber&) = delete;
+
+    /**
+     * @brief Create a fiber that starts at entry(argument) when first switched to
+     * @param stackSize Stack bytes
+     * @param entry Must never return; switch away instead
+     * @return False if the fiber could not be created
+     */
+    bool Create(size_t stackSize, Entry entry, void* argument);
+
+    /**
+     * @brief Make the calling thread's own context switchable
+     * @return False if the thread could not be converted
+     */
+    bool ConvertThread();
+
+    /**
+     * @brief Undo ConvertThread(); call on the same thread, while running this fiber
+     */
+    void RevertThread();
+
+    /**
+     * @brief Save the running context into this fiber and continue in target
+     * @note Must be called while this fiber is the one running; returns when
+     *       something switches back to it
+     */
+    void SwitchTo(Fiber& target);
+
+  private:
+#if defined(_WIN32)
+    static void __stdcall Start(void* fiber);
+
+    void* m_handle = nullptr;
+#else
+    static void Start(unsigned int low, unsigned int high);
+
+    ucontext_t m_context;
+    std::unique_ptr<char[]> m_stack;
+#endif
+    Entry m_entry = nullptr;
+    void* m_argument = nullptr;
+    bool m_converted = false; // Adopted a thread rather than created
+
+    // Sanitizer state: the stack bounds (learned on each switch away for a
+    // converted thread) and the ThreadSanitizer fiber handle
+    const void* m_stackBottom = nullptr;
+    size_t m_stackSize = 0;
+    void* m_sanitizerFiber = nullptr;
+};
+} // namespace Threading
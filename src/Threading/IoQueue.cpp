@@ -0,0 +1,74 @@
+#include "Threading/IoQueue.h"
+#include <fstream>
+
+namespace Threading
+{
+IoQueue::IoQueue(JobSystem& jobs) : m_jobs(jobs)
+{
+    m_thread = std::thread([this]() { ThreadMain(); });
+}
+
+IoQueue::~IoQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+}
+
+void IoQueue::Push(ReadAwaiter* request)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        request->m_next = nullptr;
+        if (m_tail)
+            m_tail->m_next = request;
+        else
+            m_head = request;
+        m_tail = request;
+    }
+    m_wake.notify_one();
+}
+
+void IoQueue::ThreadMain()
+{
+    for (;;)
+    {
+        ReadAwaiter* request = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [this]() { return m_head || m_stop; });
+            if (!m_head)
+                return;
+            request = m_head;
+            m_head = request->m_next;
+            if (!m_head)
+                m_tail = nullptr;
+        }
+
+        request->m_succeeded = ReadWholeFile(request->m_path, request->m_data);
+        m_completed.fetch_add(1, std::memory_order_release);
+
+        // The request lives in the awaiting frame: nothing may touch it once
+        // the continuation is queued
+        const std::coroutine_handle<> handle = request->m_handle;
+        m_jobs.RunDetached([handle]() { handle.resume(); });
+    }
+}
+
+bool IoQueue::ReadWholeFile(const char* path, std::vector<uint8_t>& data)
+{
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return false;
+
+    const std::streamoff size = file.tellg();
+    if (size < 0)
+        return false;
+    data.resize(static_cast<size_t>(size));
+    file.seekg(0, std::ios::beg);
+    return size == 0 || static_cast<bool>(file.read(reinterpret_cast<char*>(data.data()), size));
+}
+} // namespace Threading
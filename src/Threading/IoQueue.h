@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Threading/JobSystem.h"
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Threading
+{
+/**
+ * @brief Background file reads that coroutines await
+ *
+ * One I/O thread serves reads in the order they were made, so waiting on
+ * the disk never occupies a worker. A coroutine that does
+ * co_await io.ReadFile(path, data) continues as a job on the JobSystem once
+ * the data is in memory, so the disk reads, decoding and uploads of
+ * different assets overlap while each loader reads as straight-line code.
+ *
+ * Requests are the awaiters themselves, linked into the queue, so a read
+ * allocates nothing beyond its destination buffer.
+ */
+class IoQueue
+{
+  public:
+    class ReadAwaiter
+    {
+      public:
+        ReadAwaiter(IoQueue& queue, const char* path, std::vector<uint8_t>& data)
+            : m_queue(queue), m_path(path), m_data(data)
+        {
+        }
+
+        bool await_ready() noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_handle = handle;
+            m_queue.Push(this);
+        }
+
+        // False if the file could not be opened or read
+        bool await_resume() noexcept { return m_succeeded; }
+
+      private:
+        friend class IoQueue;
+        IoQueue& m_queue;
+        const char* m_path;
+        std::vector<uint8_t>& m_data;
+        std::coroutine_handle<> m_handle;
+        ReadAwaiter* m_next = nullptr;
+        bool m_succeeded = false;
+    };
+
+    /**
+     * @param jobs System the awaiting coroutines continue on
+     */
+    explicit IoQueue(JobSystem& jobs);
+
+    /**
+     * @note Reads still queued are served before the I/O thread exits
+     */
+    ~IoQueue();
+
+    IoQueue(const IoQueue&) = delete;
+    IoQueue& operator=(const IoQueue&) = delete;
+
+    /**
+     * @brief Read a whole file
+     * @param path Must stay valid until the read completes
+     * @param data Replaced with the file contents
+     * @return Awaitable yielding true on success
+     */
+    ReadAwaiter ReadFile(const char* path, std::vector<uint8_t>& data) { return ReadAwaiter(*this, path, data); }
+
+    // Reads served so far
+    uint64_t GetCompletedCount() const { return m_completed.load(std::memory_order_acquire); }
+
+  private:
+    void Push(ReadAwaiter* request);
+    void ThreadMain();
+    static bool ReadWholeFile(const char* path, std::vector<uint8_t>& data);
+
+    JobSystem& m_jobs;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    ReadAwaiter* m_head = nullptr; // FIFO, guarded by m_mutex
+    ReadAwaiter* m_tail = nullptr;
+    bool m_stop = false;
+    std::atomic<uint64_t> m_completed{0};
+    std::thread m_thread;
+};
+} // namespace Threading
@@ -0,0 +1,529 @@
+#include "Threading/JobSystem.h"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace Threading
+{
+namespace
+{
+constexpr size_t JOBS_PER_BLOCK = 256;
+constexpr uint32_t SHARED_POOL = 0xFFFFFFFF;
+// Failed attempts to find work before an idle worker sleeps
+constexpr uint32_t IDLE_SPINS = 64;
+
+// Keeps a function out of line and opaque to the optimizer, so a
+// thread_local address it returns is looked up afresh on every call
+#if defined(_MSC_VER)
+#define HERMIT_NO_TLS_CACHE __declspec(noinline)
+#elif defined(__clang__)
+#define HERMIT_NO_TLS_CACHE __attribute__((noinline, optnone))
+#else
+#define HERMIT_NO_TLS_CACHE __attribute__((noinline, noipa))
+#endif
+
+std::mutex g_defaultMutex;
+std::unique_ptr<JobSystem> g_default;
+std::atomic<JobSystem*> g_defaultInstance{nullptr};
+
+void PinThread(std::thread& thread, size_t core)
+{
+#if defined(_WIN32)
+    SetThreadAffinityMask(thread.native_handle(), static_cast<DWORD_PTR>(1) << (core % 64));
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % CPU_SETSIZE, &set);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#else
+    (void)thread;
+    (void)core;
+#endif
+}
+
+uint32_t NextRandom(uint32_t& state)
+{
+    // xorshift32
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+} // namespace
+
+thread_local JobSystem::ThreadState JobSystem::s_thread;
+
+HERMIT_NO_TLS_CACHE JobSystem::ThreadState& JobSystem::LocalThread()
+{
+    return s_thread;
+}
+
+JobSystem::JobSystem(const JobSystemOptions& options)
+{
+    const size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    const size_t workerCount =
+        options.workerCount == JobSystemOptions::AUTO_WORKER_COUNT ? hardwareThreads - 1 : options.workerCount;
+
+    // Every deque exists before any worker starts stealing
+    m_workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        m_workers.push_back(std::make_unique<Worker>(options.dequeCapacity));
+    }
+
+    // One fiber per worker to start on, and at least one more to wait with
+    const size_t fiberCount =
+        workerCount > 0 && options.fiberCount > 0 ? std::max(options.fiberCount, workerCount + 1) : 0;
+    m_fibers.reserve(fiberCount);
+    m_freeFibers.reserve(fiberCount);
+    m_parkedFibers.reserve(fiberCount);
+    for (size_t i = 0; i < fiberCount; ++i)
+    {
+        auto slot = std::make_unique<FiberSlot>();
+        slot->system = this;
+        slot->index = static_cast<uint32_t>(m_fibers.size());
+        slot->waitCounter = nullptr;
+        if (!slot->fiber.Create(options.fiberStackSize, &JobSystem::FiberMain, slot.get()))
+            break;
+        m_freeFibers.push_back(slot->index);
+        m_fibers.push_back(std::move(slot));
+    }
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        m_workers[i]->thread = std::thread([this, i]() { WorkerMain(static_cast<uint32_t>(i)); });
+        if (options.affinity == ThreadAffinity::PinWorkers)
+            PinThread(m_workers[i]->thread, (i + 1) % hardwareThreads);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    m_stop.store(true, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_wake.notify_all();
+    }
+    for (auto& worker : m_workers)
+    {
+        worker->thread.join();
+    }
+}
+
+JobSystem& JobSystem::GetDefault()
+{
+    if (JobSystem* instance = g_defaultInstance.load(std::memory_order_acquire))
+        return *instance;
+
+    std::lock_guard<std::mutex> lock(g_defaultMutex);
+    if (!g_default)
+    {
+        g_default = std::make_unique<JobSystem>();
+        g_defaultInstance.store(g_default.get(), std::memory_order_release);
+    }
+    return *g_default;
+}
+
+bool JobSystem::InitializeDefault(const JobSystemOptions& options)
+{
+    std::lock_guard<std::mutex> lock(g_defaultMutex);
+    if (g_default)
+        return false;
+
+    g_default = std::make_unique<JobSystem>(options);
+    g_defaultInstance.store(g_default.get(), std::memory_order_release);
+    return true;
+}
+
+void JobSystem::WaitForCounter(const JobCounter& counter)
+{
+    while (!counter.IsDone())
+    {
+        // On one of this system's fibers, park and let the thread go on with
+        // a fiber that is ready to resume or a free one
+        const ThreadState& state = LocalThread();
+        if (state.fiber != NO_FIBER && state.owner == this)
+        {
+            uint32_t next = ClaimReadyFiber();
+            if (next == NO_FIBER)
+                next = AcquireFiber();
+            if (next != NO_FIBER)
+            {
+                Suspend(counter, next);
+                continue;
+            }
+        }
+
+        // Not on a fiber, or the pool is exhausted: run jobs on this stack
+        if (!TryRunJob())
+            std::this_thread::yield();
+    }
+}
+
+JobSystem::Job* JobSystem::AllocateJob()
+{
+    const int32_t index = GetWorkerIndex();
+    std::unique_lock<std::mutex> lock(m_sharedMutex, std::defer_lock);
+    if (index < 0)
+        lock.lock();
+
+    JobPool& pool = index >= 0 ? m_workers[index]->pool : m_sharedPool;
+    if (!pool.free)
+        pool.free = pool.returned.exchange(nullptr, std::memory_order_acquire);
+    if (!pool.free)
+    {
+        pool.blocks.push_back(std::make_unique<Job[]>(JOBS_PER_BLOCK));
+        Job* block = pool.blocks.back().get();
+        for (size_t i = 0; i < JOBS_PER_BLOCK; ++i)
+        {
+            block[i].pool = index >= 0 ? static_cast<uint32_t>(index) : SHARED_POOL;
+            block[i].next = i + 1 < JOBS_PER_BLOCK ? &block[i + 1] : nullptr;
+        }
+        pool.free = block;
+    }
+
+    Job* job = pool.free;
+    pool.free = job->next;
+    return job;
+}
+
+void JobSystem::Release(Job* job)
+{
+    // Any thread may finish a job, so it goes back through the owner's
+    // returned list, which the owner takes whole
+    JobPool& pool = job->pool == SHARED_POOL ? m_sharedPool : m_workers[job->pool]->pool;
+    Job* head = pool.returned.load(std::memory_order_relaxed);
+    do
+    {
+        job->next = head;
+    } while (!pool.returned.compare_exchange_weak(head, job, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void JobSystem::Retain(JobCounter& counter)
+{
+    counter.m_value.fetch_add(1, std::memory_order_relaxed);
+}
+
+void JobSystem::Signal(JobCounter& counter)
+{
+    Decrement(counter);
+}
+
+void JobSystem::Submit(Job* job, JobCounter* counter, bool detached)
+{
+    const ThreadState& state = LocalThread();
+    job->parent = state.running == this && !detached ? state.job : nullptr;
+    job->counter = counter;
+    job->unfinished.store(1, std::memory_order_relaxed);
+    if (job->parent)
+        job->parent->unfinished.fetch_add(1, std::memory_order_relaxed);
+    if (counter)
+        counter->m_value.fetch_add(1, std::memory_order_relaxed);
+
+    const int32_t index = GetWorkerIndex();
+    if (m_workers.empty() || (index >= 0 && !m_workers[index]->deque.Push(job)))
+    {
+        // Nobody else to run it, or the deque is full
+        Execute(job);
+        return;
+    }
+    if (index < 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sharedMutex);
+        m_sharedQueue.push_back(job);
+        m_sharedCount.fetch_add(1, std::memory_order_release);
+    }
+
+    // Pairs with Sleep(): either the sleeper sees the job or this sees the sleeper
+    m_queuedJobs.fetch_add(1, std::memory_order_seq_cst);
+    if (m_sleepingWorkers.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_wake.notify_one();
+    }
+}
+
+bool JobSystem::TryRunJob()
+{
+    Job* job = nullptr;
+    const int32_t index = GetWorkerIndex();
+    bool found = index >= 0 && m_workers[index]->deque.Pop(job);
+
+    const size_t workerCount = m_workers.size();
+    const size_t start = workerCount > 0 ? NextRandom(LocalThread().random) % workerCount : 0;
+    for (size_t i = 0; i < workerCount && !found; ++i)
+    {
+        const size_t victim = (start + i) % workerCount;
+        if (static_cast<int32_t>(victim) != index)
+            found = m_workers[victim]->deque.Steal(job);
+    }
+
+    if (!found && m_sharedCount.load(std::memory_order_acquire) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sharedMutex);
+        if (m_sharedHead < m_sharedQueue.size())
+        {
+            job = m_sharedQueue[m_sharedHead++];
+            if (m_sharedHead == m_sharedQueue.size())
+            {
+                m_sharedQueue.clear();
+                m_sharedHead = 0;
+            }
+            m_sharedCount.fetch_sub(1, std::memory_order_relaxed);
+            found = true;
+        }
+    }
+
+    if (!found)
+        return false;
+
+    m_queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    Execute(job);
+    return true;
+}
+
+void JobSystem::Execute(Job* job)
+{
+    // Jobs run inside WaitForCounter() nest, so restore the outer job
+    // afterwards, on whichever thread the job finished
+    ThreadState& state = LocalThread();
+    const JobSystem* outerSystem = state.running;
+    Job* outerJob = state.job;
+    state.running = this;
+    state.job = job;
+    job->invoke(job->payload);
+    ThreadState& after = LocalThread();
+    after.running = outerSystem;
+    after.job = outerJob;
+    Finish(job);
+}
+
+void JobSystem::Finish(Job* job)
+{
+    while (job && job->unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        Job* parent = job->parent;
+        JobCounter* counter = job->counter;
+        Release(job);
+        if (counter)
+            Decrement(*counter);
+        job = parent;
+    }
+}
+
+void JobSystem::Decrement(JobCounter& counter)
+{
+    // Last touch: a waiter may destroy the counter as soon as it reads zero.
+    // Pairs with Sleep(): either the sleeper sees the counter or this sees
+    // the sleeper and wakes it to resume the fiber parked on it
+    if (counter.m_value.fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+        m_parkedCount.load(std::memory_order_seq_cst) > 0 && m_sleepingWorkers.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_wake.notify_all();
+    }
+}
+
+bool JobSystem::ShouldSplit() const
+{
+    // Split only when nothing is left for idle threads to take
+    const int32_t index = GetWorkerIndex();
+    if (index >= 0)
+        return m_workers[index]->deque.GetSizeEstimate() == 0;
+    return m_queuedJobs.load(std::memory_order_relaxed) <= 0;
+}
+
+void JobSystem::WorkerMain(uint32_t index)
+{
+    ThreadState& state = LocalThread();
+    state.owner = this;
+    state.worker = index;
+    state.random = 0x9E3779B9u * (index + 1);
+
+    // Run the loop on a pool fiber; control comes back here on shutdown.
+    // Without one (fibers disabled, or taken by early waits) run it here
+    Fiber& threadFiber = m_workers[index]->threadFiber;
+    if (!m_fibers.empty() && threadFiber.ConvertThread())
+    {
+        const uint32_t fiber = AcquireFiber();
+        if (fiber != NO_FIBER)
+            SwitchFiber(fiber, PendingAction::None);
+        else
+            WorkerLoop();
+        threadFiber.RevertThread();
+        return;
+    }
+    WorkerLoop();
+}
+
+void JobSystem::WorkerLoop()
+{
+    uint32_t idle = 0;
+    while (!m_stop.load(std::memory_order_acquire))
+    {
+        // Parked fibers come first: they finish work already under way.
+        // This fiber is freed by the switch and, when next acquired, resumes
+        // here as if new
+        if (LocalThread().fiber != NO_FIBER)
+        {
+            const uint32_t ready = ClaimReadyFiber();
+            if (ready != NO_FIBER)
+            {
+                SwitchFiber(ready, PendingAction::Free);
+                idle = 0;
+                continue;
+            }
+        }
+        if (TryRunJob())
+        {
+            idle = 0;
+            continue;
+        }
+        if (++idle < IDLE_SPINS)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        Sleep();
+        idle = 0;
+    }
+}
+
+void JobSystem::Sleep()
+{
+    // Only a pool fiber can resume a parked one
+    const bool onFiber = LocalThread().fiber != NO_FIBER;
+    m_sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+    {
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_wake.wait(lock, [this, onFiber]() {
+            return m_queuedJobs.load(std::memory_order_seq_cst) > 0 || m_stop.load(std::memory_order_acquire) ||
+                   (onFiber && HasReadyFiber());
+        });
+    }
+    m_sleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+}
+
+int32_t JobSystem::GetWorkerIndex() const
+{
+    const ThreadState& state = LocalThread();
+    return state.owner == this ? static_cast<int32_t>(state.worker) : -1;
+}
+
+void JobSystem::FiberMain(void* slot)
+{
+    FiberSlot& self = *static_cast<FiberSlot*>(slot);
+    JobSystem& system = *self.system;
+    system.CompleteSwitch(self.index);
+    system.WorkerLoop();
+
+    // Shutting down: return to the thread's own context. The fiber is not
+    // freed, since its context now ends here and a worker starting late
+    // must not pick it up
+    system.SwitchFiber(NO_FIBER, PendingAction::None);
+}
+
+uint32_t JobSystem::AcquireFiber()
+{
+    std::lock_guard<std::mutex> lock(m_fiberMutex);
+    if (m_freeFibers.empty())
+        return NO_FIBER;
+    const uint32_t fiber = m_freeFibers.back();
+    m_freeFibers.pop_back();
+    return fiber;
+}
+
+uint32_t JobSystem::ClaimReadyFiber()
+{
+    if (m_parkedCount.load(std::memory_order_seq_cst) == 0)
+        return NO_FIBER;
+
+    std::lock_guard<std::mutex> lock(m_fiberMutex);
+    for (size_t i = 0; i < m_parkedFibers.size(); ++i)
+    {
+        const uint32_t fiber = m_parkedFibers[i];
+        if (m_fibers[fiber]->waitCounter->IsDone())
+        {
+            m_parkedFibers[i] = m_parkedFibers.back();
+            m_parkedFibers.pop_back();
+            m_parkedCount.fetch_sub(1, std::memory_order_relaxed);
+            return fiber;
+        }
+    }
+    return NO_FIBER;
+}
+
+bool JobSystem::HasReadyFiber()
+{
+    if (m_parkedCount.load(std::memory_order_seq_cst) == 0)
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_fiberMutex);
+    for (uint32_t fiber : m_parkedFibers)
+    {
+        if (m_fibers[fiber]->waitCounter->m_value.load(std::memory_order_seq_cst) == 0)
+            return true;
+    }
+    return false;
+}
+
+void JobSystem::Suspend(const JobCounter& counter, uint32_t next)
+{
+    // The job belongs to this fiber, not the thread; take it along
+    const ThreadState& state = LocalThread();
+    const JobSystem* running = state.running;
+    Job* job = state.job;
+    m_fibers[state.fiber]->waitCounter = &counter;
+
+    SwitchFiber(next, PendingAction::Park);
+
+    ThreadState& resumed = LocalThread();
+    resumed.running = running;
+    resumed.job = job;
+}
+
+void JobSystem::SwitchFiber(uint32_t target, PendingAction action)
+{
+    ThreadState& state = LocalThread();
+    const uint32_t self = state.fiber;
+    state.pendingAction = action;
+    state.pendingFiber = self;
+    state.running = nullptr;
+    state.job = nullptr;
+
+    Fiber& from = self == NO_FIBER ? m_workers[state.worker]->threadFiber : m_fibers[self]->fiber;
+    Fiber& to = target == NO_FIBER ? m_workers[state.worker]->threadFiber : m_fibers[target]->fiber;
+    from.SwitchTo(to);
+
+    // Resumed, possibly on another thread
+    CompleteSwitch(self);
+}
+
+void JobSystem::CompleteSwitch(uint32_t self)
+{
+    ThreadState& state = LocalThread();
+    state.fiber = self;
+    const PendingAction action = state.pendingAction;
+    state.pendingAction = PendingAction::None;
+    if (action == PendingAction::None)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_fiberMutex);
+    if (action == PendingAction::Free)
+    {
+        m_freeFibers.push_back(state.pendingFiber);
+    }
+    else
+    {
+        // Listed before counted, so a claimer that sees the count finds the fiber
+        m_parkedFibers.push_back(state.pendingFiber);
+        m_parkedCount.fetch_add(1, std::memory_order_seq_cst);
+    }
+}
+} // namespace Threading
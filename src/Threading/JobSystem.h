@@ -0,0 +1,362 @@
+#pragma once
+
+#include "Threading/Fiber.h"
+#include "Threading/WorkStealingDeque.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Threading
+{
+/**
+ * @brief Number of jobs still to finish; the unit jobs are waited on
+ *
+ * Each Run() with a counter adds one and each finished job subtracts one;
+ * Retain() and Signal() do the same for work that is not a job.
+ * A counter may be reused once it reads zero, and destroyed after
+ * WaitForCounter() returns.
+ */
+class JobCounter
+{
+  public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    bool IsDone() const { return m_value.load(std::memory_order_acquire) == 0; }
+    uint32_t GetValue() const { return m_value.load(std::memory_order_acquire); }
+
+  private:
+    friend class JobSystem;
+    std::atomic<uint32_t> m_value{0};
+};
+
+enum class ThreadAffinity
+{
+    None,      // Let the OS place worker threads
+    PinWorkers // Worker i runs only on logical core (i + 1) % cores; core 0 is left to the main thread
+};
+
+struct JobSystemOptions
+{
+    size_t workerCount = AUTO_WORKER_COUNT;  // Threads besides the callers
+    ThreadAffinity affinity = ThreadAffinity::None;
+    size_t dequeCapacity = 4096;             // Jobs queued per worker before Run() executes inline
+    size_t fiberCount = 0;                   // Fibers shared by the workers; 0 runs jobs on the worker threads
+    size_t fiberStackSize = 256 * 1024;      // Bytes per fiber stack
+
+    // One worker per hardware thread except the caller's
+    static constexpr size_t AUTO_WORKER_COUNT = ~size_t(0);
+};
+
+/**
+ * @brief Work-stealing job scheduler with counters, nested jobs and parallel loops
+ *
+ * Every worker owns a WorkStealingDeque. A job run from a worker goes to that
+ * worker's deque; a job run from any other thread goes to a shared queue.
+ * Idle workers pop their own deque, then steal from the others, then take
+ * from the shared queue, and sleep when all are empty. Threads that wait on
+ * a counter run jobs too, so waiting inside a job never idles a worker.
+ *
+ * With fiberCount set, workers run jobs on fibers from a fixed pool created
+ * up front. A job that waits on an unfinished counter parks its fiber, with
+ * its whole stack, and the worker switches to a free fiber and carries on;
+ * the first idle worker to see the counter reach zero resumes the parked
+ * fiber, possibly on another thread. Waiting then costs two switches and no
+ * allocation, and a deep chain of waits holds fibers rather than stacking
+ * jobs on one thread. When the pool runs out, waits fall back to running
+ * jobs in place. Jobs must not hold a lock or cache thread_local addresses
+ * across a wait, since they may resume on another thread.
+ *
+ * Jobs are small: a function pointer and up to JOB_PAYLOAD_SIZE bytes of
+ * captured state stored inline, taken from per-thread pools that only
+ * allocate while they grow. A job run from inside another job becomes its
+ * child: the parent, and the parent's counter, finish only when all of its
+ * children have finished.
+ *
+ * ParallelFor() splits its range lazily: a thread holding a range hands
+ * the upper half to a new job only when its own deque is empty (or, outside
+ * the workers, when nothing is queued), so ranges split as far as idle
+ * threads demand and no further.
+ *
+ * GetDefault() is the process-wide instance behind Threading::ParallelFor.
+ */
+class JobSystem
+{
+  public:
+    // Bytes of captured state a job function may carry
+    static constexpr size_t JOB_PAYLOAD_SIZE = 64;
+
+    explicit JobSystem(const JobSystemOptions& options = JobSystemOptions());
+
+    /**
+     * @note All jobs must have finished; workers are stopped and joined
+     */
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    /**
+     * @brief The shared instance, created with default options on first use
+     */
+    static JobSystem& GetDefault();
+
+    /**
+     * @brief Create the shared instance with the given options
+     * @return False if it already exists (it is left unchanged)
+     */
+    static bool InitializeDefault(const JobSystemOptions& options);
+
+    size_t GetWorkerCount() const { return m_workers.size(); }
+
+    // Workers plus the calling thread, which takes part in WaitForCounter() and ParallelFor()
+    size_t GetThreadCount() const { return m_workers.size() + 1; }
+
+    size_t GetFiberCount() const { return m_fibers.size(); }
+
+    // Fibers suspended in WaitForCounter() and not yet resumed
+    size_t GetParkedFiberCount() const { return m_parkedCount.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Queue a job
+     * @param func Callable invoked as func(); at most JOB_PAYLOAD_SIZE bytes
+     * @param counter Incremented now and decremented when the job (and its
+     *                children) finish; may be null
+     */
+    template <typename Func>
+    void Run(Func&& func, JobCounter* counter = nullptr);
+
+    /**
+     * @brief Queue a job that is not a child of the job calling this
+     * @note For continuations, such as a resumed coroutine, that would
+     *       otherwise keep every job they pass through unfinished
+     */
+    template <typename Func>
+    void RunDetached(Func&& func, JobCounter* counter = nullptr);
+
+    /**
+     * @brief Count work that is not a job, such as a coroutine or an I/O
+     *        request, against a counter
+     * @note Each Retain() is matched by one Signal() when the work is done
+     */
+    void Retain(JobCounter& counter);
+    void Signal(JobCounter& counter);
+
+    /**
+     * @brief Return once the counter reaches zero
+     * @note A job on a worker fiber is suspended and its worker runs other
+     *       jobs meanwhile; any other caller runs queued jobs until then
+     */
+    void WaitForCounter(const JobCounter& counter);
+
+    /**
+     * @brief Run a function over [0, count) in grain-sized chunks
+     * @param count Number of elements
+     * @param grainSize Elements per chunk
+     * @param func Callable invoked as func(begin, end) once per chunk; chunk
+     *             k covers [k * grainSize, min((k + 1) * grainSize, count))
+     * @note Returns when every chunk has run. The calling thread takes part.
+     */
+    template <typename Func>
+    void ParallelFor(size_t count, size_t grainSize, Func&& func);
+
+  private:
+    struct Job
+    {
+        void (*invoke)(void* payload); // Runs and destroys the payload
+        Job* parent;
+        JobCounter* counter;
+        std::atomic<int32_t> unfinished; // Itself plus unfinished children
+        uint32_t pool;
+        Job* next;                       // Free-list link
+        alignas(16) unsigned char payload[JOB_PAYLOAD_SIZE];
+    };
+
+    // Owned by one thread; other threads hand jobs back through returned
+    struct JobPool
+    {
+        Job* free = nullptr;
+        std::atomic<Job*> returned{nullptr};
+        std::vector<std::unique_ptr<Job[]>> blocks;
+    };
+
+    struct Worker
+    {
+        explicit Worker(size_t dequeCapacity) : deque(dequeCapacity) {}
+
+        WorkStealingDeque<Job*> deque;
+        JobPool pool;
+        std::thread thread;
+        Fiber threadFiber; // The thread's own context, returned to on shutdown
+    };
+
+    struct FiberSlot
+    {
+        Fiber fiber;
+        JobSystem* system;
+        uint32_t index;
+        const JobCounter* waitCounter; // Set while parked
+    };
+
+    // Done by the fiber switched to, once the one switched from is off its stack
+    enum class PendingAction
+    {
+        None,
+        Free, // Return the previous fiber to the pool
+        Park  // Add the previous fiber to the parked list
+    };
+
+    static constexpr uint32_t NO_FIBER = 0xFFFFFFFF; // The thread's own context
+
+    struct ThreadState
+    {
+        const JobSystem* owner = nullptr;   // System this thread is a worker of
+        uint32_t worker = 0;
+        const JobSystem* running = nullptr; // System of the job being run
+        Job* job = nullptr;
+        uint32_t random = 1;                // Victim selection
+        uint32_t fiber = NO_FIBER;          // Pool fiber running on this thread
+        PendingAction pendingAction = PendingAction::None;
+        uint32_t pendingFiber = NO_FIBER;
+    };
+
+    template <typename Func>
+    struct Loop
+    {
+        Func* func;
+        JobCounter* counter;
+        size_t count;
+        size_t grainSize;
+    };
+
+    template <typename Func>
+    static void Invoke(void* payload)
+    {
+        Func& func = *static_cast<Func*>(payload);
+        func();
+        func.~Func();
+    }
+
+    template <typename Func>
+    void RunChunks(const Loop<Func>& loop, size_t first, size_t last);
+
+    template <typename Func>
+    Job* CreateJob(Func&& func);
+    Job* AllocateJob();
+    void Release(Job* job);
+    void Submit(Job* job, JobCounter* counter, bool detached);
+    bool TryRunJob();
+    void Execute(Job* job);
+    void Finish(Job* job);
+    void Decrement(JobCounter& counter);
+    bool ShouldSplit() const;
+    void WorkerMain(uint32_t index);
+    void WorkerLoop();
+    void Sleep();
+    int32_t GetWorkerIndex() const;
+
+    static void FiberMain(void* slot);
+    uint32_t AcquireFiber();
+    uint32_t ClaimReadyFiber();
+    bool HasReadyFiber();
+    void Suspend(const JobCounter& counter, uint32_t next);
+    void SwitchFiber(uint32_t target, PendingAction action);
+    void CompleteSwitch(uint32_t self);
+
+    // Every access goes through LocalThread(): a fiber may resume on another
+    // thread, so the thread_local address must not be cached across a switch
+    static ThreadState& LocalThread();
+    static thread_local ThreadState s_thread;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    // Jobs run from threads that are not workers
+    std::mutex m_sharedMutex;
+    std::vector<Job*> m_sharedQueue; // Taken from the front
+    size_t m_sharedHead = 0;
+    std::atomic<size_t> m_sharedCount{0};
+    JobPool m_sharedPool;            // Guarded by m_sharedMutex for allocation
+
+    // Jobs queued and not yet taken, and sleeping workers, to decide on wake-ups
+    std::atomic<int64_t> m_queuedJobs{0};
+    std::atomic<uint32_t> m_sleepingWorkers{0};
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+    std::atomic<bool> m_stop{false};
+
+    // Fiber pool; the lists are reserved to its size, so they never allocate
+    std::vector<std::unique_ptr<FiberSlot>> m_fibers;
+    std::mutex m_fiberMutex;
+    std::vector<uint32_t> m_freeFibers;
+    std::vector<uint32_t> m_parkedFibers;
+    std::atomic<size_t> m_parkedCount{0};
+};
+
+template <typename Func>
+void JobSystem::Run(Func&& func, JobCounter* counter)
+{
+    Submit(CreateJob(std::forward<Func>(func)), counter, false);
+}
+
+template <typename Func>
+void JobSystem::RunDetached(Func&& func, JobCounter* counter)
+{
+    Submit(CreateJob(std::forward<Func>(func)), counter, true);
+}
+
+template <typename Func>
+JobSystem::Job* JobSystem::CreateJob(Func&& func)
+{
+    using Stored = std::decay_t<Func>;
+    static_assert(sizeof(Stored) <= JOB_PAYLOAD_SIZE, "Job state is too large; capture by reference instead");
+    static_assert(alignof(Stored) <= 16, "Job state is over-aligned");
+
+    Job* job = AllocateJob();
+    new (job->payload) Stored(std::forward<Func>(func));
+    job->invoke = &Invoke<Stored>;
+    return job;
+}
+
+template <typename Func>
+void JobSystem::ParallelFor(size_t count, size_t grainSize, Func&& func)
+{
+    if (count == 0)
+        return;
+
+    grainSize = std::max<size_t>(grainSize, 1);
+    const size_t chunkCount = (count + grainSize - 1) / grainSize;
+    JobCounter counter;
+    const Loop<std::remove_reference_t<Func>> loop{&func, &counter, count, grainSize};
+    RunChunks(loop, 0, chunkCount);
+    WaitForCounter(counter);
+}
+
+template <typename Func>
+void JobSystem::RunChunks(const Loop<Func>& loop, size_t first, size_t last)
+{
+    while (first < last)
+    {
+        if (last - first > 1 && !m_workers.empty() && ShouldSplit())
+        {
+            const size_t middle = first + (last - first) / 2;
+            Run([this, &loop, middle, last]() { RunChunks(loop, middle, last); }, loop.counter);
+            last = middle;
+            continue;
+        }
+
+        const size_t begin = first * loop.grainSize;
+        (*loop.func)(begin, std::min(begin + loop.grainSize, loop.count));
+        ++first;
+    }
+}
+} // namespace Threading
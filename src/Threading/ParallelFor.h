@@ -0,0 +1,32 @@
+#pragma once
+
+#include "Threading/JobSystem.h"
+#include <cstddef>
+#include <utility>
+
+namespace Threading
+{
+/**
+ * @brief Get the number of threads that run parallel loops
+ * @return Workers of the default JobSystem plus the calling thread, never less than 1
+ */
+inline size_t GetWorkerCount()
+{
+    return JobSystem::GetDefault().GetThreadCount();
+}
+
+/**
+ * @brief Run a function over the range [0, count) split into chunks
+ * @param count Number of elements to process
+ * @param grainSize Number of elements handed to a worker at a time
+ * @param func Callable invoked as func(begin, end) for each chunk
+ * @note Runs on the default JobSystem, which splits the chunks lazily across
+ *       its workers by work stealing. The calling thread participates, and
+ *       calls from inside jobs nest without blocking a worker.
+ */
+template <typename Func>
+void ParallelFor(size_t count, size_t grainSize, Func&& func)
+{
+    JobSystem::GetDefault().ParallelFor(count, grainSize, std::forward<Func>(func));
+}
+} // namespace Threading
@@ -0,0 +1,166 @@
+#include "Threading/Task.h"
+#include <new>
+
+namespace Threading
+{
+namespace
+{
+constexpr size_t MIN_CLASS_SHIFT = 7; // 128-byte smallest class
+constexpr size_t CLASS_COUNT = 6;     // 128 .. MAX_POOLED_SIZE
+// Frames a thread keeps per class, and how many move to or from the shared list at once
+constexpr uint32_t LOCAL_LIMIT = 64;
+constexpr uint32_t BATCH_SIZE = 32;
+
+static_assert(size_t(1) << (MIN_CLASS_SHIFT + CLASS_COUNT - 1) == TaskFrames::MAX_POOLED_SIZE,
+              "Size classes must end at MAX_POOLED_SIZE");
+
+struct FreeFrame
+{
+    FreeFrame* next;
+};
+
+struct SharedList
+{
+    std::mutex mutex;
+    FreeFrame* head = nullptr;
+};
+
+SharedList g_shared[CLASS_COUNT];
+std::atomic<uint64_t> g_heapAllocations{0};
+std::atomic<uint64_t> g_heapBytes{0};
+
+// Moves up to count frames from one list to another
+uint32_t MoveFrames(FreeFrame*& from, FreeFrame*& to, uint32_t count)
+{
+    uint32_t moved = 0;
+    while (from && moved < count)
+    {
+        FreeFrame* frame = from;
+        from = frame->next;
+        frame->next = to;
+        to = frame;
+        ++moved;
+    }
+    return moved;
+}
+
+struct LocalCache
+{
+    FreeFrame* heads[CLASS_COUNT] = {};
+    uint32_t counts[CLASS_COUNT] = {};
+
+    // Frames outlive the thread that freed them: hand them to the shared lists
+    ~LocalCache()
+    {
+        for (size_t sizeClass = 0; sizeClass < CLASS_COUNT; ++sizeClass)
+        {
+            std::lock_guard<std::mutex> lock(g_shared[sizeClass].mutex);
+            MoveFrames(heads[sizeClass], g_shared[sizeClass].head, counts[sizeClass]);
+        }
+    }
+};
+
+thread_local LocalCache t_cache;
+
+size_t GetSizeClass(size_t size)
+{
+    size_t sizeClass = 0;
+    while ((size_t(1) << (MIN_CLASS_SHIFT + sizeClass)) < size)
+    {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+} // namespace
+
+void* TaskFrames::Allocate(size_t size)
+{
+    if (size > MAX_POOLED_SIZE)
+    {
+        g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+        g_heapBytes.fetch_add(size, std::memory_order_relaxed);
+        return ::operator new(size);
+    }
+
+    const size_t sizeClass = GetSizeClass(size);
+    LocalCache& cache = t_cache;
+    if (!cache.heads[sizeClass])
+    {
+        std::lock_guard<std::mutex> lock(g_shared[sizeClass].mutex);
+        cache.counts[sizeClass] += MoveFrames(g_shared[sizeClass].head, cache.heads[sizeClass], BATCH_SIZE);
+    }
+    if (FreeFrame* frame = cache.heads[sizeClass])
+    {
+        cache.heads[sizeClass] = frame->next;
+        --cache.counts[sizeClass];
+        return frame;
+    }
+
+    const size_t classSize = size_t(1) << (MIN_CLASS_SHIFT + sizeClass);
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    g_heapBytes.fetch_add(classSize, std::memory_order_relaxed);
+    return ::operator new(classSize);
+}
+
+void TaskFrames::Free(void* frame, size_t size)
+{
+    if (size > MAX_POOLED_SIZE)
+    {
+        ::operator delete(frame);
+        return;
+    }
+
+    const size_t sizeClass = GetSizeClass(size);
+    LocalCache& cache = t_cache;
+    FreeFrame* freed = static_cast<FreeFrame*>(frame);
+    freed->next = cache.heads[sizeClass];
+    cache.heads[sizeClass] = freed;
+    if (++cache.counts[sizeClass] > LOCAL_LIMIT)
+    {
+        std::lock_guard<std::mutex> lock(g_shared[sizeClass].mutex);
+        cache.counts[sizeClass] -= MoveFrames(cache.heads[sizeClass], g_shared[sizeClass].head, BATCH_SIZE);
+    }
+}
+
+TaskFrameStats TaskFrames::GetStats()
+{
+    TaskFrameStats stats;
+    stats.heapAllocations = g_heapAllocations.load(std::memory_order_relaxed);
+    stats.heapBytes = g_heapBytes.load(std::memory_order_relaxed);
+    return stats;
+}
+
+size_t ResumeQueue::RunPending()
+{
+    // Taken newest first; reverse to continue in queue order
+    Awaiter* taken = m_head.exchange(nullptr, std::memory_order_acquire);
+    Awaiter* ordered = nullptr;
+    while (taken)
+    {
+        Awaiter* next = taken->m_next;
+        taken->m_next = ordered;
+        ordered = taken;
+        taken = next;
+    }
+
+    size_t count = 0;
+    while (ordered)
+    {
+        // The awaiter lives in the frame being resumed; read the link first
+        Awaiter* next = ordered->m_next;
+        ordered->m_handle.resume();
+        ordered = next;
+        ++count;
+    }
+    return count;
+}
+
+void ResumeQueue::Push(Awaiter* awaiter)
+{
+    Awaiter* head = m_head.load(std::memory_order_relaxed);
+    do
+    {
+        awaiter->m_next = head;
+    } while (!m_head.compare_exchange_weak(head, awaiter, std::memory_order_release, std::memory_order_relaxed));
+}
+} // namespace Threading
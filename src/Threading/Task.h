@@ -0,0 +1,358 @@
+#pragma once
+
+#include "Threading/JobSystem.h"
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace Threading
+{
+/**
+ * @brief Heap use of the coroutine frame pool
+ */
+struct TaskFrameStats
+{
+    uint64_t heapAllocations = 0; // Frames the pool could not supply
+    uint64_t heapBytes = 0;
+};
+
+/**
+ * @brief Allocator behind every Task coroutine frame
+ *
+ * Frames up to MAX_POOLED_SIZE bytes come from power-of-two size classes
+ * kept on per-thread free lists, which trade batches with a shared list so
+ * a frame created on one thread and finished on another is still reused.
+ * Once a pipeline has run, running it again allocates nothing; larger
+ * frames go to the heap.
+ */
+namespace TaskFrames
+{
+constexpr size_t MAX_POOLED_SIZE = 4096;
+
+void* Allocate(size_t size);
+void Free(void* frame, size_t size);
+TaskFrameStats GetStats();
+} // namespace TaskFrames
+
+template <typename T = void>
+class Task;
+
+/**
+ * @brief What every Task promise shares: pooled frames, lazy start and the
+ *        hand-off to the awaiting coroutine on completion
+ */
+class TaskPromiseBase
+{
+  public:
+    static void* operator new(size_t size) { return TaskFrames::Allocate(size); }
+    static void operator delete(void* frame, size_t size) { TaskFrames::Free(frame, size); }
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    struct FinalAwaiter
+    {
+        bool await_ready() noexcept { return false; }
+
+        // Symmetric transfer: resume the awaiter without growing the stack
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            const std::coroutine_handle<> continuation = handle.promise().m_continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() noexcept {}
+    };
+
+    FinalAwaiter final_suspend() noexcept { return {}; }
+
+    // Errors are returned as values here; an escaping exception is a bug
+    void unhandled_exception() noexcept { std::terminate(); }
+
+    void SetContinuation(std::coroutine_handle<> continuation) { m_continuation = continuation; }
+
+  private:
+    std::coroutine_handle<> m_continuation;
+};
+
+/**
+ * @brief Lazily started coroutine producing a T
+ *
+ * Nothing runs until the task is awaited, which starts it on the awaiting
+ * thread; when it finishes, the awaiting coroutine continues on whichever
+ * thread the task ended on. Frames come from TaskFrames, and awaiting a
+ * task, a job or a queue allocates nothing, since each awaiter lives in the
+ * suspended frame.
+ *
+ * A task is awaited once. Run a top-level task with Spawn() or SyncWait().
+ */
+template <typename T>
+class Task
+{
+  public:
+    class promise_type : public TaskPromiseBase
+    {
+      public:
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+
+        template <typename U>
+        void return_value(U&& value)
+        {
+            m_value.emplace(std::forward<U>(value));
+        }
+
+        T TakeValue() { return std::move(*m_value); }
+
+      private:
+        std::optional<T> m_value;
+    };
+
+    Task() = default;
+    Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_handle)
+                m_handle.destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+    ~Task()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    bool IsValid() const { return static_cast<bool>(m_handle); }
+
+    auto operator co_await() noexcept
+    {
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                handle.promise().SetContinuation(awaiting);
+                return handle;
+            }
+            T await_resume() { return handle.promise().TakeValue(); }
+        };
+        return Awaiter{m_handle};
+    }
+
+  private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+template <>
+class Task<void>
+{
+  public:
+    class promise_type : public TaskPromiseBase
+    {
+      public:
+        Task get_return_object() { return Task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        void return_void() {}
+        void TakeValue() {}
+    };
+
+    Task() = default;
+    Task(Task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr)) {}
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_handle)
+                m_handle.destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+    ~Task()
+    {
+        if (m_handle)
+            m_handle.destroy();
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    bool IsValid() const { return static_cast<bool>(m_handle); }
+
+    auto operator co_await() noexcept
+    {
+        struct Awaiter
+        {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() noexcept { return false; }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                handle.promise().SetContinuation(awaiting);
+                return handle;
+            }
+            void await_resume() {}
+        };
+        return Awaiter{m_handle};
+    }
+
+  private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * @brief Awaitable that continues the coroutine as a job
+ */
+class ScheduleAwaiter
+{
+  public:
+    explicit ScheduleAwaiter(JobSystem& jobs) : m_jobs(jobs) {}
+
+    bool await_ready() noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        m_jobs.RunDetached([handle]() { handle.resume(); });
+    }
+    void await_resume() noexcept {}
+
+  private:
+    JobSystem& m_jobs;
+};
+
+/**
+ * @brief co_await Schedule(jobs) moves the rest of the coroutine onto the job system
+ */
+inline ScheduleAwaiter Schedule(JobSystem& jobs)
+{
+    return ScheduleAwaiter(jobs);
+}
+
+/**
+ * @brief Coroutines waiting to continue on one particular thread
+ *
+ * For work tied to a thread, such as GPU uploads on the render thread: a
+ * coroutine does co_await queue.Schedule(), and that thread calls
+ * RunPending() once per frame to continue every coroutine queued so far.
+ * Waiters are linked through their own awaiters, so queuing allocates nothing.
+ */
+class ResumeQueue
+{
+  public:
+    class Awaiter
+    {
+      public:
+        explicit Awaiter(ResumeQueue& queue) : m_queue(queue) {}
+
+        bool await_ready() noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            m_handle = handle;
+            m_queue.Push(this);
+        }
+        void await_resume() noexcept {}
+
+      private:
+        friend class ResumeQueue;
+        ResumeQueue& m_queue;
+        std::coroutine_handle<> m_handle;
+        Awaiter* m_next = nullptr;
+    };
+
+    ResumeQueue() = default;
+    ResumeQueue(const ResumeQueue&) = delete;
+    ResumeQueue& operator=(const ResumeQueue&) = delete;
+
+    Awaiter Schedule() { return Awaiter(*this); }
+
+    /**
+     * @brief Continue the coroutines queued before this call, in queue order
+     * @return Number continued; ones they queue in turn wait for the next call
+     */
+    size_t RunPending();
+
+    bool IsEmpty() const { return m_head.load(std::memory_order_acquire) == nullptr; }
+
+  private:
+    void Push(Awaiter* awaiter);
+
+    // Lock-free stack of waiters, reversed when taken
+    std::atomic<Awaiter*> m_head{nullptr};
+};
+
+/**
+ * @brief Fire-and-forget coroutine that owns the frame it runs in
+ *
+ * Used to start a top-level Task; not meant to be awaited.
+ */
+class DetachedTask
+{
+  public:
+    class promise_type : public TaskPromiseBase
+    {
+      public:
+        DetachedTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+    };
+};
+
+/**
+ * @brief Start a task on the job system without waiting for it
+ * @param counter Retained now and signalled when the task has finished; may be null
+ */
+template <typename T>
+void Spawn(JobSystem& jobs, Task<T> task, JobCounter* counter = nullptr)
+{
+    if (counter)
+        jobs.Retain(*counter);
+
+    [](JobSystem& system, Task<T> owned, JobCounter* done) -> DetachedTask {
+        co_await Schedule(system);
+        co_await owned;
+        if (done)
+            system.Signal(*done);
+    }(jobs, std::move(task), counter);
+}
+
+/**
+ * @brief Run a task on the job system and wait for its result
+ * @note Waits with JobSystem::WaitForCounter(), so the caller runs other
+ *       jobs meanwhile, or parks if it is a job on a fiber
+ */
+template <typename T>
+T SyncWait(JobSystem& jobs, Task<T> task)
+{
+    JobCounter counter;
+    if constexpr (std::is_void_v<T>)
+    {
+        Spawn(jobs, std::move(task), &counter);
+        jobs.WaitForCounter(counter);
+    }
+    else
+    {
+        std::optional<T> result;
+        Spawn(jobs, [](Task<T> inner, std::optional<T>& out) -> Task<> { out.emplace(co_await inner); }(
+                        std::move(task), result), &counter);
+        jobs.WaitForCounter(counter);
+        return std::move(*result);
+    }
+}
+} // namespace Threading
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace Threading
+{
+/**
+ * @brief Fixed-capacity Chase-Lev work-stealing deque of pointers
+ *
+ * One owner thread pushes and pops at the bottom (LIFO, so it works on the
+ * most recent and cache-hot item); any other thread steals from the top
+ * (FIFO, taking the oldest and usually largest piece of work). The owner
+ * only synchronizes with thieves when they race for the last item.
+ *
+ * Memory ordering follows Le et al., "Correct and Efficient Work-Stealing
+ * for Weak Memory Models" (PPoPP 2013). Their two seq_cst fences become
+ * seq_cst operations on the indices (the same instructions on x86, and
+ * visible to ThreadSanitizer), and the push publishes through a release
+ * store of the bottom index. The capacity is fixed, so nothing is
+ * allocated or reclaimed after construction; Push() reports a full deque
+ * and the caller runs the item itself.
+ */
+template <typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_pointer<T>::value, "WorkStealingDeque holds pointers");
+
+  public:
+    /**
+     * @param capacity Maximum number of items; rounded up to a power of two
+     */
+    explicit WorkStealingDeque(size_t capacity)
+    {
+        size_t size = 2;
+        while (size < capacity)
+        {
+            size *= 2;
+        }
+        m_items = std::vector<std::atomic<T>>(size);
+        m_mask = static_cast<int64_t>(size - 1);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    /**
+     * @brief Add an item at the bottom; owner thread only
+     * @return False if the deque is full
+     */
+    bool Push(T item)
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_top.load(std::memory_order_acquire);
+        if (bottom - top > m_mask)
+            return false;
+
+        m_items[bottom & m_mask].store(item, std::memory_order_relaxed);
+        m_bottom.store(bottom + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Take the most recently pushed item; owner thread only
+     * @return False if the deque is empty or a thief took the last item
+     */
+    bool Pop(T& item)
+    {
+        // Claim the bottom slot before looking at the top, so a thief and the
+        // owner cannot both miss each other
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_seq_cst);
+
+        if (top > bottom)
+        {
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        item = m_items[bottom & m_mask].load(std::memory_order_relaxed);
+        if (top == bottom)
+        {
+            // Last item: race the thieves for it
+            const bool won =
+                m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Take the oldest item; any thread
+     * @return False if the deque is empty or another thread won the item
+     */
+    bool Steal(T& item)
+    {
+        int64_t top = m_top.load(std::memory_order_seq_cst);
+        const int64_t bottom = m_bottom.load(std::memory_order_seq_cst);
+        if (top >= bottom)
+            return false;
+
+        item = m_items[top & m_mask].load(std::memory_order_relaxed);
+        return m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Approximate number of items; exact only on a quiescent deque
+     */
+    size_t GetSizeEstimate() const
+    {
+        const int64_t size = m_bottom.load(std::memory_order_relaxed) - m_top.load(std::memory_order_relaxed);
+        return size > 0 ? static_cast<size_t>(size) : 0;
+    }
+
+    size_t GetCapacity() const { return m_items.size(); }
+
+  private:
+    // Thieves hammer the top and the owner the bottom; keep them on separate lines
+    alignas(64) std::atomic<int64_t> m_top{0};
+    alignas(64) std::atomic<int64_t> m_bottom{0};
+    alignas(64) std::vector<std::atomic<T>> m_items;
+    int64_t m_mask = 0;
+};
+} // namespace Threading
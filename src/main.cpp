@@ -1,8 +1,11 @@
+#include "Memory/AllocationTracker.h"
+#include "Memory/FrameArena.h"
 #include "Renderer/IRenderer.h"
 #include "Renderer/RendererFactory.h"
 #include "System/IInput.h"
 #include "System/IWindow.h"
 #include "System/SystemFactory.h"
+#include "Threading/JobSystem.h"
 #include <iostream>
 #include <memory>
 
@@ -19,6 +22,14 @@ int main()
 {
     try
     {
+        // Step 0: Start the job system that runs parallel loops, one worker per
+        // remaining core, pinned so workers do not migrate between cores, with
+        // fibers so jobs waiting on other jobs do not hold a worker
+        Threading::JobSystemOptions jobOptions;
+        jobOptions.affinity = Threading::ThreadAffinity::PinWorkers;
+        jobOptions.fiberCount = 128;
+        Threading::JobSystem::InitializeDefault(jobOptions);
+
         // Step 1: Configure the window
         WindowConfig config;
         config.title = "System Application with Renderer";
@@ -87,7 +98,7 @@ int main()
 
         input->SetMouseButtonCallback(
             [](MouseButton button, bool pressed, int x, int y) {
-                std::string buttonName = (button == MouseButton::Left)    ? "Left"
+                const char* buttonName = (button == MouseButton::Left)    ? "Left"
                                          : (button == MouseButton::Right) ? "Right"
                                                                           : "Middle";
                 std::cout << buttonName << " mouse button "
@@ -106,76 +117,88 @@ int main()
         std::cout << "  - R key to change clear color" << std::endl;
         std::cout << "  - Escape to exit" << std::endl;
 
+        // Home for per-frame temporaries (draw lists, culling output, strings)
+        // once the loop builds any; nothing allocates from it yet
+        Memory::FrameArena frameArena;
+
         bool running = true;
         ClearColor clearColor = {0.2f, 0.3f, 0.4f, 1.0f}; // Nice blue-grey color
         float colorTime = 0.0f;
 
         while (running && !window->ShouldClose())
         {
-            // Update window (processes messages and updates input)
-            window->Update();
-
-            // Example: Polling-based input checking
-            if (input->IsKeyDown(Key::W))
-            {
-                std::cout << "P";
-                // Move forward logic here
-            }
-            if (input->IsKeyDown(Key::S))
-            {
-                // Move backward logic here
-            }
-            if (input->IsKeyDown(Key::A))
-            {
-                // Move left logic here
-            }
-            if (input->IsKeyDown(Key::D))
-            {
-                // Move right logic here
-            }
-
-            if (input->WasKeyPressed(Key::Space))
-            {
-                std::cout << "Space bar was pressed this frame (jump action)" << std::endl;
-            }
-
-            // Color animation with R key
-            if (input->WasKeyPressed(Key::R))
-            {
-                std::cout << "Changing clear color..." << std::endl;
-                colorTime = 0.0f; // Reset animation
-            }
+            frameArena.BeginFrame();
+            Memory::AllocationTracker::BeginFrame();
 
-            // Exit condition
-            if (input->WasKeyPressed(Key::Escape))
+            // Heap use between input and Present shows up as no-alloc violations
             {
-                std::cout << "ESCAPE";
-                running = false;
+                Memory::NoAllocScope noAlloc;
+
+                // Update window (processes messages and updates input)
+                window->Update();
+
+                // Example: Polling-based input checking
+                if (input->IsKeyDown(Key::W))
+                {
+                    std::cout << "P";
+                    // Move forward logic here
+                }
+                if (input->IsKeyDown(Key::S))
+                {
+                    // Move backward logic here
+                }
+                if (input->IsKeyDown(Key::A))
+                {
+                    // Move left logic here
+                }
+                if (input->IsKeyDown(Key::D))
+                {
+                    // Move right logic here
+                }
+
+                if (input->WasKeyPressed(Key::Space))
+                {
+                    std::cout << "Space bar was pressed this frame (jump action)" << std::endl;
+                }
+
+                // Color animation with R key
+                if (input->WasKeyPressed(Key::R))
+                {
+                    std::cout << "Changing clear color..." << std::endl;
+                    colorTime = 0.0f; // Reset animation
+                }
+
+                // Exit condition
+                if (input->WasKeyPressed(Key::Escape))
+                {
+                    std::cout << "ESCAPE";
+                    running = false;
+                }
+
+                // Animate clear color
+                colorTime += 0.016f; // Assume ~60fps
+                clearColor.r = 0.5f + 0.3f * sin(colorTime);
+                clearColor.g = 0.5f + 0.3f * sin(colorTime * 1.3f);
+                clearColor.b = 0.5f + 0.3f * sin(colorTime * 0.7f);
+
+                // RENDERING
+                renderer->BeginFrame();
+
+                // Clear the screen with animated color
+                renderer->Clear(clearColor);
+
+                // Set viewport to full window
+                renderer->SetViewport(0, 0, renderer->GetBackBufferWidth(), renderer->GetBackBufferHeight());
+
+                // TODO: Add your actual rendering calls here
+                // renderer->DrawMesh(mesh);
+                // renderer->DrawSprite(sprite);
+                // etc.
+
+                renderer->EndFrame();
+                renderer->Present();
             }
 
-            // Animate clear color
-            colorTime += 0.016f; // Assume ~60fps
-            clearColor.r = 0.5f + 0.3f * sin(colorTime);
-            clearColor.g = 0.5f + 0.3f * sin(colorTime * 1.3f);
-            clearColor.b = 0.5f + 0.3f * sin(colorTime * 0.7f);
-
-            // RENDERING
-            renderer->BeginFrame();
-
-            // Clear the screen with animated color
-            renderer->Clear(clearColor);
-
-            // Set viewport to full window
-            renderer->SetViewport(0, 0, renderer->GetBackBufferWidth(), renderer->GetBackBufferHeight());
-
-            // TODO: Add your actual rendering calls here
-            // renderer->DrawMesh(mesh);
-            // renderer->DrawSprite(sprite);
-            // etc.
-
-            renderer->EndFrame();
-            renderer->Present();
-
             // Print stats occasionally
             static int frameCounter = 0;
             if (++frameCounter % 300 == 0) // Every ~5 seconds at 60fps
@@ -183,6 +206,19 @@ int main()
                 auto stats = renderer->GetStats();
                 std::cout << "Renderer Stats - Frames: " << stats.frameCount
                           << ", Frame Time: " << stats.frameTime << "ms" << std::endl;
+
+                const Memory::MemoryTagStats memory = Memory::GetTotalStats();
+                std::cout << "Memory Stats - Frame Arena: " << frameArena.GetCapacity() / 1024
+                          << "KB, Resident: " << memory.residentBytes / 1024
+                          << "KB, Heap Allocations: " << memory.heapAllocations << std::endl;
+
+                if (Memory::AllocationTracker::IsAvailable())
+                {
+                    const Memory::AllocationFrameStats allocations = Memory::AllocationTracker::GetLastFrameStats();
+                    std::cout << "Allocation Stats - Last Frame: " << allocations.allocations << " ("
+                              << allocations.bytes << " bytes from " << allocations.callSites
+                              << " sites), No-Alloc Violations: " << allocations.violations << std::endl;
+                }
             }
 
 // Small sleep to prevent 100% CPU usage
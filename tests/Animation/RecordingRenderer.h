@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Renderer/IRenderer.h"
+#include <cstring>
+#include <vector>
+
+// Minimal IRenderer that records buffer traffic instead of talking to a GPU
+class RecordingRenderer : public Renderer::IRenderer
+{
+  public:
+    struct Buffer
+    {
+        Renderer::BufferType type;
+        Renderer::BufferUsage usage;
+        std::vector<uint8_t> data;
+        bool destroyed = false;
+    };
+
+    bool Initialize(Renderer::WindowHandle, uint32_t, uint32_t) override { return true; }
+    void Shutdown() override {}
+    void BeginFrame() override {}
+    void EndFrame() override {}
+    void Present() override {}
+    void Clear(const Renderer::ClearColor&) override {}
+    void SetViewport(uint32_t, uint32_t, uint32_t, uint32_t) override {}
+    void OnResize(uint32_t, uint32_t) override {}
+    const char* GetRendererName() const override { return "Recording"; }
+    const char* GetVersion() const override { return "1.0"; }
+    Renderer::RenderStats GetStats() const override { return stats; }
+    bool IsInitialized() const override { return true; }
+    uint32_t GetBackBufferWidth() const override { return 0; }
+    uint32_t GetBackBufferHeight() const override { return 0; }
+    void WaitForGPU() override {}
+
+    Renderer::BufferHandle CreateBuffer(Renderer::BufferType type, Renderer::BufferUsage usage, uint32_t size,
+                                        const void* initialData) override
+    {
+        buffers.push_back(new Buffer{type, usage, std::vector<uint8_t>(size), false});
+        if (initialData)
+            std::memcpy(buffers.back()->data.data(), initialData, size);
+        return buffers.back();
+    }
+
+    void DestroyBuffer(Renderer::BufferHandle buffer) override
+    {
+        static_cast<Buffer*>(buffer)->destroyed = true;
+    }
+
+    void UpdateBuffer(Renderer::BufferHandle buffer, uint32_t offset, uint32_t size, const void* data) override
+    {
+        updateCount++;
+        std::memcpy(static_cast<Buffer*>(buffer)->data.data() + offset, data, size);
+    }
+
+    void SetVertexBuffer(Renderer::BufferHandle, uint32_t stride, uint32_t) override { vertexStride = stride; }
+    void SetIndexBuffer(Renderer::BufferHandle, uint32_t) override {}
+    void SetPrimitiveTopology(Renderer::PrimitiveTopology) override {}
+
+    void DrawIndexed(uint32_t indexCount, uint32_t, int32_t) override
+    {
+        stats.drawCalls++;
+        stats.triangles += indexCount / 3;
+    }
+
+    Renderer::ShaderHandle CreateColorShader() override { return nullptr; }
+    void DestroyShader(Renderer::ShaderHandle) override {}
+    void SetShader(Renderer::ShaderHandle) override {}
+
+    ~RecordingRenderer() override
+    {
+        for (Buffer* buffer : buffers)
+        {
+            delete buffer;
+        }
+    }
+
+    std::vector<Buffer*> buffers;
+    Renderer::RenderStats stats;
+    uint32_t updateCount = 0;
+    uint32_t vertexStride = 0;
+};
@@ -0,0 +1,100 @@
+#include "Animation/SkinnedMeshBuffer.h"
+#include "../Geometry/TestMeshes.h"
+#include "RecordingRenderer.h"
+#include <cstring>
+#include <gtest/gtest.h>
+
+using namespace Animation;
+
+class SkinnedMeshBufferTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        Renderer::Mesh bindPose = MakeGridMesh(10);
+        std::vector<BoneInfluences> influences(bindPose.vertices.size());
+        for (size_t i = 0; i < influences.size(); ++i)
+        {
+            influences[i].bones[0] = static_cast<uint32_t>(i % 2);
+            influences[i].weights[0] = 1.0f;
+        }
+        ASSERT_TRUE(Skinner::Prepare(bindPose, influences, mesh));
+
+        palette = {Math::Matrix4x4(), Math::Matrix4x4::Translation(Math::Vector3(0.0f, 5.0f, 0.0f))};
+    }
+
+    SkinnedMesh mesh;
+    std::vector<Math::Matrix4x4> palette;
+    RecordingRenderer renderer;
+};
+
+TEST_F(SkinnedMeshBufferTest, CreatesDynamicVertexBuffer)
+{
+    SkinnedMeshBuffer buffer(renderer, mesh);
+
+    ASSERT_EQ(renderer.buffers.size(), 2u);
+    EXPECT_EQ(renderer.buffers[0]->type, Renderer::BufferType::VertexBuffer);
+    EXPECT_EQ(renderer.buffers[0]->usage, Renderer::BufferUsage::Dynamic);
+    EXPECT_EQ(renderer.buffers[0]->data.size(), mesh.GetVertexCount() * sizeof(Renderer::Vertex));
+    EXPECT_EQ(renderer.buffers[1]->type, Renderer::BufferType::IndexBuffer);
+    EXPECT_EQ(renderer.buffers[1]->usage, Renderer::BufferUsage::Immutable);
+}
+
+TEST_F(SkinnedMeshBufferTest, UpdateUploadsSkinnedVertices)
+{
+    SkinnedMeshBuffer buffer(renderer, mesh);
+    ASSERT_TRUE(buffer.Update(palette));
+    EXPECT_EQ(renderer.updateCount, 1u);
+
+    const std::vector<uint8_t>& uploaded = renderer.buffers[0]->data;
+    ASSERT_EQ(uploaded.size(), buffer.GetVertices().size() * sizeof(Renderer::Vertex));
+    EXPECT_EQ(std::memcmp(uploaded.data(), buffer.GetVertices().data(), uploaded.size()), 0);
+
+    for (size_t i = 0; i < buffer.GetVertices().size(); ++i)
+    {
+        const float expectedY = mesh.bindPose.vertices[i].position.y + (i % 2 ? 5.0f : 0.0f);
+        EXPECT_FLOAT_EQ(buffer.GetVertices()[i].position.y, expectedY);
+    }
+}
+
+TEST_F(SkinnedMeshBufferTest, UpdateWithSmallPaletteUploadsNothing)
+{
+    SkinnedMeshBuffer buffer(renderer, mesh);
+    palette.pop_back();
+    EXPECT_FALSE(buffer.Update(palette));
+    EXPECT_EQ(renderer.updateCount, 0u);
+}
+
+TEST_F(SkinnedMeshBufferTest, BatchedJobsThenUpload)
+{
+    SkinnedMeshBuffer first(renderer, mesh);
+    SkinnedMeshBuffer second(renderer, mesh);
+
+    ASSERT_TRUE(Skinner::SkinJobs({first.GetSkinningJob(palette), second.GetSkinningJob(palette)}));
+    first.Upload();
+    second.Upload();
+
+    EXPECT_EQ(renderer.updateCount, 2u);
+    EXPECT_FLOAT_EQ(first.GetVertices()[1].position.y, 5.0f);
+    EXPECT_FLOAT_EQ(second.GetVertices()[1].position.y, 5.0f);
+}
+
+TEST_F(SkinnedMeshBufferTest, DrawUsesVertexStride)
+{
+    SkinnedMeshBuffer buffer(renderer, mesh);
+    buffer.Draw();
+
+    EXPECT_EQ(renderer.vertexStride, sizeof(Renderer::Vertex));
+    EXPECT_EQ(renderer.GetStats().drawCalls, 1u);
+    EXPECT_EQ(renderer.GetStats().triangles, mesh.bindPose.indices.size() / 3);
+}
+
+TEST_F(SkinnedMeshBufferTest, DestructorReleasesBuffers)
+{
+    {
+        SkinnedMeshBuffer buffer(renderer, mesh);
+    }
+    ASSERT_EQ(renderer.buffers.size(), 2u);
+    EXPECT_TRUE(renderer.buffers[0]->destroyed);
+    EXPECT_TRUE(renderer.buffers[1]->destroyed);
+}
@@ -0,0 +1,199 @@
+#include "Animation/Skinner.h"
+#include "../Geometry/TestMeshes.h"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace Animation;
+
+class SkinnerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // 31 x 31 vertices, deliberately not a multiple of the batch size
+        bindPose = MakeGridMesh(30, 1.5f);
+        for (Renderer::Vertex& v : bindPose.vertices)
+        {
+            v.normal = Math::Vector3(0.0f, 1.0f, 0.0f);
+        }
+
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> weight(0.0f, 1.0f);
+        std::uniform_int_distribution<uint32_t> bone(0, BONE_COUNT - 1);
+        for (size_t i = 0; i < bindPose.vertices.size(); ++i)
+        {
+            BoneInfluences influence;
+            const int used = 1 + static_cast<int>(i % MAX_BONE_INFLUENCES);
+            for (int k = 0; k < used; ++k)
+            {
+                influence.bones[k] = bone(rng);
+                influence.weights[k] = weight(rng) + 0.01f;
+            }
+            influences.push_back(influence);
+        }
+
+        for (uint32_t b = 0; b < BONE_COUNT; ++b)
+        {
+            const Math::Vector3 axis = Math::Vector3(1.0f, static_cast<float>(b), 2.0f).Normalized();
+            palette.push_back(Math::Matrix4x4::RotationAxis(axis, 0.3f * b) *
+                              Math::Matrix4x4::Translation(Math::Vector3(0.5f * b, -1.0f, 2.0f)));
+        }
+    }
+
+    // Straightforward matrix blend used as the reference
+    static Renderer::Vertex SkinReference(const Renderer::Vertex& v, const BoneInfluences& influence,
+                                          const std::vector<Math::Matrix4x4>& palette)
+    {
+        float total = 0.0f;
+        for (float w : influence.weights)
+        {
+            total += w;
+        }
+
+        Math::Matrix4x4 blended = Math::Matrix4x4() * 0.0f;
+        for (int k = 0; k < MAX_BONE_INFLUENCES; ++k)
+        {
+            if (influence.weights[k] > 0.0f)
+                blended = blended + palette[influence.bones[k]] * (influence.weights[k] / total);
+        }
+
+        Renderer::Vertex result = v;
+        result.position = blended.TransformPoint(v.position);
+        result.normal = blended.TransformVector(v.normal).Normalized();
+        const Math::Vector3 tangent =
+            blended.TransformVector(Math::Vector3(v.tangent.x, v.tangent.y, v.tangent.z)).Normalized();
+        result.tangent = {tangent.x, tangent.y, tangent.z, v.tangent.w};
+        return result;
+    }
+
+    static void ExpectNear(const Math::Vector3& actual, const Math::Vector3& expected, float epsilon = 1e-4f)
+    {
+        EXPECT_NEAR(actual.x, expected.x, epsilon);
+        EXPECT_NEAR(actual.y, expected.y, epsilon);
+        EXPECT_NEAR(actual.z, expected.z, epsilon);
+    }
+
+    static constexpr uint32_t BONE_COUNT = 6;
+    Renderer::Mesh bindPose;
+    std::vector<BoneInfluences> influences;
+    std::vector<Math::Matrix4x4> palette;
+};
+
+TEST_F(SkinnerTest, PrepareRejectsMismatchedInfluences)
+{
+    influences.pop_back();
+    SkinnedMesh mesh;
+    EXPECT_FALSE(Skinner::Prepare(bindPose, influences, mesh));
+}
+
+TEST_F(SkinnerTest, PrepareNormalizesAndPads)
+{
+    influences[0] = BoneInfluences();
+    influences[0].bones[0] = 3;
+    influences[1] = BoneInfluences();
+    influences[1].bones[0] = 2;
+    influences[1].bones[1] = 5;
+    influences[1].weights[0] = 3.0f;
+    influences[1].weights[1] = 1.0f;
+
+    SkinnedMesh mesh;
+    ASSERT_TRUE(Skinner::Prepare(bindPose, influences, mesh));
+
+    EXPECT_EQ(mesh.GetVertexCount(), bindPose.vertices.size());
+    EXPECT_EQ(mesh.streams[SkinnedMesh::PositionX].size() % Skinner::BATCH_SIZE, 0u);
+    EXPECT_GE(mesh.streams[SkinnedMesh::PositionX].size(), bindPose.vertices.size());
+    EXPECT_EQ(mesh.boneCount, BONE_COUNT);
+
+    // All-zero weights bind the vertex to its first bone
+    EXPECT_EQ(mesh.boneIndices[0][0], 3u);
+    EXPECT_FLOAT_EQ(mesh.boneWeights[0][0], 1.0f);
+
+    EXPECT_FLOAT_EQ(mesh.boneWeights[0][1], 0.75f);
+    EXPECT_FLOAT_EQ(mesh.boneWeights[1][1], 0.25f);
+    EXPECT_EQ(mesh.boneWeights[2][1], 0.0f);
+}
+
+TEST_F(SkinnerTest, IdentityPaletteReproducesBindPose)
+{
+    SkinnedMesh mesh;
+    ASSERT_TRUE(Skinner::Prepare(bindPose, influences, mesh));
+
+    std::vector<Renderer::Vertex> output = bindPose.vertices;
+    ASSERT_TRUE(Skinner::Skin(mesh, std::vector<Math::Matrix4x4>(BONE_COUNT), output.data()));
+
+    for (size_t i = 0; i < output.size(); ++i)
+    {
+        ExpectNear(output[i].position, bindPose.vertices[i].position, 1e-5f);
+        ExpectNear(output[i].normal, bindPose.vertices[i].normal, 1e-5f);
+    }
+}
+
+TEST_F(SkinnerTest, MatchesReferenceBlend)
+{
+    SkinnedMesh mesh;
+    ASSERT_TRUE(Skinner::Prepare(bindPose, influences, mesh));
+
+    std::vector<Renderer::Vertex> output = bindPose.vertices;
+    ASSERT_TRUE(Skinner::Skin(mesh, palette, output.data()));
+
+    for (size_t i = 0; i < output.size(); ++i)
+    {
+        const Renderer::Vertex expected = SkinReference(bindPose.vertices[i], influences[i], palette);
+        ExpectNear(output[i].position, expected.position);
+        ExpectNear(output[i].normal, expected.normal);
+        EXPECT_NEAR(output[i].tangent.x, expected.tangent.x, 1e-4f);
+        EXPECT_NEAR(output[i].tangent.y, expected.tangent.y, 1e-4f);
+        EXPECT_NEAR(output[i].tangent.z, expected.tangent.z, 1e-4f);
+
+        // Attributes outside the skinned set are left alone
+        EXPECT_EQ(output[i].texCoord, bindPose.vertices[i].texCoord);
+        EXPECT_EQ(output[i].tangent.w, bindPose.vertices[i].tangent.w);
+    }
+}
+
+TEST_F(SkinnerTest, RejectsSmallPalette)
+{
+    SkinnedMesh mesh;
+    ASSERT_TRUE(Skinner::Prepare(bindPose, influences, mesh));
+
+    std::vector<Renderer::Vertex> output = bindPose.vertices;
+    palette.pop_back();
+    EXPECT_FALSE(Skinner::Skin(mesh, palette, output.data()));
+}
+
+TEST_F(SkinnerTest, SkinJobsSkinsValidInstances)
+{
+    SkinnedMesh mesh;
+    ASSERT_TRUE(Skinner::Prepare(bindPose, influences, mesh));
+
+    const std::vector<Math::Matrix4x4> shortPalette(1);
+    std::vector<std::vector<Renderer::Vertex>> outputs(5, bindPose.vertices);
+    std::vector<SkinningJob> jobs;
+    for (std::vector<Renderer::Vertex>& output : outputs)
+    {
+        jobs.push_back(SkinningJob{&mesh, palette.data(), palette.size(), output.data()});
+    }
+    jobs[2].palette = shortPalette.data();
+    jobs[2].paletteSize = shortPalette.size();
+
+    EXPECT_FALSE(Skinner::SkinJobs(jobs));
+
+    std::vector<Renderer::Vertex> expected = bindPose.vertices;
+    ASSERT_TRUE(Skinner::Skin(mesh, palette, expected.data()));
+    for (size_t j = 0; j < outputs.size(); ++j)
+    {
+        const std::vector<Renderer::Vertex>& reference = j == 2 ? bindPose.vertices : expected;
+        for (size_t i = 0; i < reference.size(); ++i)
+        {
+            EXPECT_EQ(outputs[j][i].position, reference[i].position);
+        }
+    }
+}
+
+TEST_F(SkinnerTest, EmptyMesh)
+{
+    SkinnedMesh mesh;
+    ASSERT_TRUE(Skinner::Prepare(Renderer::Mesh(), {}, mesh));
+    EXPECT_EQ(mesh.boneCount, 0u);
+    EXPECT_TRUE(Skinner::Skin(mesh, {}, nullptr));
+}
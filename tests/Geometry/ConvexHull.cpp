@@ -0,0 +1,156 @@
+#include "Geometry/ConvexHull.h"
+#include "TestMeshes.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace Geometry;
+
+class ConvexHullTest : public ::testing::Test
+{
+  protected:
+    // Half-edge links are consistent, the surface is closed (Euler
+    // characteristic 2) and no input point lies outside any face
+    static void ExpectValidHull(const ConvexHull& hull, const std::vector<Math::Vector3>& points,
+                                float tolerance = 1e-4f)
+    {
+        ASSERT_EQ(hull.edges.size(), hull.faces.size() * 3);
+        for (uint32_t e = 0; e < hull.edges.size(); ++e)
+        {
+            const HullHalfEdge& edge = hull.edges[e];
+            const HullHalfEdge& twin = hull.edges[edge.twin];
+            ASSERT_EQ(twin.twin, e);
+            ASSERT_NE(twin.face, edge.face);
+            ASSERT_EQ(twin.origin, hull.edges[edge.next].origin);
+            ASSERT_EQ(hull.edges[hull.edges[hull.edges[e].next].next].next, e);
+        }
+        const size_t v = hull.vertices.size(), e = hull.edges.size() / 2, f = hull.faces.size();
+        EXPECT_EQ(v + f, e + 2);
+
+        for (const HullFace& face : hull.faces)
+        {
+            for (const Math::Vector3& point : points)
+            {
+                ASSERT_LE(face.plane.GetSignedDistance(point), tolerance);
+            }
+        }
+    }
+
+    static std::vector<Math::Vector3> RandomPoints(size_t count, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> coordinate(-1.0f, 1.0f);
+        std::vector<Math::Vector3> points(count);
+        for (Math::Vector3& point : points)
+        {
+            point = Math::Vector3(coordinate(rng), coordinate(rng), coordinate(rng));
+        }
+        return points;
+    }
+};
+
+TEST_F(ConvexHullTest, CubeWithInteriorPoints)
+{
+    std::vector<Math::Vector3> points = RandomPoints(1000, 1);
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        points.emplace_back(corner & 1 ? 1.5f : -1.5f, corner & 2 ? 1.5f : -1.5f, corner & 4 ? 1.5f : -1.5f);
+    }
+    // Points on the cube's faces and edges are not vertices
+    points.emplace_back(0.0f, 1.5f, 0.0f);
+    points.emplace_back(1.5f, 1.5f, 0.3f);
+
+    ConvexHull hull;
+    ASSERT_TRUE(ConvexHullBuilder::Build(points, hull));
+    EXPECT_EQ(hull.vertices.size(), 8u);
+    EXPECT_EQ(hull.faces.size(), 12u);
+    ExpectValidHull(hull, points);
+}
+
+TEST_F(ConvexHullTest, PointsOnASphereAreAllVertices)
+{
+    std::vector<Math::Vector3> points = RandomPoints(2000, 2);
+    for (Math::Vector3& point : points)
+    {
+        point.Normalize();
+    }
+
+    ConvexHull hull;
+    ASSERT_TRUE(ConvexHullBuilder::Build(points, hull));
+    EXPECT_EQ(hull.vertices.size(), points.size());
+    ExpectValidHull(hull, points);
+}
+
+TEST_F(ConvexHullTest, DegenerateInputsFail)
+{
+    ConvexHull hull;
+    std::vector<Math::Vector3> points = {Math::Vector3(0, 0, 0), Math::Vector3(1, 0, 0), Math::Vector3(0, 1, 0)};
+    EXPECT_FALSE(ConvexHullBuilder::Build(points, hull));
+
+    // Coplanar and collinear sets span no volume
+    points = RandomPoints(100, 3);
+    for (Math::Vector3& point : points)
+    {
+        point.y = 2.0f;
+    }
+    EXPECT_FALSE(ConvexHullBuilder::Build(points, hull));
+    for (Math::Vector3& point : points)
+    {
+        point.z = 0.0f;
+    }
+    EXPECT_FALSE(ConvexHullBuilder::Build(points, hull));
+    EXPECT_TRUE(hull.faces.empty());
+
+    points.assign(10, Math::Vector3(1, 2, 3));
+    EXPECT_FALSE(ConvexHullBuilder::Build(points, hull));
+}
+
+TEST_F(ConvexHullTest, VertexLimit)
+{
+    std::vector<Math::Vector3> points = RandomPoints(5000, 4);
+    for (Math::Vector3& point : points)
+    {
+        point.Normalize();
+    }
+
+    HullOptions options;
+    options.maxVertices = 24;
+    ConvexHull hull;
+    ASSERT_TRUE(ConvexHullBuilder::Build(points, hull, options));
+    EXPECT_EQ(hull.vertices.size(), 24u);
+
+    // Still a closed hull of its own vertices, and a coarse fit of the sphere
+    ExpectValidHull(hull, hull.vertices);
+    for (const HullFace& face : hull.faces)
+    {
+        EXPECT_LT(face.plane.distance, -0.5f);
+    }
+}
+
+TEST_F(ConvexHullTest, MeshRoundTrip)
+{
+    const Renderer::Mesh sphere = MakeSphereMesh(12, 16);
+    ConvexHull hull;
+    ASSERT_TRUE(ConvexHullBuilder::Build(sphere, hull));
+    EXPECT_EQ(hull.vertices.size(), sphere.vertices.size());
+
+    // Triangles wind so their geometric normal points outward
+    const Renderer::Mesh mesh = ConvexHullBuilder::ToMesh(hull);
+    ASSERT_EQ(mesh.indices.size(), hull.faces.size() * 3);
+    for (size_t i = 0; i < mesh.indices.size(); i += 3)
+    {
+        const Math::Vector3& a = mesh.vertices[mesh.indices[i]].position;
+        const Math::Vector3& b = mesh.vertices[mesh.indices[i + 1]].position;
+        const Math::Vector3& c = mesh.vertices[mesh.indices[i + 2]].position;
+        EXPECT_GT(Math::Vector3::Dot(Math::Vector3::Cross(b - a, c - a), a + b + c), 0.0f);
+    }
+}
+
+TEST_F(ConvexHullTest, LargeInput)
+{
+    const std::vector<Math::Vector3> points = RandomPoints(100000, 5);
+    ConvexHull hull;
+    ASSERT_TRUE(ConvexHullBuilder::Build(points, hull));
+    EXPECT_GT(hull.vertices.size(), 50u);
+    ExpectValidHull(hull, points);
+}
@@ -0,0 +1,53 @@
+#include "Geometry/LodSelector.h"
+#include <gtest/gtest.h>
+
+using namespace Geometry;
+
+class LodSelectorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        chain.levels.push_back({0, 3000, 0.0f});
+        chain.levels.push_back({3000, 1500, 0.01f});
+        chain.levels.push_back({4500, 600, 0.05f});
+        chain.levels.push_back({5100, 150, 0.2f});
+    }
+
+    LodChain chain;
+};
+
+TEST_F(LodSelectorTest, ProjectedErrorFallsWithDistance)
+{
+    LodSelector selector(1.0f, 1000);
+    EXPECT_GT(selector.GetProjectedError(0.1f, 1.0f), selector.GetProjectedError(0.1f, 10.0f));
+    EXPECT_FLOAT_EQ(selector.GetProjectedError(0.0f, 5.0f), 0.0f);
+}
+
+TEST_F(LodSelectorTest, CoarserLevelsWithDistance)
+{
+    LodSelector selector(1.0471976f, 1080, 1.0f);
+
+    uint32_t previous = 0;
+    for (float distance = 0.5f; distance < 1000.0f; distance *= 2.0f)
+    {
+        uint32_t level = selector.SelectLevel(chain, distance);
+        EXPECT_GE(level, previous);
+        previous = level;
+    }
+
+    EXPECT_EQ(selector.SelectLevel(chain, 0.1f), 0u);
+    EXPECT_EQ(selector.SelectLevel(chain, 10000.0f), 3u);
+}
+
+TEST_F(LodSelectorTest, ScaleAndThresholdAffectSelection)
+{
+    LodSelector selector(1.0471976f, 1080, 1.0f);
+    const float distance = 100.0f;
+    const uint32_t base = selector.SelectLevel(chain, distance);
+
+    EXPECT_LE(selector.SelectLevel(chain, distance, 10.0f), base);
+
+    selector.SetPixelThreshold(50.0f);
+    EXPECT_GE(selector.SelectLevel(chain, distance), base);
+}
@@ -0,0 +1,118 @@
+#include "Geometry/MeshCodec.h"
+#include "TestMeshes.h"
+#include <cstring>
+#include <gtest/gtest.h>
+
+using namespace Geometry;
+
+class MeshCodecTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        sphere = MakeSphereMesh(32, 48);
+    }
+
+    static void ExpectBitExact(const Renderer::Mesh& a, const Renderer::Mesh& b)
+    {
+        ASSERT_EQ(a.vertices.size(), b.vertices.size());
+        ASSERT_EQ(a.indices, b.indices);
+        EXPECT_EQ(std::memcmp(a.vertices.data(), b.vertices.data(), a.vertices.size() * sizeof(Renderer::Vertex)), 0);
+    }
+
+    Renderer::Mesh sphere;
+};
+
+TEST_F(MeshCodecTest, RoundTrip)
+{
+    std::vector<uint8_t> encoded = MeshCodec::Encode(sphere);
+    Renderer::Mesh decoded;
+    ASSERT_TRUE(MeshCodec::Decode(encoded, decoded));
+    ExpectBitExact(sphere, decoded);
+}
+
+TEST_F(MeshCodecTest, CompressesBelowRawSize)
+{
+    std::vector<uint8_t> encoded = MeshCodec::Encode(sphere);
+    const size_t rawSize = sphere.vertices.size() * sizeof(Renderer::Vertex) + sphere.indices.size() * sizeof(uint32_t);
+    EXPECT_LT(encoded.size(), rawSize * 3 / 4);
+}
+
+TEST_F(MeshCodecTest, ConstantAttributesAreNearlyFree)
+{
+    // Colors, normals and tangents never change, so only their control bits are stored
+    Renderer::Mesh grid = MakeGridMesh(64);
+    std::vector<uint8_t> encoded = MeshCodec::Encode(grid);
+    const size_t varyingBytes = grid.vertices.size() * 5 * sizeof(float) + grid.indices.size() * sizeof(uint32_t);
+    EXPECT_LT(encoded.size(), varyingBytes / 2);
+}
+
+TEST_F(MeshCodecTest, RoundTripOddCountsAndSpecialValues)
+{
+    Renderer::Mesh mesh;
+    const float values[] = {0.0f, -0.0f, 1e-38f, -3.0e38f, 123.456f, -1.0f, 7.0f};
+    for (int i = 0; i < 7; ++i)
+    {
+        Renderer::Vertex v;
+        v.position = Math::Vector3(values[i], values[(i + 1) % 7], values[(i + 2) % 7]);
+        v.color = {values[(i + 3) % 7], values[(i + 4) % 7], values[(i + 5) % 7], values[(i + 6) % 7]};
+        mesh.vertices.push_back(v);
+    }
+    mesh.indices = {6, 0, 5, 1, 2, 6, 4, 0, 3}; // Odd count, negative deltas
+
+    Renderer::Mesh decoded;
+    ASSERT_TRUE(MeshCodec::Decode(MeshCodec::Encode(mesh), decoded));
+    ExpectBitExact(mesh, decoded);
+}
+
+TEST_F(MeshCodecTest, RoundTripLargeMeshAcrossChunks)
+{
+    Renderer::Mesh grid = MakeGridMesh(100, 2.0f);
+    Renderer::Mesh decoded;
+    ASSERT_TRUE(MeshCodec::Decode(MeshCodec::Encode(grid), decoded));
+    ExpectBitExact(grid, decoded);
+}
+
+TEST_F(MeshCodecTest, EmptyMesh)
+{
+    Renderer::Mesh empty;
+    Renderer::Mesh decoded;
+    decoded.indices = {1, 2, 3};
+    ASSERT_TRUE(MeshCodec::Decode(MeshCodec::Encode(empty), decoded));
+    EXPECT_TRUE(decoded.vertices.empty());
+    EXPECT_TRUE(decoded.indices.empty());
+}
+
+TEST_F(MeshCodecTest, RejectsMalformedData)
+{
+    std::vector<uint8_t> encoded = MeshCodec::Encode(sphere);
+    Renderer::Mesh decoded;
+
+    EXPECT_FALSE(MeshCodec::Decode(nullptr, 0, decoded));
+    EXPECT_FALSE(MeshCodec::Decode(encoded.data(), 10, decoded));
+
+    std::vector<uint8_t> badMagic = encoded;
+    badMagic[0] ^= 0xFF;
+    EXPECT_FALSE(MeshCodec::Decode(badMagic, decoded));
+
+    std::vector<uint8_t> truncated(encoded.begin(), encoded.end() - 40);
+    EXPECT_FALSE(MeshCodec::Decode(truncated, decoded));
+
+    std::vector<uint8_t> badCount = encoded;
+    badCount[9] ^= 0x01; // Vertex count off by 256 no longer matches the streams
+    EXPECT_FALSE(MeshCodec::Decode(badCount, decoded));
+}
+
+TEST_F(MeshCodecTest, RejectsIndicesPastTheVertices)
+{
+    Renderer::Mesh mesh = sphere;
+    Renderer::Mesh decoded;
+    ASSERT_TRUE(MeshCodec::Decode(MeshCodec::Encode(mesh), decoded));
+
+    // The streams are well formed; only the index is out of range
+    mesh.indices[mesh.indices.size() / 2] = static_cast<uint32_t>(mesh.vertices.size());
+    EXPECT_FALSE(MeshCodec::Decode(MeshCodec::Encode(mesh), decoded));
+
+    mesh.indices[0] = 0xFFFFFFFFu;
+    EXPECT_FALSE(MeshCodec::Decode(MeshCodec::Encode(mesh), decoded));
+}
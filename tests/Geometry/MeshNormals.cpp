@@ -0,0 +1,171 @@
+#include "Geometry/MeshNormals.h"
+#include "TestMeshes.h"
+#include <gtest/gtest.h>
+
+using namespace Geometry;
+
+namespace
+{
+Math::Vector3 TangentOf(const Renderer::Vertex& v)
+{
+    return Math::Vector3(v.tangent.x, v.tangent.y, v.tangent.z);
+}
+} // namespace
+
+TEST(MeshNormalsTest, FlatGridPointsUp)
+{
+    Renderer::Mesh grid = MakeGridMesh(8);
+    MeshNormals::GenerateNormals(grid);
+
+    for (const Renderer::Vertex& v : grid.vertices)
+    {
+        EXPECT_NEAR(v.normal.x, 0.0f, 1e-6f);
+        EXPECT_NEAR(v.normal.y, 1.0f, 1e-6f);
+        EXPECT_NEAR(v.normal.z, 0.0f, 1e-6f);
+    }
+}
+
+TEST(MeshNormalsTest, SphereNormalsPointOutward)
+{
+    Renderer::Mesh sphere = MakeSphereMesh(24, 48);
+    MeshNormals::GenerateNormals(sphere, NormalWeighting::Area);
+
+    for (const Renderer::Vertex& v : sphere.vertices)
+    {
+        EXPECT_NEAR(v.normal.Magnitude(), 1.0f, 1e-5f);
+        EXPECT_GT(Math::Vector3::Dot(v.normal, v.position), 0.99f);
+    }
+}
+
+TEST(MeshNormalsTest, SplitVerticesShareNormals)
+{
+    // Duplicate every vertex with a different texCoord per triangle corner
+    Renderer::Mesh sphere = MakeSphereMesh(12, 24);
+    Renderer::Mesh split;
+    for (size_t i = 0; i < sphere.indices.size(); ++i)
+    {
+        Renderer::Vertex v = sphere.vertices[sphere.indices[i]];
+        v.texCoord = Math::Vector2(static_cast<float>(i % 3), 0.0f);
+        split.vertices.push_back(v);
+        split.indices.push_back(static_cast<uint32_t>(i));
+    }
+
+    MeshNormals::GenerateNormals(sphere);
+    MeshNormals::GenerateNormals(split);
+
+    for (size_t i = 0; i < sphere.indices.size(); ++i)
+    {
+        const Math::Vector3& expected = sphere.vertices[sphere.indices[i]].normal;
+        const Math::Vector3& actual = split.vertices[i].normal;
+        EXPECT_NEAR(actual.x, expected.x, 1e-5f);
+        EXPECT_NEAR(actual.y, expected.y, 1e-5f);
+        EXPECT_NEAR(actual.z, expected.z, 1e-5f);
+    }
+}
+
+TEST(MeshNormalsTest, AngleWeightingIgnoresTessellation)
+{
+    // A box corner where one face is split into a fan of slivers. Each face
+    // spans 90 degrees at the corner, so angle weighting yields the diagonal.
+    Renderer::Mesh mesh;
+    auto add = [&mesh](float x, float y, float z) {
+        Renderer::Vertex v;
+        v.position = Math::Vector3(x, y, z);
+        mesh.vertices.push_back(v);
+        return static_cast<uint32_t>(mesh.vertices.size() - 1);
+    };
+
+    const uint32_t corner = add(0.0f, 0.0f, 0.0f);
+    const uint32_t x = add(1.0f, 0.0f, 0.0f);
+    const uint32_t y = add(0.0f, 1.0f, 0.0f);
+    const uint32_t z = add(0.0f, 0.0f, 1.0f);
+    mesh.indices.insert(mesh.indices.end(), {corner, y, x});
+    mesh.indices.insert(mesh.indices.end(), {corner, x, z});
+
+    // Fan of slivers covering the YZ quarter disc
+    const int slivers = 8;
+    uint32_t previous = y;
+    for (int i = 1; i <= slivers; ++i)
+    {
+        const float angle = 1.5707963f * i / slivers;
+        const uint32_t next = i == slivers ? z : add(0.0f, std::cos(angle), std::sin(angle));
+        mesh.indices.insert(mesh.indices.end(), {corner, next, previous});
+        previous = next;
+    }
+
+    MeshNormals::GenerateNormals(mesh, NormalWeighting::Angle);
+    const Math::Vector3 normal = mesh.vertices[corner].normal;
+    const float diagonal = -1.0f / std::sqrt(3.0f);
+    EXPECT_NEAR(normal.x, diagonal, 1e-5f);
+    EXPECT_NEAR(normal.y, diagonal, 1e-5f);
+    EXPECT_NEAR(normal.z, diagonal, 1e-5f);
+}
+
+TEST(MeshNormalsTest, GridTangentsFollowU)
+{
+    Renderer::Mesh grid = MakeGridMesh(8);
+    MeshNormals::GenerateNormals(grid);
+    MeshNormals::GenerateTangents(grid);
+
+    for (const Renderer::Vertex& v : grid.vertices)
+    {
+        EXPECT_NEAR(v.tangent.x, 1.0f, 1e-5f);
+        EXPECT_NEAR(v.tangent.y, 0.0f, 1e-5f);
+        EXPECT_NEAR(v.tangent.z, 0.0f, 1e-5f);
+
+        // V runs along +Z, and Cross(+Y, +X) is -Z
+        EXPECT_EQ(v.tangent.w, -1.0f);
+    }
+}
+
+TEST(MeshNormalsTest, MirroredUVsFlipHandedness)
+{
+    Renderer::Mesh grid = MakeGridMesh(8);
+    for (Renderer::Vertex& v : grid.vertices)
+    {
+        v.texCoord.y = 1.0f - v.texCoord.y;
+    }
+
+    MeshNormals::GenerateNormals(grid);
+    MeshNormals::GenerateTangents(grid);
+
+    for (const Renderer::Vertex& v : grid.vertices)
+    {
+        EXPECT_NEAR(v.tangent.x, 1.0f, 1e-5f);
+        EXPECT_EQ(v.tangent.w, 1.0f);
+    }
+}
+
+TEST(MeshNormalsTest, TangentsAreOrthonormal)
+{
+    Renderer::Mesh grid = MakeGridMesh(32, 2.0f);
+    MeshNormals::GenerateNormals(grid);
+    MeshNormals::GenerateTangents(grid);
+
+    for (const Renderer::Vertex& v : grid.vertices)
+    {
+        const Math::Vector3 tangent = TangentOf(v);
+        EXPECT_NEAR(tangent.Magnitude(), 1.0f, 1e-5f);
+        EXPECT_NEAR(Math::Vector3::Dot(tangent, v.normal), 0.0f, 1e-5f);
+        EXPECT_GT(tangent.x, 0.0f);
+    }
+}
+
+TEST(MeshNormalsTest, DegenerateUVsStillProduceTangentFrame)
+{
+    Renderer::Mesh grid = MakeGridMesh(4);
+    for (Renderer::Vertex& v : grid.vertices)
+    {
+        v.texCoord = Math::Vector2(0.5f, 0.5f);
+    }
+
+    MeshNormals::GenerateNormals(grid);
+    MeshNormals::GenerateTangents(grid);
+
+    for (const Renderer::Vertex& v : grid.vertices)
+    {
+        const Math::Vector3 tangent = TangentOf(v);
+        EXPECT_NEAR(tangent.Magnitude(), 1.0f, 1e-5f);
+        EXPECT_NEAR(Math::Vector3::Dot(tangent, v.normal), 0.0f, 1e-5f);
+    }
+}
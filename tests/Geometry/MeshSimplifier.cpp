@@ -0,0 +1,144 @@
+#include "Geometry/MeshSimplifier.h"
+#include "TestMeshes.h"
+#include <gtest/gtest.h>
+#include <set>
+
+using namespace Geometry;
+
+class MeshSimplifierTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        flatGrid = MakeGridMesh(16);
+        sphere = MakeSphereMesh(24, 32);
+    }
+
+    Renderer::Mesh flatGrid;
+    Renderer::Mesh sphere;
+};
+
+TEST_F(MeshSimplifierTest, FlatGridSimplifiesWithoutError)
+{
+    float error = -1.0f;
+    std::vector<uint32_t> indices = MeshSimplifier::Simplify(flatGrid, 0.25f, 1e30f, &error);
+
+    EXPECT_LE(indices.size(), flatGrid.indices.size() / 2);
+    EXPECT_EQ(indices.size() % 3, 0u);
+    EXPECT_NEAR(error, 0.0f, 1e-4f);
+}
+
+TEST_F(MeshSimplifierTest, BorderVerticesArePreserved)
+{
+    std::vector<uint32_t> indices = MeshSimplifier::Simplify(flatGrid, 0.1f);
+    std::set<uint32_t> used(indices.begin(), indices.end());
+
+    // The four corners of the grid sit on the border and must survive
+    EXPECT_TRUE(used.count(0));
+    EXPECT_TRUE(used.count(16));
+    EXPECT_TRUE(used.count(16 * 17));
+    EXPECT_TRUE(used.count(16 * 17 + 16));
+}
+
+TEST_F(MeshSimplifierTest, ClosedMeshReachesTarget)
+{
+    float error = 0.0f;
+    std::vector<uint32_t> indices = MeshSimplifier::Simplify(sphere, 0.2f, 1e30f, &error);
+
+    const size_t target = (sphere.indices.size() / 3) / 5 * 3;
+    EXPECT_LE(indices.size(), target + 3);
+    EXPECT_GT(indices.size(), 0u);
+    EXPECT_GT(error, 0.0f);
+    EXPECT_LT(error, 0.5f);
+}
+
+TEST_F(MeshSimplifierTest, MaxErrorLimitsSimplification)
+{
+    std::vector<uint32_t> strict = MeshSimplifier::Simplify(sphere, 0.0f, 1e-6f);
+    std::vector<uint32_t> loose = MeshSimplifier::Simplify(sphere, 0.0f, 1.0f);
+
+    EXPECT_EQ(strict.size(), sphere.indices.size());
+    EXPECT_LT(loose.size(), strict.size());
+}
+
+TEST_F(MeshSimplifierTest, AttributeSeamIsLocked)
+{
+    // Split the grid along x == 8 by duplicating those vertices with a new color
+    Renderer::Mesh mesh = flatGrid;
+    const uint32_t originalCount = static_cast<uint32_t>(mesh.vertices.size());
+    std::vector<uint32_t> seamCopy(originalCount, UINT32_MAX);
+    for (uint32_t z = 0; z <= 16; ++z)
+    {
+        const uint32_t index = z * 17 + 8;
+        Renderer::Vertex copy = mesh.vertices[index];
+        copy.color = {1.0f, 0.0f, 0.0f, 1.0f};
+        seamCopy[index] = static_cast<uint32_t>(mesh.vertices.size());
+        mesh.vertices.push_back(copy);
+    }
+
+    for (size_t t = 0; t < mesh.indices.size(); t += 3)
+    {
+        bool rightSide = false;
+        for (int k = 0; k < 3; ++k)
+            rightSide |= mesh.vertices[mesh.indices[t + k]].position.x > 8.0f;
+
+        for (int k = 0; rightSide && k < 3; ++k)
+        {
+            if (seamCopy[mesh.indices[t + k]] != UINT32_MAX)
+                mesh.indices[t + k] = seamCopy[mesh.indices[t + k]];
+        }
+    }
+
+    std::vector<uint32_t> indices = MeshSimplifier::Simplify(mesh, 0.1f);
+    std::set<uint32_t> used(indices.begin(), indices.end());
+
+    for (uint32_t z = 0; z <= 16; ++z)
+    {
+        EXPECT_TRUE(used.count(z * 17 + 8)) << "Seam vertex " << z << " lost on the left side";
+        EXPECT_TRUE(used.count(seamCopy[z * 17 + 8])) << "Seam vertex " << z << " lost on the right side";
+    }
+}
+
+TEST_F(MeshSimplifierTest, LodChainLevelsShrink)
+{
+    LodChain chain = MeshSimplifier::BuildLodChain(sphere, {0.5f, 0.25f, 0.125f});
+
+    ASSERT_EQ(chain.levels.size(), 4u);
+    EXPECT_EQ(chain.levels[0].indexOffset, 0u);
+    EXPECT_EQ(chain.levels[0].indexCount, sphere.indices.size());
+    EXPECT_EQ(chain.mesh.vertices.size(), sphere.vertices.size());
+
+    for (size_t i = 1; i < chain.levels.size(); ++i)
+    {
+        const LodLevel& previous = chain.levels[i - 1];
+        const LodLevel& level = chain.levels[i];
+        EXPECT_LT(level.indexCount, previous.indexCount);
+        EXPECT_GE(level.error, previous.error);
+        EXPECT_EQ(level.indexOffset, previous.indexOffset + previous.indexCount);
+    }
+
+    const LodLevel& last = chain.levels.back();
+    EXPECT_EQ(chain.mesh.indices.size(), last.indexOffset + last.indexCount);
+}
+
+TEST_F(MeshSimplifierTest, ParallelChainsMatchSerial)
+{
+    std::vector<Renderer::Mesh> meshes = {sphere, flatGrid, MakeSphereMesh(12, 16)};
+    std::vector<LodChain> chains = MeshSimplifier::BuildLodChains(meshes, {0.5f, 0.25f});
+
+    ASSERT_EQ(chains.size(), meshes.size());
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        LodChain serial = MeshSimplifier::BuildLodChain(meshes[i], {0.5f, 0.25f});
+        EXPECT_EQ(chains[i].mesh.indices, serial.mesh.indices);
+    }
+}
+
+TEST_F(MeshSimplifierTest, EmptyMesh)
+{
+    Renderer::Mesh empty;
+    EXPECT_TRUE(MeshSimplifier::Simplify(empty, 0.5f).empty());
+
+    LodChain chain = MeshSimplifier::BuildLodChain(empty, {0.5f});
+    EXPECT_EQ(chain.levels.size(), 1u);
+}
@@ -0,0 +1,117 @@
+#include "Geometry/MeshletBuilder.h"
+#include "TestMeshes.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <set>
+
+using namespace Geometry;
+
+class MeshletBuilderTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        sphere = MakeSphereMesh(48, 64);
+        grid = MakeGridMesh(40);
+    }
+
+    Renderer::Mesh sphere;
+    Renderer::Mesh grid;
+};
+
+TEST_F(MeshletBuilderTest, RespectsLimits)
+{
+    MeshletMesh result = MeshletBuilder::Build(sphere);
+    ASSERT_FALSE(result.meshlets.empty());
+
+    for (const Meshlet& meshlet : result.meshlets)
+    {
+        EXPECT_LE(meshlet.vertexCount, MeshletBuilder::MAX_VERTICES);
+        EXPECT_LE(meshlet.triangleCount, MeshletBuilder::MAX_TRIANGLES);
+        EXPECT_GT(meshlet.triangleCount, 0u);
+    }
+}
+
+TEST_F(MeshletBuilderTest, CustomLimits)
+{
+    MeshletMesh result = MeshletBuilder::Build(grid, 16, 20);
+    for (const Meshlet& meshlet : result.meshlets)
+    {
+        EXPECT_LE(meshlet.vertexCount, 16u);
+        EXPECT_LE(meshlet.triangleCount, 20u);
+    }
+}
+
+TEST_F(MeshletBuilderTest, PreservesEveryTriangle)
+{
+    MeshletMesh result = MeshletBuilder::Build(sphere);
+    ASSERT_EQ(result.indices.size(), sphere.indices.size());
+
+    auto triangleKeys = [](const std::vector<uint32_t>& indices) {
+        std::multiset<std::vector<uint32_t>> keys;
+        for (size_t i = 0; i < indices.size(); i += 3)
+        {
+            // Rotate so the smallest index is first, preserving winding
+            std::vector<uint32_t> tri = {indices[i], indices[i + 1], indices[i + 2]};
+            std::rotate(tri.begin(), std::min_element(tri.begin(), tri.end()), tri.end());
+            keys.insert(tri);
+        }
+        return keys;
+    };
+
+    EXPECT_EQ(triangleKeys(result.indices), triangleKeys(sphere.indices));
+}
+
+TEST_F(MeshletBuilderTest, MeshletRangesAreConsistent)
+{
+    MeshletMesh result = MeshletBuilder::Build(sphere);
+
+    uint32_t expectedIndexOffset = 0;
+    for (const Meshlet& meshlet : result.meshlets)
+    {
+        EXPECT_EQ(meshlet.indexOffset, expectedIndexOffset);
+        expectedIndexOffset += meshlet.triangleCount * 3;
+
+        std::set<uint32_t> meshletVertices(result.vertexIndices.begin() + meshlet.vertexOffset,
+                                           result.vertexIndices.begin() + meshlet.vertexOffset + meshlet.vertexCount);
+        EXPECT_EQ(meshletVertices.size(), meshlet.vertexCount);
+
+        for (uint32_t i = 0; i < meshlet.triangleCount * 3; ++i)
+        {
+            EXPECT_TRUE(meshletVertices.count(result.indices[meshlet.indexOffset + i]));
+        }
+    }
+}
+
+TEST_F(MeshletBuilderTest, BoundsContainVertices)
+{
+    MeshletMesh result = MeshletBuilder::Build(sphere);
+
+    for (const Meshlet& meshlet : result.meshlets)
+    {
+        for (uint32_t i = 0; i < meshlet.vertexCount; ++i)
+        {
+            const Math::Vector3& p = sphere.vertices[result.vertexIndices[meshlet.vertexOffset + i]].position;
+            EXPECT_LE(Math::Vector3::Distance(p, meshlet.center), meshlet.radius + 1e-5f);
+        }
+    }
+}
+
+TEST_F(MeshletBuilderTest, FlatMeshHasTightCone)
+{
+    MeshletMesh result = MeshletBuilder::Build(grid);
+
+    for (const Meshlet& meshlet : result.meshlets)
+    {
+        EXPECT_NEAR(meshlet.coneAxis.y, 1.0f, 1e-4f);
+        EXPECT_NEAR(meshlet.coneCutoff, 0.0f, 1e-3f);
+    }
+}
+
+TEST_F(MeshletBuilderTest, EmptyMesh)
+{
+    Renderer::Mesh empty;
+    MeshletMesh result = MeshletBuilder::Build(empty);
+    EXPECT_TRUE(result.meshlets.empty());
+    EXPECT_TRUE(result.indices.empty());
+}
@@ -0,0 +1,100 @@
+#include "Geometry/MeshletCuller.h"
+#include "TestMeshes.h"
+#include <gtest/gtest.h>
+
+using namespace Geometry;
+
+class MeshletCullerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        sphere = MakeSphereMesh(48, 64);
+        meshlets = MeshletBuilder::Build(sphere);
+    }
+
+    Math::Frustum LookAtOrigin(const Math::Vector3& eye, float fov = 1.0f) const
+    {
+        return Math::Frustum::FromPerspective(eye, -eye, Math::Vector3::Up(), fov, 1.0f, 0.1f, 100.0f);
+    }
+
+    Renderer::Mesh sphere;
+    MeshletMesh meshlets;
+};
+
+TEST_F(MeshletCullerTest, BackfacingHalfIsCulled)
+{
+    const Math::Vector3 eye(0.0f, 0.0f, -10.0f);
+    std::vector<MeshletDrawRange> ranges;
+    MeshletCullStats stats;
+    MeshletCuller::Cull(meshlets, LookAtOrigin(eye), eye, ranges, &stats);
+
+    EXPECT_EQ(stats.totalMeshlets, meshlets.meshlets.size());
+    EXPECT_EQ(stats.frustumCulled, 0u);
+    EXPECT_GT(stats.backfaceCulled, stats.totalMeshlets / 4);
+    EXPECT_LT(stats.backfaceCulled, stats.totalMeshlets * 3 / 4);
+    EXPECT_NEAR(stats.GetCulledRatio(), float(stats.backfaceCulled) / stats.totalMeshlets, 1e-6f);
+}
+
+TEST_F(MeshletCullerTest, NoVisibleTriangleIsCulled)
+{
+    const Math::Vector3 eye(3.0f, 4.0f, -6.0f);
+    std::vector<MeshletDrawRange> ranges;
+    MeshletCuller::Cull(meshlets, LookAtOrigin(eye, 1.2f), eye, ranges);
+
+    std::vector<uint8_t> drawn(meshlets.indices.size() / 3, 0);
+    for (const MeshletDrawRange& range : ranges)
+    {
+        for (uint32_t i = 0; i < range.indexCount; i += 3)
+            drawn[(range.indexOffset + i) / 3] = 1;
+    }
+
+    // Every triangle that faces the camera must be in a drawn range
+    for (size_t t = 0; t < drawn.size(); ++t)
+    {
+        const uint32_t* tri = &meshlets.indices[t * 3];
+        const Math::Vector3& a = sphere.vertices[tri[0]].position;
+        const Math::Vector3 normal = Math::Vector3::Cross(sphere.vertices[tri[1]].position - a, sphere.vertices[tri[2]].position - a);
+        if (Math::Vector3::Dot(normal, eye - a) > 0.0f)
+        {
+            EXPECT_TRUE(drawn[t]) << "Front-facing triangle " << t << " was culled";
+        }
+    }
+}
+
+TEST_F(MeshletCullerTest, FrustumCullsEverythingBehindCamera)
+{
+    const Math::Vector3 eye(0.0f, 0.0f, -10.0f);
+    Math::Frustum away = Math::Frustum::FromPerspective(eye, Math::Vector3(0.0f, 0.0f, -1.0f), Math::Vector3::Up(),
+                                                        1.0f, 1.0f, 0.1f, 100.0f);
+    std::vector<MeshletDrawRange> ranges;
+    MeshletCullStats stats;
+    MeshletCuller::Cull(meshlets, away, eye, ranges, &stats);
+
+    EXPECT_TRUE(ranges.empty());
+    EXPECT_FLOAT_EQ(stats.GetCulledRatio(), 1.0f);
+}
+
+TEST_F(MeshletCullerTest, AdjacentRangesAreMerged)
+{
+    // A grid seen from above keeps every cluster, so one range covers it all
+    Renderer::Mesh grid = MakeGridMesh(40);
+    MeshletMesh gridMeshlets = MeshletBuilder::Build(grid);
+    const Math::Vector3 eye(20.0f, 50.0f, 20.0f);
+    Math::Frustum down = Math::Frustum::FromPerspective(eye, Math::Vector3::Down(), Math::Vector3::Forward(),
+                                                        1.5f, 1.0f, 0.1f, 100.0f);
+    std::vector<MeshletDrawRange> ranges;
+    MeshletCullStats stats;
+    MeshletCuller::Cull(gridMeshlets, down, eye, ranges, &stats);
+
+    EXPECT_FLOAT_EQ(stats.GetCulledRatio(), 0.0f);
+    ASSERT_EQ(ranges.size(), 1u);
+    EXPECT_EQ(ranges[0].indexOffset, 0u);
+    EXPECT_EQ(ranges[0].indexCount, gridMeshlets.indices.size());
+}
+
+TEST(MeshletCullStatsTest, EmptyRatio)
+{
+    MeshletCullStats stats;
+    EXPECT_FLOAT_EQ(stats.GetCulledRatio(), 0.0f);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Renderer/RendererResources.h"
+#include <cmath>
+#include <cstdint>
+
+// Procedural meshes shared by the Geometry tests
+
+// A size x size unit-spaced grid in the XZ plane with optional height bumps
+inline Renderer::Mesh MakeGridMesh(uint32_t size, float bumpHeight = 0.0f)
+{
+    Renderer::Mesh mesh;
+    for (uint32_t z = 0; z <= size; ++z)
+    {
+        for (uint32_t x = 0; x <= size; ++x)
+        {
+            Renderer::Vertex v;
+            const float height = bumpHeight * std::sin(x * 0.7f) * std::cos(z * 0.5f);
+            v.position = Math::Vector3(static_cast<float>(x), height, static_cast<float>(z));
+            v.color = {1.0f, 1.0f, 1.0f, 1.0f};
+            v.texCoord = Math::Vector2(static_cast<float>(x) / size, static_cast<float>(z) / size);
+            mesh.vertices.push_back(v);
+        }
+    }
+
+    const uint32_t stride = size + 1;
+    for (uint32_t z = 0; z < size; ++z)
+    {
+        for (uint32_t x = 0; x < size; ++x)
+        {
+            const uint32_t i0 = z * stride + x;
+            const uint32_t i1 = i0 + 1;
+            const uint32_t i2 = i0 + stride;
+            const uint32_t i3 = i2 + 1;
+            mesh.indices.insert(mesh.indices.end(), {i0, i2, i1, i1, i2, i3});
+        }
+    }
+
+    return mesh;
+}
+
+// A closed unit sphere with shared vertices (no seams, no borders)
+inline Renderer::Mesh MakeSphereMesh(uint32_t stacks, uint32_t slices)
+{
+    const float pi = 3.14159265358979323846f;
+    Renderer::Mesh mesh;
+
+    Renderer::Vertex top;
+    top.position = Math::Vector3(0.0f, 1.0f, 0.0f);
+    top.color = {1.0f, 1.0f, 1.0f, 1.0f};
+    mesh.vertices.push_back(top);
+
+    for (uint32_t i = 1; i < stacks; ++i)
+    {
+        const float phi = pi * i / stacks;
+        for (uint32_t j = 0; j < slices; ++j)
+        {
+            const float theta = 2.0f * pi * j / slices;
+            Renderer::Vertex v;
+            v.position = Math::Vector3(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+            v.color = {1.0f, 1.0f, 1.0f, 1.0f};
+            mesh.vertices.push_back(v);
+        }
+    }
+
+    Renderer::Vertex bottom = top;
+    bottom.position = Math::Vector3(0.0f, -1.0f, 0.0f);
+    mesh.vertices.push_back(bottom);
+
+    const uint32_t bottomIndex = static_cast<uint32_t>(mesh.vertices.size() - 1);
+    auto ring = [slices](uint32_t stack, uint32_t slice) { return 1 + (stack - 1) * slices + slice % slices; };
+
+    for (uint32_t j = 0; j < slices; ++j)
+    {
+        mesh.indices.insert(mesh.indices.end(), {0u, ring(1, j + 1), ring(1, j)});
+        mesh.indices.insert(mesh.indices.end(), {bottomIndex, ring(stacks - 1, j), ring(stacks - 1, j + 1)});
+    }
+
+    for (uint32_t i = 1; i + 1 < stacks; ++i)
+    {
+        for (uint32_t j = 0; j < slices; ++j)
+        {
+            const uint32_t a = ring(i, j);
+            const uint32_t b = ring(i, j + 1);
+            const uint32_t c = ring(i + 1, j);
+            const uint32_t d = ring(i + 1, j + 1);
+            mesh.indices.insert(mesh.indices.end(), {a, b, c, b, d, c});
+        }
+    }
+
+    return mesh;
+}
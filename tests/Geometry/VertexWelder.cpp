@@ -0,0 +1,127 @@
+#include "Geometry/VertexWelder.h"
+#include "TestMeshes.h"
+#include <gtest/gtest.h>
+#include <limits>
+
+using namespace Geometry;
+
+class VertexWelderTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        grid = MakeGridMesh(8);
+        for (uint32_t index : grid.indices)
+        {
+            soup.push_back(grid.vertices[index]);
+        }
+    }
+
+    static Renderer::Vertex MakeVertex(float x, float y, float z, float r = 1.0f)
+    {
+        Renderer::Vertex v;
+        v.position = Math::Vector3(x, y, z);
+        v.color = {r, 1.0f, 1.0f, 1.0f};
+        return v;
+    }
+
+    Renderer::Mesh grid;
+    std::vector<Renderer::Vertex> soup;
+};
+
+TEST_F(VertexWelderTest, WeldsTriangleSoup)
+{
+    Renderer::Mesh welded = VertexWelder::Weld(soup);
+
+    EXPECT_EQ(welded.vertices.size(), grid.vertices.size());
+    ASSERT_EQ(welded.indices.size(), soup.size());
+
+    for (size_t i = 0; i < soup.size(); ++i)
+    {
+        EXPECT_EQ(welded.vertices[welded.indices[i]].position, soup[i].position);
+    }
+}
+
+TEST_F(VertexWelderTest, RemapKeepsFirstOccurrenceOrder)
+{
+    std::vector<Renderer::Vertex> vertices = {MakeVertex(0, 0, 0), MakeVertex(1, 0, 0), MakeVertex(0, 0, 0), MakeVertex(2, 0, 0), MakeVertex(1, 0, 0)};
+    std::vector<uint32_t> remap;
+    uint32_t unique = VertexWelder::GenerateRemap(vertices, remap);
+
+    EXPECT_EQ(unique, 3u);
+    EXPECT_EQ(remap, (std::vector<uint32_t>{0, 1, 0, 2, 1}));
+}
+
+TEST_F(VertexWelderTest, ColorSeparatesVertices)
+{
+    std::vector<Renderer::Vertex> vertices = {MakeVertex(0, 0, 0, 1.0f), MakeVertex(0, 0, 0, 0.5f)};
+    std::vector<uint32_t> remap;
+    EXPECT_EQ(VertexWelder::GenerateRemap(vertices, remap), 2u);
+
+    WeldOptions positionOnly;
+    positionOnly.positionOnly = true;
+    EXPECT_EQ(VertexWelder::GenerateRemap(vertices, remap, positionOnly), 1u);
+}
+
+TEST_F(VertexWelderTest, NegativeZeroMatchesZero)
+{
+    std::vector<Renderer::Vertex> vertices = {MakeVertex(0.0f, 0.0f, 0.0f), MakeVertex(-0.0f, 0.0f, -0.0f)};
+    std::vector<uint32_t> remap;
+    EXPECT_EQ(VertexWelder::GenerateRemap(vertices, remap), 1u);
+}
+
+TEST_F(VertexWelderTest, EpsilonMergesJitteredVertices)
+{
+    std::vector<Renderer::Vertex> jittered = soup;
+    for (size_t i = 0; i < jittered.size(); ++i)
+    {
+        jittered[i].position.x += (i % 2 ? 1e-5f : -1e-5f);
+    }
+
+    EXPECT_GT(VertexWelder::Weld(jittered).vertices.size(), grid.vertices.size());
+
+    WeldOptions options;
+    options.positionEpsilon = 1e-3f;
+    EXPECT_EQ(VertexWelder::Weld(jittered, options).vertices.size(), grid.vertices.size());
+}
+
+TEST_F(VertexWelderTest, EpsilonSaturatesOutOfRangeValues)
+{
+    // Past 2^31 cells every value shares the outermost cell; NaN sits with -inf
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float infinity = std::numeric_limits<float>::infinity();
+    std::vector<Renderer::Vertex> vertices;
+    for (float x : {3e9f, 1e30f, infinity, -1e30f, nan, 0.25f})
+    {
+        vertices.push_back(MakeVertex(x, 0, 0));
+    }
+    WeldOptions options;
+    options.positionEpsilon = 1e-3f;
+    std::vector<uint32_t> remap;
+
+    EXPECT_EQ(VertexWelder::GenerateRemap(vertices, remap, options), 3u);
+    EXPECT_EQ(remap, (std::vector<uint32_t>{0, 0, 0, 1, 1, 2}));
+}
+
+TEST_F(VertexWelderTest, WeldsIndexedMesh)
+{
+    // Duplicate every vertex and point the second half of the indices at the copies
+    Renderer::Mesh doubled = grid;
+    const uint32_t originalCount = static_cast<uint32_t>(grid.vertices.size());
+    doubled.vertices.insert(doubled.vertices.end(), grid.vertices.begin(), grid.vertices.end());
+    for (size_t i = doubled.indices.size() / 2; i < doubled.indices.size(); ++i)
+    {
+        doubled.indices[i] += originalCount;
+    }
+
+    Renderer::Mesh welded = VertexWelder::Weld(doubled);
+    EXPECT_EQ(welded.vertices.size(), grid.vertices.size());
+    EXPECT_EQ(welded.indices, grid.indices);
+}
+
+TEST_F(VertexWelderTest, EmptyInput)
+{
+    Renderer::Mesh welded = VertexWelder::Weld(std::vector<Renderer::Vertex>());
+    EXPECT_TRUE(welded.vertices.empty());
+    EXPECT_TRUE(welded.indices.empty());
+}
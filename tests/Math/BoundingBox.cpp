@@ -0,0 +1,90 @@
+#include "Math/BoundingBox.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+
+using namespace Math;
+
+class BoundingBoxTest : public ::testing::Test
+{
+  protected:
+    BoundingBox unit = BoundingBox(Vector3(0.0f, 0.0f, 0.0f), Vector3(1.0f, 1.0f, 1.0f));
+    const float EPSILON = 1e-6f;
+};
+
+TEST_F(BoundingBoxTest, DefaultIsEmptyAndExpands)
+{
+    BoundingBox box;
+    EXPECT_TRUE(box.IsEmpty());
+    EXPECT_EQ(box.GetSurfaceArea(), 0.0f);
+
+    box.Expand(Vector3(1.0f, 2.0f, 3.0f));
+    EXPECT_FALSE(box.IsEmpty());
+    EXPECT_EQ(box.min, Vector3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(box.max, Vector3(1.0f, 2.0f, 3.0f));
+
+    box.Expand(Vector3(-1.0f, 4.0f, 0.0f));
+    EXPECT_EQ(box.min, Vector3(-1.0f, 2.0f, 0.0f));
+    EXPECT_EQ(box.max, Vector3(1.0f, 4.0f, 3.0f));
+}
+
+TEST_F(BoundingBoxTest, UnionWithEmptyIsIdentity)
+{
+    EXPECT_EQ(BoundingBox::Union(unit, BoundingBox()).min, unit.min);
+    EXPECT_EQ(BoundingBox::Union(BoundingBox(), unit).max, unit.max);
+
+    const BoundingBox other(Vector3(2.0f, -1.0f, 0.5f), Vector3(3.0f, 0.0f, 0.5f));
+    const BoundingBox both = BoundingBox::Union(unit, other);
+    EXPECT_EQ(both.min, Vector3(0.0f, -1.0f, 0.0f));
+    EXPECT_EQ(both.max, Vector3(3.0f, 1.0f, 1.0f));
+}
+
+TEST_F(BoundingBoxTest, CenterExtentsAndArea)
+{
+    const BoundingBox box = BoundingBox::FromCenterExtents(Vector3(1.0f, 2.0f, 3.0f), Vector3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(box.min, Vector3::Zero());
+    EXPECT_EQ(box.GetCenter(), Vector3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(box.GetSize(), Vector3(2.0f, 4.0f, 6.0f));
+    EXPECT_NEAR(box.GetSurfaceArea(), 2.0f * (8.0f + 24.0f + 12.0f), EPSILON);
+}
+
+TEST_F(BoundingBoxTest, ContainmentAndOverlap)
+{
+    EXPECT_TRUE(unit.Contains(Vector3(0.5f, 0.5f, 0.5f)));
+    EXPECT_TRUE(unit.Contains(Vector3(1.0f, 0.0f, 1.0f)));
+    EXPECT_FALSE(unit.Contains(Vector3(1.1f, 0.5f, 0.5f)));
+
+    EXPECT_TRUE(unit.Contains(BoundingBox(Vector3(0.2f, 0.2f, 0.2f), Vector3(0.8f, 0.8f, 0.8f))));
+    EXPECT_FALSE(unit.Contains(BoundingBox(Vector3(0.2f, 0.2f, 0.2f), Vector3(1.8f, 0.8f, 0.8f))));
+
+    EXPECT_TRUE(unit.Intersects(BoundingBox(Vector3(1.0f, 1.0f, 1.0f), Vector3(2.0f, 2.0f, 2.0f)))); // Touching
+    EXPECT_FALSE(unit.Intersects(BoundingBox(Vector3(1.5f, 0.0f, 0.0f), Vector3(2.0f, 1.0f, 1.0f))));
+
+    EXPECT_TRUE(unit.IntersectsSphere(Vector3(2.0f, 0.5f, 0.5f), 1.0f));
+    EXPECT_FALSE(unit.IntersectsSphere(Vector3(2.0f, 2.0f, 0.5f), 1.0f));
+    EXPECT_NEAR(unit.DistanceSquared(Vector3(2.0f, 3.0f, 0.5f)), 1.0f + 4.0f, EPSILON);
+    EXPECT_EQ(unit.DistanceSquared(Vector3(0.5f, 0.5f, 0.5f)), 0.0f);
+}
+
+TEST_F(BoundingBoxTest, RaySlabTest)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    float distance = -1.0f;
+
+    // Axis-aligned ray: zero direction components become infinite reciprocals
+    EXPECT_TRUE(unit.IntersectsRay(Vector3(-2.0f, 0.5f, 0.5f), Vector3(1.0f, inf, inf), 100.0f, distance));
+    EXPECT_NEAR(distance, 2.0f, EPSILON);
+
+    EXPECT_FALSE(unit.IntersectsRay(Vector3(-2.0f, 0.5f, 0.5f), Vector3(1.0f, inf, inf), 1.5f, distance));
+    EXPECT_FALSE(unit.IntersectsRay(Vector3(-2.0f, 0.5f, 0.5f), Vector3(-1.0f, inf, inf), 100.0f, distance));
+    EXPECT_FALSE(unit.IntersectsRay(Vector3(-2.0f, 1.5f, 0.5f), Vector3(1.0f, inf, inf), 100.0f, distance));
+
+    // Starting inside reports zero
+    EXPECT_TRUE(unit.IntersectsRay(Vector3(0.5f, 0.5f, 0.5f), Vector3(1.0f, 1.0f, 1.0f), 100.0f, distance));
+    EXPECT_EQ(distance, 0.0f);
+
+    // Diagonal through the corner region
+    const float invSqrt = 1.0f / (1.0f / std::sqrt(3.0f));
+    EXPECT_TRUE(unit.IntersectsRay(Vector3(-1.0f, -1.0f, -1.0f), Vector3(invSqrt, invSqrt, invSqrt), 100.0f, distance));
+    EXPECT_NEAR(distance, std::sqrt(3.0f), 1e-5f);
+}
@@ -0,0 +1,148 @@
+#include "Math/Expression.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Math;
+
+class ExpressionTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Odd length so both the packet loop and the scalar tail run
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            const float f = static_cast<float>(i);
+            ax.push_back(f);
+            ay.push_back(-0.5f * f);
+            az.push_back(1.0f + 0.25f * f);
+            bx.push_back(2.0f - f);
+            by.push_back(0.1f * f * f);
+            bz.push_back(3.0f);
+        }
+    }
+
+    static void ExpectNear(const Vector3& actual, const Vector3& expected, float epsilon = 1e-5f)
+    {
+        EXPECT_NEAR(actual.x, expected.x, epsilon);
+        EXPECT_NEAR(actual.y, expected.y, epsilon);
+        EXPECT_NEAR(actual.z, expected.z, epsilon);
+    }
+
+    static constexpr size_t COUNT = 37;
+    std::vector<float> ax, ay, az, bx, by, bz;
+};
+
+TEST_F(ExpressionTest, VectorExpressionMatchesOperators)
+{
+    const Vector3 a(1.0f, 2.0f, 3.0f);
+    const Vector3 b(-4.0f, 0.5f, 2.0f);
+    const Vector3 c(0.25f, -1.0f, 7.0f);
+    const float s = 1.5f;
+
+    ExpectNear(Evaluate(Lazy(a) + b * s - c), a + b * s - c);
+    ExpectNear(Evaluate(a - Lazy(b) / s), a - b / s);
+    ExpectNear(Evaluate(-(Lazy(a) + c) * 2.0f), -(a + c) * 2.0f);
+    ExpectNear(Evaluate(s * Lazy(a)), a * s);
+}
+
+TEST_F(ExpressionTest, VectorCrossAndDot)
+{
+    const Vector3 a(1.0f, 2.0f, 3.0f);
+    const Vector3 b(-4.0f, 0.5f, 2.0f);
+
+    ExpectNear(Evaluate(Cross(Lazy(a), b)), Vector3::Cross(a, b));
+    ExpectNear(Evaluate(Cross(Lazy(a) + b, a - Lazy(b))), Vector3::Cross(a + b, a - b));
+    EXPECT_FLOAT_EQ(Dot(Lazy(a) * 2.0f, b), Vector3::Dot(a * 2.0f, b));
+}
+
+TEST_F(ExpressionTest, ExpressionsOutliveTemporaries)
+{
+    // Operands are copied into the expression, so this must not dangle
+    auto expression = Lazy(Vector3(1.0f, 2.0f, 3.0f)) + Vector3(1.0f, 1.0f, 1.0f);
+    ExpectNear(Evaluate(expression), Vector3(2.0f, 3.0f, 4.0f));
+}
+
+TEST_F(ExpressionTest, ScalarStreamAssign)
+{
+    std::vector<float> out(COUNT);
+    Assign(out.data(), COUNT, Stream(ax.data()) * 2.0f + Stream(bx.data()) / 4.0f - 1.0f);
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        EXPECT_FLOAT_EQ(out[i], ax[i] * 2.0f + bx[i] / 4.0f - 1.0f);
+    }
+}
+
+TEST_F(ExpressionTest, ScalarStreamFunctions)
+{
+    std::vector<float> out(COUNT);
+    Assign(out.data(), COUNT, Sqrt(Max(Stream(ax.data()), 4.0f)) + Min(-Stream(ay.data()), Stream(az.data())));
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        EXPECT_FLOAT_EQ(out[i], std::sqrt(std::max(ax[i], 4.0f)) + std::min(-ay[i], az[i]));
+    }
+}
+
+TEST_F(ExpressionTest, Vector3StreamMatchesVector3)
+{
+    std::vector<float> x(COUNT), y(COUNT), z(COUNT);
+    const Vector3 offset(0.5f, -1.0f, 2.0f);
+    Assign(x.data(), y.data(), z.data(), COUNT,
+           Streams(ax.data(), ay.data(), az.data()) + Streams(bx.data(), by.data(), bz.data()) * 0.5f - Splat(offset));
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        const Vector3 a(ax[i], ay[i], az[i]);
+        const Vector3 b(bx[i], by[i], bz[i]);
+        ExpectNear(Vector3(x[i], y[i], z[i]), a + b * 0.5f - offset);
+    }
+}
+
+TEST_F(ExpressionTest, Vector3StreamCrossDotAndMagnitude)
+{
+    auto a = Streams(ax.data(), ay.data(), az.data());
+    auto b = Streams(bx.data(), by.data(), bz.data());
+
+    std::vector<float> x(COUNT), y(COUNT), z(COUNT), dot(COUNT), length(COUNT);
+    Assign(x.data(), y.data(), z.data(), COUNT, Cross(a, b));
+    Assign(dot.data(), COUNT, Dot(a, b));
+    Assign(length.data(), COUNT, Magnitude(a - b));
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        const Vector3 va(ax[i], ay[i], az[i]);
+        const Vector3 vb(bx[i], by[i], bz[i]);
+        const Vector3 cross = Vector3::Cross(va, vb);
+        EXPECT_NEAR(x[i], cross.x, 1e-3f);
+        EXPECT_NEAR(y[i], cross.y, 1e-3f);
+        EXPECT_NEAR(z[i], cross.z, 1e-3f);
+        EXPECT_NEAR(dot[i], Vector3::Dot(va, vb), 1e-3f);
+        EXPECT_NEAR(length[i], (va - vb).Magnitude(), 1e-3f);
+    }
+}
+
+TEST_F(ExpressionTest, Vector3StreamAssignMayAliasInputs)
+{
+    // Cross reads every component, so in-place evaluation must not clobber
+    // an element before all of its outputs are computed
+    std::vector<float> x = ax, y = ay, z = az;
+    Assign(x.data(), y.data(), z.data(), COUNT,
+           Cross(Streams(x.data(), y.data(), z.data()), Streams(bx.data(), by.data(), bz.data())));
+
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        const Vector3 cross = Vector3::Cross(Vector3(ax[i], ay[i], az[i]), Vector3(bx[i], by[i], bz[i]));
+        EXPECT_NEAR(x[i], cross.x, 1e-3f);
+        EXPECT_NEAR(y[i], cross.y, 1e-3f);
+        EXPECT_NEAR(z[i], cross.z, 1e-3f);
+    }
+}
+
+TEST_F(ExpressionTest, EmptyAssignWritesNothing)
+{
+    float sentinel = 42.0f;
+    Assign(&sentinel, 0, Stream(ax.data()) + 1.0f);
+    EXPECT_EQ(sentinel, 42.0f);
+}
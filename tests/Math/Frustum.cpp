@@ -0,0 +1,81 @@
+#include "Math/Frustum.h"
+#include <gtest/gtest.h>
+
+using namespace Math;
+
+class FrustumTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        // Camera at origin looking down +Z with a 90 degree square view
+        frustum = Frustum::FromPerspective(Vector3::Zero(), Vector3::Forward(), Vector3::Up(),
+                                           1.5707964f, 1.0f, 0.1f, 100.0f);
+    }
+
+    Frustum frustum;
+    const float EPSILON = 1e-5f;
+};
+
+// Plane Tests
+TEST_F(FrustumTest, PlaneFromPointNormal)
+{
+    Plane plane = Plane::FromPointNormal(Vector3(0.0f, 2.0f, 0.0f), Vector3(0.0f, 3.0f, 0.0f));
+    EXPECT_NEAR(plane.normal.y, 1.0f, EPSILON);
+    EXPECT_NEAR(plane.distance, -2.0f, EPSILON);
+    EXPECT_NEAR(plane.GetSignedDistance(Vector3(5.0f, 5.0f, 5.0f)), 3.0f, EPSILON);
+    EXPECT_NEAR(plane.GetSignedDistance(Vector3(0.0f, 0.0f, 0.0f)), -2.0f, EPSILON);
+}
+
+// Frustum Tests
+TEST_F(FrustumTest, PlanesFaceInward)
+{
+    Vector3 inside(0.0f, 0.0f, 10.0f);
+    for (const Plane& plane : frustum.planes)
+    {
+        EXPECT_GT(plane.GetSignedDistance(inside), 0.0f);
+    }
+}
+
+TEST_F(FrustumTest, ContainsPoint)
+{
+    EXPECT_TRUE(frustum.ContainsPoint(Vector3(0.0f, 0.0f, 1.0f)));
+    EXPECT_TRUE(frustum.ContainsPoint(Vector3(4.0f, -4.0f, 5.0f)));
+
+    EXPECT_FALSE(frustum.ContainsPoint(Vector3(0.0f, 0.0f, -1.0f))); // Behind the camera
+    EXPECT_FALSE(frustum.ContainsPoint(Vector3(0.0f, 0.0f, 0.05f))); // Before the near plane
+    EXPECT_FALSE(frustum.ContainsPoint(Vector3(0.0f, 0.0f, 200.0f))); // Beyond the far plane
+    EXPECT_FALSE(frustum.ContainsPoint(Vector3(6.0f, 0.0f, 5.0f))); // Right of the view
+    EXPECT_FALSE(frustum.ContainsPoint(Vector3(0.0f, 6.0f, 5.0f))); // Above the view
+}
+
+TEST_F(FrustumTest, IntersectsSphere)
+{
+    EXPECT_TRUE(frustum.IntersectsSphere(Vector3(0.0f, 0.0f, 10.0f), 1.0f));
+    EXPECT_TRUE(frustum.IntersectsSphere(Vector3(0.0f, 0.0f, -0.5f), 1.0f)); // Straddles the camera
+    EXPECT_TRUE(frustum.IntersectsSphere(Vector3(6.0f, 0.0f, 5.0f), 1.0f)); // Touches the right plane
+
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3(0.0f, 0.0f, -5.0f), 1.0f));
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3(20.0f, 0.0f, 5.0f), 1.0f));
+    EXPECT_FALSE(frustum.IntersectsSphere(Vector3(0.0f, 0.0f, 110.0f), 5.0f));
+}
+
+TEST_F(FrustumTest, IntersectsBox)
+{
+    EXPECT_TRUE(frustum.IntersectsBox(BoundingBox(Vector3(-1.0f, -1.0f, 9.0f), Vector3(1.0f, 1.0f, 11.0f))));
+    EXPECT_TRUE(frustum.IntersectsBox(BoundingBox(Vector3(5.5f, -1.0f, 4.0f), Vector3(7.0f, 1.0f, 6.0f)))); // Crosses the right plane
+    EXPECT_TRUE(frustum.IntersectsBox(BoundingBox(Vector3(-500.0f, -500.0f, -500.0f), Vector3(500.0f, 500.0f, 500.0f))));
+
+    EXPECT_FALSE(frustum.IntersectsBox(BoundingBox(Vector3(-1.0f, -1.0f, -6.0f), Vector3(1.0f, 1.0f, -4.0f))));
+    EXPECT_FALSE(frustum.IntersectsBox(BoundingBox(Vector3(19.0f, -1.0f, 4.0f), Vector3(21.0f, 1.0f, 6.0f))));
+    EXPECT_FALSE(frustum.IntersectsBox(BoundingBox(Vector3(-1.0f, -1.0f, 101.0f), Vector3(1.0f, 1.0f, 103.0f))));
+}
+
+TEST_F(FrustumTest, LeftHandedOrientation)
+{
+    // With +Y up and +Z forward, +X is to the right
+    Frustum narrow = Frustum::FromPerspective(Vector3::Zero(), Vector3::Forward(), Vector3::Up(),
+                                              0.5f, 1.0f, 0.1f, 100.0f);
+    EXPECT_LT(narrow.planes[Frustum::Right].GetSignedDistance(Vector3(10.0f, 0.0f, 5.0f)), 0.0f);
+    EXPECT_LT(narrow.planes[Frustum::Left].GetSignedDistance(Vector3(-10.0f, 0.0f, 5.0f)), 0.0f);
+}
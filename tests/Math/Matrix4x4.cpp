@@ -0,0 +1,111 @@
+#include "Math/Matrix4x4.h"
+#include <cmath>
+#include <gtest/gtest.h>
+
+using namespace Math;
+
+class Matrix4x4Test : public ::testing::Test
+{
+  protected:
+    static void ExpectNear(const Vector3& actual, const Vector3& expected, float epsilon = 1e-5f)
+    {
+        EXPECT_NEAR(actual.x, expected.x, epsilon);
+        EXPECT_NEAR(actual.y, expected.y, epsilon);
+        EXPECT_NEAR(actual.z, expected.z, epsilon);
+    }
+
+    static void ExpectNear(const Matrix4x4& actual, const Matrix4x4& expected, float epsilon = 1e-5f)
+    {
+        for (int row = 0; row < 4; ++row)
+        {
+            for (int column = 0; column < 4; ++column)
+            {
+                EXPECT_NEAR(actual.m[row][column], expected.m[row][column], epsilon) << row << "," << column;
+            }
+        }
+    }
+
+    const float HALF_PI = 1.57079632679f;
+};
+
+TEST_F(Matrix4x4Test, DefaultIsIdentity)
+{
+    Matrix4x4 matrix;
+    EXPECT_EQ(matrix, Matrix4x4::Identity());
+    ExpectNear(matrix.TransformPoint(Vector3(1.0f, 2.0f, 3.0f)), Vector3(1.0f, 2.0f, 3.0f));
+}
+
+TEST_F(Matrix4x4Test, TranslationMovesPointsNotVectors)
+{
+    Matrix4x4 translation = Matrix4x4::Translation(Vector3(1.0f, -2.0f, 3.0f));
+    ExpectNear(translation.TransformPoint(Vector3(1.0f, 1.0f, 1.0f)), Vector3(2.0f, -1.0f, 4.0f));
+    ExpectNear(translation.TransformVector(Vector3(1.0f, 1.0f, 1.0f)), Vector3(1.0f, 1.0f, 1.0f));
+}
+
+TEST_F(Matrix4x4Test, MultiplicationAppliesLeftFirst)
+{
+    // Scale, then translate: the translation must not be scaled
+    Matrix4x4 combined = Matrix4x4::Scale(Vector3(2.0f, 2.0f, 2.0f)) * Matrix4x4::Translation(Vector3(1.0f, 0.0f, 0.0f));
+    ExpectNear(combined.TransformPoint(Vector3(1.0f, 1.0f, 1.0f)), Vector3(3.0f, 2.0f, 2.0f));
+}
+
+TEST_F(Matrix4x4Test, AxisRotations)
+{
+    ExpectNear(Matrix4x4::RotationX(HALF_PI).TransformVector(Vector3(0.0f, 1.0f, 0.0f)), Vector3(0.0f, 0.0f, 1.0f));
+    ExpectNear(Matrix4x4::RotationY(HALF_PI).TransformVector(Vector3(0.0f, 0.0f, 1.0f)), Vector3(1.0f, 0.0f, 0.0f));
+    ExpectNear(Matrix4x4::RotationZ(HALF_PI).TransformVector(Vector3(1.0f, 0.0f, 0.0f)), Vector3(0.0f, 1.0f, 0.0f));
+}
+
+TEST_F(Matrix4x4Test, RotationAxisMatchesAxisRotationsAndVector3)
+{
+    ExpectNear(Matrix4x4::RotationAxis(Vector3(1.0f, 0.0f, 0.0f), 0.7f), Matrix4x4::RotationX(0.7f));
+    ExpectNear(Matrix4x4::RotationAxis(Vector3(0.0f, 1.0f, 0.0f), 0.7f), Matrix4x4::RotationY(0.7f));
+    ExpectNear(Matrix4x4::RotationAxis(Vector3(0.0f, 0.0f, 1.0f), 0.7f), Matrix4x4::RotationZ(0.7f));
+
+    const Vector3 axis = Vector3(1.0f, 2.0f, -1.0f).Normalized();
+    const Vector3 v(0.3f, -1.2f, 2.0f);
+    ExpectNear(Matrix4x4::RotationAxis(axis, 1.1f).TransformVector(v), Vector3::RotateAroundAxis(v, axis, 1.1f));
+}
+
+TEST_F(Matrix4x4Test, Transposed)
+{
+    Matrix4x4 matrix(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+    Matrix4x4 transposed = matrix.Transposed();
+    EXPECT_EQ(transposed.m[0][3], 13.0f);
+    EXPECT_EQ(transposed.m[3][0], 4.0f);
+    EXPECT_EQ(transposed.Transposed(), matrix);
+}
+
+TEST_F(Matrix4x4Test, Determinant)
+{
+    EXPECT_FLOAT_EQ(Matrix4x4::Identity().Determinant(), 1.0f);
+    EXPECT_FLOAT_EQ(Matrix4x4::Scale(Vector3(2.0f, 3.0f, 4.0f)).Determinant(), 24.0f);
+    EXPECT_NEAR(Matrix4x4::RotationAxis(Vector3(0.0f, 0.6f, 0.8f), 2.0f).Determinant(), 1.0f, 1e-5f);
+
+    Matrix4x4 singular(1, 2, 3, 4, 2, 4, 6, 8, 0, 1, 0, 0, 0, 0, 1, 0);
+    EXPECT_FLOAT_EQ(singular.Determinant(), 0.0f);
+}
+
+TEST_F(Matrix4x4Test, InverseUndoesTransform)
+{
+    Matrix4x4 transform = Matrix4x4::Scale(Vector3(2.0f, 0.5f, 3.0f)) * Matrix4x4::RotationAxis(Vector3(0.0f, 0.6f, 0.8f), 0.9f) *
+                          Matrix4x4::Translation(Vector3(4.0f, -1.0f, 2.0f));
+    ExpectNear(transform * transform.Inverse(), Matrix4x4::Identity());
+    ExpectNear(transform.Inverse() * transform, Matrix4x4::Identity());
+
+    const Vector3 point(1.0f, 2.0f, 3.0f);
+    ExpectNear(transform.Inverse().TransformPoint(transform.TransformPoint(point)), point);
+}
+
+TEST_F(Matrix4x4Test, InverseOfSingularIsIdentity)
+{
+    Matrix4x4 singular = Matrix4x4::Scale(Vector3(1.0f, 0.0f, 1.0f));
+    EXPECT_EQ(singular.Inverse(), Matrix4x4::Identity());
+}
+
+TEST_F(Matrix4x4Test, ScalarAndAddition)
+{
+    Matrix4x4 blended = Matrix4x4::Translation(Vector3(2.0f, 0.0f, 0.0f)) * 0.5f + Matrix4x4::Identity() * 0.5f;
+    ExpectNear(blended.TransformPoint(Vector3::Zero()), Vector3(1.0f, 0.0f, 0.0f));
+    EXPECT_FLOAT_EQ(blended.m[3][3], 1.0f);
+}
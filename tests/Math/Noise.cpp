@@ -0,0 +1,198 @@
+#include "Math/Noise.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace Math;
+
+class NoiseTest : public ::testing::Test
+{
+  protected:
+    static constexpr size_t COUNT = 10003; // Not a multiple of the batch size
+    // The compiler may fuse multiply-adds in one path only, which moves the
+    // skewed offsets of coordinates in the hundreds by an ulp or so
+    static constexpr float TOLERANCE = 1e-3f;
+
+    void SetUp() override
+    {
+        std::mt19937 rng(11);
+        std::uniform_real_distribution<float> coordinate(-300.0f, 300.0f);
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            points2.emplace_back(coordinate(rng), coordinate(rng));
+            points3.emplace_back(coordinate(rng), coordinate(rng), coordinate(rng));
+            points4.push_back(Float4(coordinate(rng), coordinate(rng), coordinate(rng), coordinate(rng)));
+        }
+    }
+
+    std::vector<Vector2> points2;
+    std::vector<Vector3> points3;
+    std::vector<Float4> points4;
+    std::vector<float> values = std::vector<float>(COUNT);
+};
+
+TEST_F(NoiseTest, DeterministicAndSeeded)
+{
+    for (NoiseType type : {NoiseType::Perlin, NoiseType::Simplex})
+    {
+        size_t differences = 0;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            const Vector3& p = points3[i];
+            const float value = type == NoiseType::Perlin ? Noise::Perlin(p.x, p.y, p.z, 1u) : Noise::Simplex(p.x, p.y, p.z, 1u);
+            const float again = type == NoiseType::Perlin ? Noise::Perlin(p.x, p.y, p.z, 1u) : Noise::Simplex(p.x, p.y, p.z, 1u);
+            const float reseeded = type == NoiseType::Perlin ? Noise::Perlin(p.x, p.y, p.z, 2u) : Noise::Simplex(p.x, p.y, p.z, 2u);
+            EXPECT_EQ(value, again);
+            differences += value != reseeded;
+        }
+        EXPECT_GT(differences, 90u);
+    }
+}
+
+TEST_F(NoiseTest, ValuesStayInRange)
+{
+    float extreme[6] = {};
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        const Vector2& a = points2[i];
+        const Vector3& b = points3[i];
+        const Float4& c = points4[i];
+        const float samples[6] = {Noise::Perlin(a.x, a.y),         Noise::Perlin(b.x, b.y, b.z),
+                                  Noise::Perlin(c.x, c.y, c.z, c.w), Noise::Simplex(a.x, a.y),
+                                  Noise::Simplex(b.x, b.y, b.z),     Noise::Simplex(c.x, c.y, c.z, c.w)};
+        for (int k = 0; k < 6; ++k)
+        {
+            ASSERT_LE(std::fabs(samples[k]), 1.0f);
+            extreme[k] = std::max(extreme[k], std::fabs(samples[k]));
+        }
+    }
+
+    // The scales use most of the range
+    for (float value : extreme)
+    {
+        EXPECT_GT(value, 0.6f);
+    }
+}
+
+TEST_F(NoiseTest, PerlinVanishesOnTheLattice)
+{
+    for (int i = -5; i <= 5; ++i)
+    {
+        const float x = static_cast<float>(i), y = static_cast<float>(i * 7 - 3), z = static_cast<float>(i * i);
+        EXPECT_EQ(Noise::Perlin(x, y), 0.0f);
+        EXPECT_EQ(Noise::Perlin(x, y, z), 0.0f);
+        EXPECT_EQ(Noise::Perlin(x, y, z, -x), 0.0f);
+    }
+}
+
+TEST_F(NoiseTest, Continuous)
+{
+    const float step = 1e-3f;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        const Float4& p = points4[i];
+        EXPECT_NEAR(Noise::Perlin(p.x, p.y), Noise::Perlin(p.x + step, p.y), 0.01f);
+        EXPECT_NEAR(Noise::Perlin(p.x, p.y, p.z), Noise::Perlin(p.x, p.y + step, p.z), 0.01f);
+        EXPECT_NEAR(Noise::Perlin(p.x, p.y, p.z, p.w), Noise::Perlin(p.x, p.y, p.z, p.w + step), 0.01f);
+        EXPECT_NEAR(Noise::Simplex(p.x, p.y), Noise::Simplex(p.x + step, p.y), 0.01f);
+        EXPECT_NEAR(Noise::Simplex(p.x, p.y, p.z), Noise::Simplex(p.x, p.y + step, p.z), 0.01f);
+        EXPECT_NEAR(Noise::Simplex(p.x, p.y, p.z, p.w), Noise::Simplex(p.x, p.y, p.z, p.w + step), 0.01f);
+    }
+}
+
+TEST_F(NoiseTest, BatchesMatchTheReference)
+{
+    const uint32_t seed = 5;
+    for (NoiseType type : {NoiseType::Perlin, NoiseType::Simplex})
+    {
+        const bool perlin = type == NoiseType::Perlin;
+
+        Noise::Evaluate(type, points2.data(), COUNT, values.data(), seed);
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            const Vector2& p = points2[i];
+            ASSERT_NEAR(values[i], perlin ? Noise::Perlin(p.x, p.y, seed) : Noise::Simplex(p.x, p.y, seed), TOLERANCE);
+        }
+
+        Noise::Evaluate(type, points3.data(), COUNT, values.data(), seed);
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            const Vector3& p = points3[i];
+            ASSERT_NEAR(values[i], perlin ? Noise::Perlin(p.x, p.y, p.z, seed) : Noise::Simplex(p.x, p.y, p.z, seed),
+                        TOLERANCE);
+        }
+
+        Noise::Evaluate(type, points4.data(), COUNT, values.data(), seed);
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            const Float4& p = points4[i];
+            ASSERT_NEAR(values[i],
+                        perlin ? Noise::Perlin(p.x, p.y, p.z, p.w, seed) : Noise::Simplex(p.x, p.y, p.z, p.w, seed),
+                        TOLERANCE);
+        }
+    }
+
+    // Short batches only write their own outputs
+    values.assign(COUNT, 7.0f);
+    Noise::Evaluate(NoiseType::Simplex, points2.data(), 3, values.data());
+    EXPECT_NEAR(values[2], Noise::Simplex(points2[2].x, points2[2].y), TOLERANCE);
+    EXPECT_EQ(values[3], 7.0f);
+}
+
+TEST_F(NoiseTest, FractalIsNormalized)
+{
+    FractalSettings settings;
+    settings.octaves = 6;
+    settings.frequency = 0.05f;
+    settings.seed = 3;
+
+    for (NoiseType type : {NoiseType::Perlin, NoiseType::Simplex})
+    {
+        settings.type = type;
+        Noise::Fractal(settings, points2.data(), COUNT, values.data());
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            const Vector2& p = points2[i];
+            ASSERT_LE(std::fabs(values[i]), 1.0f);
+            ASSERT_NEAR(values[i], Noise::Fractal(settings, p.x, p.y), TOLERANCE);
+        }
+
+        Noise::Fractal(settings, points3.data(), COUNT, values.data());
+        for (size_t i = 0; i < COUNT; ++i)
+        {
+            const Vector3& p = points3[i];
+            ASSERT_NEAR(values[i], Noise::Fractal(settings, p.x, p.y, p.z), TOLERANCE);
+        }
+    }
+
+    // One octave is plain noise at the base frequency
+    settings.octaves = 1;
+    settings.type = NoiseType::Perlin;
+    EXPECT_EQ(Noise::Fractal(settings, 10.3f, -4.1f), Noise::Perlin(10.3f * 0.05f, -4.1f * 0.05f, 3u));
+}
+
+TEST_F(NoiseTest, ImageMatchesFractal)
+{
+    FractalSettings settings;
+    settings.octaves = 4;
+    settings.frequency = 0.02f;
+
+    // Neither side is a multiple of the tile or batch size
+    const size_t width = Noise::TILE_SIZE * 2 + 13;
+    const size_t height = Noise::TILE_SIZE + 5;
+    const Vector2 origin(-37.5f, 12.25f);
+    const float spacing = 0.75f;
+    std::vector<float> pixels(width * height, 9.0f);
+    Noise::GenerateImage(settings, origin, spacing, width, height, pixels.data());
+
+    for (size_t y = 0; y < height; ++y)
+    {
+        for (size_t x = 0; x < width; ++x)
+        {
+            const float expected = Noise::Fractal(settings, origin.x + static_cast<float>(x) * spacing,
+                                                  origin.y + static_cast<float>(y) * spacing);
+            ASSERT_NEAR(pixels[y * width + x], expected, TOLERANCE) << x << ", " << y;
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#include "Math/Quaternion.h"
+#include <cmath>
+#include <gtest/gtest.h>
+
+using namespace Math;
+
+class QuaternionTest : public ::testing::Test
+{
+  protected:
+    static void ExpectNear(const Vector3& actual, const Vector3& expected, float epsilon = 1e-5f)
+    {
+        EXPECT_NEAR(actual.x, expected.x, epsilon);
+        EXPECT_NEAR(actual.y, expected.y, epsilon);
+        EXPECT_NEAR(actual.z, expected.z, epsilon);
+    }
+
+    static void ExpectNear(const Matrix4x4& actual, const Matrix4x4& expected, float epsilon = 1e-5f)
+    {
+        for (int row = 0; row < 4; ++row)
+        {
+            for (int column = 0; column < 4; ++column)
+            {
+                EXPECT_NEAR(actual.m[row][column], expected.m[row][column], epsilon) << row << "," << column;
+            }
+        }
+    }
+
+    const float HALF_PI = 1.57079632679f;
+};
+
+TEST_F(QuaternionTest, DefaultIsIdentity)
+{
+    Quaternion q;
+    EXPECT_EQ(q, Quaternion::Identity());
+    ExpectNear(q.Rotate(Vector3(1.0f, 2.0f, 3.0f)), Vector3(1.0f, 2.0f, 3.0f));
+    ExpectNear(q.ToMatrix(), Matrix4x4::Identity());
+}
+
+TEST_F(QuaternionTest, MatchesMatrixRotations)
+{
+    ExpectNear(Quaternion::FromAxisAngle(Vector3(1.0f, 0.0f, 0.0f), 0.7f).ToMatrix(), Matrix4x4::RotationX(0.7f));
+    ExpectNear(Quaternion::FromAxisAngle(Vector3(0.0f, 1.0f, 0.0f), 0.7f).ToMatrix(), Matrix4x4::RotationY(0.7f));
+    ExpectNear(Quaternion::FromAxisAngle(Vector3(0.0f, 0.0f, 1.0f), 0.7f).ToMatrix(), Matrix4x4::RotationZ(0.7f));
+
+    const Vector3 axis = Vector3(1.0f, 2.0f, -1.0f).Normalized();
+    const Quaternion q = Quaternion::FromAxisAngle(axis, 1.1f);
+    ExpectNear(q.ToMatrix(), Matrix4x4::RotationAxis(axis, 1.1f));
+
+    const Vector3 v(0.3f, -1.2f, 2.0f);
+    ExpectNear(q.Rotate(v), Matrix4x4::RotationAxis(axis, 1.1f).TransformVector(v));
+    ExpectNear(q.Conjugate().Rotate(q.Rotate(v)), v);
+}
+
+TEST_F(QuaternionTest, ProductAppliesRightFirst)
+{
+    const Quaternion aboutX = Quaternion::FromAxisAngle(Vector3(1.0f, 0.0f, 0.0f), HALF_PI);
+    const Quaternion aboutZ = Quaternion::FromAxisAngle(Vector3(0.0f, 0.0f, 1.0f), HALF_PI);
+
+    // X goes to Y under Z, then Y goes to Z under X
+    const Quaternion combined = aboutX * aboutZ;
+    ExpectNear(combined.Rotate(Vector3(1.0f, 0.0f, 0.0f)), Vector3(0.0f, 0.0f, 1.0f));
+    ExpectNear(combined.ToMatrix(), aboutZ.ToMatrix() * aboutX.ToMatrix());
+}
+
+TEST_F(QuaternionTest, NormalizeAndSlerp)
+{
+    Quaternion q(0.0f, 0.0f, 0.0f, 0.0f);
+    q.Normalize();
+    EXPECT_EQ(q, Quaternion::Identity());
+    EXPECT_NEAR(Quaternion(1.0f, 2.0f, 2.0f, 4.0f).Normalized().Magnitude(), 1.0f, 1e-6f);
+
+    const Vector3 axis(0.0f, 1.0f, 0.0f);
+    const Quaternion a = Quaternion::FromAxisAngle(axis, 0.2f);
+    const Quaternion b = Quaternion::FromAxisAngle(axis, 1.4f);
+    ExpectNear(Quaternion::Slerp(a, b, 0.25f).ToMatrix(), Matrix4x4::RotationY(0.5f));
+
+    // The negated end is the same rotation; slerp takes the short way
+    ExpectNear(Quaternion::Slerp(a, b * -1.0f, 0.25f).ToMatrix(), Matrix4x4::RotationY(0.5f));
+}
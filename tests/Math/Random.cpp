@@ -0,0 +1,204 @@
+#include "Math/Random.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Math;
+
+class RandomTest : public ::testing::Test
+{
+  protected:
+    static constexpr size_t COUNT = 100003; // Not a multiple of the lane count
+
+    static double Mean(const std::vector<float>& values)
+    {
+        double sum = 0.0;
+        for (float value : values)
+        {
+            sum += value;
+        }
+        return sum / values.size();
+    }
+
+    static double Variance(const std::vector<float>& values)
+    {
+        const double mean = Mean(values);
+        double sum = 0.0;
+        for (float value : values)
+        {
+            sum += (value - mean) * (value - mean);
+        }
+        return sum / values.size();
+    }
+
+    std::vector<float> x = std::vector<float>(COUNT);
+    std::vector<float> y = std::vector<float>(COUNT);
+    std::vector<float> z = std::vector<float>(COUNT);
+};
+
+TEST_F(RandomTest, StreamsAreDeterministicAndIndependent)
+{
+    RandomStream a(42), b(42), c(42, 1);
+    uint32_t valuesA[RandomStream::LANES], valuesB[RandomStream::LANES], valuesC[RandomStream::LANES];
+    for (int step = 0; step < 100; ++step)
+    {
+        a.Next8(valuesA);
+        b.Next8(valuesB);
+        c.Next8(valuesC);
+        for (size_t lane = 0; lane < RandomStream::LANES; ++lane)
+        {
+            EXPECT_EQ(valuesA[lane], valuesB[lane]);
+            EXPECT_NE(valuesA[lane], valuesC[lane]);
+        }
+    }
+
+    // Lanes of one stream differ from each other too
+    a.Next8(valuesA);
+    EXPECT_NE(valuesA[0], valuesA[1]);
+}
+
+TEST_F(RandomTest, FloatsUseTheTop24Bits)
+{
+    RandomStream stream(7);
+    RandomStream copy = stream;
+
+    float floats[2 * RandomStream::LANES];
+    uint32_t bits[2 * RandomStream::LANES];
+    stream.NextFloat16(floats);
+    copy.Next8(bits);
+    copy.Next8(bits + RandomStream::LANES);
+    for (size_t i = 0; i < 2 * RandomStream::LANES; ++i)
+    {
+        EXPECT_EQ(floats[i], static_cast<float>(bits[i] >> 8) / 16777216.0f);
+        EXPECT_GE(floats[i], 0.0f);
+        EXPECT_LT(floats[i], 1.0f);
+    }
+}
+
+TEST_F(RandomTest, FillUniformCoversTheRange)
+{
+    RandomStream stream(1);
+    stream.FillUniform(x.data(), COUNT, -2.0f, 6.0f);
+
+    int buckets[8] = {};
+    for (float value : x)
+    {
+        ASSERT_GE(value, -2.0f);
+        ASSERT_LT(value, 6.0f);
+        buckets[static_cast<int>(value + 2.0f)]++;
+    }
+    for (int count : buckets)
+    {
+        EXPECT_NEAR(count, COUNT / 8.0, COUNT * 0.01);
+    }
+    EXPECT_NEAR(Mean(x), 2.0, 0.05);
+    EXPECT_NEAR(Variance(x), 64.0 / 12.0, 0.1);
+}
+
+TEST_F(RandomTest, UniformBoxStaysInside)
+{
+    RandomStream stream(2);
+    const BoundingBox box(Vector3(-1.0f, 10.0f, 0.0f), Vector3(3.0f, 11.0f, 0.5f));
+    Sampling::UniformBox(stream, box, x.data(), y.data(), z.data(), COUNT);
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        ASSERT_TRUE(box.Contains(Vector3(x[i], y[i], z[i])));
+    }
+    EXPECT_NEAR(Mean(x), 1.0, 0.02);
+    EXPECT_NEAR(Mean(y), 10.5, 0.01);
+    EXPECT_NEAR(Mean(z), 0.25, 0.01);
+}
+
+TEST_F(RandomTest, SplitCallsMatchOneCall)
+{
+    constexpr size_t SPLIT = 5 * RandomStream::LANES;
+    const BoundingBox box(Vector3(-1.0f, 10.0f, 0.0f), Vector3(3.0f, 11.0f, 0.5f));
+    RandomStream whole(6);
+    RandomStream parts(6);
+    std::vector<float> splitX(COUNT), splitY(COUNT), splitZ(COUNT);
+
+    Sampling::UniformBox(whole, box, x.data(), y.data(), z.data(), COUNT);
+    Sampling::UniformBox(parts, box, splitX.data(), splitY.data(), splitZ.data(), SPLIT);
+    Sampling::UniformBox(parts, box, splitX.data() + SPLIT, splitY.data() + SPLIT, splitZ.data() + SPLIT,
+                         COUNT - SPLIT);
+    EXPECT_EQ(splitX, x);
+    EXPECT_EQ(splitY, y);
+    EXPECT_EQ(splitZ, z);
+
+    Sampling::OnUnitSphere(whole, x.data(), y.data(), z.data(), COUNT);
+    Sampling::OnUnitSphere(parts, splitX.data(), splitY.data(), splitZ.data(), SPLIT);
+    Sampling::OnUnitSphere(parts, splitX.data() + SPLIT, splitY.data() + SPLIT, splitZ.data() + SPLIT,
+                           COUNT - SPLIT);
+    EXPECT_EQ(splitX, x);
+    EXPECT_EQ(splitZ, z);
+
+    // Gaussian batches are two lanes wide
+    Sampling::Gaussian(whole, x.data(), COUNT);
+    Sampling::Gaussian(parts, splitX.data(), 2 * SPLIT);
+    Sampling::Gaussian(parts, splitX.data() + 2 * SPLIT, COUNT - 2 * SPLIT);
+    EXPECT_EQ(splitX, x);
+}
+
+TEST_F(RandomTest, SphereSamplesAreUniform)
+{
+    RandomStream stream(3);
+    Sampling::OnUnitSphere(stream, x.data(), y.data(), z.data(), COUNT);
+    double meanSquaredZ = 0.0;
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        ASSERT_NEAR(x[i] * x[i] + y[i] * y[i] + z[i] * z[i], 1.0f, 1e-5f);
+        meanSquaredZ += z[i] * z[i];
+    }
+    EXPECT_NEAR(Mean(x), 0.0, 0.01);
+    EXPECT_NEAR(Mean(y), 0.0, 0.01);
+    EXPECT_NEAR(Mean(z), 0.0, 0.01);
+    EXPECT_NEAR(meanSquaredZ / COUNT, 1.0 / 3.0, 0.01);
+
+    // Inside the ball, the volume within half the radius holds one eighth
+    Sampling::InUnitSphere(stream, x.data(), y.data(), z.data(), COUNT);
+    size_t inner = 0;
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        const float lengthSquared = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+        ASSERT_LE(lengthSquared, 1.0f + 1e-5f);
+        inner += lengthSquared < 0.25f;
+    }
+    EXPECT_NEAR(static_cast<double>(inner) / COUNT, 0.125, 0.005);
+    EXPECT_NEAR(Mean(x), 0.0, 0.01);
+}
+
+TEST_F(RandomTest, CosineHemisphereFollowsTheNormal)
+{
+    RandomStream stream(4);
+    const Vector3 normal = Vector3(0.3f, -0.5f, -0.8f).Normalized();
+    Sampling::CosineHemisphere(stream, normal, x.data(), y.data(), z.data(), COUNT);
+
+    // For a cosine-weighted hemisphere E[cos] = 2/3 and E[cos^2] = 1/2
+    double sumCosine = 0.0, sumCosineSquared = 0.0;
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        ASSERT_NEAR(x[i] * x[i] + y[i] * y[i] + z[i] * z[i], 1.0f, 1e-5f);
+        const float cosine = x[i] * normal.x + y[i] * normal.y + z[i] * normal.z;
+        ASSERT_GE(cosine, -1e-5f);
+        sumCosine += cosine;
+        sumCosineSquared += cosine * cosine;
+    }
+    EXPECT_NEAR(sumCosine / COUNT, 2.0 / 3.0, 0.005);
+    EXPECT_NEAR(sumCosineSquared / COUNT, 0.5, 0.005);
+}
+
+TEST_F(RandomTest, GaussianMoments)
+{
+    RandomStream stream(5);
+    Sampling::Gaussian(stream, x.data(), COUNT, 3.0f, 2.0f);
+    EXPECT_NEAR(Mean(x), 3.0, 0.03);
+    EXPECT_NEAR(std::sqrt(Variance(x)), 2.0, 0.03);
+
+    size_t withinOneSigma = 0;
+    for (float value : x)
+    {
+        ASSERT_TRUE(std::isfinite(value));
+        withinOneSigma += std::fabs(value - 3.0f) < 2.0f;
+    }
+    EXPECT_NEAR(static_cast<double>(withinOneSigma) / COUNT, 0.6827, 0.005);
+}
@@ -0,0 +1,195 @@
+#include "Math/Spline.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Math;
+
+class SplineTest : public ::testing::Test
+{
+  protected:
+    static constexpr float TOLERANCE = 1e-4f;
+
+    static void ExpectNear(const Vector3& a, const Vector3& b, float tolerance = TOLERANCE)
+    {
+        EXPECT_NEAR(a.x, b.x, tolerance);
+        EXPECT_NEAR(a.y, b.y, tolerance);
+        EXPECT_NEAR(a.z, b.z, tolerance);
+    }
+
+    // A unit circle in the XZ plane from four Bezier quarter arcs
+    static std::vector<Vector3> BezierCircle(float radius)
+    {
+        const float k = 0.5522847498f * radius;
+        return {Vector3(radius, 0, 0),  Vector3(radius, 0, k),   Vector3(k, 0, radius),   Vector3(0, 0, radius),
+                Vector3(-k, 0, radius), Vector3(-radius, 0, k),  Vector3(-radius, 0, 0),  Vector3(-radius, 0, -k),
+                Vector3(-k, 0, -radius), Vector3(0, 0, -radius), Vector3(k, 0, -radius), Vector3(radius, 0, -k),
+                Vector3(radius, 0, 0)};
+    }
+
+    std::vector<Vector3> points = {Vector3(0, 0, 0), Vector3(1, 2, 0),  Vector3(3, 3, 1),
+                                   Vector3(4, 1, 2), Vector3(6, 0, 2), Vector3(7, 2, -1)};
+};
+
+TEST_F(SplineTest, BuildValidatesCounts)
+{
+    Spline spline;
+    EXPECT_FALSE(spline.Build(SplineType::CatmullRom, points.data(), 3));
+    EXPECT_FALSE(spline.Build(SplineType::Bezier, points.data(), 6));
+    EXPECT_EQ(spline.GetSegmentCount(), 0u);
+    EXPECT_EQ(spline.GetLength(), 0.0f);
+
+    EXPECT_TRUE(spline.Build(SplineType::Bezier, points.data(), 4));
+    EXPECT_EQ(spline.GetSegmentCount(), 1u);
+    EXPECT_TRUE(spline.Build(SplineType::CatmullRom, points));
+    EXPECT_EQ(spline.GetSegmentCount(), 3u);
+    EXPECT_TRUE(spline.Build(SplineType::BSpline, points));
+    EXPECT_EQ(spline.GetSegmentCount(), 3u);
+}
+
+TEST_F(SplineTest, CurveTypesFollowTheirDefinitions)
+{
+    // Catmull-Rom passes through the inner points with central-difference tangents
+    Spline spline;
+    ASSERT_TRUE(spline.Build(SplineType::CatmullRom, points));
+    for (size_t i = 0; i <= spline.GetSegmentCount(); ++i)
+    {
+        const float t = static_cast<float>(i);
+        ExpectNear(spline.Evaluate(t), points[i + 1]);
+        ExpectNear(spline.Tangent(t), (points[i + 2] - points[i]) * 0.5f);
+    }
+
+    // Bezier starts and ends on its end points and matches de Casteljau
+    ASSERT_TRUE(spline.Build(SplineType::Bezier, points.data(), 4));
+    ExpectNear(spline.Evaluate(0.0f), points[0]);
+    ExpectNear(spline.Evaluate(1.0f), points[3]);
+    ExpectNear(spline.Tangent(0.0f), (points[1] - points[0]) * 3.0f);
+    const Vector3 ab = Vector3::Lerp(points[0], points[1], 0.3f), bc = Vector3::Lerp(points[1], points[2], 0.3f),
+                  cd = Vector3::Lerp(points[2], points[3], 0.3f);
+    ExpectNear(spline.Evaluate(0.3f),
+               Vector3::Lerp(Vector3::Lerp(ab, bc, 0.3f), Vector3::Lerp(bc, cd, 0.3f), 0.3f));
+
+    // B-splines start at a weighted average and are continuous in position
+    // and tangent across segments
+    ASSERT_TRUE(spline.Build(SplineType::BSpline, points));
+    ExpectNear(spline.Evaluate(0.0f), (points[0] + points[1] * 4.0f + points[2]) / 6.0f);
+    for (float joint : {1.0f, 2.0f})
+    {
+        ExpectNear(spline.Evaluate(joint - 1e-4f), spline.Evaluate(joint), 1e-3f);
+        ExpectNear(spline.Tangent(joint - 1e-4f), spline.Tangent(joint), 2e-3f);
+    }
+
+    // Parameters are clamped to the curve
+    ExpectNear(spline.Evaluate(-5.0f), spline.Evaluate(0.0f));
+    ExpectNear(spline.Evaluate(50.0f), spline.Evaluate(3.0f));
+}
+
+TEST_F(SplineTest, BatchMatchesSinglePoints)
+{
+    Spline spline;
+    ASSERT_TRUE(spline.Build(SplineType::CatmullRom, points));
+
+    const size_t count = 10007;
+    std::vector<float> parameters(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        parameters[i] = 3.2f * static_cast<float>((i * 7919) % count) / count - 0.1f;
+    }
+    std::vector<Vector3> positions(count), tangents(count);
+    spline.Evaluate(parameters.data(), count, positions.data(), tangents.data());
+    for (size_t i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(positions[i], spline.Evaluate(parameters[i]));
+        ASSERT_EQ(tangents[i], spline.Tangent(parameters[i]));
+    }
+
+    std::vector<Vector3> positionsOnly(count);
+    spline.Evaluate(parameters.data(), count, positionsOnly.data());
+    EXPECT_EQ(positionsOnly, positions);
+}
+
+TEST_F(SplineTest, ArcLengthOfKnownCurves)
+{
+    // Evenly spaced collinear Bezier points move at constant speed
+    Spline spline;
+    const std::vector<Vector3> line = {Vector3(0, 0, 0), Vector3(1, 0, 0), Vector3(2, 0, 0), Vector3(3, 0, 0)};
+    ASSERT_TRUE(spline.Build(SplineType::Bezier, line));
+    EXPECT_NEAR(spline.GetLength(), 3.0f, TOLERANCE);
+    EXPECT_NEAR(spline.GetParameterAtDistance(1.5f), 0.5f, TOLERANCE);
+
+    const float radius = 5.0f;
+    ASSERT_TRUE(spline.Build(SplineType::Bezier, BezierCircle(radius)));
+    EXPECT_NEAR(spline.GetLength(), 2.0f * 3.14159265f * radius, 0.01f);
+    EXPECT_EQ(spline.GetParameterAtDistance(-1.0f), 0.0f);
+    EXPECT_EQ(spline.GetParameterAtDistance(1000.0f), 4.0f);
+}
+
+TEST_F(SplineTest, ConstantSpeedTraversal)
+{
+    // Uneven spacing makes the parameter speed vary by more than 10x
+    Spline spline;
+    const std::vector<Vector3> uneven = {Vector3(-1, 0, 0), Vector3(0, 0, 0),  Vector3(1, 0.5f, 0),
+                                         Vector3(5, 1, 0),  Vector3(6, 4, 2), Vector3(6.5f, 9, 2), Vector3(7, 9, 3)};
+    ASSERT_TRUE(spline.Build(SplineType::CatmullRom, uneven));
+
+    const size_t count = 501;
+    const float length = spline.GetLength();
+    std::vector<float> distances(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        distances[i] = length * static_cast<float>(i) / (count - 1);
+    }
+    std::vector<Vector3> positions(count), tangents(count);
+    spline.EvaluateAtDistances(distances.data(), count, positions.data(), tangents.data());
+
+    ExpectNear(positions.front(), spline.Evaluate(0.0f));
+    ExpectNear(positions.back(), spline.Evaluate(4.0f));
+    const float expectedChord = length / (count - 1);
+    for (size_t i = 1; i < count; ++i)
+    {
+        ASSERT_NEAR(Vector3::Distance(positions[i - 1], positions[i]), expectedChord, expectedChord * 0.01f) << i;
+    }
+
+    // Distances agree with a dense polyline measurement of the curve
+    double measured = 0.0;
+    Vector3 previous = spline.Evaluate(0.0f);
+    const int samples = 100000;
+    for (int i = 1; i <= samples; ++i)
+    {
+        const float t = 4.0f * static_cast<float>(i) / samples;
+        const Vector3 current = spline.Evaluate(t);
+        measured += Vector3::Distance(previous, current);
+        previous = current;
+        if (i % 5000 == 0)
+        {
+            ASSERT_NEAR(spline.GetParameterAtDistance(static_cast<float>(measured)), t, 1e-3f);
+        }
+    }
+    EXPECT_NEAR(length, measured, 1e-3 * measured);
+}
+
+TEST_F(SplineTest, StepperMatchesEvaluation)
+{
+    Spline spline;
+    ASSERT_TRUE(spline.Build(SplineType::BSpline, points));
+
+    const uint32_t steps = 64;
+    SplineStepper stepper(spline, steps);
+    Vector3 position, tangent;
+    size_t produced = 0;
+    while (stepper.Next(position, tangent))
+    {
+        const float t = static_cast<float>(produced) / steps;
+        ExpectNear(position, spline.Evaluate(t));
+        ExpectNear(tangent, spline.Tangent(t));
+        ++produced;
+    }
+    EXPECT_EQ(produced, spline.GetSegmentCount() * steps + 1);
+    EXPECT_EQ(position, spline.Evaluate(3.0f));
+    EXPECT_FALSE(stepper.Next(position));
+
+    // An empty spline produces nothing
+    Spline empty;
+    SplineStepper nothing(empty, steps);
+    EXPECT_FALSE(nothing.Next(position));
+}
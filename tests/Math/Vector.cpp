@@ -0,0 +1,147 @@
+#include "Math/Vector.h"
+#include <gtest/gtest.h>
+#include <unordered_set>
+
+using namespace Math;
+
+// Everything except Magnitude/Normalized must work in constant expressions
+static_assert(Float3(1.0f, 2.0f, 3.0f) + Float3(1.0f, 1.0f, 1.0f) == Float3(2.0f, 3.0f, 4.0f), "constexpr add");
+static_assert(Dot(Float4(1, 2, 3, 4), Float4(1, 1, 1, 1)) == 10.0f, "constexpr float4 dot");
+static_assert(Dot(Double2(3.0, 4.0), Double2(3.0, 4.0)) == 25.0, "constexpr double2 dot");
+static_assert(Cross(Int3(1, 0, 0), Int3(0, 1, 0)) == Int3(0, 0, 1), "constexpr cross");
+static_assert(Min(Int4(1, 5, -3, 7), Int4(2, 4, -4, 7)) == Int4(1, 4, -4, 7), "constexpr int4 min");
+static_assert(FloorDivide(Int2(-1, 17), 16) == Int2(-1, 1), "constexpr floor divide");
+static_assert(Int3::Splat(2) * 3 == Int3(6, 6, 6), "constexpr scalar multiply");
+
+static_assert(sizeof(Float3) == 12, "Float3 is tightly packed");
+static_assert(alignof(Float4) == 16 && alignof(Int4) == 16 && alignof(Double2) == 16, "SIMD shapes are aligned");
+static_assert(sizeof(Vector<float, 6>) == 24, "Larger vectors use an array");
+
+class VectorTest : public ::testing::Test
+{
+  protected:
+    // Opaque at compile time so the run-time (SIMD) paths are exercised
+    template <typename T>
+    static T Runtime(T value)
+    {
+        volatile bool keep = true;
+        return keep ? value : T();
+    }
+};
+
+TEST_F(VectorTest, ConstructionAndAccess)
+{
+    Float4 v(1.0f, 2.0f, 3.0f, 4.0f);
+    EXPECT_EQ(v.x, 1.0f);
+    EXPECT_EQ(v.w, 4.0f);
+    EXPECT_EQ(v[2], 3.0f);
+
+    v[1] = 7.0f;
+    EXPECT_EQ(v.y, 7.0f);
+
+    EXPECT_EQ(Int3(), Int3(0, 0, 0));
+    EXPECT_EQ(Double2::One(), Double2(1.0, 1.0));
+
+    Vector<float, 6> wide = Vector<float, 6>::Splat(2.0f);
+    EXPECT_EQ(Dot(wide, wide), 24.0f);
+}
+
+TEST_F(VectorTest, Float4RuntimeMatchesScalar)
+{
+    const Float4 a = Runtime(Float4(1.0f, -2.0f, 3.5f, 4.0f));
+    const Float4 b = Runtime(Float4(0.5f, 2.0f, -1.0f, 8.0f));
+
+    EXPECT_EQ(a + b, Float4(1.5f, 0.0f, 2.5f, 12.0f));
+    EXPECT_EQ(a - b, Float4(0.5f, -4.0f, 4.5f, -4.0f));
+    EXPECT_EQ(a * b, Float4(0.5f, -4.0f, -3.5f, 32.0f));
+    EXPECT_EQ(a / b, Float4(2.0f, -1.0f, -3.5f, 0.5f));
+    EXPECT_EQ(Min(a, b), Float4(0.5f, -2.0f, -1.0f, 4.0f));
+    EXPECT_EQ(Max(a, b), Float4(1.0f, 2.0f, 3.5f, 8.0f));
+    EXPECT_EQ(Dot(a, b), 0.5f - 4.0f - 3.5f + 32.0f);
+    EXPECT_EQ(-a, Float4(-1.0f, 2.0f, -3.5f, -4.0f));
+    EXPECT_EQ(Abs(a), Float4(1.0f, 2.0f, 3.5f, 4.0f));
+}
+
+TEST_F(VectorTest, Int4RuntimeMatchesScalar)
+{
+    const Int4 a = Runtime(Int4(1, -2, 30, 4));
+    const Int4 b = Runtime(Int4(5, 2, -10, 4));
+
+    EXPECT_EQ(a + b, Int4(6, 0, 20, 8));
+    EXPECT_EQ(a - b, Int4(-4, -4, 40, 0));
+    EXPECT_EQ(a * b, Int4(5, -4, -300, 16));
+    EXPECT_EQ(a / b, Int4(0, -1, -3, 1));
+    EXPECT_EQ(Min(a, b), Int4(1, -2, -10, 4));
+    EXPECT_EQ(Max(a, b), Int4(5, 2, 30, 4));
+    EXPECT_EQ(Dot(a, b), 5 - 4 - 300 + 16);
+}
+
+TEST_F(VectorTest, Double2RuntimeMatchesScalar)
+{
+    const Double2 a = Runtime(Double2(1e10, -2.0));
+    const Double2 b = Runtime(Double2(0.5, 4.0));
+
+    EXPECT_EQ(a + b, Double2(1e10 + 0.5, 2.0));
+    EXPECT_EQ(a * b, Double2(5e9, -8.0));
+    EXPECT_EQ(Min(a, b), Double2(0.5, -2.0));
+    EXPECT_EQ(Dot(a, b), 5e9 - 8.0);
+}
+
+TEST_F(VectorTest, CompoundAssignment)
+{
+    Float3 v(1.0f, 2.0f, 3.0f);
+    v += Float3(1.0f, 1.0f, 1.0f);
+    v *= 2.0f;
+    v -= Float3(0.0f, 2.0f, 4.0f);
+    v /= 2.0f;
+    EXPECT_EQ(v, Float3(2.0f, 2.0f, 2.0f));
+}
+
+TEST_F(VectorTest, MagnitudeAndNormalized)
+{
+    const Double3 v(3.0, 0.0, 4.0);
+    EXPECT_DOUBLE_EQ(Magnitude(v), 5.0);
+    EXPECT_DOUBLE_EQ(Magnitude(Normalized(v)), 1.0);
+    EXPECT_EQ(Normalized(Float3()), Float3());
+}
+
+TEST_F(VectorTest, GridCoordinates)
+{
+    EXPECT_EQ(FloorToInt(Float2(-0.5f, 2.99f)), Int2(-1, 2));
+    EXPECT_EQ(FloorToInt(Double3(-3.0, 0.0, 1e9)), Int3(-3, 0, 1000000000));
+
+    EXPECT_EQ(FloorDivide(Int2(-17, -16), 16), Int2(-2, -1));
+    EXPECT_EQ(FloorDivide(Int2(15, 16), 16), Int2(0, 1));
+
+    std::unordered_set<Int3> cells = {Int3(0, 0, 0), Int3(1, 0, 0), Int3(0, 0, 0)};
+    EXPECT_EQ(cells.size(), 2u);
+    EXPECT_EQ(cells.count(Int3(1, 0, 0)), 1u);
+}
+
+TEST_F(VectorTest, ConversionsBetweenTypes)
+{
+    EXPECT_EQ(Int3(Float3(1.9f, -1.9f, 0.0f)), Int3(1, -1, 0));
+    EXPECT_EQ(Double2(Float2(0.5f, 2.0f)), Double2(0.5, 2.0));
+
+    const Vector3 v(1.0f, 2.0f, 3.0f);
+    EXPECT_EQ(ToVector3(ToFloat3(v)), v);
+    EXPECT_EQ(ToVector2(ToFloat2(Vector2(4.0f, 5.0f))), Vector2(4.0f, 5.0f));
+}
+
+TEST_F(VectorTest, CameraRelativeKeepsPrecisionFarFromOrigin)
+{
+    // 10,000 km from the origin a float cannot resolve millimetres
+    const Double3 camera(1e7, 0.0, -1e7);
+    const Double3 world = camera + Double3(0.001, 2.5, -0.25);
+
+    const Vector3 relative = ToCameraRelative(world, camera);
+    EXPECT_NEAR(relative.x, 0.001f, 1e-6f);
+    EXPECT_NEAR(relative.y, 2.5f, 1e-6f);
+    EXPECT_NEAR(relative.z, -0.25f, 1e-6f);
+
+    const Double3 positions[] = {world, camera};
+    Vector3 output[2];
+    ToCameraRelative(positions, 2, camera, output);
+    EXPECT_EQ(output[0], relative);
+    EXPECT_EQ(output[1], Vector3::Zero());
+}
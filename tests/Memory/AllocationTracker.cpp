@@ -0,0 +1,153 @@
+#include "Memory/AllocationTracker.h"
+#include "Memory/StlAllocators.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <new>
+#include <string>
+
+using namespace Memory;
+
+class AllocationTrackerTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        if (!AllocationTracker::IsAvailable())
+            GTEST_SKIP() << "Built without allocation tracking";
+        AllocationTracker::SetNoAllocPolicy(NoAllocPolicy::Record);
+    }
+
+    // Called through volatile pointers so each keeps a single call site
+    static void* AllocateHere(size_t bytes) { return ::operator new(bytes); }
+    static void* AllocateThere(size_t bytes) { return ::operator new(bytes); }
+
+    static void* (*volatile s_allocateHere)(size_t);
+    static void* (*volatile s_allocateThere)(size_t);
+};
+
+void* (*volatile AllocationTrackerTest::s_allocateHere)(size_t) = &AllocationTrackerTest::AllocateHere;
+void* (*volatile AllocationTrackerTest::s_allocateThere)(size_t) = &AllocationTrackerTest::AllocateThere;
+
+TEST_F(AllocationTrackerTest, FramesCountAllocationsAndBytes)
+{
+    void* blocks[3] = {};
+    AllocationTracker::BeginFrame();
+    const uint64_t frameIndex = AllocationTracker::GetFrameStats().frameIndex;
+    blocks[0] = ::operator new(100);
+    blocks[1] = ::operator new[](28);
+    blocks[2] = ::operator new(64, std::align_val_t(64));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(blocks[2]) % 64, 0u);
+    ::operator delete(blocks[0]);
+    ::operator delete[](blocks[1]);
+    ::operator delete(blocks[2], std::align_val_t(64));
+
+    const AllocationFrameStats frame = AllocationTracker::GetFrameStats();
+    EXPECT_EQ(frame.allocations, 3u);
+    EXPECT_EQ(frame.frees, 3u);
+    EXPECT_EQ(frame.bytes, 192u);
+    EXPECT_EQ(frame.callSites, 3u);
+
+    AllocationTracker::BeginFrame();
+    const AllocationFrameStats last = AllocationTracker::GetLastFrameStats();
+    EXPECT_EQ(last.frameIndex, frameIndex);
+    EXPECT_EQ(last.allocations, frame.allocations);
+    EXPECT_EQ(last.bytes, frame.bytes);
+    EXPECT_EQ(AllocationTracker::GetFrameStats().allocations, 0u);
+    EXPECT_EQ(AllocationTracker::GetFrameStats().frameIndex, frameIndex + 1);
+}
+
+TEST_F(AllocationTrackerTest, CallSitesAreRankedByCount)
+{
+    void* blocks[13] = {};
+    AllocationTracker::BeginFrame();
+    for (int i = 0; i < 10; ++i)
+    {
+        blocks[i] = s_allocateHere(16);
+    }
+    for (int i = 10; i < 13; ++i)
+    {
+        blocks[i] = s_allocateThere(40);
+    }
+
+    AllocationCallSite sites[4];
+    const size_t count = AllocationTracker::GetCallSites(sites, 4);
+    for (void* block : blocks)
+    {
+        ::operator delete(block);
+    }
+    ASSERT_EQ(count, 2u);
+    EXPECT_EQ(sites[0].allocations, 10u);
+    EXPECT_EQ(sites[0].bytes, 160u);
+    EXPECT_EQ(sites[1].allocations, 3u);
+    EXPECT_EQ(sites[1].bytes, 120u);
+    EXPECT_NE(sites[0].hash, sites[1].hash);
+    EXPECT_NE(sites[0].address, sites[1].address);
+
+    // A smaller output keeps only the busiest
+    EXPECT_EQ(AllocationTracker::GetCallSites(sites, 1), 1u);
+    EXPECT_EQ(sites[0].allocations, 10u);
+}
+
+TEST_F(AllocationTrackerTest, NoAllocScopesRecordViolations)
+{
+    FrameArena arena(1024);
+    arena.BeginFrame();
+    AllocationTracker::BeginFrame();
+    {
+        NoAllocScope outer;
+        FrameVector<int> values{ArenaAllocator<int, FrameArena>(arena)};
+        values.reserve(64);
+        for (int i = 0; i < 64; ++i)
+        {
+            values.push_back(i);
+        }
+        EXPECT_EQ(outer.GetViolationCount(), 0u);
+        EXPECT_EQ(outer.GetViolationSite(), nullptr);
+
+        const uint64_t total = AllocationTracker::GetViolationCount();
+        {
+            NoAllocScope inner;
+            ::operator delete(s_allocateHere(32));
+            EXPECT_EQ(inner.GetViolationCount(), 1u);
+            EXPECT_NE(inner.GetViolationSite(), nullptr);
+        }
+        EXPECT_EQ(outer.GetViolationCount(), 1u);
+        EXPECT_EQ(AllocationTracker::GetViolationCount(), total + 1);
+    }
+    EXPECT_EQ(AllocationTracker::GetFrameStats().violations, 1u);
+
+    // Outside any scope allocations are only counted
+    const std::string label(100, 'x');
+    EXPECT_EQ(AllocationTracker::GetFrameStats().violations, 1u);
+    EXPECT_GE(AllocationTracker::GetFrameStats().bytes, label.size());
+}
+
+TEST_F(AllocationTrackerTest, FailedAllocationsCallTheNewHandler)
+{
+    // A handler that gives up on its second call, so the third failure throws
+    static int s_handlerCalls;
+    s_handlerCalls = 0;
+    const std::new_handler previous = std::set_new_handler([]() {
+        if (++s_handlerCalls == 2)
+            std::set_new_handler(nullptr);
+    });
+
+    const size_t impossible = std::numeric_limits<size_t>::max() / 2;
+    EXPECT_THROW(::operator delete(::operator new(impossible)), std::bad_alloc);
+    EXPECT_EQ(s_handlerCalls, 2);
+    EXPECT_EQ(::operator new(impossible, std::nothrow), nullptr);
+    EXPECT_EQ(s_handlerCalls, 2);
+    std::set_new_handler(previous);
+}
+
+TEST_F(AllocationTrackerTest, AbortPolicyFailsOnTheFirstAllocation)
+{
+    EXPECT_DEATH(
+        {
+            AllocationTracker::SetNoAllocPolicy(NoAllocPolicy::Abort);
+            NoAllocScope scope;
+            ::operator delete(s_allocateHere(24));
+        },
+        "24 byte allocation inside a no-alloc scope");
+}
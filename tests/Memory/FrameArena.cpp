@@ -0,0 +1,100 @@
+#include "Memory/FrameArena.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace Memory;
+
+class FrameArenaTest : public ::testing::Test
+{
+  protected:
+    // Allocates count blocks of size bytes from several threads, tagging each with its thread
+    static std::vector<uint32_t*> AllocateFromThreads(FrameArena& arena, size_t threadCount, size_t count,
+                                                      size_t size)
+    {
+        std::vector<uint32_t*> blocks(threadCount * count);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    uint32_t* block = static_cast<uint32_t*>(arena.Allocate(size, 16));
+                    std::fill(block, block + size / sizeof(uint32_t), static_cast<uint32_t>(t * count + i));
+                    blocks[t * count + i] = block;
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        return blocks;
+    }
+};
+
+TEST_F(FrameArenaTest, PreviousFrameStaysValidForOneFrame)
+{
+    FrameArena arena(4096);
+    arena.BeginFrame();
+    int* previous = arena.AllocateArray<int>(16);
+    previous[15] = 42;
+
+    arena.BeginFrame();
+    int* current = arena.AllocateArray<int>(16);
+    current[15] = 7;
+    EXPECT_EQ(previous[15], 42);
+    EXPECT_NE(previous, current);
+
+    // Two frames on, the first buffer is handed out again
+    arena.BeginFrame();
+    EXPECT_EQ(arena.AllocateArray<int>(16), previous);
+    EXPECT_EQ(arena.GetFrameIndex(), 3u);
+}
+
+TEST_F(FrameArenaTest, ConcurrentAllocationsDoNotOverlap)
+{
+    FrameArena arena(1024 * 1024);
+    arena.BeginFrame();
+    const size_t threadCount = 4;
+    const size_t count = 2000;
+    const std::vector<uint32_t*> blocks = AllocateFromThreads(arena, threadCount, count, 32);
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(blocks[i]) % 16, 0u);
+        for (size_t word = 0; word < 32 / sizeof(uint32_t); ++word)
+        {
+            ASSERT_EQ(blocks[i][word], i) << "Block " << i << " was overwritten";
+        }
+    }
+    EXPECT_GE(arena.GetUsedBytes(), threadCount * count * 32);
+}
+
+TEST_F(FrameArenaTest, OverflowGrowsUntilFramesMakeNoHeapCalls)
+{
+    FrameArena arena(1024, MemoryTag::Rendering);
+    const auto frame = [&arena]() {
+        arena.BeginFrame();
+        const std::vector<uint32_t*> blocks = AllocateFromThreads(arena, 2, 200, 64);
+        for (size_t i = 0; i < blocks.size(); ++i)
+        {
+            ASSERT_EQ(blocks[i][0], i);
+        }
+    };
+
+    // Both buffers overflow once, then are regrown to fit the frame
+    for (int i = 0; i < 4; ++i)
+    {
+        frame();
+    }
+    const uint64_t heapAllocations = GetStats(MemoryTag::Rendering).heapAllocations;
+    for (int i = 0; i < 10; ++i)
+    {
+        frame();
+    }
+    EXPECT_EQ(GetStats(MemoryTag::Rendering).heapAllocations, heapAllocations);
+    EXPECT_GE(arena.GetCapacity(), 2u * 200u * 64u);
+}
@@ -0,0 +1,86 @@
+#include "Memory/LinearArena.h"
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace Memory;
+
+class LinearArenaTest : public ::testing::Test
+{
+  protected:
+    static bool IsAligned(const void* pointer, size_t alignment)
+    {
+        return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+    }
+};
+
+TEST_F(LinearArenaTest, AllocationsAreAlignedAndDisjoint)
+{
+    LinearArena arena(1024, MemoryTag::Geometry);
+    EXPECT_EQ(arena.GetCapacity(), 0u);
+
+    char* bytes = arena.AllocateArray<char>(3);
+    double* doubles = arena.AllocateArray<double>(4);
+    void* wide = arena.Allocate(10, 64);
+    EXPECT_TRUE(IsAligned(doubles, alignof(double)));
+    EXPECT_TRUE(IsAligned(wide, 64));
+    EXPECT_GE(reinterpret_cast<char*>(doubles), bytes + 3);
+    EXPECT_GE(static_cast<char*>(wide), reinterpret_cast<char*>(doubles + 4));
+    EXPECT_GE(arena.GetUsedBytes(), 3u + 32u + 10u);
+    EXPECT_EQ(arena.GetCapacity(), 1024u);
+}
+
+TEST_F(LinearArenaTest, MarkersRollBack)
+{
+    LinearArena arena(256);
+    arena.Allocate(16);
+    const LinearArena::Marker marker = arena.GetMarker();
+    void* first = arena.Allocate(32);
+    arena.Allocate(1000); // Spills into a second chunk
+    arena.ResetTo(marker);
+    EXPECT_EQ(arena.Allocate(32), first);
+}
+
+TEST_F(LinearArenaTest, ResetConsolidatesSoRepeatsMakeNoHeapCalls)
+{
+    LinearArena arena(128, MemoryTag::Spatial);
+    const auto pass = [&arena]() {
+        for (int i = 0; i < 100; ++i)
+        {
+            std::memset(arena.Allocate(48), i, 48);
+        }
+        arena.Reset();
+    };
+
+    pass();
+    const uint64_t heapAfterFirst = GetStats(MemoryTag::Spatial).heapAllocations;
+    pass(); // Runs in the single consolidated chunk
+    pass();
+    EXPECT_EQ(GetStats(MemoryTag::Spatial).heapAllocations, heapAfterFirst);
+    EXPECT_GE(arena.GetCapacity(), 100u * 48u);
+}
+
+TEST_F(LinearArenaTest, ScratchScopesNestPerThread)
+{
+    LinearArena& scratch = GetScratchArena();
+    const size_t before = scratch.GetUsedBytes();
+    {
+        ScratchScope outer;
+        int* values = outer.AllocateArray<int>(100);
+        values[99] = 7;
+        {
+            ScratchScope inner;
+            inner.Allocate(4096);
+            EXPECT_GT(scratch.GetUsedBytes(), before + 4096);
+        }
+        EXPECT_EQ(values[99], 7);
+        EXPECT_LT(scratch.GetUsedBytes(), before + 4096);
+    }
+    EXPECT_EQ(scratch.GetUsedBytes(), before);
+
+    // Another thread has its own arena
+    LinearArena* other = nullptr;
+    std::thread([&other]() { other = &GetScratchArena(); }).join();
+    EXPECT_NE(other, &scratch);
+}
@@ -0,0 +1,95 @@
+#include "Memory/PoolAllocator.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+
+using namespace Memory;
+
+class PoolAllocatorTest : public ::testing::Test
+{
+  protected:
+    struct Particle
+    {
+        Particle(float x, int id) : x(x), id(id) { ++s_live; }
+        ~Particle() { --s_live; }
+
+        float x;
+        int id;
+        double padding[3];
+    };
+
+    static int s_live;
+};
+
+int PoolAllocatorTest::s_live = 0;
+
+TEST_F(PoolAllocatorTest, BlocksAreReusedAfterFree)
+{
+    FixedPool pool(24, 8, MemoryTag::Physics);
+    EXPECT_EQ(pool.GetBlockSize(), 32u);
+
+    std::vector<void*> blocks;
+    std::set<void*> unique;
+    for (int i = 0; i < 20; ++i)
+    {
+        blocks.push_back(pool.Allocate());
+        unique.insert(blocks.back());
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(blocks.back()) % alignof(std::max_align_t), 0u);
+    }
+    EXPECT_EQ(unique.size(), 20u);
+    EXPECT_EQ(pool.GetCapacity(), 24u);
+    EXPECT_EQ(pool.GetLiveCount(), 20u);
+
+    void* freed = blocks[5];
+    pool.Free(freed);
+    EXPECT_EQ(pool.Allocate(), freed);
+
+    // Freeing everything and allocating again stays within the pages
+    const uint64_t heapAllocations = GetStats(MemoryTag::Physics).heapAllocations;
+    for (void* block : blocks)
+    {
+        pool.Free(block);
+    }
+    EXPECT_EQ(pool.GetLiveCount(), 0u);
+    for (int i = 0; i < 24; ++i)
+    {
+        pool.Allocate();
+    }
+    EXPECT_EQ(GetStats(MemoryTag::Physics).heapAllocations, heapAllocations);
+}
+
+TEST_F(PoolAllocatorTest, ObjectPoolConstructsAndDestroys)
+{
+    ObjectPool<Particle> pool(4);
+    Particle* a = pool.Create(1.5f, 1);
+    Particle* b = pool.Create(2.5f, 2);
+    EXPECT_EQ(s_live, 2);
+    EXPECT_EQ(a->id, 1);
+    EXPECT_FLOAT_EQ(b->x, 2.5f);
+    pool.Destroy(a);
+    pool.Destroy(nullptr);
+    EXPECT_EQ(s_live, 1);
+    EXPECT_EQ(pool.GetLiveCount(), 1u);
+    EXPECT_EQ(pool.Create(3.0f, 3), a);
+    pool.Destroy(a);
+    pool.Destroy(b);
+    EXPECT_EQ(s_live, 0);
+}
+
+TEST_F(PoolAllocatorTest, PoolSetPicksTheSmallestClass)
+{
+    PoolSet pools(MemoryTag::Animation, 4);
+    void* small = pools.Allocate(10);
+    void* medium = pools.Allocate(100);
+    void* large = pools.Allocate(PoolSet::MAX_POOLED_SIZE + 1);
+    pools.Free(small, 10);
+    pools.Free(medium, 100);
+    EXPECT_EQ(pools.Allocate(16), small);
+    EXPECT_EQ(pools.Allocate(128), medium);
+
+    const int64_t resident = GetStats(MemoryTag::Animation).residentBytes;
+    pools.Free(large, PoolSet::MAX_POOLED_SIZE + 1);
+    EXPECT_EQ(GetStats(MemoryTag::Animation).residentBytes,
+              resident - static_cast<int64_t>(PoolSet::MAX_POOLED_SIZE + 1));
+}
@@ -0,0 +1,94 @@
+#include "Memory/StlAllocators.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <string>
+
+using namespace Memory;
+
+class StlAllocatorsTest : public ::testing::Test
+{
+  protected:
+    // Builds a frame's worth of temporaries the way a culling pass would
+    static size_t BuildFrame(FrameArena& arena, PoolSet& pools)
+    {
+        FrameVector<int> visible{ArenaAllocator<int, FrameArena>(arena)};
+        visible.reserve(256);
+        for (int i = 0; i < 256; ++i)
+        {
+            if (i % 3 == 0)
+                visible.push_back(i);
+        }
+
+        FrameString label{ArenaAllocator<char, FrameArena>(arena)};
+        label.reserve(64);
+        label += "visible: ";
+        label += std::to_string(visible.size()).c_str();
+
+        PoolMap<int, float> batches{PoolAllocator<std::pair<const int, float>>(pools)};
+        for (int id : visible)
+        {
+            batches[id % 16] += 1.0f;
+        }
+        return visible.size() + label.size() + batches.size();
+    }
+};
+
+TEST_F(StlAllocatorsTest, ContainersUseTheirArenas)
+{
+    LinearArena arena(4096, MemoryTag::Geometry);
+    ScratchVector<float> values{ArenaAllocator<float, LinearArena>(arena)};
+    values.reserve(100);
+    for (int i = 0; i < 100; ++i)
+    {
+        values.push_back(static_cast<float>(i));
+    }
+    EXPECT_FLOAT_EQ(std::accumulate(values.begin(), values.end(), 0.0f), 4950.0f);
+    EXPECT_GE(arena.GetUsedBytes(), 100u * sizeof(float));
+
+    PoolSet pools(MemoryTag::Geometry);
+    PoolList<int> list{PoolAllocator<int>(pools)};
+    for (int i = 0; i < 50; ++i)
+    {
+        list.push_back(i);
+    }
+    list.remove_if([](int value) { return value % 2 == 0; });
+    EXPECT_EQ(list.size(), 25u);
+    EXPECT_EQ(list.front(), 1);
+}
+
+TEST_F(StlAllocatorsTest, TaggedContainersChargeTheirSubsystem)
+{
+    const MemoryTagStats before = GetStats(MemoryTag::Particles);
+    {
+        TaggedVector<double, MemoryTag::Particles> values;
+        values.resize(1000);
+        const MemoryTagStats during = GetStats(MemoryTag::Particles);
+        EXPECT_GT(during.requests, before.requests);
+        EXPECT_GE(during.residentBytes - before.residentBytes, static_cast<int64_t>(1000 * sizeof(double)));
+        EXPECT_GE(during.peakResidentBytes, during.residentBytes);
+    }
+    EXPECT_EQ(GetStats(MemoryTag::Particles).residentBytes, before.residentBytes);
+    EXPECT_STREQ(GetTagName(MemoryTag::Particles), "Particles");
+}
+
+TEST_F(StlAllocatorsTest, SteadyStateFramesMakeNoHeapCalls)
+{
+    FrameArena arena(256);
+    PoolSet pools(MemoryTag::Rendering, 8);
+    for (int frame = 0; frame < 4; ++frame)
+    {
+        arena.BeginFrame();
+        BuildFrame(arena, pools);
+    }
+
+    const uint64_t heapAllocations = GetTotalStats().heapAllocations;
+    size_t built = 0;
+    for (int frame = 0; frame < 20; ++frame)
+    {
+        arena.BeginFrame();
+        built += BuildFrame(arena, pools);
+    }
+    EXPECT_EQ(GetTotalStats().heapAllocations, heapAllocations);
+    EXPECT_EQ(built, 20u * (86u + 11u + 16u));
+}
@@ -0,0 +1,130 @@
+#include "Particles/ParticleBuffer.h"
+#include "../Animation/RecordingRenderer.h"
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Particles;
+
+class ParticleBufferTest : public ::testing::Test
+{
+  protected:
+    static void ExpectNear(const Math::Vector3& actual, const Math::Vector3& expected, float epsilon = 1e-5f)
+    {
+        EXPECT_NEAR(actual.x, expected.x, epsilon);
+        EXPECT_NEAR(actual.y, expected.y, epsilon);
+        EXPECT_NEAR(actual.z, expected.z, epsilon);
+    }
+
+    // Particles at x = 0, 1, 2, ... that stay put
+    static void EmitRow(ParticleSystem& system, size_t count, float lifetime)
+    {
+        system.SetGravity(Math::Vector3());
+        for (size_t i = 0; i < count; ++i)
+        {
+            ParticleEmitter emitter;
+            const Math::Vector3 at(static_cast<float>(i), 0.0f, 0.0f);
+            emitter.region = Math::BoundingBox(at, at);
+            emitter.minLifetime = lifetime;
+            emitter.maxLifetime = lifetime;
+            system.Emit(emitter, 1);
+        }
+    }
+
+    const Math::Vector3 RIGHT = Math::Vector3(1.0f, 0.0f, 0.0f);
+    const Math::Vector3 UP = Math::Vector3(0.0f, 1.0f, 0.0f);
+};
+
+TEST_F(ParticleBufferTest, CreatesBuffersForCapacity)
+{
+    RecordingRenderer renderer;
+    {
+        ParticleBuffer buffer(renderer, 10);
+        ASSERT_EQ(renderer.buffers.size(), 2u);
+        const RecordingRenderer::Buffer& vertices = *renderer.buffers[0];
+        const RecordingRenderer::Buffer& indices = *renderer.buffers[1];
+        EXPECT_EQ(vertices.type, Renderer::BufferType::VertexBuffer);
+        EXPECT_EQ(vertices.usage, Renderer::BufferUsage::Dynamic);
+        EXPECT_EQ(vertices.data.size(), 10u * 4u * sizeof(Renderer::Vertex));
+        EXPECT_EQ(indices.type, Renderer::BufferType::IndexBuffer);
+        EXPECT_EQ(indices.usage, Renderer::BufferUsage::Immutable);
+        ASSERT_EQ(indices.data.size(), 10u * 6u * sizeof(uint32_t));
+
+        std::vector<uint32_t> values(60);
+        std::memcpy(values.data(), indices.data.data(), indices.data.size());
+        const uint32_t pattern[6] = {0, 1, 2, 2, 1, 3};
+        for (uint32_t i = 0; i < 60; ++i)
+        {
+            EXPECT_EQ(values[i], (i / 6) * 4 + pattern[i % 6]) << i;
+        }
+    }
+    EXPECT_TRUE(renderer.buffers[0]->destroyed);
+    EXPECT_TRUE(renderer.buffers[1]->destroyed);
+}
+
+TEST_F(ParticleBufferTest, WritesCameraFacingQuads)
+{
+    RecordingRenderer renderer;
+    ParticleBuffer buffer(renderer, 16);
+    // More particles than one SIMD block of the system, aged to a quarter
+    ParticleSystem system(16);
+    EmitRow(system, 11, 4.0f);
+    system.Update(1.0f);
+
+    BillboardStyle style;
+    style.startSize = 1.0f;
+    style.endSize = 3.0f;
+    style.startColor = Math::Float4(1.0f, 0.0f, 0.0f, 1.0f);
+    style.endColor = Math::Float4(0.0f, 0.0f, 1.0f, 0.0f);
+    ASSERT_EQ(buffer.Update(system, RIGHT, UP, style), 11u);
+
+    // Quarter age: size 1.5, color a quarter of the way to the end
+    const Math::Vector3 corners[4] = {Math::Vector3(-0.75f, 0.75f, 0.0f), Math::Vector3(0.75f, 0.75f, 0.0f),
+                                      Math::Vector3(-0.75f, -0.75f, 0.0f), Math::Vector3(0.75f, -0.75f, 0.0f)};
+    const float u[4] = {0.0f, 1.0f, 0.0f, 1.0f};
+    const float v[4] = {0.0f, 0.0f, 1.0f, 1.0f};
+    for (size_t i = 0; i < 11; ++i)
+    {
+        for (size_t k = 0; k < 4; ++k)
+        {
+            const Renderer::Vertex& vertex = buffer.GetVertices()[4 * i + k];
+            ExpectNear(vertex.position, Math::Vector3(static_cast<float>(i), 0.0f, 0.0f) + corners[k]);
+            EXPECT_NEAR(vertex.color.r, 0.75f, 1e-5f);
+            EXPECT_NEAR(vertex.color.g, 0.0f, 1e-5f);
+            EXPECT_NEAR(vertex.color.b, 0.25f, 1e-5f);
+            EXPECT_NEAR(vertex.color.a, 0.75f, 1e-5f);
+            // Toward a camera looking down +Z
+            ExpectNear(vertex.normal, Math::Vector3(0.0f, 0.0f, -1.0f));
+            EXPECT_EQ(vertex.tangent.x, 1.0f);
+            EXPECT_EQ(vertex.tangent.w, 1.0f);
+            EXPECT_EQ(vertex.texCoord.x, u[k]);
+            EXPECT_EQ(vertex.texCoord.y, v[k]);
+        }
+    }
+}
+
+TEST_F(ParticleBufferTest, UploadsLiveParticlesAndDrawsOnce)
+{
+    RecordingRenderer renderer;
+    ParticleBuffer buffer(renderer, 8);
+    ParticleSystem system(20);
+    EmitRow(system, 20, 1.0f);
+
+    // Only the capacity is written, uploaded in one call, and drawn in one call
+    EXPECT_EQ(buffer.Update(system, RIGHT, UP, BillboardStyle()), 8u);
+    EXPECT_EQ(renderer.updateCount, 1u);
+    EXPECT_EQ(std::memcmp(renderer.buffers[0]->data.data(), buffer.GetVertices().data(),
+                          8 * 4 * sizeof(Renderer::Vertex)),
+              0);
+    buffer.Draw();
+    EXPECT_EQ(renderer.vertexStride, sizeof(Renderer::Vertex));
+    EXPECT_EQ(renderer.stats.drawCalls, 1u);
+    EXPECT_EQ(renderer.stats.triangles, 16u);
+
+    // Once every particle has expired nothing is uploaded or drawn
+    system.Update(1.0f);
+    EXPECT_EQ(buffer.Update(system, RIGHT, UP, BillboardStyle()), 0u);
+    buffer.Draw();
+    EXPECT_EQ(renderer.updateCount, 1u);
+    EXPECT_EQ(renderer.stats.drawCalls, 1u);
+}
@@ -0,0 +1,213 @@
+#include "Particles/ParticleSystem.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Particles;
+
+class ParticleSystemTest : public ::testing::Test
+{
+  protected:
+    static ParticleEmitter Box(const Math::Vector3& min, const Math::Vector3& max, float lifetime = 10.0f)
+    {
+        ParticleEmitter emitter;
+        emitter.region = Math::BoundingBox(min, max);
+        emitter.minLifetime = lifetime;
+        emitter.maxLifetime = lifetime;
+        return emitter;
+    }
+
+    static void Run(ParticleSystem& system, float seconds, float step)
+    {
+        const int steps = static_cast<int>(std::lround(seconds / step));
+        for (int i = 0; i < steps; ++i)
+        {
+            system.Update(step);
+        }
+    }
+
+    // More than one SIMD block with a remainder, so both paths run
+    const size_t COUNT = 8 * ParticleSystem::SIMD_WIDTH + 5;
+};
+
+TEST_F(ParticleSystemTest, EmitRespectsCapacityAndRanges)
+{
+    ParticleSystem system(100);
+    ParticleEmitter emitter = Box(Math::Vector3(-1.0f, 2.0f, 3.0f), Math::Vector3(1.0f, 4.0f, 5.0f));
+    emitter.velocity = Math::Vector3(0.0f, 5.0f, 0.0f);
+    emitter.velocitySpread = 0.5f;
+    EXPECT_EQ(system.Emit(emitter, 60), 60u);
+    EXPECT_EQ(system.Emit(emitter, 60), 40u);
+    EXPECT_EQ(system.Emit(emitter, 1), 0u);
+    ASSERT_EQ(system.GetCount(), 100u);
+
+    for (size_t i = 0; i < system.GetCount(); ++i)
+    {
+        const Math::Vector3& position = system.GetPositions()[i];
+        EXPECT_TRUE(position.x >= -1.0f && position.x <= 1.0f) << i;
+        EXPECT_TRUE(position.y >= 2.0f && position.y <= 4.0f) << i;
+        EXPECT_TRUE(position.z >= 3.0f && position.z <= 5.0f) << i;
+        EXPECT_LE((system.GetVelocities()[i] - emitter.velocity).Magnitude(), 0.5f + 1e-5f) << i;
+        EXPECT_EQ(system.GetAges()[i], 0.0f);
+    }
+
+    system.Clear();
+    ParticleEmitter invalid = emitter;
+    invalid.region = Math::BoundingBox();
+    EXPECT_EQ(system.Emit(invalid, 10), 0u);
+    invalid = emitter;
+    invalid.minLifetime = 0.0f;
+    EXPECT_EQ(system.Emit(invalid, 10), 0u);
+    invalid = emitter;
+    invalid.maxLifetime = 0.5f;
+    EXPECT_EQ(system.Emit(invalid, 10), 0u);
+    EXPECT_EQ(system.GetCount(), 0u);
+}
+
+TEST_F(ParticleSystemTest, FreeParticlesFollowBallisticMotion)
+{
+    ParticleSystem system(COUNT);
+    system.SetGravity(Math::Vector3(0.0f, -10.0f, 0.0f));
+    ParticleEmitter emitter = Box(Math::Vector3(-5.0f, 0.0f, -5.0f), Math::Vector3(5.0f, 1.0f, 5.0f));
+    emitter.velocity = Math::Vector3(1.0f, 5.0f, 0.0f);
+    emitter.velocitySpread = 2.0f;
+    ASSERT_EQ(system.Emit(emitter, COUNT), COUNT);
+    const std::vector<Math::Vector3> start(system.GetPositions(), system.GetPositions() + COUNT);
+    const std::vector<Math::Vector3> launch(system.GetVelocities(), system.GetVelocities() + COUNT);
+
+    // Semi-implicit Euler over n steps: p = p0 + n h v0 + g h^2 n (n + 1) / 2
+    const int n = 50;
+    const float h = 0.02f;
+    Run(system, n * h, h);
+    ASSERT_EQ(system.GetCount(), COUNT);
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        const Math::Vector3& position = system.GetPositions()[i];
+        const Math::Vector3& velocity = system.GetVelocities()[i];
+        EXPECT_NEAR(position.x, start[i].x + n * h * launch[i].x, 1e-4f) << i;
+        EXPECT_NEAR(position.y, start[i].y + n * h * launch[i].y - 5.0f * h * h * n * (n + 1), 1e-4f) << i;
+        EXPECT_NEAR(position.z, start[i].z + n * h * launch[i].z, 1e-4f) << i;
+        EXPECT_NEAR(velocity.y, launch[i].y - 10.0f * n * h, 1e-4f) << i;
+        EXPECT_NEAR(system.GetAges()[i], 0.1f, 1e-5f) << i;
+    }
+
+    // Drag divides the velocity by 1 + drag h every step
+    system.SetGravity(Math::Vector3());
+    system.SetDrag(2.0f);
+    const std::vector<Math::Vector3> before(system.GetVelocities(), system.GetVelocities() + COUNT);
+    Run(system, 10 * h, h);
+    const float scale = std::pow(1.0f + 2.0f * h, -10.0f);
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        EXPECT_NEAR(system.GetVelocities()[i].x, before[i].x * scale, 1e-5f) << i;
+        EXPECT_NEAR(system.GetVelocities()[i].y, before[i].y * scale, 1e-5f) << i;
+    }
+}
+
+TEST_F(ParticleSystemTest, ExpiredParticlesAreRemovedInOrder)
+{
+    ParticleSystem system(COUNT);
+    system.SetGravity(Math::Vector3());
+
+    // Every third particle is short-lived; survivors must keep their order
+    // across whole blocks, partial blocks and the remainder
+    std::vector<Math::Vector3> survivors;
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        const float lifetime = i % 3 == 0 ? 0.5f : 2.0f;
+        const Math::Vector3 at(static_cast<float>(i), 0.0f, 0.0f);
+        ASSERT_EQ(system.Emit(Box(at, at, lifetime), 1), 1u);
+        if (i % 3 != 0)
+            survivors.push_back(at);
+    }
+
+    Run(system, 1.0f, 0.1f);
+    ASSERT_EQ(system.GetCount(), survivors.size());
+    for (size_t i = 0; i < survivors.size(); ++i)
+    {
+        EXPECT_EQ(system.GetPositions()[i], survivors[i]) << i;
+        EXPECT_NEAR(system.GetAges()[i], 0.5f, 1e-5f) << i;
+    }
+
+    Run(system, 1.0f, 0.1f);
+    EXPECT_EQ(system.GetCount(), 0u);
+}
+
+TEST_F(ParticleSystemTest, PlanesKeepParticlesOnTheirSide)
+{
+    ParticleSystem system(1000);
+    system.SetCollisionResponse(0.0f, 1.0f);
+    system.AddPlane(Math::Plane(Math::Vector3(0.0f, 1.0f, 0.0f), 0.0f));
+    system.AddPlane(Math::Plane::FromPointNormal(Math::Vector3(2.0f, 0.0f, 0.0f), Math::Vector3(-1.0f, 0.0f, 0.0f)));
+
+    ParticleEmitter emitter = Box(Math::Vector3(-2.0f, 1.0f, -2.0f), Math::Vector3(2.0f, 5.0f, 2.0f));
+    emitter.velocity = Math::Vector3(3.0f, 0.0f, 0.0f);
+    emitter.velocitySpread = 1.0f;
+    system.Emit(emitter, 1000);
+
+    Run(system, 2.0f, 1.0f / 60.0f);
+    for (size_t i = 0; i < system.GetCount(); ++i)
+    {
+        const Math::Vector3& position = system.GetPositions()[i];
+        EXPECT_GE(position.y, -1e-5f) << i;
+        EXPECT_LE(position.x, 2.0f + 1e-5f) << i;
+        // Without restitution and with full friction, landed particles stop
+        EXPECT_LT(system.GetVelocities()[i].Magnitude(), 1e-4f) << i;
+    }
+}
+
+TEST_F(ParticleSystemTest, RestitutionReflectsNormalSpeed)
+{
+    ParticleSystem system(COUNT);
+    system.SetGravity(Math::Vector3());
+    system.SetCollisionResponse(0.5f, 0.2f);
+    system.AddPlane(Math::Plane(Math::Vector3(0.0f, 1.0f, 0.0f), 0.0f));
+
+    ParticleEmitter emitter = Box(Math::Vector3(0.0f, 0.1f, 0.0f), Math::Vector3(1.0f, 0.1f, 1.0f));
+    emitter.velocity = Math::Vector3(2.0f, -5.0f, 0.0f);
+    system.Emit(emitter, COUNT);
+
+    // One step crosses the plane: the particle lands on it, half the normal
+    // speed comes back and friction takes a fifth of the sliding speed
+    system.Update(0.1f);
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        EXPECT_NEAR(system.GetPositions()[i].y, 0.0f, 1e-6f) << i;
+        EXPECT_NEAR(system.GetVelocities()[i].x, 1.6f, 1e-5f) << i;
+        EXPECT_NEAR(system.GetVelocities()[i].y, 2.5f, 1e-5f) << i;
+    }
+
+    // Moving away, the next step is free flight
+    system.Update(0.1f);
+    for (size_t i = 0; i < COUNT; ++i)
+    {
+        EXPECT_NEAR(system.GetPositions()[i].y, 0.25f, 1e-5f) << i;
+        EXPECT_NEAR(system.GetVelocities()[i].y, 2.5f, 1e-5f) << i;
+    }
+}
+
+TEST_F(ParticleSystemTest, SameSeedGivesSameParticles)
+{
+    ParticleEmitter emitter = Box(Math::Vector3(-1.0f, -1.0f, -1.0f), Math::Vector3(1.0f, 1.0f, 1.0f));
+    emitter.velocitySpread = 3.0f;
+    emitter.minLifetime = 0.5f;
+    emitter.maxLifetime = 1.5f;
+
+    ParticleSystem first(COUNT, 42), second(COUNT, 42), other(COUNT, 43);
+    for (ParticleSystem* system : {&first, &second, &other})
+    {
+        system->AddPlane(Math::Plane(Math::Vector3(0.0f, 1.0f, 0.0f), 2.0f));
+        system->Emit(emitter, COUNT);
+        Run(*system, 1.0f, 0.05f);
+    }
+
+    ASSERT_EQ(first.GetCount(), second.GetCount());
+    EXPECT_GT(first.GetCount(), 0u);
+    EXPECT_LT(first.GetCount(), COUNT);
+    for (size_t i = 0; i < first.GetCount(); ++i)
+    {
+        EXPECT_EQ(first.GetPositions()[i], second.GetPositions()[i]) << i;
+        EXPECT_EQ(first.GetVelocities()[i], second.GetVelocities()[i]) << i;
+    }
+    EXPECT_NE(first.GetPositions()[0], other.GetPositions()[0]);
+}
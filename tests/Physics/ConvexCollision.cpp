@@ -0,0 +1,229 @@
+#include "Physics/ConvexCollision.h"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace Physics;
+
+class ConvexCollisionTest : public ::testing::Test
+{
+  protected:
+    static constexpr float TOLERANCE = 1e-3f;
+
+    static Math::Matrix4x4 At(float x, float y, float z)
+    {
+        return Math::Matrix4x4::Translation(Math::Vector3(x, y, z));
+    }
+
+    static std::vector<Math::Vector3> BoxCorners(const Math::Vector3& halfExtents)
+    {
+        std::vector<Math::Vector3> corners;
+        for (uint32_t i = 0; i < 8; ++i)
+        {
+            corners.emplace_back(i & 1 ? halfExtents.x : -halfExtents.x, i & 2 ? halfExtents.y : -halfExtents.y,
+                                 i & 4 ? halfExtents.z : -halfExtents.z);
+        }
+        return corners;
+    }
+};
+
+TEST_F(ConvexCollisionTest, SphereSphereMatchesAnalytic)
+{
+    const ConvexShape a = ConvexShape::Sphere(1.0f);
+    const ConvexShape b = ConvexShape::Sphere(0.5f);
+
+    DistanceResult distance;
+    EXPECT_TRUE(ConvexCollision::Distance(a, At(0, 0, 0), b, At(3, 0, 0), distance));
+    EXPECT_NEAR(distance.distance, 1.5f, TOLERANCE);
+    EXPECT_NEAR(distance.pointA.x, 1.0f, TOLERANCE);
+    EXPECT_NEAR(distance.pointB.x, 2.5f, TOLERANCE);
+
+    ContactResult contact;
+    ASSERT_TRUE(ConvexCollision::Penetration(a, At(0, 0, 0), b, At(0, 1.2f, 0), contact));
+    EXPECT_NEAR(contact.depth, 0.3f, TOLERANCE);
+    EXPECT_NEAR(contact.normal.y, 1.0f, TOLERANCE);
+    EXPECT_NEAR(contact.pointA.y, 1.0f, TOLERANCE);
+    EXPECT_NEAR(contact.pointB.y, 0.7f, TOLERANCE);
+
+    EXPECT_FALSE(ConvexCollision::Penetration(a, At(0, 0, 0), b, At(0, 1.6f, 0), contact));
+}
+
+TEST_F(ConvexCollisionTest, BoxBoxPenetrationUsesShallowestAxis)
+{
+    const ConvexShape a = ConvexShape::Box(Math::Vector3(1.0f, 1.0f, 1.0f));
+    const ConvexShape b = ConvexShape::Box(Math::Vector3(0.5f, 0.5f, 0.5f));
+
+    ContactResult contact;
+    ASSERT_TRUE(ConvexCollision::Penetration(a, At(0, 0, 0), b, At(0.2f, 0.1f, 1.3f), contact));
+    EXPECT_NEAR(contact.depth, 0.2f, TOLERANCE);
+    EXPECT_NEAR(contact.normal.z, 1.0f, TOLERANCE);
+
+    // Deep overlap, where GJK ends with the origin inside a tetrahedron
+    ASSERT_TRUE(ConvexCollision::Penetration(a, At(0, 0, 0), b, At(0.1f, -0.6f, 0.0f), contact));
+    EXPECT_NEAR(contact.depth, 0.9f, TOLERANCE);
+    EXPECT_NEAR(contact.normal.y, -1.0f, TOLERANCE);
+
+    DistanceResult distance;
+    EXPECT_TRUE(ConvexCollision::Distance(a, At(0, 0, 0), b, At(2.0f, 0.0f, 0.0f), distance));
+    EXPECT_NEAR(distance.distance, 0.5f, TOLERANCE);
+}
+
+TEST_F(ConvexCollisionTest, CapsuleUsesItsCoreSegment)
+{
+    const ConvexShape capsule = ConvexShape::Capsule(0.5f, 1.0f);
+    const ConvexShape sphere = ConvexShape::Sphere(0.25f);
+
+    // Beside the segment, the distance is measured from the axis
+    DistanceResult distance;
+    EXPECT_TRUE(ConvexCollision::Distance(capsule, At(0, 0, 0), sphere, At(2.0f, 0.4f, 0.0f), distance));
+    EXPECT_NEAR(distance.distance, 1.25f, TOLERANCE);
+
+    // Beyond the cap, from the segment's end
+    EXPECT_TRUE(ConvexCollision::Distance(capsule, At(0, 0, 0), sphere, At(0.0f, 3.0f, 0.0f), distance));
+    EXPECT_NEAR(distance.distance, 1.25f, TOLERANCE);
+
+    // A capsule lying along X after rotation
+    const Math::Matrix4x4 lying = Math::Matrix4x4::RotationZ(1.5707963f);
+    ContactResult contact;
+    ASSERT_TRUE(ConvexCollision::Penetration(capsule, lying, sphere, At(0.9f, 0.6f, 0.0f), contact));
+    EXPECT_NEAR(contact.depth, 0.15f, TOLERANCE);
+    EXPECT_NEAR(contact.normal.y, 1.0f, TOLERANCE);
+}
+
+TEST_F(ConvexCollisionTest, HullMatchesEquivalentBox)
+{
+    const Math::Vector3 halfExtents(0.8f, 0.4f, 0.6f);
+    ConvexPolytope polytope;
+    ASSERT_TRUE(polytope.Build(BoxCorners(halfExtents).data(), 8));
+    const ConvexShape hull = ConvexShape::Hull(polytope);
+    const ConvexShape box = ConvexShape::Box(halfExtents);
+    const ConvexShape probe = ConvexShape::Capsule(0.3f, 0.5f);
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> offset(-2.0f, 2.0f);
+    std::uniform_real_distribution<float> angle(-3.14159f, 3.14159f);
+    for (int i = 0; i < 200; ++i)
+    {
+        const Math::Matrix4x4 transformA = Math::Matrix4x4::RotationY(angle(rng));
+        const Math::Matrix4x4 transformB =
+            Math::Matrix4x4::RotationAxis(Math::Vector3(1.0f, 2.0f, 3.0f).Normalized(), angle(rng)) *
+            At(offset(rng), offset(rng), offset(rng));
+
+        DistanceResult fromHull, fromBox;
+        const bool separatedHull = ConvexCollision::Distance(hull, transformA, probe, transformB, fromHull);
+        const bool separatedBox = ConvexCollision::Distance(box, transformA, probe, transformB, fromBox);
+        ASSERT_EQ(separatedHull, separatedBox);
+        EXPECT_NEAR(fromHull.distance, fromBox.distance, TOLERANCE);
+
+        ContactResult contactHull, contactBox;
+        ASSERT_EQ(ConvexCollision::Penetration(hull, transformA, probe, transformB, contactHull),
+                  ConvexCollision::Penetration(box, transformA, probe, transformB, contactBox));
+        if (!separatedBox)
+        {
+            EXPECT_NEAR(contactHull.depth, contactBox.depth, 1e-2f);
+        }
+    }
+}
+
+TEST_F(ConvexCollisionTest, PenetrationSeparatesShapes)
+{
+    const ConvexShape a = ConvexShape::Box(Math::Vector3(1.0f, 0.5f, 0.75f));
+    const ConvexShape b = ConvexShape::Capsule(0.4f, 0.6f);
+
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> offset(-1.5f, 1.5f);
+    std::uniform_real_distribution<float> angle(-3.14159f, 3.14159f);
+    int overlaps = 0;
+    for (int i = 0; i < 300; ++i)
+    {
+        const Math::Matrix4x4 transformA = Math::Matrix4x4::RotationX(angle(rng));
+        const Math::Matrix4x4 rotationB = Math::Matrix4x4::RotationZ(angle(rng));
+        const Math::Vector3 position(offset(rng), offset(rng), offset(rng));
+        const Math::Matrix4x4 transformB = rotationB * At(position.x, position.y, position.z);
+
+        // Intersect agrees with Distance everywhere
+        DistanceResult distance;
+        const bool separated = ConvexCollision::Distance(a, transformA, b, transformB, distance);
+        ASSERT_EQ(!separated, ConvexCollision::Intersect(a, transformA, b, transformB));
+
+        ContactResult contact;
+        if (!ConvexCollision::Penetration(a, transformA, b, transformB, contact))
+        {
+            continue;
+        }
+        ++overlaps;
+        EXPECT_NEAR(contact.normal.Magnitude(), 1.0f, TOLERANCE);
+
+        // Moving B out by the depth leaves the shapes just touching
+        const Math::Vector3 resolved = position + contact.normal * (contact.depth + 1e-2f);
+        EXPECT_TRUE(ConvexCollision::Distance(a, transformA, b, rotationB * At(resolved.x, resolved.y, resolved.z),
+                                              distance));
+        EXPECT_LT(distance.distance, 2e-2f);
+    }
+    EXPECT_GT(overlaps, 50);
+}
+
+TEST_F(ConvexCollisionTest, WarmStartReducesIterations)
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::vector<Math::Vector3> points;
+    for (int i = 0; i < 400; ++i)
+    {
+        points.emplace_back(Math::Vector3(unit(rng), unit(rng), unit(rng)).Normalized());
+    }
+    ConvexPolytope polytope;
+    ASSERT_TRUE(polytope.Build(points.data(), points.size()));
+    const ConvexShape hull = ConvexShape::Hull(polytope);
+    const ConvexShape box = ConvexShape::Box(Math::Vector3(0.5f, 0.5f, 0.5f));
+
+    // A slowly moving pair, as between two frames of a persistent contact
+    SimplexCache cache;
+    uint32_t cold = 0, warm = 0;
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        const float t = frame * 0.01f;
+        const Math::Matrix4x4 transformB = Math::Matrix4x4::RotationY(t) * At(2.0f + 0.2f * t, 0.3f, 0.1f * t);
+
+        DistanceResult coldResult, warmResult;
+        ASSERT_TRUE(ConvexCollision::Distance(hull, At(0, 0, 0), box, transformB, coldResult));
+        ASSERT_TRUE(ConvexCollision::Distance(hull, At(0, 0, 0), box, transformB, warmResult, &cache));
+        EXPECT_NEAR(coldResult.distance, warmResult.distance, TOLERANCE);
+        if (frame > 0)
+        {
+            cold += coldResult.iterations;
+            warm += warmResult.iterations;
+        }
+    }
+    EXPECT_LT(warm * 2, cold);
+}
+
+TEST_F(ConvexCollisionTest, PolytopeSupportMatchesBruteForce)
+{
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::vector<Math::Vector3> points;
+    for (int i = 0; i < 1000; ++i)
+    {
+        points.emplace_back(Math::Vector3(unit(rng), unit(rng), unit(rng)).Normalized());
+    }
+    ConvexPolytope polytope;
+    ASSERT_TRUE(polytope.Build(points.data(), points.size()));
+    ASSERT_GT(polytope.GetVertexCount(), 100u);
+
+    for (int i = 0; i < 500; ++i)
+    {
+        const Math::Vector3 direction(unit(rng), unit(rng), unit(rng));
+        float best = -1e30f;
+        for (uint32_t v = 0; v < polytope.GetVertexCount(); ++v)
+        {
+            const float dot = Math::Vector3::Dot(polytope.GetVertex(v), direction);
+            best = std::max(best, dot);
+        }
+        const uint32_t index = polytope.Support(direction.x, direction.y, direction.z);
+        ASSERT_LT(index, polytope.GetVertexCount());
+        EXPECT_FLOAT_EQ(Math::Vector3::Dot(polytope.GetVertex(index), direction), best);
+    }
+}
@@ -0,0 +1,218 @@
+#include "Physics/RigidBodyWorld.h"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Physics;
+
+class RigidBodyWorldTest : public ::testing::Test
+{
+  protected:
+    static RigidBodyDesc Ground()
+    {
+        RigidBodyDesc desc;
+        desc.shape = ConvexShape::Box(Math::Vector3(20.0f, 0.5f, 20.0f));
+        desc.position = Math::Vector3(0.0f, -0.5f, 0.0f);
+        desc.mass = 0.0f;
+        return desc;
+    }
+
+    static RigidBodyDesc Crate(float x, float y, float z)
+    {
+        RigidBodyDesc desc;
+        desc.shape = ConvexShape::Box(Math::Vector3(0.5f, 0.5f, 0.5f));
+        desc.position = Math::Vector3(x, y, z);
+        return desc;
+    }
+
+    static void Run(RigidBodyWorld& world, float seconds)
+    {
+        const int steps = static_cast<int>(std::lround(seconds / world.GetTimeStep()));
+        for (int i = 0; i < steps; ++i)
+        {
+            world.Step();
+        }
+    }
+};
+
+TEST_F(RigidBodyWorldTest, RejectsInvalidBodies)
+{
+    RigidBodyWorld world;
+    RigidBodyDesc desc = Crate(0, 0, 0);
+    desc.mass = -1.0f;
+    EXPECT_EQ(world.AddBody(desc), RigidBodyWorld::INVALID_INDEX);
+    desc.mass = 1.0f;
+    desc.shape.type = ShapeType::Hull;
+    EXPECT_EQ(world.AddBody(desc), RigidBodyWorld::INVALID_INDEX);
+
+    // A polytope whose points span no volume stays empty
+    ConvexPolytope flat;
+    const Math::Vector3 points[3] = {Math::Vector3(0, 0, 0), Math::Vector3(1, 0, 0), Math::Vector3(0, 1, 0)};
+    EXPECT_FALSE(flat.Build(points, 3));
+    desc.shape = ConvexShape::Hull(flat);
+    EXPECT_EQ(desc.shape.polytope, nullptr);
+    EXPECT_EQ(world.AddBody(desc), RigidBodyWorld::INVALID_INDEX);
+    desc.shape.polytope = &flat;
+    EXPECT_EQ(world.AddBody(desc), RigidBodyWorld::INVALID_INDEX);
+    EXPECT_EQ(world.GetBodyCount(), 0u);
+
+    const uint32_t ground = world.AddBody(Ground());
+    EXPECT_EQ(ground, 0u);
+    EXPECT_FALSE(world.SetVelocity(ground, Math::Vector3(1, 0, 0), Math::Vector3()));
+    EXPECT_FALSE(world.SetVelocity(5, Math::Vector3(1, 0, 0), Math::Vector3()));
+}
+
+TEST_F(RigidBodyWorldTest, FreeBodiesFollowBallisticMotion)
+{
+    RigidBodyWorld world(0.01f);
+    world.SetGravity(Math::Vector3(0.0f, -10.0f, 0.0f));
+
+    // More bodies than one SIMD block, so both paths run
+    const float spin = 2.0f;
+    for (int i = 0; i < 11; ++i)
+    {
+        RigidBodyDesc desc = Crate(i * 5.0f, 0.0f, 0.0f);
+        desc.linearVelocity = Math::Vector3(1.0f, 5.0f, 0.0f);
+        desc.angularVelocity = Math::Vector3(0.0f, spin, 0.0f);
+        world.AddBody(desc);
+    }
+    RigidBodyDesc ground = Ground();
+    ground.position = Math::Vector3(0.0f, -100.0f, 0.0f);
+    const uint32_t fixed = world.AddBody(ground);
+
+    Run(world, 1.0f);
+    for (uint32_t id = 0; id < 11; ++id)
+    {
+        // Semi-implicit Euler over n steps: y = n h v0 - g h^2 n (n + 1) / 2, less a little damping
+        const Math::Vector3& position = world.GetPositions()[id];
+        EXPECT_NEAR(position.x, id * 5.0f + 1.0f, 1e-2f);
+        EXPECT_NEAR(position.y, 5.0f - 5.0f * 1.01f, 5e-2f);
+        EXPECT_NEAR(world.GetLinearVelocities()[id].y, -5.0f, 5e-2f);
+
+        // The body turned by the integrated spin about Y
+        const Math::Vector3 forward = world.GetOrientations()[id].Rotate(Math::Vector3(1.0f, 0.0f, 0.0f));
+        const float angle = std::atan2(-forward.z, forward.x);
+        EXPECT_NEAR(angle, spin * 0.975f, 2e-2f);
+        EXPECT_NEAR(world.GetOrientations()[id].Magnitude(), 1.0f, 1e-5f);
+    }
+    EXPECT_FLOAT_EQ(world.GetPositions()[fixed].y, -100.0f);
+    EXPECT_EQ(world.GetContactCount(), 0u);
+}
+
+TEST_F(RigidBodyWorldTest, UpdateRunsWholeFixedSteps)
+{
+    RigidBodyWorld world(0.01f);
+    world.AddBody(Crate(0, 0, 0));
+    EXPECT_EQ(world.Update(0.025f), 2u);
+    EXPECT_EQ(world.Update(0.0075f), 1u);
+    EXPECT_EQ(world.Update(0.001f), 0u);
+
+    // A long stall runs a bounded number of steps and drops the rest
+    EXPECT_EQ(world.Update(5.0f), RigidBodyWorld::MAX_STEPS_PER_UPDATE);
+    EXPECT_LE(world.Update(0.0f), 1u);
+}
+
+TEST_F(RigidBodyWorldTest, StackComesToRest)
+{
+    RigidBodyWorld world;
+    world.AddBody(Ground());
+    const int height = 5;
+    for (int level = 0; level < height; ++level)
+    {
+        world.AddBody(Crate(0.0f, 0.6f + level * 1.05f, 0.0f));
+    }
+
+    Run(world, 4.0f);
+    for (int level = 0; level < height; ++level)
+    {
+        const uint32_t id = static_cast<uint32_t>(level + 1);
+        const Math::Vector3& position = world.GetPositions()[id];
+        EXPECT_NEAR(position.y, 0.5f + level, 0.03f) << "level " << level;
+        EXPECT_NEAR(position.x, 0.0f, 0.02f);
+        EXPECT_NEAR(position.z, 0.0f, 0.02f);
+        EXPECT_LT(world.GetLinearVelocities()[id].Magnitude(), 0.05f);
+
+        // Still upright
+        EXPECT_GT(world.GetOrientations()[id].Rotate(Math::Vector3(0.0f, 1.0f, 0.0f)).y, 0.999f);
+    }
+
+    // Faces rest on full manifolds, and the stack is one island
+    EXPECT_GE(world.GetContactCount(), 4u * height);
+    EXPECT_EQ(world.GetIslandCount(), 1u);
+}
+
+TEST_F(RigidBodyWorldTest, FrictionStopsSlidingBox)
+{
+    RigidBodyWorld world;
+    world.AddBody(Ground());
+    RigidBodyDesc desc = Crate(0.0f, 0.5f, 0.0f);
+    desc.linearVelocity = Math::Vector3(3.0f, 0.0f, 0.0f);
+    const uint32_t id = world.AddBody(desc);
+
+    Run(world, 2.0f);
+    // Both frictions are 0.5, so the box slides v^2 / (2 mu g) before stopping
+    const float expected = 9.0f / (2.0f * 0.5f * 9.81f);
+    EXPECT_NEAR(world.GetPositions()[id].x, expected, 0.15f * expected);
+    EXPECT_LT(world.GetLinearVelocities()[id].Magnitude(), 0.05f);
+}
+
+TEST_F(RigidBodyWorldTest, RestitutionBounces)
+{
+    RigidBodyWorld world(1.0f / 120.0f);
+    world.AddBody(Ground());
+    RigidBodyDesc desc;
+    desc.shape = ConvexShape::Sphere(0.25f);
+    desc.position = Math::Vector3(0.0f, 2.25f, 0.0f);
+    desc.restitution = 0.8f;
+    const uint32_t id = world.AddBody(desc);
+
+    // Fall 2 m, then track the highest point after the bounce
+    float peak = 0.0f;
+    bool bounced = false;
+    for (int i = 0; i < 240; ++i)
+    {
+        world.Step();
+        const float velocity = world.GetLinearVelocities()[id].y;
+        bounced = bounced || velocity > 0.0f;
+        if (bounced)
+            peak = std::max(peak, world.GetPositions()[id].y - 0.25f);
+    }
+    ASSERT_TRUE(bounced);
+    EXPECT_NEAR(peak, 2.0f * 0.8f * 0.8f, 0.2f);
+}
+
+TEST_F(RigidBodyWorldTest, SeparatePilesSolveAsIslandsDeterministically)
+{
+    // Piles resting on the same static ground are still separate islands,
+    // so the result must not depend on which worker solved which
+    const auto build = [](RigidBodyWorld& world) {
+        world.AddBody(Ground());
+        for (int pile = 0; pile < 8; ++pile)
+        {
+            for (int level = 0; level < 3; ++level)
+            {
+                RigidBodyDesc desc = Crate(pile * 2.0f - 8.0f, 0.6f + level * 1.1f, 0.0f);
+                desc.orientation = Math::Quaternion::FromAxisAngle(Math::Vector3(0.0f, 1.0f, 0.0f), 0.1f * pile);
+                world.AddBody(desc);
+            }
+        }
+    };
+
+    RigidBodyWorld first, second;
+    build(first);
+    build(second);
+    Run(first, 1.5f);
+    Run(second, 1.5f);
+
+    EXPECT_EQ(first.GetIslandCount(), 8u);
+    for (uint32_t id = 0; id < first.GetBodyCount(); ++id)
+    {
+        EXPECT_EQ(first.GetPositions()[id], second.GetPositions()[id]) << "body " << id;
+        EXPECT_EQ(first.GetOrientations()[id], second.GetOrientations()[id]) << "body " << id;
+    }
+    for (uint32_t id = 1; id < first.GetBodyCount(); ++id)
+    {
+        EXPECT_NEAR(first.GetPositions()[id].y, 0.5f + (id - 1) % 3, 0.05f) << "body " << id;
+    }
+}
@@ -0,0 +1,231 @@
+#include "Physics/SweepAndPrune.h"
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace Physics;
+
+class SweepAndPruneTest : public ::testing::Test
+{
+  protected:
+    using PairSet = std::set<std::pair<uint32_t, uint32_t>>;
+
+    static PairSet ToSet(const std::vector<BroadphasePair>& pairs)
+    {
+        PairSet set;
+        for (const BroadphasePair& pair : pairs)
+        {
+            EXPECT_LT(pair.idA, pair.idB);
+            EXPECT_TRUE(set.emplace(pair.idA, pair.idB).second) << "duplicate pair";
+        }
+        return set;
+    }
+
+    static PairSet BruteForce(const std::vector<Math::BoundingBox>& boxes, const std::vector<bool>& present)
+    {
+        PairSet set;
+        for (uint32_t a = 0; a < boxes.size(); ++a)
+        {
+            for (uint32_t b = a + 1; b < boxes.size(); ++b)
+            {
+                if (present[a] && present[b] && boxes[a].Intersects(boxes[b]))
+                    set.emplace(a, b);
+            }
+        }
+        return set;
+    }
+
+    // The pair set, the previous set and the events must agree
+    static void ExpectConsistent(const SweepAndPrune& broadphase, const PairSet& previous, const PairSet& expected)
+    {
+        const PairSet current = ToSet(broadphase.GetPairs());
+        EXPECT_EQ(current, expected);
+
+        PairSet rebuilt = previous;
+        for (const BroadphasePair& pair : broadphase.GetRemovedPairs())
+            EXPECT_EQ(rebuilt.erase({pair.idA, pair.idB}), 1u) << "removed a pair that did not exist";
+        for (const BroadphasePair& pair : broadphase.GetAddedPairs())
+            EXPECT_TRUE(rebuilt.emplace(pair.idA, pair.idB).second) << "added a pair that already existed";
+        EXPECT_EQ(rebuilt, current);
+    }
+
+    static Math::BoundingBox RandomBox(std::mt19937& rng, float worldSize, float maxExtent)
+    {
+        std::uniform_real_distribution<float> position(0.0f, worldSize);
+        std::uniform_real_distribution<float> extent(0.05f, maxExtent);
+        return Math::BoundingBox::FromCenterExtents(Math::Vector3(position(rng), position(rng), position(rng)),
+                                                    Math::Vector3(extent(rng), extent(rng), extent(rng)));
+    }
+};
+
+TEST_F(SweepAndPruneTest, RejectsInvalidChanges)
+{
+    SweepAndPrune broadphase;
+    const Math::BoundingBox box(Math::Vector3(0, 0, 0), Math::Vector3(1, 1, 1));
+    EXPECT_FALSE(broadphase.Insert(0, Math::BoundingBox()));
+    EXPECT_TRUE(broadphase.Insert(0, box));
+    EXPECT_FALSE(broadphase.Insert(0, box));
+    EXPECT_FALSE(broadphase.Move(1, box));
+    EXPECT_FALSE(broadphase.Remove(1));
+    EXPECT_EQ(broadphase.GetCount(), 1u);
+    EXPECT_TRUE(broadphase.Remove(0));
+    EXPECT_FALSE(broadphase.Contains(0));
+    EXPECT_EQ(broadphase.GetCount(), 0u);
+}
+
+TEST_F(SweepAndPruneTest, RejectsNonFiniteBoxes)
+{
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    SweepAndPrune broadphase;
+    for (uint32_t id = 0; id < 20; ++id)
+    {
+        const float x = static_cast<float>(id);
+        broadphase.Insert(id, Math::BoundingBox(Math::Vector3(x, 0, 0), Math::Vector3(x + 1.5f, 1, 1)));
+    }
+    EXPECT_FALSE(broadphase.Insert(20, Math::BoundingBox(Math::Vector3(0, 0, 0), Math::Vector3(inf, 1, 1))));
+    EXPECT_FALSE(broadphase.Insert(21, Math::BoundingBox(Math::Vector3(-inf, 0, 0), Math::Vector3(1, 1, 1))));
+    EXPECT_FALSE(broadphase.Insert(22, Math::BoundingBox(Math::Vector3(0, 0, 0), Math::Vector3(1, nan, 1))));
+    EXPECT_FALSE(broadphase.Move(5, Math::BoundingBox(Math::Vector3(5, 0, 0), Math::Vector3(inf, inf, inf))));
+    EXPECT_FALSE(broadphase.Contains(20));
+    EXPECT_EQ(broadphase.GetCount(), 20u);
+
+    // The rejected move keeps the old box, so the chain of neighbours is unchanged
+    broadphase.UpdatePairs();
+    EXPECT_EQ(broadphase.GetPairs().size(), 19u);
+}
+
+TEST_F(SweepAndPruneTest, TouchingBoxesOverlap)
+{
+    SweepAndPrune broadphase;
+    broadphase.Insert(0, Math::BoundingBox(Math::Vector3(0, 0, 0), Math::Vector3(1, 1, 1)));
+    broadphase.Insert(1, Math::BoundingBox(Math::Vector3(1, 0, 0), Math::Vector3(2, 1, 1)));
+    broadphase.Insert(2, Math::BoundingBox(Math::Vector3(2.5f, 0, 0), Math::Vector3(3, 1, 1)));
+    broadphase.UpdatePairs();
+    ASSERT_EQ(broadphase.GetPairs().size(), 1u);
+    EXPECT_EQ(broadphase.GetAddedPairs().size(), 1u);
+
+    // Sliding box 2 until it touches box 1 adds their pair
+    broadphase.Move(2, Math::BoundingBox(Math::Vector3(2, 0, 0), Math::Vector3(2.5f, 1, 1)));
+    broadphase.UpdatePairs();
+    ASSERT_EQ(broadphase.GetAddedPairs().size(), 1u);
+    EXPECT_EQ(broadphase.GetAddedPairs()[0].idA, 1u);
+    EXPECT_EQ(broadphase.GetAddedPairs()[0].idB, 2u);
+    EXPECT_TRUE(broadphase.GetRemovedPairs().empty());
+}
+
+TEST_F(SweepAndPruneTest, IncrementalUpdatesMatchBruteForce)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> step(-0.15f, 0.15f);
+    std::uniform_int_distribution<int> chance(0, 99);
+
+    const uint32_t count = 1500;
+    std::vector<Math::BoundingBox> boxes(count);
+    std::vector<bool> present(count, false);
+    SweepAndPrune broadphase;
+    for (uint32_t id = 0; id < count; ++id)
+    {
+        boxes[id] = RandomBox(rng, 20.0f, 0.6f);
+        present[id] = id % 3 != 0;
+        if (present[id])
+            broadphase.Insert(id, boxes[id]);
+    }
+    broadphase.UpdatePairs();
+    PairSet previous = BruteForce(boxes, present);
+    ExpectConsistent(broadphase, {}, previous);
+    // Boxes spanning several slabs must still be reported once
+    EXPECT_GT(broadphase.GetSlabCount(), 1u);
+
+    for (int frame = 0; frame < 40; ++frame)
+    {
+        for (uint32_t id = 0; id < count; ++id)
+        {
+            const int roll = chance(rng);
+            if (!present[id])
+            {
+                // A few bodies appear every other frame
+                if (roll == 0 && frame % 2 == 0)
+                {
+                    boxes[id] = RandomBox(rng, 20.0f, 0.6f);
+                    present[id] = broadphase.Insert(id, boxes[id]);
+                }
+                continue;
+            }
+            if (roll == 0)
+            {
+                present[id] = !broadphase.Remove(id);
+                continue;
+            }
+            // Mostly small steps, occasionally a teleport
+            const Math::Vector3 offset = roll == 1 ? RandomBox(rng, 20.0f, 0.1f).GetCenter() - boxes[id].GetCenter()
+                                                   : Math::Vector3(step(rng), step(rng), step(rng));
+            boxes[id] = Math::BoundingBox(boxes[id].min + offset, boxes[id].max + offset);
+            ASSERT_TRUE(broadphase.Move(id, boxes[id]));
+        }
+        broadphase.UpdatePairs();
+        const PairSet expected = BruteForce(boxes, present);
+        ExpectConsistent(broadphase, previous, expected);
+        previous = expected;
+    }
+}
+
+TEST_F(SweepAndPruneTest, LargeInsertionMatchesBruteForce)
+{
+    std::mt19937 rng(21);
+    const uint32_t count = 4000;
+    std::vector<Math::BoundingBox> boxes(count);
+    std::vector<bool> present(count, true);
+    SweepAndPrune broadphase;
+
+    // Start with a few bodies, then add enough to lay the slabs out again
+    for (uint32_t id = 0; id < 10; ++id)
+    {
+        boxes[id] = RandomBox(rng, 30.0f, 1.0f);
+        broadphase.Insert(id, boxes[id]);
+    }
+    broadphase.UpdatePairs();
+    PairSet previous = ToSet(broadphase.GetPairs());
+
+    for (uint32_t id = 10; id < count; ++id)
+    {
+        boxes[id] = RandomBox(rng, 30.0f, 1.0f);
+        broadphase.Insert(id, boxes[id]);
+    }
+    // Also move an original body so that its pairs are removed
+    boxes[0] = Math::BoundingBox(Math::Vector3(100, 100, 100), Math::Vector3(101, 101, 101));
+    broadphase.Move(0, boxes[0]);
+    broadphase.UpdatePairs();
+    const PairSet expected = BruteForce(boxes, present);
+    ASSERT_GT(expected.size(), count / 2);
+    ExpectConsistent(broadphase, previous, expected);
+
+    // Removing bodies reports every pair they were part of
+    previous = expected;
+    for (uint32_t id = 0; id < count; id += 2)
+    {
+        broadphase.Remove(id);
+        present[id] = false;
+    }
+    broadphase.UpdatePairs();
+    ExpectConsistent(broadphase, previous, BruteForce(boxes, present));
+}
+
+TEST_F(SweepAndPruneTest, ReinsertBeforeUpdateActsAsMove)
+{
+    SweepAndPrune broadphase;
+    broadphase.Insert(0, Math::BoundingBox(Math::Vector3(0, 0, 0), Math::Vector3(1, 1, 1)));
+    broadphase.Insert(1, Math::BoundingBox(Math::Vector3(0.5f, 0, 0), Math::Vector3(1.5f, 1, 1)));
+    broadphase.UpdatePairs();
+    ASSERT_EQ(broadphase.GetPairs().size(), 1u);
+
+    EXPECT_TRUE(broadphase.Remove(1));
+    EXPECT_TRUE(broadphase.Insert(1, Math::BoundingBox(Math::Vector3(5, 0, 0), Math::Vector3(6, 1, 1))));
+    broadphase.UpdatePairs();
+    EXPECT_TRUE(broadphase.GetPairs().empty());
+    EXPECT_EQ(broadphase.GetRemovedPairs().size(), 1u);
+    EXPECT_EQ(broadphase.GetCount(), 2u);
+}
@@ -0,0 +1,181 @@
+#include "Spatial/KdTree.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace Spatial;
+
+class KdTreeTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::mt19937 rng(29);
+        std::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+        for (int i = 0; i < 4000; ++i)
+        {
+            points.emplace_back(coordinate(rng), coordinate(rng), coordinate(rng) * 0.1f);
+        }
+
+        // Duplicates and a tight cluster
+        for (int i = 0; i < 20; ++i)
+        {
+            points.push_back(points[7]);
+            points.emplace_back(10.0f + i * 1e-4f, 10.0f, 0.0f);
+        }
+
+        for (int i = 0; i < 40; ++i)
+        {
+            queries.emplace_back(coordinate(rng) * 1.3f, coordinate(rng) * 1.3f, coordinate(rng) * 0.2f);
+        }
+        queries.push_back(points[7]);
+        queries.emplace_back(10.0f, 10.0f, 0.0f);
+    }
+
+    std::vector<float> BruteForceDistances(const Math::Vector3& position) const
+    {
+        std::vector<float> distances;
+        for (const Math::Vector3& point : points)
+        {
+            const float dx = point.x - position.x;
+            const float dy = point.y - position.y;
+            const float dz = point.z - position.z;
+            distances.push_back(dx * dx + dy * dy + dz * dz);
+        }
+        return distances;
+    }
+
+    std::vector<uint32_t> BruteForceRadius(const Math::Vector3& center, float radius) const
+    {
+        const std::vector<float> distances = BruteForceDistances(center);
+        std::vector<uint32_t> result;
+        for (uint32_t i = 0; i < distances.size(); ++i)
+        {
+            if (distances[i] <= radius * radius)
+                result.push_back(i);
+        }
+        return result;
+    }
+
+    // Neighbour distances must match the k smallest, and indices must agree with them
+    void ExpectNearest(const Math::Vector3& position, size_t k, const uint32_t* indices, const float* distances,
+                       size_t found) const
+    {
+        std::vector<float> expected = BruteForceDistances(position);
+        const std::vector<float> all = expected;
+        std::sort(expected.begin(), expected.end());
+
+        ASSERT_EQ(found, std::min(k, points.size()));
+        for (size_t i = 0; i < found; ++i)
+        {
+            EXPECT_EQ(distances[i], expected[i]);
+            EXPECT_EQ(all[indices[i]], distances[i]);
+        }
+    }
+
+    static std::vector<uint32_t> Sorted(std::vector<uint32_t> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+
+    std::vector<Math::Vector3> points;
+    std::vector<Math::Vector3> queries;
+};
+
+TEST_F(KdTreeTest, NearestMatchesBruteForce)
+{
+    KdTree tree;
+    tree.Build(points);
+    EXPECT_EQ(tree.GetCount(), points.size());
+
+    for (size_t k : {size_t(1), size_t(5), size_t(32)})
+    {
+        for (const Math::Vector3& query : queries)
+        {
+            std::vector<uint32_t> indices(k);
+            std::vector<float> distances(k);
+            const size_t found = tree.FindNearest(query, k, indices.data(), distances.data());
+            ExpectNearest(query, k, indices.data(), distances.data(), found);
+        }
+    }
+}
+
+TEST_F(KdTreeTest, NearestRespectsMaxDistance)
+{
+    KdTree tree;
+    tree.Build(points);
+
+    uint32_t indices[16];
+    float distances[16];
+    const Math::Vector3 far(500.0f, 500.0f, 500.0f);
+    EXPECT_EQ(tree.FindNearest(far, 16, indices, distances, 100.0f), 0u);
+
+    const size_t found = tree.FindNearest(queries[0], 16, indices, distances, 3.0f);
+    EXPECT_EQ(found, std::min<size_t>(16, BruteForceRadius(queries[0], 3.0f).size()));
+    for (size_t i = 0; i < found; ++i)
+    {
+        EXPECT_LE(distances[i], 9.0f);
+    }
+}
+
+TEST_F(KdTreeTest, RadiusMatchesBruteForce)
+{
+    KdTree tree;
+    tree.Build(points);
+
+    for (float radius : {0.0f, 0.01f, 2.5f, 12.0f, 1000.0f})
+    {
+        for (const Math::Vector3& query : queries)
+        {
+            std::vector<uint32_t> found;
+            tree.QueryRadius(query, radius, found);
+            EXPECT_EQ(Sorted(found), BruteForceRadius(query, radius)) << "radius " << radius;
+        }
+    }
+}
+
+TEST_F(KdTreeTest, BatchesMatchSingleQueries)
+{
+    KdTree tree;
+    tree.Build(points);
+
+    const size_t k = 6;
+    std::vector<uint32_t> indices(queries.size() * k);
+    std::vector<float> distances(queries.size() * k);
+    std::vector<uint32_t> counts(queries.size());
+    tree.FindNearestBatch(queries.data(), queries.size(), k, indices.data(), distances.data(), counts.data());
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        ExpectNearest(queries[i], k, indices.data() + i * k, distances.data() + i * k, counts[i]);
+    }
+
+    std::vector<std::vector<uint32_t>> lists(3, std::vector<uint32_t>(5, 123)); // Stale contents are cleared
+    tree.QueryRadiusBatch(queries.data(), queries.size(), 8.0f, lists);
+    ASSERT_EQ(lists.size(), queries.size());
+    for (size_t i = 0; i < queries.size(); ++i)
+    {
+        EXPECT_EQ(Sorted(lists[i]), BruteForceRadius(queries[i], 8.0f));
+    }
+}
+
+TEST_F(KdTreeTest, SmallAndEmptyClouds)
+{
+    KdTree tree;
+    uint32_t index = 0;
+    float distance = 0.0f;
+    tree.Build(nullptr, 0);
+    EXPECT_EQ(tree.FindNearest(Math::Vector3::Zero(), 1, &index, &distance), 0u);
+
+    std::vector<uint32_t> found;
+    tree.QueryRadius(Math::Vector3::Zero(), 100.0f, found);
+    EXPECT_TRUE(found.empty());
+
+    // Rebuilding with fewer points than a leaf, and more neighbours than points
+    points.resize(3);
+    tree.Build(points);
+    uint32_t indices[8];
+    float distances[8];
+    const size_t count = tree.FindNearest(Math::Vector3::Zero(), 8, indices, distances);
+    ExpectNearest(Math::Vector3::Zero(), 8, indices, distances, count);
+}
@@ -0,0 +1,195 @@
+#include "Spatial/LinearBvh.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace Spatial;
+
+class LinearBvhTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::mt19937 rng(21);
+        std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> size(0.1f, 2.0f);
+        for (int i = 0; i < 5000; ++i)
+        {
+            const Math::Vector3 center(coordinate(rng), coordinate(rng), coordinate(rng));
+            boxes.push_back(Math::BoundingBox::FromCenterExtents(center, Math::Vector3(size(rng), size(rng), size(rng))));
+        }
+    }
+
+    static std::vector<uint32_t> Sorted(std::vector<uint32_t> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+
+    // Every primitive appears in exactly one leaf and every node contains its children
+    void ExpectValidTree(const LinearBvh& bvh, size_t primitiveCount)
+    {
+        const std::vector<BvhNode>& nodes = bvh.GetNodes();
+        ASSERT_EQ(nodes.size(), 2 * primitiveCount - 1);
+
+        std::vector<int> seen(primitiveCount, 0);
+        for (const BvhNode& node : nodes)
+        {
+            if (node.IsLeaf())
+            {
+                ASSERT_LT(node.left, primitiveCount);
+                seen[node.left]++;
+                EXPECT_TRUE(node.bounds.Contains(boxes[node.left]));
+            }
+            else
+            {
+                EXPECT_TRUE(node.bounds.Contains(nodes[node.left].bounds));
+                EXPECT_TRUE(node.bounds.Contains(nodes[node.right].bounds));
+            }
+        }
+        EXPECT_EQ(std::count(seen.begin(), seen.end(), 1), static_cast<long>(primitiveCount));
+    }
+
+    std::vector<Math::BoundingBox> boxes;
+};
+
+TEST_F(LinearBvhTest, BuildsValidTree)
+{
+    LinearBvh bvh;
+    bvh.Build(boxes);
+    EXPECT_EQ(bvh.GetPrimitiveCount(), boxes.size());
+    ExpectValidTree(bvh, boxes.size());
+
+    // Rebuilding reuses the scratch buffers and gives the same result
+    const std::vector<BvhNode> first = bvh.GetNodes();
+    bvh.Build(boxes);
+    ASSERT_EQ(bvh.GetNodes().size(), first.size());
+    EXPECT_EQ(bvh.GetNodes()[0].bounds.min, first[0].bounds.min);
+}
+
+TEST_F(LinearBvhTest, EmptyAndSinglePrimitive)
+{
+    LinearBvh bvh;
+    bvh.Build(nullptr, 0);
+    EXPECT_TRUE(bvh.GetNodes().empty());
+    EXPECT_TRUE(bvh.GetBounds().IsEmpty());
+
+    std::vector<uint32_t> found;
+    bvh.QueryBox(Math::BoundingBox(Math::Vector3(-1e9f, -1e9f, -1e9f), Math::Vector3(1e9f, 1e9f, 1e9f)), found);
+    EXPECT_TRUE(found.empty());
+
+    bvh.Build(boxes.data(), 1);
+    ASSERT_EQ(bvh.GetNodes().size(), 1u);
+    EXPECT_TRUE(bvh.GetNodes()[0].IsLeaf());
+    EXPECT_EQ(bvh.GetBounds().min, boxes[0].min);
+}
+
+TEST_F(LinearBvhTest, IdenticalCentroidsStillSplit)
+{
+    boxes.assign(100, Math::BoundingBox(Math::Vector3(0.0f, 0.0f, 0.0f), Math::Vector3(1.0f, 1.0f, 1.0f)));
+    LinearBvh bvh;
+    bvh.Build(boxes);
+    ExpectValidTree(bvh, boxes.size());
+}
+
+TEST_F(LinearBvhTest, BoxQueryMatchesBruteForce)
+{
+    LinearBvh bvh;
+    bvh.Build(boxes);
+
+    const Math::BoundingBox query(Math::Vector3(-20.0f, -30.0f, 0.0f), Math::Vector3(25.0f, 10.0f, 40.0f));
+    std::vector<uint32_t> expected;
+    for (uint32_t i = 0; i < boxes.size(); ++i)
+    {
+        if (boxes[i].Intersects(query))
+            expected.push_back(i);
+    }
+
+    std::vector<uint32_t> found;
+    bvh.QueryBox(query, found);
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(Sorted(found), expected);
+}
+
+TEST_F(LinearBvhTest, FrustumQueryMatchesBruteForce)
+{
+    LinearBvh bvh;
+    bvh.Build(boxes);
+
+    const Math::Frustum frustum = Math::Frustum::FromPerspective(Math::Vector3(0.0f, 0.0f, -120.0f), Math::Vector3::Forward(),
+                                                                 Math::Vector3::Up(), 0.8f, 1.5f, 0.1f, 150.0f);
+    std::vector<uint32_t> expected;
+    for (uint32_t i = 0; i < boxes.size(); ++i)
+    {
+        if (frustum.IntersectsBox(boxes[i]))
+            expected.push_back(i);
+    }
+
+    std::vector<uint32_t> found;
+    bvh.QueryFrustum(frustum, found);
+    EXPECT_FALSE(expected.empty());
+    EXPECT_LT(expected.size(), boxes.size());
+    EXPECT_EQ(Sorted(found), expected);
+}
+
+TEST_F(LinearBvhTest, RaycastFindsClosestBox)
+{
+    LinearBvh bvh;
+    bvh.Build(boxes);
+
+    const float inf = std::numeric_limits<float>::infinity();
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+    for (int ray = 0; ray < 50; ++ray)
+    {
+        const Math::Vector3 origin(coordinate(rng), coordinate(rng), -150.0f);
+        const Math::Vector3 direction = (Math::Vector3(coordinate(rng), coordinate(rng), 150.0f) - origin).Normalized();
+        const Math::Vector3 inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+
+        // Brute force over the same slab test the callback uses
+        float expected = inf;
+        for (const Math::BoundingBox& box : boxes)
+        {
+            float distance;
+            if (box.IntersectsRay(origin, inverse, expected, distance))
+                expected = std::min(expected, distance);
+        }
+
+        int tested = 0;
+        RaycastHit hit;
+        const bool found = bvh.Raycast(
+            origin, direction, inf,
+            [&](uint32_t primitive, float& distance) {
+                ++tested;
+                return boxes[primitive].IntersectsRay(origin, inverse, distance, distance);
+            },
+            hit);
+
+        ASSERT_EQ(found, expected != inf);
+        if (found)
+        {
+            EXPECT_FLOAT_EQ(hit.distance, expected);
+        }
+        EXPECT_LT(tested, static_cast<int>(boxes.size()) / 10); // The hierarchy prunes most boxes
+    }
+}
+
+TEST_F(LinearBvhTest, RaycastRespectsMaxDistance)
+{
+    boxes = {Math::BoundingBox(Math::Vector3(-1.0f, -1.0f, 10.0f), Math::Vector3(1.0f, 1.0f, 12.0f)),
+             Math::BoundingBox(Math::Vector3(-1.0f, -1.0f, 20.0f), Math::Vector3(1.0f, 1.0f, 22.0f))};
+    LinearBvh bvh;
+    bvh.Build(boxes);
+
+    const Math::Vector3 inverse(std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), 1.0f);
+    auto intersect = [&](uint32_t primitive, float& distance) {
+        return boxes[primitive].IntersectsRay(Math::Vector3::Zero(), inverse, distance, distance);
+    };
+
+    RaycastHit hit;
+    ASSERT_TRUE(bvh.Raycast(Math::Vector3::Zero(), Math::Vector3::Forward(), 100.0f, intersect, hit));
+    EXPECT_EQ(hit.id, 0u);
+    EXPECT_FLOAT_EQ(hit.distance, 10.0f);
+
+    EXPECT_FALSE(bvh.Raycast(Math::Vector3::Zero(), Math::Vector3::Forward(), 5.0f, intersect, hit));
+}
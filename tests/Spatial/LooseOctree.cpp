@@ -0,0 +1,233 @@
+#include "Spatial/LooseOctree.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace Spatial;
+
+class LooseOctreeTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::mt19937 rng(33);
+        std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> size(0.05f, 4.0f);
+        for (int i = 0; i < 3000; ++i)
+        {
+            const Math::Vector3 center(coordinate(rng), coordinate(rng), coordinate(rng));
+            boxes.push_back(Math::BoundingBox::FromCenterExtents(center, Math::Vector3(size(rng), size(rng), size(rng))));
+        }
+
+        // A few large boxes that only fit near the root
+        boxes.push_back(Math::BoundingBox::FromCenterExtents(Math::Vector3::Zero(), Math::Vector3(90.0f, 5.0f, 5.0f)));
+        boxes.push_back(Math::BoundingBox::FromCenterExtents(Math::Vector3(60.0f, 60.0f, 60.0f), Math::Vector3(30.0f, 30.0f, 30.0f)));
+    }
+
+    static Math::BoundingBox World()
+    {
+        return Math::BoundingBox::FromCenterExtents(Math::Vector3::Zero(), Math::Vector3(100.0f, 100.0f, 100.0f));
+    }
+
+    void InsertAll(LooseOctree& octree) const
+    {
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            ASSERT_TRUE(octree.Insert(i, boxes[i]));
+        }
+    }
+
+    static std::vector<uint32_t> Sorted(std::vector<uint32_t> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+
+    template <typename Overlaps>
+    std::vector<uint32_t> BruteForce(Overlaps&& overlaps) const
+    {
+        std::vector<uint32_t> result;
+        for (uint32_t i = 0; i < boxes.size(); ++i)
+        {
+            if (overlaps(boxes[i]))
+                result.push_back(i);
+        }
+        return result;
+    }
+
+    void ExpectBoxQueriesMatch(const LooseOctree& octree) const
+    {
+        const Math::BoundingBox queries[] = {
+            Math::BoundingBox::FromCenterExtents(Math::Vector3::Zero(), Math::Vector3(10.0f, 10.0f, 10.0f)),
+            Math::BoundingBox::FromCenterExtents(Math::Vector3(-80.0f, 40.0f, 95.0f), Math::Vector3(3.0f, 20.0f, 8.0f)),
+            Math::BoundingBox::FromCenterExtents(Math::Vector3(150.0f, 0.0f, 0.0f), Math::Vector3(45.0f, 45.0f, 45.0f)),
+            World()};
+        for (const Math::BoundingBox& query : queries)
+        {
+            std::vector<uint32_t> found;
+            octree.QueryBox(query, found);
+            EXPECT_EQ(Sorted(found), BruteForce([&](const Math::BoundingBox& box) { return box.Intersects(query); }));
+        }
+    }
+
+    std::vector<Math::BoundingBox> boxes;
+};
+
+TEST_F(LooseOctreeTest, BoxAndSphereQueriesMatchBruteForce)
+{
+    LooseOctree octree(World());
+    InsertAll(octree);
+    EXPECT_EQ(octree.GetCount(), boxes.size());
+    EXPECT_GT(octree.GetNodeCount(), 1u);
+    ExpectBoxQueriesMatch(octree);
+
+    for (float radius : {0.5f, 7.0f, 40.0f})
+    {
+        const Math::Vector3 center(20.0f, -35.0f, 5.0f);
+        std::vector<uint32_t> found;
+        octree.QuerySphere(center, radius, found);
+        EXPECT_EQ(Sorted(found),
+                  BruteForce([&](const Math::BoundingBox& box) { return box.IntersectsSphere(center, radius); }));
+    }
+}
+
+TEST_F(LooseOctreeTest, FrustumQueryMatchesBruteForce)
+{
+    LooseOctree octree(World());
+    InsertAll(octree);
+
+    const Math::Frustum frustum = Math::Frustum::FromPerspective(Math::Vector3(0.0f, 0.0f, -120.0f), Math::Vector3::Forward(),
+                                                                 Math::Vector3::Up(), 0.8f, 1.5f, 0.1f, 150.0f);
+    const std::vector<uint32_t> expected =
+        BruteForce([&](const Math::BoundingBox& box) { return frustum.IntersectsBox(box); });
+
+    std::vector<uint32_t> found;
+    octree.QueryFrustum(frustum, found);
+    EXPECT_FALSE(expected.empty());
+    EXPECT_LT(expected.size(), boxes.size());
+    EXPECT_EQ(Sorted(found), expected);
+}
+
+TEST_F(LooseOctreeTest, UpdateRelocatesMovedObjects)
+{
+    LooseOctree octree(World());
+    InsertAll(octree);
+    EXPECT_FALSE(octree.Insert(0, boxes[0]));
+
+    // Small jitters, long moves, size changes, and moves out of the world
+    std::mt19937 rng(8);
+    std::uniform_real_distribution<float> offset(-30.0f, 30.0f);
+    for (uint32_t i = 0; i < boxes.size(); ++i)
+    {
+        const float scale = (i % 7 == 0) ? 20.0f : (i % 3 == 0 ? 0.05f : 1.0f);
+        const Math::Vector3 center = boxes[i].GetCenter() + Math::Vector3(offset(rng), offset(rng), offset(rng)) * scale;
+        boxes[i] = Math::BoundingBox::FromCenterExtents(center, boxes[i].GetExtents() * (i % 5 == 0 ? 3.0f : 1.0f));
+        ASSERT_TRUE(octree.Update(i, boxes[i]));
+    }
+
+    EXPECT_FALSE(octree.Update(static_cast<uint32_t>(boxes.size()), boxes[0]));
+    ExpectBoxQueriesMatch(octree);
+}
+
+TEST_F(LooseOctreeTest, UpdateBatchMatchesIndividualUpdates)
+{
+    LooseOctree octree(World());
+    InsertAll(octree);
+
+    std::mt19937 rng(12);
+    std::uniform_real_distribution<float> offset(-3.0f, 3.0f);
+    std::vector<uint32_t> ids;
+    for (uint32_t i = 0; i < boxes.size(); i += 2)
+    {
+        boxes[i] = Math::BoundingBox::FromCenterExtents(
+            boxes[i].GetCenter() + Math::Vector3(offset(rng), offset(rng), offset(rng)), boxes[i].GetExtents());
+        ids.push_back(i);
+    }
+
+    std::vector<Math::BoundingBox> bounds;
+    for (uint32_t id : ids)
+    {
+        bounds.push_back(boxes[id]);
+    }
+    EXPECT_TRUE(octree.UpdateBatch(ids.data(), bounds.data(), ids.size()));
+    ExpectBoxQueriesMatch(octree);
+
+    // Missing ids are reported, and the others are still applied
+    const uint32_t mixed[] = {1, 999999};
+    boxes[1] = Math::BoundingBox::FromCenterExtents(Math::Vector3(-99.0f, -99.0f, -99.0f), Math::Vector3(0.5f, 0.5f, 0.5f));
+    const Math::BoundingBox mixedBounds[] = {boxes[1], boxes[1]};
+    EXPECT_FALSE(octree.UpdateBatch(mixed, mixedBounds, 2));
+    ExpectBoxQueriesMatch(octree);
+}
+
+TEST_F(LooseOctreeTest, RemovingEverythingReleasesNodes)
+{
+    LooseOctree octree(World());
+    InsertAll(octree);
+
+    // Remove half, check, then the rest
+    for (uint32_t i = 0; i < boxes.size(); i += 2)
+    {
+        ASSERT_TRUE(octree.Remove(i));
+        boxes[i] = Math::BoundingBox(); // Empty boxes match nothing
+    }
+    EXPECT_FALSE(octree.Remove(0));
+    EXPECT_FALSE(octree.Contains(0));
+    EXPECT_TRUE(octree.Contains(1));
+    ExpectBoxQueriesMatch(octree);
+
+    for (uint32_t i = 1; i < boxes.size(); i += 2)
+    {
+        ASSERT_TRUE(octree.Remove(i));
+    }
+    EXPECT_EQ(octree.GetCount(), 0u);
+    EXPECT_EQ(octree.GetNodeCount(), 1u);
+
+    // Freed blocks are reused
+    InsertAll(octree);
+    EXPECT_EQ(octree.GetCount(), boxes.size());
+    octree.Clear();
+    EXPECT_EQ(octree.GetNodeCount(), 1u);
+    EXPECT_FALSE(octree.Contains(1));
+}
+
+TEST_F(LooseOctreeTest, RaycastFindsClosestBox)
+{
+    LooseOctree octree(World());
+    InsertAll(octree);
+
+    const float inf = std::numeric_limits<float>::infinity();
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+    for (int ray = 0; ray < 50; ++ray)
+    {
+        const Math::Vector3 origin(coordinate(rng), coordinate(rng), -150.0f);
+        const Math::Vector3 direction = (Math::Vector3(coordinate(rng), coordinate(rng), 150.0f) - origin).Normalized();
+        const Math::Vector3 inverse(1.0f / direction.x, 1.0f / direction.y, 1.0f / direction.z);
+
+        float expected = inf;
+        for (const Math::BoundingBox& box : boxes)
+        {
+            float distance;
+            if (box.IntersectsRay(origin, inverse, expected, distance))
+                expected = std::min(expected, distance);
+        }
+
+        int tested = 0;
+        RaycastHit hit;
+        const bool found = octree.Raycast(
+            origin, direction, inf,
+            [&](uint32_t id, float& distance) {
+                ++tested;
+                return boxes[id].IntersectsRay(origin, inverse, distance, distance);
+            },
+            hit);
+
+        ASSERT_EQ(found, expected != inf);
+        if (found)
+        {
+            EXPECT_FLOAT_EQ(hit.distance, expected);
+        }
+        EXPECT_LT(tested, static_cast<int>(boxes.size()) / 4);
+    }
+}
@@ -0,0 +1,75 @@
+#include "Spatial/Morton.h"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace Spatial;
+
+class MortonTest : public ::testing::Test
+{
+};
+
+TEST_F(MortonTest, InterleavesXYZ)
+{
+    EXPECT_EQ(Morton::Encode(0, 0, 0), 0u);
+    EXPECT_EQ(Morton::Encode(0, 0, 1), 1u);
+    EXPECT_EQ(Morton::Encode(0, 1, 0), 2u);
+    EXPECT_EQ(Morton::Encode(1, 0, 0), 4u);
+    EXPECT_EQ(Morton::Encode(2, 0, 0), 32u);
+    EXPECT_EQ(Morton::Encode(Morton::MAX_COORDINATE, Morton::MAX_COORDINATE, Morton::MAX_COORDINATE),
+              (1u << Morton::CODE_BITS) - 1);
+}
+
+TEST_F(MortonTest, DecodeInvertsEncode)
+{
+    std::mt19937 rng(7);
+    for (int i = 0; i < 1000; ++i)
+    {
+        const uint32_t x = rng() & Morton::MAX_COORDINATE;
+        const uint32_t y = rng() & Morton::MAX_COORDINATE;
+        const uint32_t z = rng() & Morton::MAX_COORDINATE;
+
+        uint32_t dx, dy, dz;
+        Morton::Decode(Morton::Encode(x, y, z), dx, dy, dz);
+        EXPECT_EQ(dx, x);
+        EXPECT_EQ(dy, y);
+        EXPECT_EQ(dz, z);
+    }
+}
+
+TEST_F(MortonTest, EncodePointQuantizesToBounds)
+{
+    const Math::BoundingBox bounds(Math::Vector3(-1.0f, 0.0f, 0.0f), Math::Vector3(1.0f, 1.0f, 0.0f));
+
+    uint32_t x, y, z;
+    Morton::Decode(Morton::EncodePoint(Math::Vector3(0.0f, 1.0f, 0.0f), bounds), x, y, z);
+    EXPECT_EQ(x, 512u);
+    EXPECT_EQ(y, Morton::MAX_COORDINATE); // The max face clamps into the last cell
+    EXPECT_EQ(z, 0u);                     // Flat axes map to cell 0
+
+    // Points outside the bounds clamp to the border cells
+    Morton::Decode(Morton::EncodePoint(Math::Vector3(-5.0f, 9.0f, 3.0f), bounds), x, y, z);
+    EXPECT_EQ(x, 0u);
+    EXPECT_EQ(y, Morton::MAX_COORDINATE);
+}
+
+TEST_F(MortonTest, BatchMatchesSinglePoint)
+{
+    // 37 points so the 8-wide path and the scalar tail both run
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+    std::vector<Math::Vector3> points(37);
+    Math::BoundingBox bounds;
+    for (Math::Vector3& point : points)
+    {
+        point = Math::Vector3(coordinate(rng), coordinate(rng), coordinate(rng));
+        bounds.Expand(point);
+    }
+
+    std::vector<uint32_t> codes(points.size());
+    Morton::EncodePoints(points.data(), points.size(), bounds, codes.data());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        EXPECT_EQ(codes[i], Morton::EncodePoint(points[i], bounds)) << "point " << i;
+    }
+}
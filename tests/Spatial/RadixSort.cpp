@@ -0,0 +1,91 @@
+#include "Spatial/RadixSort.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+
+using namespace Spatial;
+
+class RadixSortTest : public ::testing::Test
+{
+  protected:
+    // Reference: stable sort of (key, original index) on the masked key
+    static void ExpectSortedLikeStableSort(const std::vector<uint32_t>& original, uint32_t keyBits)
+    {
+        const uint32_t mask = keyBits >= 32 ? 0xFFFFFFFF : (1u << keyBits) - 1;
+
+        std::vector<uint32_t> expected(original.size());
+        std::iota(expected.begin(), expected.end(), 0u);
+        std::stable_sort(expected.begin(), expected.end(),
+                         [&](uint32_t a, uint32_t b) { return (original[a] & mask) < (original[b] & mask); });
+
+        std::vector<uint32_t> keys = original;
+        std::vector<uint32_t> values(original.size());
+        std::iota(values.begin(), values.end(), 0u);
+        ASSERT_TRUE(RadixSort::SortPairs(keys, values, keyBits));
+
+        ASSERT_EQ(values, expected);
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            ASSERT_EQ(keys[i], original[values[i]]);
+        }
+    }
+};
+
+TEST_F(RadixSortTest, SortsRandomKeysStably)
+{
+    // Large enough to be split into several chunks
+    std::mt19937 rng(11);
+    std::vector<uint32_t> keys(200000);
+    for (uint32_t& key : keys)
+    {
+        key = rng() % 5000; // Plenty of duplicates to exercise stability
+    }
+    ExpectSortedLikeStableSort(keys, 32);
+}
+
+TEST_F(RadixSortTest, FullWidthKeys)
+{
+    std::mt19937 rng(5);
+    std::vector<uint32_t> keys(5000);
+    for (uint32_t& key : keys)
+    {
+        key = rng();
+    }
+    keys[0] = 0xFFFFFFFF;
+    keys[1] = 0;
+    ExpectSortedLikeStableSort(keys, 32);
+}
+
+TEST_F(RadixSortTest, IgnoresBitsAboveKeyBits)
+{
+    std::mt19937 rng(9);
+    std::vector<uint32_t> keys(3000);
+    for (uint32_t& key : keys)
+    {
+        key = rng();
+    }
+    ExpectSortedLikeStableSort(keys, 30);
+    ExpectSortedLikeStableSort(keys, 12);
+}
+
+TEST_F(RadixSortTest, SingleDigitPassesAreSkipped)
+{
+    // Only the second byte varies, so three passes have a single digit
+    std::vector<uint32_t> keys = {0x00000300, 0x00000100, 0x00000200, 0x00000100};
+    ExpectSortedLikeStableSort(keys, 32);
+
+    std::vector<uint32_t> same(1000, 0xABCDEF01);
+    ExpectSortedLikeStableSort(same, 32);
+}
+
+TEST_F(RadixSortTest, MismatchedSizesAreRejected)
+{
+    std::vector<uint32_t> keys = {3, 1, 2};
+    std::vector<uint32_t> values = {0, 1};
+    EXPECT_FALSE(RadixSort::SortPairs(keys, values));
+    EXPECT_EQ(keys, (std::vector<uint32_t>{3, 1, 2}));
+
+    std::vector<uint32_t> empty;
+    EXPECT_TRUE(RadixSort::SortPairs(empty, empty));
+}
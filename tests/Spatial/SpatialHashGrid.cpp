@@ -0,0 +1,205 @@
+#include "Spatial/SpatialHashGrid.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace Spatial;
+
+class SpatialHashGridTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        std::mt19937 rng(17);
+        std::uniform_real_distribution<float> coordinate(-50.0f, 50.0f);
+        for (int i = 0; i < 2000; ++i)
+        {
+            positions.emplace_back(coordinate(rng), coordinate(rng), coordinate(rng));
+        }
+    }
+
+    std::vector<uint32_t> BruteForceRadius(const Math::Vector3& center, float radius) const
+    {
+        std::vector<uint32_t> result;
+        for (uint32_t i = 0; i < positions.size(); ++i)
+        {
+            if (Math::Vector3::DistanceSquared(positions[i], center) <= radius * radius)
+                result.push_back(i);
+        }
+        return result;
+    }
+
+    static std::vector<uint32_t> Sorted(std::vector<uint32_t> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+
+    void ExpectQueriesMatch(const SpatialHashGrid& grid)
+    {
+        const Math::Vector3 centers[] = {Math::Vector3(0.0f, 0.0f, 0.0f), Math::Vector3(-31.5f, 12.0f, 40.0f),
+                                         Math::Vector3(49.0f, -49.0f, 0.5f)};
+        for (const Math::Vector3& center : centers)
+        {
+            for (float radius : {0.5f, 4.0f, 11.0f, 500.0f})
+            {
+                std::vector<uint32_t> found;
+                grid.QueryRadius(center, radius, found);
+                EXPECT_EQ(Sorted(found), BruteForceRadius(center, radius)) << "radius " << radius;
+            }
+        }
+    }
+
+    std::vector<Math::Vector3> positions;
+};
+
+TEST_F(SpatialHashGridTest, CellsRoundTowardNegativeInfinity)
+{
+    SpatialHashGrid grid(2.0f);
+    EXPECT_EQ(grid.GetCell(Math::Vector3(0.5f, 3.9f, -0.1f)), Math::Int3(0, 1, -1));
+    EXPECT_EQ(grid.GetCell(Math::Vector3(-4.0f, -4.1f, 0.0f)), Math::Int3(-2, -3, 0));
+}
+
+TEST_F(SpatialHashGridTest, InsertedPointsMatchBruteForce)
+{
+    SpatialHashGrid grid(5.0f);
+    for (uint32_t i = 0; i < positions.size(); ++i)
+    {
+        ASSERT_TRUE(grid.Insert(i, positions[i]));
+    }
+    EXPECT_FALSE(grid.Insert(3, positions[3]));
+    EXPECT_EQ(grid.GetCount(), positions.size());
+    ExpectQueriesMatch(grid);
+}
+
+TEST_F(SpatialHashGridTest, RebuildMatchesBruteForce)
+{
+    SpatialHashGrid grid(5.0f);
+    grid.Insert(9999, Math::Vector3(1.0f, 1.0f, 1.0f)); // Replaced by the rebuild
+    grid.Rebuild(positions.data(), positions.size());
+
+    EXPECT_EQ(grid.GetCount(), positions.size());
+    EXPECT_FALSE(grid.Contains(9999));
+    ExpectQueriesMatch(grid);
+
+    // Rebuilding again with the same grid reuses its storage
+    positions.resize(1000);
+    grid.Rebuild(positions.data(), positions.size());
+    EXPECT_EQ(grid.GetCount(), 1000u);
+    ExpectQueriesMatch(grid);
+}
+
+TEST_F(SpatialHashGridTest, MoveAcrossCells)
+{
+    SpatialHashGrid grid(5.0f);
+    grid.Rebuild(positions.data(), positions.size());
+
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<float> step(-7.0f, 7.0f);
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        for (uint32_t i = 0; i < positions.size(); i += 3)
+        {
+            positions[i] += Math::Vector3(step(rng), step(rng), step(rng));
+            ASSERT_TRUE(grid.Move(i, positions[i]));
+        }
+        ExpectQueriesMatch(grid);
+    }
+
+    EXPECT_FALSE(grid.Move(123456, Math::Vector3::Zero()));
+}
+
+TEST_F(SpatialHashGridTest, EmptiedCellsAreReused)
+{
+    SpatialHashGrid grid(5.0f);
+    grid.Rebuild(positions.data(), positions.size());
+    const size_t startCells = grid.GetCellCount();
+
+    // Every point marches through fresh cells; the emptied ones must be recycled
+    const Math::Vector3 step(5.0f, 2.5f, -5.0f);
+    for (int frame = 0; frame < 40; ++frame)
+    {
+        for (uint32_t i = 0; i < positions.size(); ++i)
+        {
+            positions[i] += step;
+            ASSERT_TRUE(grid.Move(i, positions[i]));
+        }
+        EXPECT_LE(grid.GetCellCount(), startCells + positions.size());
+    }
+    for (Math::Vector3& position : positions)
+    {
+        position -= step * 40.0f;
+    }
+    for (uint32_t i = 0; i < positions.size(); ++i)
+    {
+        grid.Move(i, positions[i]);
+    }
+    ExpectQueriesMatch(grid);
+
+    // Removing every point frees every cell, and reinserting reuses them
+    for (uint32_t i = 0; i < positions.size(); ++i)
+    {
+        ASSERT_TRUE(grid.Remove(i));
+    }
+    const size_t cellsBeforeInsert = grid.GetCellCount();
+    for (uint32_t i = 0; i < positions.size(); ++i)
+    {
+        ASSERT_TRUE(grid.Insert(i, positions[i]));
+    }
+    EXPECT_EQ(grid.GetCellCount(), cellsBeforeInsert);
+    ExpectQueriesMatch(grid);
+}
+
+TEST_F(SpatialHashGridTest, RemoveKeepsOtherPoints)
+{
+    SpatialHashGrid grid(5.0f);
+    grid.Rebuild(positions.data(), positions.size());
+
+    // Remove every other point; the brute force skips them by moving them far away
+    for (uint32_t i = 0; i < positions.size(); i += 2)
+    {
+        ASSERT_TRUE(grid.Remove(i));
+        positions[i] = Math::Vector3(1e6f, 1e6f, 1e6f);
+    }
+    EXPECT_FALSE(grid.Remove(0));
+    EXPECT_FALSE(grid.Contains(0));
+    EXPECT_TRUE(grid.Contains(1));
+    EXPECT_EQ(grid.GetCount(), positions.size() / 2);
+    ExpectQueriesMatch(grid);
+
+    ASSERT_TRUE(grid.Insert(0, Math::Vector3(0.0f, 0.0f, 0.0f)));
+    positions[0] = Math::Vector3(0.0f, 0.0f, 0.0f);
+    ExpectQueriesMatch(grid);
+}
+
+TEST_F(SpatialHashGridTest, BoxQuery)
+{
+    SpatialHashGrid grid(4.0f);
+    grid.Rebuild(positions.data(), positions.size());
+
+    const Math::BoundingBox box(Math::Vector3(-10.0f, -3.0f, 5.0f), Math::Vector3(12.5f, 20.0f, 9.0f));
+    std::vector<uint32_t> expected;
+    for (uint32_t i = 0; i < positions.size(); ++i)
+    {
+        if (box.Contains(positions[i]))
+            expected.push_back(i);
+    }
+
+    std::vector<uint32_t> found;
+    grid.QueryBox(box, found);
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(Sorted(found), expected);
+}
+
+TEST_F(SpatialHashGridTest, ClearForgetsEverything)
+{
+    SpatialHashGrid grid(1.0f);
+    grid.Insert(4, Math::Vector3(0.5f, 0.5f, 0.5f));
+    grid.Clear();
+
+    std::vector<uint32_t> found;
+    grid.QueryRadius(Math::Vector3(0.5f, 0.5f, 0.5f), 10.0f, found);
+    EXPECT_TRUE(found.empty());
+    EXPECT_EQ(grid.GetCount(), 0u);
+    EXPECT_TRUE(grid.Insert(4, Math::Vector3(0.5f, 0.5f, 0.5f)));
+}
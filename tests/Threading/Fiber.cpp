@@ -0,0 +1,73 @@
+#include "Threading/Fiber.h"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace Threading;
+
+class FiberTest : public ::testing::Test
+{
+  protected:
+    struct PingPong
+    {
+        Fiber* caller = nullptr; // Switched back to after each step
+        Fiber worker;
+        std::vector<int> trace;
+    };
+
+    static void Resume(PingPong& state, Fiber& caller)
+    {
+        state.caller = &caller;
+        caller.SwitchTo(state.worker);
+    }
+
+    static void Bounce(void* argument)
+    {
+        PingPong& state = *static_cast<PingPong*>(argument);
+        for (int i = 0;; ++i)
+        {
+            state.trace.push_back(i);
+            state.worker.SwitchTo(*state.caller);
+        }
+    }
+};
+
+TEST_F(FiberTest, SwitchesKeepEachStack)
+{
+    PingPong state;
+    Fiber thread;
+    ASSERT_TRUE(thread.ConvertThread());
+    ASSERT_TRUE(state.worker.Create(64 * 1024, &FiberTest::Bounce, &state));
+
+    for (int i = 0; i < 5; ++i)
+    {
+        state.trace.push_back(100 + i);
+        Resume(state, thread);
+    }
+    thread.RevertThread();
+
+    // Each side resumes where it left off, with its locals intact
+    const std::vector<int> expected = {100, 0, 101, 1, 102, 2, 103, 3, 104, 4};
+    EXPECT_EQ(state.trace, expected);
+}
+
+TEST_F(FiberTest, SuspendedFiberResumesOnAnotherThread)
+{
+    PingPong state;
+    ASSERT_TRUE(state.worker.Create(64 * 1024, &FiberTest::Bounce, &state));
+    const auto step = [&state]() {
+        Fiber thread;
+        ASSERT_TRUE(thread.ConvertThread());
+        Resume(state, thread);
+        thread.RevertThread();
+    };
+
+    // Started on one thread, suspended, then continued on another
+    std::thread first(step);
+    first.join();
+    std::thread second(step);
+    second.join();
+
+    const std::vector<int> expected = {0, 1};
+    EXPECT_EQ(state.trace, expected);
+}
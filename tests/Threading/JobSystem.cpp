@@ -0,0 +1,262 @@
+#include "Threading/JobSystem.h"
+#include "Threading/ParallelFor.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace Threading;
+
+class JobSystemTest : public ::testing::Test
+{
+  protected:
+    static JobSystemOptions Workers(size_t count)
+    {
+        JobSystemOptions options;
+        options.workerCount = count;
+        return options;
+    }
+};
+
+TEST_F(JobSystemTest, RunsJobsAndWaitsOnCounter)
+{
+    JobSystem jobs(Workers(3));
+    EXPECT_EQ(jobs.GetWorkerCount(), 3u);
+    EXPECT_EQ(jobs.GetThreadCount(), 4u);
+
+    std::atomic<int> sum(0);
+    JobCounter counter;
+    for (int i = 1; i <= 1000; ++i)
+    {
+        jobs.Run([&sum, i]() { sum.fetch_add(i, std::memory_order_relaxed); }, &counter);
+    }
+    jobs.WaitForCounter(counter);
+    EXPECT_TRUE(counter.IsDone());
+    EXPECT_EQ(sum.load(), 500500);
+
+    // The counter and the pooled jobs are reusable
+    jobs.Run([&sum]() { sum.store(0); }, &counter);
+    jobs.WaitForCounter(counter);
+    EXPECT_EQ(sum.load(), 0);
+}
+
+TEST_F(JobSystemTest, ParentsFinishAfterTheirChildren)
+{
+    JobSystem jobs(Workers(3));
+    std::atomic<int> children(0);
+    JobCounter counter;
+    for (int parent = 0; parent < 8; ++parent)
+    {
+        // Children are not counted themselves, only through their parent
+        jobs.Run([&jobs, &children]() {
+            for (int child = 0; child < 10; ++child)
+            {
+                jobs.Run([&children]() {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                    children.fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+        }, &counter);
+    }
+    jobs.WaitForCounter(counter);
+    EXPECT_EQ(children.load(), 80);
+}
+
+TEST_F(JobSystemTest, ParallelForRunsEveryChunkOnce)
+{
+    JobSystem jobs(Workers(3));
+    const size_t count = 10007;
+    const size_t grain = 64;
+    const size_t chunkCount = (count + grain - 1) / grain;
+    std::vector<std::atomic<int>> calls(chunkCount);
+    std::atomic<bool> aligned(true);
+    jobs.ParallelFor(count, grain, [&](size_t begin, size_t end) {
+        if (begin % grain != 0 || end != std::min(begin + grain, count))
+            aligned.store(false);
+        calls[begin / grain].fetch_add(1, std::memory_order_relaxed);
+    });
+    EXPECT_TRUE(aligned.load());
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        EXPECT_EQ(calls[chunk].load(), 1) << chunk;
+    }
+
+    size_t single = 0;
+    jobs.ParallelFor(10, 100, [&](size_t begin, size_t end) { single += end - begin; });
+    EXPECT_EQ(single, 10u);
+    jobs.ParallelFor(0, 1, [&](size_t, size_t) { ADD_FAILURE(); });
+}
+
+TEST_F(JobSystemTest, NestedLoopsDoNotBlockWorkers)
+{
+    // More outer iterations than threads, each waiting on an inner loop: a
+    // worker that blocked on its inner loop would deadlock the pool
+    JobSystem jobs(Workers(2));
+    std::vector<long long> sums(32, 0);
+    jobs.ParallelFor(sums.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t outer = begin; outer < end; ++outer)
+        {
+            std::atomic<long long> sum(0);
+            jobs.ParallelFor(1000, 16, [&](size_t first, size_t last) {
+                long long local = 0;
+                for (size_t i = first; i < last; ++i)
+                {
+                    local += static_cast<long long>(i);
+                }
+                sum.fetch_add(local, std::memory_order_relaxed);
+            });
+            sums[outer] = sum.load();
+        }
+    });
+    for (long long sum : sums)
+    {
+        EXPECT_EQ(sum, 499500);
+    }
+}
+
+TEST_F(JobSystemTest, WorkSpreadsAcrossThreads)
+{
+    JobSystemOptions options = Workers(3);
+    options.affinity = ThreadAffinity::PinWorkers;
+    JobSystem jobs(options);
+
+    std::mutex mutex;
+    std::set<std::thread::id> threads;
+    jobs.ParallelFor(64, 1, [&](size_t, size_t) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+    });
+    EXPECT_GT(threads.size(), 1u);
+}
+
+TEST_F(JobSystemTest, WithoutWorkersJobsRunInline)
+{
+    JobSystem jobs(Workers(0));
+    EXPECT_EQ(jobs.GetThreadCount(), 1u);
+    int value = 0;
+    JobCounter counter;
+    jobs.Run([&value]() { value = 7; }, &counter);
+    EXPECT_EQ(value, 7);
+    EXPECT_TRUE(counter.IsDone());
+
+    size_t covered = 0;
+    jobs.ParallelFor(100, 7, [&](size_t begin, size_t end) { covered += end - begin; });
+    EXPECT_EQ(covered, 100u);
+}
+
+TEST_F(JobSystemTest, DefaultSystemBacksParallelFor)
+{
+    // Querying creates the default instance, after which it cannot be reconfigured
+    EXPECT_GE(GetWorkerCount(), 1u);
+    EXPECT_FALSE(JobSystem::InitializeDefault(JobSystemOptions()));
+
+    std::vector<int> values(5000, 1);
+    std::atomic<int> sum(0);
+    ParallelFor(values.size(), 128, [&](size_t begin, size_t end) {
+        int local = 0;
+        for (size_t i = begin; i < end; ++i)
+        {
+            local += values[i];
+        }
+        sum.fetch_add(local);
+    });
+    EXPECT_EQ(sum.load(), 5000);
+}
+
+TEST_F(JobSystemTest, WaitingParksTheFiberAndFreesTheWorker)
+{
+    // One worker: if a waiting job held it, the gate job could never run
+    JobSystemOptions options = Workers(1);
+    options.fiberCount = 32;
+    JobSystem jobs(options);
+    EXPECT_EQ(jobs.GetFiberCount(), 32u);
+
+    const int waiterCount = 10;
+    std::atomic<bool> open(false);
+    std::atomic<int> woken(0);
+    JobCounter gate;
+    JobCounter all;
+    jobs.Run([&]() {
+        // The worker pops its own jobs newest first: the waiters, then the gate
+        jobs.Run([&open]() {
+            while (!open.load())
+                std::this_thread::yield();
+        }, &gate);
+        for (int i = 0; i < waiterCount; ++i)
+        {
+            jobs.Run([&jobs, &gate, &woken]() {
+                jobs.WaitForCounter(gate);
+                woken.fetch_add(1);
+            });
+        }
+    }, &all);
+
+    while (jobs.GetParkedFiberCount() < static_cast<size_t>(waiterCount))
+        std::this_thread::yield();
+    EXPECT_EQ(jobs.GetParkedFiberCount(), static_cast<size_t>(waiterCount));
+    EXPECT_EQ(woken.load(), 0);
+    open.store(true);
+    jobs.WaitForCounter(all);
+    EXPECT_EQ(woken.load(), waiterCount);
+    EXPECT_EQ(jobs.GetParkedFiberCount(), 0u);
+}
+
+TEST_F(JobSystemTest, DeepWaitChainsOutgrowTheFiberPool)
+{
+    // Each link waits on the next; past the pool size waits run jobs in place
+    JobSystemOptions options = Workers(2);
+    options.fiberCount = 8;
+    JobSystem jobs(options);
+
+    struct Chain
+    {
+        static void Link(JobSystem& jobs, std::atomic<int>& depth, int remaining)
+        {
+            depth.fetch_add(1);
+            if (remaining == 0)
+                return;
+            JobCounter next;
+            jobs.Run([&jobs, &depth, remaining]() { Link(jobs, depth, remaining - 1); }, &next);
+            jobs.WaitForCounter(next);
+        }
+    };
+
+    std::atomic<int> depth(0);
+    JobCounter counter;
+    jobs.Run([&jobs, &depth]() { Chain::Link(jobs, depth, 40); }, &counter);
+    jobs.WaitForCounter(counter);
+    EXPECT_EQ(depth.load(), 41);
+    EXPECT_EQ(jobs.GetParkedFiberCount(), 0u);
+}
+
+TEST_F(JobSystemTest, NestedLoopsOnFibers)
+{
+    JobSystemOptions options = Workers(3);
+    options.fiberCount = 16;
+    JobSystem jobs(options);
+    std::vector<long long> sums(64, 0);
+    jobs.ParallelFor(sums.size(), 1, [&](size_t begin, size_t end) {
+        for (size_t outer = begin; outer < end; ++outer)
+        {
+            std::atomic<long long> sum(0);
+            jobs.ParallelFor(1000, 16, [&](size_t first, size_t last) {
+                long long local = 0;
+                for (size_t i = first; i < last; ++i)
+                {
+                    local += static_cast<long long>(i);
+                }
+                sum.fetch_add(local, std::memory_order_relaxed);
+            });
+            sums[outer] = sum.load();
+        }
+    });
+    for (long long sum : sums)
+    {
+        EXPECT_EQ(sum, 499500);
+    }
+}
@@ -0,0 +1,170 @@
+#include "Threading/Task.h"
+#include "Threading/IoQueue.h"
+#include <atomic>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Threading;
+
+class TaskTest : public ::testing::Test
+{
+  protected:
+    static JobSystemOptions Workers(size_t count)
+    {
+        JobSystemOptions options;
+        options.workerCount = count;
+        return options;
+    }
+
+    static Task<int> Add(int a, int b) { co_return a + b; }
+
+    static Task<int> SumOnJobs(JobSystem& jobs, int count)
+    {
+        int total = 0;
+        for (int i = 0; i < count; ++i)
+        {
+            co_await Schedule(jobs);
+            total += co_await Add(i, 1);
+        }
+        co_return total;
+    }
+
+    static Task<> Touch(JobSystem& jobs, std::atomic<int>& touched)
+    {
+        co_await Schedule(jobs);
+        touched.fetch_add(1);
+    }
+
+    static Task<> HopToQueue(JobSystem& jobs, ResumeQueue& queue, std::thread::id& finishedOn)
+    {
+        co_await Schedule(jobs);
+        co_await queue.Schedule();
+        finishedOn = std::this_thread::get_id();
+    }
+
+    // Read on the I/O thread, decode on a worker
+    static Task<int> LoadChecksum(IoQueue& io, const char* path)
+    {
+        std::vector<uint8_t> data;
+        if (!co_await io.ReadFile(path, data))
+            co_return -1;
+        int checksum = 0;
+        for (uint8_t byte : data)
+        {
+            checksum += byte;
+        }
+        co_return checksum;
+    }
+
+    static std::string WriteTempFile(const char* name, size_t size)
+    {
+        const std::string path = ::testing::TempDir() + name;
+        std::ofstream file(path, std::ios::binary);
+        for (size_t i = 0; i < size; ++i)
+        {
+            file.put(static_cast<char>(i % 7));
+        }
+        return path;
+    }
+};
+
+TEST_F(TaskTest, TasksChainAndReturnValues)
+{
+    JobSystem jobs(Workers(2));
+    EXPECT_EQ(SyncWait(jobs, SumOnJobs(jobs, 100)), 5050);
+
+    // Without workers every step runs inline
+    JobSystem inlineJobs(Workers(0));
+    EXPECT_EQ(SyncWait(inlineJobs, SumOnJobs(inlineJobs, 10)), 55);
+}
+
+TEST_F(TaskTest, SpawnSignalsTheCounterWhenTasksFinish)
+{
+    JobSystemOptions options = Workers(3);
+    options.fiberCount = 16;
+    JobSystem jobs(options);
+    std::atomic<int> touched(0);
+    JobCounter counter;
+    for (int i = 0; i < 200; ++i)
+    {
+        Spawn(jobs, Touch(jobs, touched), &counter);
+    }
+    jobs.WaitForCounter(counter);
+    EXPECT_EQ(touched.load(), 200);
+}
+
+TEST_F(TaskTest, FramesAreReusedWithoutHeapAllocation)
+{
+    JobSystem jobs(Workers(2));
+    for (int i = 0; i < 500; ++i)
+    {
+        SyncWait(jobs, SumOnJobs(jobs, 4));
+    }
+
+    // Frames freed on workers find their way back to the thread creating them
+    const TaskFrameStats before = TaskFrames::GetStats();
+    for (int i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ(SyncWait(jobs, SumOnJobs(jobs, 4)), 10);
+    }
+    const TaskFrameStats after = TaskFrames::GetStats();
+    EXPECT_EQ(after.heapAllocations, before.heapAllocations);
+}
+
+TEST_F(TaskTest, ResumeQueueContinuesOnTheDrainingThread)
+{
+    JobSystem jobs(Workers(2));
+    ResumeQueue queue;
+    std::vector<std::thread::id> finishedOn(16);
+    JobCounter counter;
+    for (auto& id : finishedOn)
+    {
+        Spawn(jobs, HopToQueue(jobs, queue, id), &counter);
+    }
+
+    // Stands in for the render thread's frame loop
+    size_t resumed = 0;
+    while (!counter.IsDone())
+    {
+        resumed += queue.RunPending();
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(resumed, finishedOn.size());
+    EXPECT_TRUE(queue.IsEmpty());
+    for (const auto& id : finishedOn)
+    {
+        EXPECT_EQ(id, std::this_thread::get_id());
+    }
+}
+
+TEST_F(TaskTest, IoQueueReadsFilesForAwaitingTasks)
+{
+    const std::string first = WriteTempFile("task_io_first.bin", 100000);
+    const std::string second = WriteTempFile("task_io_second.bin", 10);
+    const std::string missing = ::testing::TempDir() + "task_io_missing.bin";
+
+    JobSystem jobs(Workers(2));
+    IoQueue io(jobs);
+    int checksums[3] = {};
+    JobCounter counter;
+    const auto load = [&io](const std::string& path, int& out) -> Task<> {
+        out = co_await LoadChecksum(io, path.c_str());
+    };
+    Spawn(jobs, load(first, checksums[0]), &counter);
+    Spawn(jobs, load(second, checksums[1]), &counter);
+    Spawn(jobs, load(missing, checksums[2]), &counter);
+    jobs.WaitForCounter(counter);
+
+    int expected = 0;
+    for (size_t i = 0; i < 100000; ++i)
+    {
+        expected += static_cast<int>(i % 7);
+    }
+    EXPECT_EQ(checksums[0], expected);
+    EXPECT_EQ(checksums[1], 0 + 1 + 2 + 3 + 4 + 5 + 6 + 0 + 1 + 2);
+    EXPECT_EQ(checksums[2], -1);
+    EXPECT_EQ(io.GetCompletedCount(), 3u);
+}
@@ -0,0 +1,103 @@
+#include "Threading/WorkStealingDeque.h"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace Threading;
+
+class WorkStealingDequeTest : public ::testing::Test
+{
+  protected:
+    std::vector<int> values = std::vector<int>(64);
+};
+
+TEST_F(WorkStealingDequeTest, OwnerIsLifoAndThievesAreFifo)
+{
+    WorkStealingDeque<int*> deque(8);
+    EXPECT_EQ(deque.GetCapacity(), 8u);
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_TRUE(deque.Push(&values[i]));
+    }
+    EXPECT_FALSE(deque.Push(&values[8]));
+    EXPECT_EQ(deque.GetSizeEstimate(), 8u);
+
+    int* item = nullptr;
+    ASSERT_TRUE(deque.Pop(item));
+    EXPECT_EQ(item, &values[7]);
+    ASSERT_TRUE(deque.Steal(item));
+    EXPECT_EQ(item, &values[0]);
+    ASSERT_TRUE(deque.Steal(item));
+    EXPECT_EQ(item, &values[1]);
+
+    // Wrapping around the ring keeps the order
+    EXPECT_TRUE(deque.Push(&values[8]));
+    EXPECT_TRUE(deque.Push(&values[9]));
+    ASSERT_TRUE(deque.Pop(item));
+    EXPECT_EQ(item, &values[9]);
+    for (int expected = 2; expected <= 6; ++expected)
+    {
+        ASSERT_TRUE(deque.Steal(item));
+        EXPECT_EQ(item, &values[expected]);
+    }
+    ASSERT_TRUE(deque.Pop(item));
+    EXPECT_EQ(item, &values[8]);
+    EXPECT_FALSE(deque.Pop(item));
+    EXPECT_FALSE(deque.Steal(item));
+    EXPECT_EQ(deque.GetSizeEstimate(), 0u);
+}
+
+TEST_F(WorkStealingDequeTest, EveryItemIsTakenExactlyOnce)
+{
+    // The owner pushes and pops while thieves steal; every item must come out once
+    const int itemCount = 200000;
+    std::vector<int> items(itemCount);
+    std::vector<std::atomic<int>> taken(itemCount);
+    WorkStealingDeque<int*> deque(256);
+    std::atomic<bool> done(false);
+
+    const auto take = [&](int* item) { taken[item - items.data()].fetch_add(1, std::memory_order_relaxed); };
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < 3; ++i)
+    {
+        thieves.emplace_back([&]() {
+            int* item = nullptr;
+            while (!done.load(std::memory_order_acquire))
+            {
+                if (deque.Steal(item))
+                    take(item);
+            }
+        });
+    }
+
+    int* item = nullptr;
+    for (int i = 0; i < itemCount; ++i)
+    {
+        while (!deque.Push(&items[i]))
+        {
+            if (deque.Pop(item))
+                take(item);
+        }
+        if (i % 3 == 0 && deque.Pop(item))
+            take(item);
+    }
+    while (deque.Pop(item))
+    {
+        take(item);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& thief : thieves)
+    {
+        thief.join();
+    }
+    while (deque.Steal(item))
+    {
+        take(item);
+    }
+
+    for (int i = 0; i < itemCount; ++i)
+    {
+        ASSERT_EQ(taken[i].load(), 1) << i;
+    }
+}
@@ -3,7 +3,32 @@ set_project("DisplayApp")
 set_version("1.0.0")
 
 -- Set C++ standard
-set_languages("c++17")
+set_languages("c++20")
+
+-- SIMD kernels select their AVX2 paths at compile time (see src/Math/Simd.h)
+option("avx2")
+    set_default(true)
+    set_showmenu(true)
+    set_description("Build SIMD kernels with AVX2, FMA and BMI2")
+option_end()
+
+if has_config("avx2") then
+    add_vectorexts("avx2", "fma")
+    if not is_plat("windows") then
+        add_cxflags("-mbmi2")
+    end
+end
+
+-- Replaces the global operator new/delete with counting hooks (see src/Memory/AllocationTracker.h)
+option("allocation_tracking")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Count heap allocations per frame and check no-alloc scopes")
+option_end()
+
+if has_config("allocation_tracking") then
+    add_defines("HERMIT_TRACK_ALLOCATIONS")
+end
 
 -- Add packages required for testing
 add_requires("gtest")
@@ -12,11 +37,15 @@ add_requires("gtest")
 target("CoreLib")
     set_kind("static")
     -- Add all source files from subdirectories
-    add_files("src/Renderer/*.cpp", "src/System/*.cpp", "src/Math/*.cpp")
+    add_files("src/Renderer/*.cpp", "src/System/*.cpp", "src/Math/*.cpp", "src/Geometry/*.cpp",
+              "src/Animation/*.cpp", "src/Spatial/*.cpp", "src/Physics/*.cpp", "src/Particles/*.cpp",
+              "src/Threading/*.cpp", "src/Memory/*.cpp")
     add_includedirs("src", {public = true})
 
     if is_plat("windows") then
         add_syslinks("user32", "gdi32", "d3d11", "dxgi", "d3dcompiler")
+        -- Fiber-safe thread_local access: jobs may resume on another thread
+        add_cxflags("/GT", {tools = {"cl", "clang_cl"}})
     end
 
 -- 2. Your main application now compiles main.cpp and links to the library
@@ -49,20 +78,103 @@ target("RendererTests")
     add_packages("gtest")
     add_rules("test")
 
--- 6. Define the custom rule that tells xmake how to run our tests
+-- 6. Define the test target for the Geometry library
+target("GeometryTests")
+    set_kind("binary")
+    add_files("tests/Geometry/*.cpp") -- Point to Geometry test files
+    add_deps("CoreLib")
+    add_packages("gtest")
+    add_rules("test")
+
+-- 7. Define the test target for the Animation library
+target("AnimationTests")
+    set_kind("binary")
+    add_files("tests/Animation/*.cpp") -- Point to Animation test files
+    add_deps("CoreLib")
+    add_packages("gtest")
+    add_rules("test")
+
+-- 8. Define the test target for the Spatial library
+target("SpatialTests")
+    set_kind("binary")
+    add_files("tests/Spatial/*.cpp") -- Point to Spatial test files
+    add_deps("CoreLib")
+    add_packages("gtest")
+    add_rules("test")
+
+-- 9. Define the test target for the Physics library
+target("PhysicsTests")
+    set_kind("binary")
+    add_files("tests/Physics/*.cpp") -- Point to Physics test files
+    add_deps("CoreLib")
+    add_packages("gtest")
+    add_rules("test")
+
+-- 10. Define the test target for the Particles library
+target("ParticlesTests")
+    set_kind("binary")
+    add_files("tests/Particles/*.cpp") -- Point to Particles test files
+    add_deps("CoreLib")
+    add_packages("gtest")
+    add_rules("test")
+
+-- 11. Define the test target for the Threading library
+target("ThreadingTests")
+    set_kind("binary")
+    add_files("tests/Threading/*.cpp") -- Point to Threading test files
+    add_deps("CoreLib")
+    add_packages("gtest")
+    add_rules("test")
+
+-- 12. Memory Test Executable
+target("MemoryTests")
+    set_kind("binary")
+    add_files("tests/Memory/*.cpp") -- Point to Memory test files
+    -- The tracker tests need the hooks even when the rest of the build goes without
+    if not has_config("allocation_tracking") then
+        add_files("src/Memory/AllocationHooks.cpp")
+        add_defines("HERMIT_TRACK_ALLOCATIONS")
+    end
+    add_deps("CoreLib")
+    add_packages("gtest")
+    add_rules("test")
+
+-- 13. Define the custom rule that tells xmake how to run our tests
 rule("test")
     on_run(function(target)
         print("Executing test: %s", target:name())
         os.exec(target:targetfile())
     end)
 
--- 7. Define a group to run all tests at once
+-- 14. Define a group to run all tests at once
 target("AllTests")
     set_kind("phony")
-    add_deps("SystemTests", "MathTests", "RendererTests")
+    add_deps("SystemTests", "MathTests", "RendererTests", "GeometryTests", "AnimationTests",
+             "SpatialTests", "PhysicsTests", "ParticlesTests",
+             "ThreadingTests", "MemoryTests")
     on_run(function(target)
         print("Running all tests...")
         os.exec("xmake run SystemTests")
         os.exec("xmake run MathTests")
         os.exec("xmake run RendererTests")
-    end)
\ No newline at end of file
+        os.exec("xmake run GeometryTests")
+        os.exec("xmake run AnimationTests")
+        os.exec("xmake run SpatialTests")
+        os.exec("xmake run PhysicsTests")
+        os.exec("xmake run ParticlesTests")
+        os.exec("xmake run ThreadingTests")
+        os.exec("xmake run MemoryTests")
+    end)
+
+-- 15. Benchmarks, built on request: xmake build NoiseBench && xmake run NoiseBench [args]
+target("NoiseBench")
+    set_kind("binary")
+    set_default(false)
+    add_files("benchmarks/NoiseBench.cpp")
+    add_deps("CoreLib")
+
+target("MeshNormalsBench")
+    set_kind("binary")
+    set_default(false)
+    add_files("benchmarks/MeshNormalsBench.cpp")
+    add_deps("CoreLib")